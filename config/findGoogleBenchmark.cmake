@@ -0,0 +1,14 @@
+
+IF(TARGET benchmark::benchmark)
+    message(STATUS "Found benchmark::benchmark library")
+ELSE()
+    SET(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "Don't build the benchmark tests" FORCE)
+    SET(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "Don't install benchmark" FORCE)
+    SET(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "Don't build the benchmark gtest tests" FORCE)
+    FetchContent_Declare(
+            googlebenchmark
+            GIT_REPOSITORY https://github.com/google/benchmark.git
+            GIT_TAG v1.8.3
+    )
+    FetchContent_MakeAvailable(googlebenchmark)
+ENDIF()
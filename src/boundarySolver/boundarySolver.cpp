@@ -288,6 +288,9 @@ void ablate::boundarySolver::BoundarySolver::Setup() {
     }
     RestoreRange(cellRange);
 
+    // copy the stencils into contiguous storage for the boundary loops
+    FlattenGradientStencils(cellDM);
+
     // clean up the geom
     VecRestoreArrayRead(cellGeomVec, &cellGeomArray) >> utilities::PetscUtilities::checkError;
     VecRestoreArrayRead(faceGeomVec, &faceGeomArray) >> utilities::PetscUtilities::checkError;
@@ -297,6 +300,9 @@ void ablate::boundarySolver::BoundarySolver::Initialize() {
     // call the base class Initialize
     ablate::solver::CellSolver::Initialize();
 
+    // the subDomain sections are now available, so precompute the stencil offsets
+    ComputeFlattenedStencilOffsets();
+
     if (!boundaryUpdateFunctions.empty()) {
         RegisterPreStep([this](auto ts, auto& solver) { UpdateVariablesPreStep(ts, solver); });
     }
@@ -382,9 +388,8 @@ void ablate::boundarySolver::BoundarySolver::RegisterPreRHSFunction(BoundaryPreR
 
 PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeRHSFunction(PetscReal time, Vec locXVec, Vec locFVec) {
     PetscFunctionBeginUser;
-    StartEvent("BoundarySolver::ComputeRHSFunction");
+    ScopedEvent rhsScope(*this, computeRhsEvent);
     PetscCall(ComputeRHSFunction(time, locXVec, locFVec, boundarySourceFunctions));
-    EndEvent();
     PetscFunctionReturn(0);
 }
 
@@ -396,9 +401,7 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeRHSFunction(PetscR
     auto dm = subDomain->GetDM();
     auto auxDM = subDomain->GetAuxDM();
     auto dim = subDomain->GetDimensions();
-    DM dmCell;
     const PetscScalar* cellGeomArray;
-    PetscCall(VecGetDM(cellGeomVec, &dmCell));
     PetscCall(VecGetArrayRead(cellGeomVec, &cellGeomArray));
 
     // prepare to compute the source, u, and a offsets
@@ -419,7 +422,8 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeRHSFunction(PetscR
     std::vector<PetscScalar> distributedSourceScratch(scratchSize);
 
     // Get the region to march over
-    if (!gradientStencils.empty()) {
+    const PetscInt numberFaces = flattenedStencils.Size();
+    if (numberFaces) {
         // Get pointers to sol, aux, and f vectors
         const PetscScalar *locXArray, *locAuxArray = nullptr;
         PetscScalar* locFArray;
@@ -439,24 +443,26 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeRHSFunction(PetscR
             auto inputOffsetsPointer = function.inputFieldsOffset.data();
             auto auxOffsetsPointer = function.auxFieldsOffset.data();
 
-            // March over each cell in this region
-            for (const auto& stencilInfo : gradientStencils) {
+            // March over each face in this region using the flattened stencils
+            for (PetscInt f = 0; f < numberFaces; ++f) {
+                const PetscInt stencilStart = flattenedStencils.stencilOffsets[f];
+                const PetscInt stencilSize = flattenedStencils.stencilOffsets[f + 1] - stencilStart;
+                const PetscInt* stencil = flattenedStencils.stencil.data() + stencilStart;
+                const PetscScalar* stencilWeights = flattenedStencils.gradientWeights.data() + stencilStart * dim;
+                const BoundaryFVFaceGeom* geometry = &flattenedStencils.geometry[f];
+
                 // Get the cell geom
-                const PetscFVCellGeom* cg;
-                PetscCall(DMPlexPointLocalRead(dmCell, stencilInfo.cellId, cellGeomArray, &cg));
+                const auto cg = (const PetscFVCellGeom*)(cellGeomArray + flattenedStencils.cellGeometryOffsets[f]);
 
                 // Get pointers to the area of interest
-                const PetscScalar *solPt, *auxPt = nullptr;
-                PetscCall(DMPlexPointLocalRead(dm, stencilInfo.cellId, locXArray, &solPt));
-                if (auxDM) {
-                    PetscCall(DMPlexPointLocalRead(auxDM, stencilInfo.cellId, locAuxArray, &auxPt));
-                }
+                const PetscScalar* solPt = locXArray + flattenedStencils.cellSolutionOffsets[f];
+                const PetscScalar* auxPt = auxDM ? locAuxArray + flattenedStencils.cellAuxOffsets[f] : nullptr;
 
                 // Get each of the stencil pts
-                for (PetscInt p = 0; p < stencilInfo.stencilSize; p++) {
-                    PetscCall(DMPlexPointLocalRead(dm, stencilInfo.stencil[p], locXArray, &inputStencilValues[p]));
+                for (PetscInt p = 0; p < stencilSize; p++) {
+                    inputStencilValues[p] = locXArray + flattenedStencils.stencilSolutionOffsets[stencilStart + p];
                     if (auxDM) {
-                        PetscCall(DMPlexPointLocalRead(auxDM, stencilInfo.stencil[p], locAuxArray, &auxStencilValues[p]));
+                        auxStencilValues[p] = locAuxArray + flattenedStencils.stencilAuxOffsets[stencilStart + p];
                     }
                 }
 
@@ -464,14 +470,14 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeRHSFunction(PetscR
                 switch (function.type) {
                     case BoundarySourceType::Point:
                         PetscScalar* rhs;
-                        PetscCall(DMPlexPointLocalRef(dm, stencilInfo.cellId, locFArray, &rhs));
+                        rhs = locFArray + flattenedStencils.cellSolutionOffsets[f];
 
                         /*PetscErrorCode (*)(PetscInt dim, const BoundaryFVFaceGeom* fg, const PetscFVCellGeom* boundaryCell,
                                            const PetscInt uOff[], const PetscScalar* boundaryValues, const PetscScalar* stencilValues[],
                                            const PetscInt aOff[], const PetscScalar* auxValues, const PetscScalar* stencilAuxValues[],
                                            PetscInt stencilSize, const PetscInt stencil[], const PetscScalar stencilWeights[], const PetscInt sOff[], PetscScalar source[], void* ctx)*/
                         PetscCall(function.function(dim,
-                                                    &stencilInfo.geometry,
+                                                    geometry,
                                                     cg,
                                                     inputOffsetsPointer,
                                                     solPt,
@@ -479,9 +485,9 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeRHSFunction(PetscR
                                                     auxOffsetsPointer,
                                                     auxPt,
                                                     auxStencilValues.data(),
-                                                    stencilInfo.stencilSize,
-                                                    stencilInfo.stencil.data(),
-                                                    stencilInfo.gradientWeights.data(),
+                                                    stencilSize,
+                                                    stencil,
+                                                    stencilWeights,
                                                     sourceOffsetsPointer,
                                                     rhs,
                                                     function.context));
@@ -497,7 +503,7 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeRHSFunction(PetscR
                         PetscCall(PetscArrayzero(distributedSourceScratch.data(), (PetscInt)distributedSourceScratch.size()));
 
                         PetscCall(function.function(dim,
-                                                    &stencilInfo.geometry,
+                                                    geometry,
                                                     cg,
                                                     inputOffsetsPointer,
                                                     solPt,
@@ -505,21 +511,22 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeRHSFunction(PetscR
                                                     auxOffsetsPointer,
                                                     auxPt,
                                                     auxStencilValues.data(),
-                                                    stencilInfo.stencilSize,
-                                                    stencilInfo.stencil.data(),
-                                                    stencilInfo.gradientWeights.data(),
+                                                    stencilSize,
+                                                    stencil,
+                                                    stencilWeights,
                                                     sourceOffsetsPointer,
                                                     distributedSourceScratch.data(),
                                                     function.context));
 
                         // Now distribute to each stencil point
-                        for (PetscInt s = 0; s < stencilInfo.stencilSize; ++s) {
+                        for (PetscInt s = stencilStart; s < stencilStart + stencilSize; ++s) {
                             // Get the point in the rhs for this point.  It might be ghost but that is ok, the values are added together later
-                            PetscCall(DMPlexPointLocalRef(dm, stencilInfo.stencil[s], locFArray, &rhs));
+                            rhs = locFArray + flattenedStencils.stencilSolutionOffsets[s];
 
                             // Now over the entire rhs, the function should have added the values correctly using the sourceOffsetsPointer
+                            const PetscScalar distributionFactor = flattenedStencils.distributionWeights[s] / flattenedStencils.volumes[s];
                             for (PetscInt sc = 0; sc < scratchSize; sc++) {
-                                rhs[sc] += (distributedSourceScratch[sc] * stencilInfo.distributionWeights[s]) / stencilInfo.volumes[s];
+                                rhs[sc] += distributedSourceScratch[sc] * distributionFactor;
                             }
                         }
 
@@ -529,7 +536,7 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeRHSFunction(PetscR
                         PetscCall(PetscArrayzero(distributedSourceScratch.data(), (PetscInt)distributedSourceScratch.size()));
 
                         PetscCall(function.function(dim,
-                                                    &stencilInfo.geometry,
+                                                    geometry,
                                                     cg,
                                                     inputOffsetsPointer,
                                                     solPt,
@@ -537,20 +544,20 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeRHSFunction(PetscR
                                                     auxOffsetsPointer,
                                                     auxPt,
                                                     auxStencilValues.data(),
-                                                    stencilInfo.stencilSize,
-                                                    stencilInfo.stencil.data(),
-                                                    stencilInfo.gradientWeights.data(),
+                                                    stencilSize,
+                                                    stencil,
+                                                    stencilWeights,
                                                     sourceOffsetsPointer,
                                                     distributedSourceScratch.data(),
                                                     function.context));
 
                         // the first cell in the stencil is always the neighbor cell
                         // Get the point in the rhs for this point.  It might be ghost but that is ok, the values are added together later
-                        PetscCall(DMPlexPointLocalRef(dm, stencilInfo.stencil.front(), locFArray, &rhs));
+                        rhs = locFArray + flattenedStencils.stencilSolutionOffsets[stencilStart];
 
                         // Now over the entire rhs, the function should have added the values correctly using the sourceOffsetsPointer
                         for (PetscInt sc = 0; sc < scratchSize; sc++) {
-                            rhs[sc] += distributedSourceScratch[sc] / stencilInfo.volumes.front();
+                            rhs[sc] += distributedSourceScratch[sc] / flattenedStencils.volumes[stencilStart];
                         }
 
                         break;
@@ -562,14 +569,14 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeRHSFunction(PetscR
 
                         // Assume that the right hand side vector is for face information
                         PetscScalar* faceRhs;
-                        PetscCall(DMPlexPointLocalRef(vecDm, stencilInfo.geometry.faceId, locFArray, &faceRhs));
+                        PetscCall(DMPlexPointLocalRef(vecDm, geometry->faceId, locFArray, &faceRhs));
 
                         /*PetscErrorCode (*)(PetscInt dim, const BoundaryFVFaceGeom* fg, const PetscFVCellGeom* boundaryCell,
                                            const PetscInt uOff[], const PetscScalar* boundaryValues, const PetscScalar* stencilValues[],
                                            const PetscInt aOff[], const PetscScalar* auxValues, const PetscScalar* stencilAuxValues[],
                                            PetscInt stencilSize, const PetscInt stencil[], const PetscScalar stencilWeights[], const PetscInt sOff[], PetscScalar source[], void* ctx)*/
                         PetscCall(function.function(dim,
-                                                    &stencilInfo.geometry,
+                                                    geometry,
                                                     cg,
                                                     inputOffsetsPointer,
                                                     solPt,
@@ -577,9 +584,9 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeRHSFunction(PetscR
                                                     auxOffsetsPointer,
                                                     auxPt,
                                                     auxStencilValues.data(),
-                                                    stencilInfo.stencilSize,
-                                                    stencilInfo.stencil.data(),
-                                                    stencilInfo.gradientWeights.data(),
+                                                    stencilSize,
+                                                    stencil,
+                                                    stencilWeights,
                                                     sourceOffsetsPointer,
                                                     faceRhs,
                                                     function.context));
@@ -725,14 +732,81 @@ void ablate::boundarySolver::BoundarySolver::CreateGradientStencil(PetscInt cell
     gradientStencils.push_back(std::move(newStencil));
 }
 
+void ablate::boundarySolver::BoundarySolver::FlattenGradientStencils(DM cellDM) {
+    const PetscInt dim = subDomain->GetDimensions();
+    flattenedStencils = {};
+
+    // size the arrays
+    const auto numberFaces = (PetscInt)gradientStencils.size();
+    PetscInt totalStencilSize = 0;
+    for (const auto& stencilInfo : gradientStencils) {
+        totalStencilSize += stencilInfo.stencilSize;
+    }
+    flattenedStencils.stencilOffsets.reserve(numberFaces + 1);
+    flattenedStencils.cellIds.reserve(numberFaces);
+    flattenedStencils.geometry.reserve(numberFaces);
+    flattenedStencils.cellGeometryOffsets.reserve(numberFaces);
+    flattenedStencils.stencil.reserve(totalStencilSize);
+    flattenedStencils.gradientWeights.reserve(totalStencilSize * dim);
+    flattenedStencils.distributionWeights.reserve(totalStencilSize);
+    flattenedStencils.volumes.reserve(totalStencilSize);
+
+    // Get the cell geometry section
+    PetscSection cellGeomSection;
+    DMGetLocalSection(cellDM, &cellGeomSection) >> utilities::PetscUtilities::checkError;
+
+    // copy over each stencil
+    flattenedStencils.stencilOffsets.push_back(0);
+    for (const auto& stencilInfo : gradientStencils) {
+        flattenedStencils.cellIds.push_back(stencilInfo.cellId);
+        flattenedStencils.geometry.push_back(stencilInfo.geometry);
+
+        PetscInt cellGeomOffset;
+        PetscSectionGetOffset(cellGeomSection, stencilInfo.cellId, &cellGeomOffset) >> utilities::PetscUtilities::checkError;
+        flattenedStencils.cellGeometryOffsets.push_back(cellGeomOffset);
+
+        flattenedStencils.stencil.insert(flattenedStencils.stencil.end(), stencilInfo.stencil.begin(), stencilInfo.stencil.end());
+        flattenedStencils.gradientWeights.insert(flattenedStencils.gradientWeights.end(), stencilInfo.gradientWeights.begin(), stencilInfo.gradientWeights.begin() + stencilInfo.stencilSize * dim);
+        flattenedStencils.distributionWeights.insert(
+            flattenedStencils.distributionWeights.end(), stencilInfo.distributionWeights.begin(), stencilInfo.distributionWeights.begin() + stencilInfo.stencilSize);
+        flattenedStencils.volumes.insert(flattenedStencils.volumes.end(), stencilInfo.volumes.begin(), stencilInfo.volumes.end());
+        flattenedStencils.stencilOffsets.push_back((PetscInt)flattenedStencils.stencil.size());
+    }
+}
+
+void ablate::boundarySolver::BoundarySolver::ComputeFlattenedStencilOffsets() {
+    // Get the local sections used by DMPlexPointLocalRead
+    PetscSection section, auxSection = nullptr;
+    DMGetLocalSection(subDomain->GetDM(), &section) >> utilities::PetscUtilities::checkError;
+    if (auto auxDM = subDomain->GetAuxDM()) {
+        DMGetLocalSection(auxDM, &auxSection) >> utilities::PetscUtilities::checkError;
+    }
+
+    // compute the offsets for each list of points
+    auto computeOffsets = [](PetscSection offsetSection, const std::vector<PetscInt>& points, std::vector<PetscInt>& offsets) {
+        offsets.resize(points.size());
+        for (std::size_t p = 0; p < points.size(); ++p) {
+            PetscSectionGetOffset(offsetSection, points[p], &offsets[p]) >> utilities::PetscUtilities::checkError;
+        }
+    };
+
+    computeOffsets(section, flattenedStencils.cellIds, flattenedStencils.cellSolutionOffsets);
+    computeOffsets(section, flattenedStencils.stencil, flattenedStencils.stencilSolutionOffsets);
+    if (auxSection) {
+        computeOffsets(auxSection, flattenedStencils.cellIds, flattenedStencils.cellAuxOffsets);
+        computeOffsets(auxSection, flattenedStencils.stencil, flattenedStencils.stencilAuxOffsets);
+    } else {
+        flattenedStencils.cellAuxOffsets.clear();
+        flattenedStencils.stencilAuxOffsets.clear();
+    }
+}
+
 void ablate::boundarySolver::BoundarySolver::UpdateVariablesPreStep(TS, ablate::solver::Solver&) {
     // Extract the cell geometry, and the dm that holds the information
     auto dm = subDomain->GetDM();
     auto auxDM = subDomain->GetAuxDM();
     auto dim = subDomain->GetDimensions();
-    DM dmCell;
     const PetscScalar* cellGeomArray;
-    VecGetDM(cellGeomVec, &dmCell) >> utilities::PetscUtilities::checkError;
     VecGetArrayRead(cellGeomVec, &cellGeomArray) >> utilities::PetscUtilities::checkError;
 
     // get the local x vector for ghost node information
@@ -765,7 +839,8 @@ void ablate::boundarySolver::BoundarySolver::UpdateVariablesPreStep(TS, ablate::
     DMGlobalToLocalEnd(subDomain->GetDM(), subDomain->GetSolutionVector(), INSERT_VALUES, locXVec) >> utilities::PetscUtilities::checkError;
 
     // Get the region to march over
-    if (!gradientStencils.empty()) {
+    const PetscInt numberFaces = flattenedStencils.Size();
+    if (numberFaces) {
         // Get pointers to sol, aux, and f vectors
         PetscScalar *globXArray, *locAuxArray = nullptr;
         VecGetArray(subDomain->GetSolutionVector(), &globXArray);
@@ -788,33 +863,32 @@ void ablate::boundarySolver::BoundarySolver::UpdateVariablesPreStep(TS, ablate::
             auto inputOffsetsPointer = inputOffsets.data();
             auto auxOffsetsPointer = auxOffsets.data();
 
-            // March over each cell in this region
-            for (const auto& stencilInfo : gradientStencils) {
-                if (!stencilInfo.stencilSize) {
+            // March over each face in this region using the flattened stencils
+            for (PetscInt f = 0; f < numberFaces; ++f) {
+                const PetscInt stencilStart = flattenedStencils.stencilOffsets[f];
+                if (flattenedStencils.stencilOffsets[f + 1] == stencilStart) {
                     continue;
                 }
 
                 // Get the cell geom
-                const PetscFVCellGeom* cg;
-                DMPlexPointLocalRead(dmCell, stencilInfo.cellId, cellGeomArray, &cg) >> utilities::PetscUtilities::checkError;
+                const auto cg = (const PetscFVCellGeom*)(cellGeomArray + flattenedStencils.cellGeometryOffsets[f]);
 
-                // Get pointers to the area of interest
+                // Get pointers to the area of interest, only owned cells have a global value
                 PetscScalar *solPt = nullptr, *auxPt = nullptr;
-                DMPlexPointGlobalRef(dm, stencilInfo.cellId, globXArray, &solPt) >> utilities::PetscUtilities::checkError;
+                DMPlexPointGlobalRef(dm, flattenedStencils.cellIds[f], globXArray, &solPt) >> utilities::PetscUtilities::checkError;
                 if (auxDM) {
-                    DMPlexPointLocalRef(auxDM, stencilInfo.cellId, locAuxArray, &auxPt) >> utilities::PetscUtilities::checkError;
+                    auxPt = locAuxArray + flattenedStencils.cellAuxOffsets[f];
                 }
 
-                // Get each of the stencil pts
-                const PetscScalar *solStencilPt, *auxStencilPt = nullptr;
-                DMPlexPointLocalRead(dm, stencilInfo.stencil.front(), localXArray, &solStencilPt) >> utilities::PetscUtilities::checkError;
+                // Get the first stencil pt
+                const PetscScalar *solStencilPt = localXArray + flattenedStencils.stencilSolutionOffsets[stencilStart], *auxStencilPt = nullptr;
                 if (auxDM) {
-                    DMPlexPointLocalRead(auxDM, stencilInfo.stencil.front(), locAuxArray, &auxStencilPt) >> utilities::PetscUtilities::checkError;
+                    auxStencilPt = locAuxArray + flattenedStencils.stencilAuxOffsets[stencilStart];
                 }
 
                 // update
                 if (solPt) {
-                    function.function(dim, &stencilInfo.geometry, cg, inputOffsetsPointer, solPt, solStencilPt, auxOffsetsPointer, auxPt, auxStencilPt, function.context) >>
+                    function.function(dim, &flattenedStencils.geometry[f], cg, inputOffsetsPointer, solPt, solStencilPt, auxOffsetsPointer, auxPt, auxStencilPt, function.context) >>
                         utilities::PetscUtilities::checkError;
                 }
             }
@@ -834,7 +908,7 @@ void ablate::boundarySolver::BoundarySolver::UpdateVariablesPreStep(TS, ablate::
 
 PetscErrorCode ablate::boundarySolver::BoundarySolver::PreRHSFunction(TS ts, PetscReal time, bool initialStage, Vec locX) {
     PetscFunctionBeginUser;
-    StartEvent("BoundarySolver::PreRHSFunction");
+    ScopedEvent preRhsScope(*this, preRhsEvent);
     try {
         // update any aux fields, including ghost cells
         UpdateAuxFields(time, locX, subDomain->GetAuxVector());
@@ -846,7 +920,6 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::PreRHSFunction(TS ts, Pet
     for (const auto& rhsFunction : preRhsFunctions) {
         PetscCall(rhsFunction.first(*this, ts, time, initialStage, locX, rhsFunction.second));
     }
-    EndEvent();
     PetscFunctionReturn(0);
 }
 
@@ -858,9 +931,7 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeBoundaryPreRHSPoin
     auto dm = subDomain->GetDM();
     auto auxDM = subDomain->GetAuxDM();
     auto dim = subDomain->GetDimensions();
-    DM dmCell;
     const PetscScalar* cellGeomArray;
-    PetscCall(VecGetDM(cellGeomVec, &dmCell));
     PetscCall(VecGetArrayRead(cellGeomVec, &cellGeomArray));
 
     // prepare to compute the source, u, and a offsets
@@ -881,7 +952,8 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeBoundaryPreRHSPoin
     std::vector<PetscScalar> distributedSourceScratch(scratchSize);
 
     // Get the region to march over
-    if (!gradientStencils.empty()) {
+    const PetscInt numberFaces = flattenedStencils.Size();
+    if (numberFaces) {
         // Get pointers to sol, aux, and f vectors
         PetscScalar *locXArray, *locAuxArray = nullptr;
         PetscCall(VecGetArray(locXVec, &locXArray));
@@ -897,31 +969,30 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeBoundaryPreRHSPoin
         auto inputOffsetsPointer = boundaryPreRhsPointFunction.inputFieldsOffset.data();
         auto auxOffsetsPointer = boundaryPreRhsPointFunction.auxFieldsOffset.data();
 
-        // March over each cell in this region
-        for (const auto& stencilInfo : gradientStencils) {
+        // March over each face in this region using the flattened stencils
+        for (PetscInt f = 0; f < numberFaces; ++f) {
+            const PetscInt stencilStart = flattenedStencils.stencilOffsets[f];
+            const PetscInt stencilSize = flattenedStencils.stencilOffsets[f + 1] - stencilStart;
+
             // Get the cell geom
-            const PetscFVCellGeom* cg;
-            PetscCall(DMPlexPointLocalRead(dmCell, stencilInfo.cellId, cellGeomArray, &cg));
+            const auto cg = (const PetscFVCellGeom*)(cellGeomArray + flattenedStencils.cellGeometryOffsets[f]);
 
             // Get pointers to the area of interest
-            PetscScalar *solPt, *auxPt = nullptr;
-            PetscCall(DMPlexPointLocalRef(dm, stencilInfo.cellId, locXArray, &solPt));
-            if (auxDM) {
-                PetscCall(DMPlexPointLocalRef(auxDM, stencilInfo.cellId, locAuxArray, &auxPt));
-            }
+            PetscScalar* solPt = locXArray + flattenedStencils.cellSolutionOffsets[f];
+            PetscScalar* auxPt = auxDM ? locAuxArray + flattenedStencils.cellAuxOffsets[f] : nullptr;
 
             // Get each of the stencil pts
-            for (PetscInt p = 0; p < stencilInfo.stencilSize; p++) {
-                PetscCall(DMPlexPointLocalRead(dm, stencilInfo.stencil[p], locXArray, &inputStencilValues[p]));
+            for (PetscInt p = 0; p < stencilSize; p++) {
+                inputStencilValues[p] = locXArray + flattenedStencils.stencilSolutionOffsets[stencilStart + p];
                 if (auxDM) {
-                    PetscCall(DMPlexPointLocalRead(auxDM, stencilInfo.stencil[p], locAuxArray, &auxStencilValues[p]));
+                    auxStencilValues[p] = locAuxArray + flattenedStencils.stencilAuxOffsets[stencilStart + p];
                 }
             }
 
             PetscCall(boundaryPreRhsPointFunction.function(time,
                                                            dt,
                                                            dim,
-                                                           &stencilInfo.geometry,
+                                                           &flattenedStencils.geometry[f],
                                                            cg,
                                                            inputOffsetsPointer,
                                                            solPt,
@@ -929,9 +1000,9 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeBoundaryPreRHSPoin
                                                            auxOffsetsPointer,
                                                            auxPt,
                                                            auxStencilValues.data(),
-                                                           stencilInfo.stencilSize,
-                                                           stencilInfo.stencil.data(),
-                                                           stencilInfo.gradientWeights.data(),
+                                                           stencilSize,
+                                                           flattenedStencils.stencil.data() + stencilStart,
+                                                           flattenedStencils.gradientWeights.data() + stencilStart * dim,
                                                            boundaryPreRhsPointFunction.context));
         }
 
@@ -974,6 +1045,23 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::Restore(PetscViewer viewe
     PetscFunctionReturn(0);
 }
 
+PetscObjectState ablate::boundarySolver::BoundarySolver::GetSerializableState() {
+    // each process state only increases, so the sum changes whenever any process changes
+    PetscObjectState state = 0;
+    for (auto& process : boundaryProcesses) {
+        if (auto serializablePtr = std::dynamic_pointer_cast<ablate::io::Serializable>(process)) {
+            if (serializablePtr->Serialize() != io::Serializable::SerializerType::none) {
+                auto processState = serializablePtr->GetSerializableState();
+                if (processState < 0) {
+                    return -1;
+                }
+                state += processState;
+            }
+        }
+    }
+    return state;
+}
+
 std::istream& ablate::boundarySolver::operator>>(std::istream& is, ablate::boundarySolver::BoundarySolver::BoundarySourceType& value) {
     std::string typeString;
     is >> typeString;
@@ -117,6 +117,39 @@ class BoundarySolver : public solver::CellSolver, public solver::RHSFunction, pr
         std::vector<PetscScalar> volumes;
     };
 
+    /**
+     * Flattened (CSR) copy of every GradientStencil used by the boundary function loops.  The stencil for face f is stored in [stencilOffsets[f], stencilOffsets[f+1])
+     */
+    struct FlattenedStencils {
+        /** the start of each face stencil, size is the number of faces + 1 **/
+        std::vector<PetscInt> stencilOffsets;
+        /** the boundary cell for each face **/
+        std::vector<PetscInt> cellIds;
+        /** the boundary geometry for each face **/
+        std::vector<BoundaryFVFaceGeom> geometry;
+        /** the offset into the cell geometry vector for each boundary cell **/
+        std::vector<PetscInt> cellGeometryOffsets;
+        /** the cells in every stencil **/
+        std::vector<PetscInt> stencil;
+        /** The weights in [point*dim + dir] order, the weights for face f start at stencilOffsets[f]*dim */
+        std::vector<PetscScalar> gradientWeights;
+        /** The distribution weights for every stencil cell */
+        std::vector<PetscScalar> distributionWeights;
+        /** the volume for every stencil cell */
+        std::vector<PetscScalar> volumes;
+        /** the local solution offset for each boundary cell and stencil cell **/
+        std::vector<PetscInt> cellSolutionOffsets;
+        std::vector<PetscInt> stencilSolutionOffsets;
+        /** the local aux offset for each boundary cell and stencil cell, only sized if there is an aux dm **/
+        std::vector<PetscInt> cellAuxOffsets;
+        std::vector<PetscInt> stencilAuxOffsets;
+
+        /**
+         * the number of faces/stencils
+         */
+        [[nodiscard]] inline PetscInt Size() const { return (PetscInt)cellIds.size(); }
+    };
+
     /**
      * struct to describe how to compute the source terms for boundary
      */
@@ -170,12 +203,19 @@ class BoundarySolver : public solver::CellSolver, public solver::RHSFunction, pr
     // keep track of maximumStencilSize
     PetscInt maximumStencilSize = 0;
 
+    // contiguous copy of the gradientStencils used by all boundary loops
+    FlattenedStencils flattenedStencils;
+
     // The PetscFV (usually the least squares method) is used to compute the gradient weights
     PetscFV gradientCalculator = nullptr;
 
     // Determine if multiple faces should be merged for a single cell
     const bool mergeFaces;
 
+    //! pre-registered profiling events
+    const PetscLogEvent computeRhsEvent = RegisterEvent("BoundarySolver::ComputeRHSFunction");
+    const PetscLogEvent preRhsEvent = RegisterEvent("BoundarySolver::PreRHSFunction");
+
     /**
      * private function compute weights and store a gradient stencil
      * @param cellId
@@ -186,6 +226,17 @@ class BoundarySolver : public solver::CellSolver, public solver::RHSFunction, pr
      */
     void CreateGradientStencil(PetscInt cellId, const BoundaryFVFaceGeom& geometry, const std::vector<PetscInt>& stencil, DM cellDM, const PetscScalar* cellGeomArray);
 
+    /**
+     * Copy the gradientStencils into the contiguous flattenedStencils
+     * @param cellDM
+     */
+    void FlattenGradientStencils(DM cellDM);
+
+    /**
+     * Compute the local solution/aux offsets for each flattened stencil point. This must be called after the subDomain structures are created.
+     */
+    void ComputeFlattenedStencilOffsets();
+
     /**
      * Prestep to update boundary variables
      */
@@ -309,6 +360,12 @@ class BoundarySolver : public solver::CellSolver, public solver::RHSFunction, pr
      * @param time
      */
     PetscErrorCode Restore(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) override;
+
+    /**
+     * Combine the state of each serialized process, unknown (-1) if any process state is unknown
+     * @return
+     */
+    [[nodiscard]] PetscObjectState GetSerializableState() override;
 };
 
 /**
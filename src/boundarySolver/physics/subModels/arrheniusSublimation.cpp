@@ -30,17 +30,24 @@ void ablate::boundarySolver::physics::subModels::ArrheniusSublimation::Initializ
     PetscScalar* temperatureArray;
     VecGetArray(temperatureVec, &temperatureArray) >> utilities::PetscUtilities::checkError;
 
-    /** Initialize the solid boundary heat transfer model */
+    /** Initialize the solid boundary heat transfer model for all faces at once */
+    std::vector<PetscInt> faceIds;
+    faceIds.reserve(bSolver.GetBoundaryGeometry().size());
     for (const auto& geom : bSolver.GetBoundaryGeometry()) {
-        // Create a unique name for this model based pon the faceId and rank
-        auto uniqueId = std::to_string(rank) + "-" + std::to_string(geom.geometry.faceId);
+        faceIds.push_back(geom.geometry.faceId);
+    }
+
+    // Create a unique name for this model based upon the rank, older checkpoints used the rank and face id for each face
+    auto uniqueId = "oneDimensionHeatTransfer-" + std::to_string(rank);
+    auto legacyIdPrefix = std::to_string(rank) + "-";
 
-        // by not having a maximum temperature we allow this to heat up as much as described
-        oneDimensionHeatTransfer[geom.geometry.faceId] = std::make_shared<OneDimensionHeatTransfer>(uniqueId, properties, initialization, options);
+    // by not having a maximum temperature we allow this to heat up as much as described
+    oneDimensionHeatTransfer = std::make_shared<BatchedOneDimensionHeatTransfer>(uniqueId, properties, initialization, faceIds, options, PETSC_DEFAULT, legacyIdPrefix);
 
+    for (const auto& geom : bSolver.GetBoundaryGeometry()) {
         // Get the current surface temperature
         PetscReal currentSurfaceTemp;
-        oneDimensionHeatTransfer[geom.geometry.faceId]->GetSurfaceTemperature(currentSurfaceTemp) >> utilities::PetscUtilities::checkError;
+        oneDimensionHeatTransfer->GetSurfaceTemperature(geom.geometry.faceId, currentSurfaceTemp) >> utilities::PetscUtilities::checkError;
 
         // Get and set the temperature value
         PetscScalar* temperature;
@@ -56,7 +63,7 @@ PetscErrorCode ablate::boundarySolver::physics::subModels::ArrheniusSublimation:
     PetscFunctionBegin;
 
     // compute the current mass flux used by arrhenius rat
-    oneDimensionHeatTransfer[faceId]->GetSurfaceTemperature(temperature) >> utilities::PetscUtilities::checkError;
+    oneDimensionHeatTransfer->GetSurfaceTemperature(faceId, temperature) >> utilities::PetscUtilities::checkError;
     PetscReal massFluxRate = ComputeMassFluxRate(temperature);        // kg/(m2-s)
     PetscReal energyMeltingRate = massFluxRate * latentHeatOfFusion;  // kg/(m2-s) * J/kg = J/(m2-s)
 
@@ -65,7 +72,7 @@ PetscErrorCode ablate::boundarySolver::physics::subModels::ArrheniusSublimation:
 
     // Step the time stepper in time
     PetscReal dummyVariable;
-    PetscCall(oneDimensionHeatTransfer[faceId]->Solve(heatFluxToSurface, dt, temperature, dummyVariable));
+    PetscCall(oneDimensionHeatTransfer->Solve(faceId, heatFluxToSurface, dt, temperature, dummyVariable));
     PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -73,7 +80,7 @@ PetscErrorCode ablate::boundarySolver::physics::subModels::ArrheniusSublimation:
                                                                                          ablate::boundarySolver::physics::subModels::SublimationModel::SurfaceState& surfaceState) {
     PetscFunctionBeginHot;
     PetscReal temperature;
-    oneDimensionHeatTransfer[faceId]->GetSurfaceTemperature(temperature) >> utilities::PetscUtilities::checkError;
+    oneDimensionHeatTransfer->GetSurfaceTemperature(faceId, temperature) >> utilities::PetscUtilities::checkError;
 
     // Compute the massFlux (we can only remove mass)
     surfaceState.massFlux = ComputeMassFluxRate(temperature);  // kg/(m2-s)
@@ -83,17 +90,13 @@ PetscErrorCode ablate::boundarySolver::physics::subModels::ArrheniusSublimation:
 }
 PetscErrorCode ablate::boundarySolver::physics::subModels::ArrheniusSublimation::Save(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) {
     PetscFunctionBeginUser;
-    for (auto& oneDimModel : oneDimensionHeatTransfer) {
-        oneDimModel.second->Save(viewer, sequenceNumber, time);
-    }
+    PetscCall(oneDimensionHeatTransfer->Save(viewer, sequenceNumber, time));
     PetscFunctionReturn(PETSC_SUCCESS);
 }
 
 PetscErrorCode ablate::boundarySolver::physics::subModels::ArrheniusSublimation::Restore(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) {
     PetscFunctionBeginUser;
-    for (auto& oneDimModel : oneDimensionHeatTransfer) {
-        oneDimModel.second->Restore(viewer, sequenceNumber, time);
-    }
+    PetscCall(oneDimensionHeatTransfer->Restore(viewer, sequenceNumber, time));
     PetscFunctionReturn(PETSC_SUCCESS);
 }
 
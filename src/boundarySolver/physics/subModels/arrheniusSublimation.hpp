@@ -3,7 +3,7 @@
 
 #include <map>
 #include <memory>
-#include "oneDimensionHeatTransfer.hpp"
+#include "batchedOneDimensionHeatTransfer.hpp"
 #include "solver/cellSolver.hpp"
 #include "solver/timeStepper.hpp"
 #include "sublimationModel.hpp"
@@ -12,8 +12,8 @@ namespace ablate::boundarySolver::physics::subModels {
 
 class ArrheniusSublimation : public SublimationModel {
    private:
-    //! hold onto a map of solid heat transfer
-    std::map<PetscInt, std::shared_ptr<OneDimensionHeatTransfer>> oneDimensionHeatTransfer;
+    //! hold onto the solid heat transfer for every face
+    std::shared_ptr<BatchedOneDimensionHeatTransfer> oneDimensionHeatTransfer;
 
     //! the material properties
     const std::shared_ptr<ablate::parameters::Parameters> properties;
@@ -96,6 +96,12 @@ class ArrheniusSublimation : public SublimationModel {
      * @param time
      */
     PetscErrorCode Restore(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) override;
+
+    /**
+     * The 1D fields only change when they are advanced or restored
+     * @return
+     */
+    [[nodiscard]] PetscObjectState GetSerializableState() override { return oneDimensionHeatTransfer ? oneDimensionHeatTransfer->GetState() : -1; }
 };
 
 }  // namespace ablate::boundarySolver::physics::subModels
@@ -0,0 +1,300 @@
+#include "batchedOneDimensionHeatTransfer.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include "oneDimensionHeatTransfer.hpp"
+#include "utilities/petscUtilities.hpp"
+
+ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer::BatchedOneDimensionHeatTransfer(std::string solverIdIn, const std::shared_ptr<ablate::parameters::Parameters> &propertiesIn,
+                                                                                                             const std::shared_ptr<ablate::mathFunctions::MathFunction> &initializationIn,
+                                                                                                             const std::vector<PetscInt> &faceIds,
+                                                                                                             const std::shared_ptr<ablate::parameters::Parameters> &optionsIn,
+                                                                                                             PetscScalar maxSurfaceTemperature, std::string legacySolverIdPrefixIn)
+    : solverId(std::move(solverIdIn)),
+      legacySolverIdPrefix(std::move(legacySolverIdPrefixIn)),
+      properties(propertiesIn),
+      options(optionsIn),
+      volumetricHeatCapacity(properties->GetExpect<PetscReal>("specificHeat") * properties->GetExpect<PetscReal>("density")),
+      conductivity(properties->GetExpect<PetscReal>("conductivity")),
+      numberNodes((options ? options->Get<PetscInt>("dm_plex_box_faces", 15) : 15) + 1),
+      dx((options ? options->Get<PetscReal>("dm_plex_box_upper", 0.1) : 0.1) / (PetscReal)(numberNodes - 1)),
+      maximumTimeStep(options ? options->Get<PetscReal>("ts_dt", -1.0) : -1.0),
+      maximumSurfaceTemperature(maxSurfaceTemperature),
+      initialization(initializationIn) {
+    if (numberNodes < 2) {
+        throw std::invalid_argument("The BatchedOneDimensionHeatTransfer requires at least one face (dm_plex_box_faces).");
+    }
+
+    // Store the index for each face
+    for (const auto &faceId : faceIds) {
+        faceIndices.emplace(faceId, (PetscInt)faceIndices.size());
+    }
+
+    // Size the contiguous storage
+    const auto numberFaces = (PetscInt)faceIndices.size();
+    temperature.resize(numberFaces * numberNodes);
+    time.resize(numberFaces, 0.0);
+    essentialSurface.resize(numberFaces, PETSC_FALSE);
+    rhs.resize(numberNodes);
+
+    // Set the initial conditions at each node.  The profile is the same for every face so compute it once.
+    std::vector<PetscReal> initialProfile(numberNodes);
+    for (PetscInt n = 0; n < numberNodes; ++n) {
+        PetscReal x = n * dx;
+        initialProfile[n] = initialization->Eval(&x, 1, 0.0);
+    }
+    for (PetscInt f = 0; f < numberFaces; ++f) {
+        std::copy(initialProfile.begin(), initialProfile.end(), temperature.begin() + f * numberNodes);
+    }
+}
+
+PetscInt ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer::GetFaceIndex(PetscInt faceId) const {
+    auto it = faceIndices.find(faceId);
+    if (it == faceIndices.end()) {
+        throw std::invalid_argument("The face " + std::to_string(faceId) + " is not in the BatchedOneDimensionHeatTransfer " + solverId);
+    }
+    return it->second;
+}
+
+const ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer::Factorization &
+ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer::GetFactorization(PetscReal dt, PetscBool essential) {
+    // Reuse either cached factorization for this boundary type, otherwise replace the least recently used one
+    auto &cache = factorizations[essential ? 1 : 0];
+    ++factorizationUseCount;
+    for (auto &cached : cache) {
+        if (cached.dt == dt) {
+            cached.lastUse = factorizationUseCount;
+            return cached;
+        }
+    }
+    auto &factorization = cache[0].lastUse <= cache[1].lastUse ? cache[0] : cache[1];
+    factorization.dt = dt;
+    factorization.lastUse = factorizationUseCount;
+    factorization.lower.resize(numberNodes);
+    factorization.upper.resize(numberNodes);
+    factorization.pivotInverse.resize(numberNodes);
+
+    // The consistent mass (scaled by 1/dt) and stiffness terms.  Dirichlet nodes have no time derivative, so their mass coupling is dropped.
+    const PetscReal mass = volumetricHeatCapacity * dx / (6.0 * dt);
+    const PetscReal stiffness = conductivity / dx;
+    const PetscInt lastNode = numberNodes - 1;
+    auto isFree = [essential, lastNode](PetscInt n) { return !((n == 0 && essential) || n == lastNode); };
+
+    // Build and factor the tridiagonal system in a single pass
+    PetscReal previousUpper = 0.0;
+    for (PetscInt n = 0; n < numberNodes; ++n) {
+        PetscReal a, b, c;
+        if (!isFree(n)) {
+            a = 0.0;
+            b = 1.0;
+            c = 0.0;
+        } else if (n == 0) {
+            a = 0.0;
+            b = 2.0 * mass + stiffness;
+            c = (isFree(1) ? mass : 0.0) - stiffness;
+        } else {
+            a = (isFree(n - 1) ? mass : 0.0) - stiffness;
+            b = 4.0 * mass + 2.0 * stiffness;
+            c = (isFree(n + 1) ? mass : 0.0) - stiffness;
+        }
+
+        const PetscReal pivotInverse = 1.0 / (b - a * previousUpper);
+        factorization.lower[n] = a;
+        factorization.pivotInverse[n] = pivotInverse;
+        factorization.upper[n] = c * pivotInverse;
+        previousUpper = factorization.upper[n];
+    }
+
+    return factorization;
+}
+
+void ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer::Step(PetscInt faceIndex, PetscReal heatFluxToSurface, PetscReal dt) {
+    PetscReal *profile = temperature.data() + faceIndex * numberNodes;
+
+    // Update the surface boundary condition using the same logic as OneDimensionHeatTransfer::UpdateBoundaryCondition
+    if (maximumSurfaceTemperature >= 0) {
+        PetscReal surfaceTemperature, heatFlux;
+        ComputeSurfaceInformation(faceIndex, surfaceTemperature, heatFlux);
+        PetscBool essential = surfaceTemperature >= maximumSurfaceTemperature ? PETSC_TRUE : PETSC_FALSE;
+        if (heatFluxToSurface < heatFlux) {
+            essential = PETSC_FALSE;
+        }
+        essentialSurface[faceIndex] = essential;
+        if (essential) {
+            profile[0] = maximumSurfaceTemperature;
+        }
+    }
+    const PetscBool essential = essentialSurface[faceIndex];
+    const auto &factorization = GetFactorization(dt, essential);
+
+    // Build the right hand side
+    const PetscReal mass = volumetricHeatCapacity * dx / (6.0 * dt);
+    const PetscInt lastNode = numberNodes - 1;
+    const PetscReal firstFree = essential ? 0.0 : 1.0;
+    if (essential) {
+        rhs[0] = maximumSurfaceTemperature;
+    } else {
+        rhs[0] = mass * (2.0 * profile[0] + (lastNode > 1 ? profile[1] : 0.0)) + heatFluxToSurface;
+    }
+    for (PetscInt n = 1; n < lastNode; ++n) {
+        rhs[n] = mass * (4.0 * profile[n] + (n == 1 ? firstFree : 1.0) * profile[n - 1] + (n + 1 < lastNode ? profile[n + 1] : 0.0));
+    }
+    PetscReal farFieldCoordinate = lastNode * dx;
+    rhs[lastNode] = initialization->Eval(&farFieldCoordinate, 1, time[faceIndex] + dt);
+
+    // Forward elimination and back substitution directly into the profile
+    rhs[0] *= factorization.pivotInverse[0];
+    for (PetscInt n = 1; n < numberNodes; ++n) {
+        rhs[n] = (rhs[n] - factorization.lower[n] * rhs[n - 1]) * factorization.pivotInverse[n];
+    }
+    profile[lastNode] = rhs[lastNode];
+    for (PetscInt n = lastNode - 1; n >= 0; --n) {
+        profile[n] = rhs[n] - factorization.upper[n] * profile[n + 1];
+    }
+
+    time[faceIndex] += dt;
+}
+
+void ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer::Advance(PetscInt faceIndex, PetscReal heatFluxToSurface, PetscReal dt) {
+    // March with the maximum sub step, matching the final time exactly
+    const PetscReal endTime = time[faceIndex] + dt;
+    const PetscReal tolerance = 1E-10 * dt;
+    while (endTime - time[faceIndex] > tolerance) {
+        PetscReal stepDt = endTime - time[faceIndex];
+        if (maximumTimeStep > 0 && stepDt > maximumTimeStep) {
+            stepDt = maximumTimeStep;
+        }
+        Step(faceIndex, heatFluxToSurface, stepDt);
+    }
+    time[faceIndex] = endTime;
+}
+
+PetscErrorCode ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer::Solve(PetscInt faceId, PetscReal heatFluxToSurface, PetscReal dt, PetscReal &surfaceTemperature,
+                                                                                                  PetscReal &heatFlux) {
+    PetscFunctionBeginHot;
+    const auto faceIndex = GetFaceIndex(faceId);
+    Advance(faceIndex, heatFluxToSurface, dt);
+    ++state;
+    ComputeSurfaceInformation(faceIndex, surfaceTemperature, heatFlux);
+    PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+PetscErrorCode ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer::GetSurfaceTemperature(PetscInt faceId, PetscReal &surfaceTemperature) const {
+    PetscFunctionBegin;
+    PetscReal heatFlux;
+    ComputeSurfaceInformation(GetFaceIndex(faceId), surfaceTemperature, heatFlux);
+    PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+PetscErrorCode ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer::Save(PetscViewer viewer, PetscInt sequenceNumber, PetscReal) {
+    PetscFunctionBegin;
+    if (temperature.empty()) {
+        PetscFunctionReturn(PETSC_SUCCESS);
+    }
+
+    // There is not a dm associated with these vectors so set the time step directly
+    PetscBool ishdf5;
+    PetscCall(PetscObjectTypeCompare((PetscObject)viewer, PETSCVIEWERHDF5, &ishdf5));
+    if (ishdf5) {
+        PetscCall(PetscViewerHDF5PushTimestepping(viewer));
+        PetscCall(PetscViewerHDF5SetTimestep(viewer, sequenceNumber));
+    }
+
+    // Write all profiles as a single vector
+    Vec profileVec;
+    PetscCall(VecCreateSeqWithArray(PETSC_COMM_SELF, 1, (PetscInt)temperature.size(), temperature.data(), &profileVec));
+    PetscCall(PetscObjectSetName((PetscObject)profileVec, solverId.c_str()));
+    PetscCall(VecView(profileVec, viewer));
+    PetscCall(VecDestroy(&profileVec));
+
+    // and the time for each face
+    Vec timeVec;
+    PetscCall(VecCreateSeqWithArray(PETSC_COMM_SELF, 1, (PetscInt)time.size(), time.data(), &timeVec));
+    PetscCall(PetscObjectSetName((PetscObject)timeVec, (solverId + "_time").c_str()));
+    PetscCall(VecView(timeVec, viewer));
+    PetscCall(VecDestroy(&timeVec));
+
+    if (ishdf5) {
+        PetscCall(PetscViewerHDF5PopTimestepping(viewer));
+    }
+    PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+PetscErrorCode ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer::Restore(PetscViewer viewer, PetscInt sequenceNumber, PetscReal restoreTime) {
+    PetscFunctionBegin;
+    if (temperature.empty()) {
+        PetscFunctionReturn(PETSC_SUCCESS);
+    }
+
+    ++state;
+    PetscBool ishdf5;
+    PetscCall(PetscObjectTypeCompare((PetscObject)viewer, PETSCVIEWERHDF5, &ishdf5));
+
+    // Checkpoints written before the profiles were batched hold a separate dataset for each face
+    if (ishdf5 && !legacySolverIdPrefix.empty()) {
+        PetscBool hasBatchedDataset;
+        PetscCall(PetscViewerHDF5HasDataset(viewer, solverId.c_str(), &hasBatchedDataset));
+        if (!hasBatchedDataset) {
+            PetscCall(RestoreLegacy(viewer, sequenceNumber, restoreTime));
+            PetscFunctionReturn(PETSC_SUCCESS);
+        }
+    }
+
+    if (ishdf5) {
+        PetscCall(PetscViewerHDF5PushTimestepping(viewer));
+        PetscCall(PetscViewerHDF5SetTimestep(viewer, sequenceNumber));
+    }
+
+    // Load directly into the contiguous storage
+    Vec profileVec;
+    PetscCall(VecCreateSeqWithArray(PETSC_COMM_SELF, 1, (PetscInt)temperature.size(), temperature.data(), &profileVec));
+    PetscCall(PetscObjectSetName((PetscObject)profileVec, solverId.c_str()));
+    PetscCall(VecLoad(profileVec, viewer));
+    PetscCall(VecDestroy(&profileVec));
+
+    Vec timeVec;
+    PetscCall(VecCreateSeqWithArray(PETSC_COMM_SELF, 1, (PetscInt)time.size(), time.data(), &timeVec));
+    PetscCall(PetscObjectSetName((PetscObject)timeVec, (solverId + "_time").c_str()));
+    PetscCall(VecLoad(timeVec, viewer));
+    PetscCall(VecDestroy(&timeVec));
+
+    if (ishdf5) {
+        PetscCall(PetscViewerHDF5PopTimestepping(viewer));
+    }
+    PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+PetscErrorCode ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer::RestoreLegacy(PetscViewer viewer, PetscInt sequenceNumber, PetscReal restoreTime) {
+    PetscFunctionBeginUser;
+    std::vector<PetscReal> nodeCoordinates;
+    std::vector<PetscReal> nodeTemperatures;
+    for (const auto &[faceId, faceIndex] : faceIndices) {
+        // Load the face with the same model that wrote it and copy the nodal values into the profile
+        try {
+            OneDimensionHeatTransfer legacyModel(legacySolverIdPrefix + std::to_string(faceId), properties, initialization, options, maximumSurfaceTemperature);
+            PetscCall(legacyModel.Restore(viewer, sequenceNumber, restoreTime));
+            PetscCall(legacyModel.GetNodeTemperatures(nodeCoordinates, nodeTemperatures));
+        } catch (std::exception &exception) {
+            SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "Unable to restore face %" PetscInt_FMT " of %s: %s", faceId, solverId.c_str(), exception.what());
+        }
+
+        if ((PetscInt)nodeTemperatures.size() != numberNodes) {
+            SETERRQ(PETSC_COMM_SELF,
+                    PETSC_ERR_FILE_UNEXPECTED,
+                    "The legacy profile for face %" PetscInt_FMT " has %" PetscInt_FMT " nodes but %" PetscInt_FMT " are expected",
+                    faceId,
+                    (PetscInt)nodeTemperatures.size(),
+                    numberNodes);
+        }
+        PetscReal *profile = temperature.data() + faceIndex * numberNodes;
+        for (std::size_t n = 0; n < nodeTemperatures.size(); ++n) {
+            const auto node = std::clamp((PetscInt)PetscRoundReal(nodeCoordinates[n] / dx), (PetscInt)0, numberNodes - 1);
+            profile[node] = nodeTemperatures[n];
+        }
+
+        // The per-face models did not store their time, so start from the restore time
+        time[faceIndex] = restoreTime;
+        essentialSurface[faceIndex] = PETSC_FALSE;
+    }
+    PetscFunctionReturn(PETSC_SUCCESS);
+}
@@ -0,0 +1,229 @@
+#ifndef ABLATELIBRARY_BATCHEDONEDIMENSIONHEATTRANSFER_HPP
+#define ABLATELIBRARY_BATCHEDONEDIMENSIONHEATTRANSFER_HPP
+
+#include <petsc.h>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "mathFunctions/mathFunction.hpp"
+#include "parameters/parameters.hpp"
+
+namespace ablate::boundarySolver::physics::subModels {
+
+/**
+ * Solves the same one dimensional solid heat transfer problem as the OneDimensionHeatTransfer model for every boundary face at once.  All face
+ * temperature profiles are stored in a single contiguous array (face major) and are advanced with a backward euler step using the same linear (P1) finite
+ * element discretization. Because every face shares the mesh, properties, and time step the tridiagonal (Thomas) factorization is computed once and reused
+ * for every face.
+ *
+ * The mesh is controlled using the same options as the OneDimensionHeatTransfer (dm_plex_box_faces, dm_plex_box_upper) and the ts_dt option is used
+ * as the maximum sub step size.
+ *
+ * All profiles are checkpointed in a single dataset named by the solverId.  Checkpoints written with a OneDimensionHeatTransfer for each face are
+ * still restored when a legacySolverIdPrefix is provided.
+ */
+class BatchedOneDimensionHeatTransfer {
+   private:
+    //! store the solver id, so that we can save/restore
+    const std::string solverId;
+
+    //! the prefix of the per-face OneDimensionHeatTransfer solver ids (prefix + faceId) used to restore older checkpoints, empty to disable
+    const std::string legacySolverIdPrefix;
+
+    //! keep the properties and options to rebuild the per-face models when restoring older checkpoints
+    const std::shared_ptr<ablate::parameters::Parameters> properties;
+    const std::shared_ptr<ablate::parameters::Parameters> options;
+
+    //! the volumetric heat capacity (density*specificHeat)
+    const PetscReal volumetricHeatCapacity;
+
+    //! the solid conductivity
+    const PetscReal conductivity;
+
+    //! the number of nodes in each profile, including the surface and far field nodes
+    const PetscInt numberNodes;
+
+    //! the uniform node spacing
+    const PetscReal dx;
+
+    //! the maximum sub step size, if negative the full dt is used
+    const PetscReal maximumTimeStep;
+
+    //! Store the maximum surface temperature, if negative the surface is always a heat flux boundary
+    const PetscReal maximumSurfaceTemperature;
+
+    //! store the initialization as it is also used for the far field boundary condition
+    const std::shared_ptr<ablate::mathFunctions::MathFunction> initialization;
+
+    //! map from the face id to the index in the contiguous arrays
+    std::map<PetscInt, PetscInt> faceIndices;
+
+    //! the temperature profiles for every face [face*numberNodes + node]
+    std::vector<PetscReal> temperature;
+
+    //! the current time for each face
+    std::vector<PetscReal> time;
+
+    //! flag for each face indicating if the surface node is currently held at the maximumSurfaceTemperature
+    std::vector<PetscBool> essentialSurface;
+
+    //! incremented whenever any profile changes, used for incremental checkpoints
+    PetscObjectState state = 0;
+
+    /**
+     * The factored tridiagonal system for a single time step size and surface boundary type
+     */
+    struct Factorization {
+        //! the time step used to build this factorization
+        PetscReal dt = -1.0;
+        //! the last time this factorization was used, to replace the least recently used factorization
+        PetscInt lastUse = 0;
+        //! the sub diagonal of the system
+        std::vector<PetscReal> lower;
+        //! the modified super diagonal from the forward elimination
+        std::vector<PetscReal> upper;
+        //! the inverse of the pivots from the forward elimination
+        std::vector<PetscReal> pivotInverse;
+    };
+
+    //! hold two factorizations (typically the full sub step and the remainder step) for the natural [0] and essential [1] surface boundary
+    Factorization factorizations[2][2];
+
+    //! counter used to track the least recently used factorization
+    PetscInt factorizationUseCount = 0;
+
+    //! scratch space for the right hand side
+    std::vector<PetscReal> rhs;
+
+    /**
+     * Returns the factorization for this time step and surface boundary type, rebuilding if needed
+     * @param dt
+     * @param essential
+     * @return
+     */
+    const Factorization &GetFactorization(PetscReal dt, PetscBool essential);
+
+    /**
+     * Restore the profiles from a checkpoint written with a OneDimensionHeatTransfer for each face
+     * @param viewer
+     * @param sequenceNumber
+     * @param restoreTime
+     * @return
+     */
+    PetscErrorCode RestoreLegacy(PetscViewer viewer, PetscInt sequenceNumber, PetscReal restoreTime);
+
+    /**
+     * Advance a single face by one backward euler step
+     * @param faceIndex
+     * @param heatFluxToSurface
+     * @param dt
+     */
+    void Step(PetscInt faceIndex, PetscReal heatFluxToSurface, PetscReal dt);
+
+    /**
+     * Advance a single face over dt using sub steps
+     * @param faceIndex
+     * @param heatFluxToSurface
+     * @param dt
+     */
+    void Advance(PetscInt faceIndex, PetscReal heatFluxToSurface, PetscReal dt);
+
+    /**
+     * Compute the surface information for this face
+     * @param faceIndex
+     * @param surfaceTemperature
+     * @param heatFlux
+     */
+    inline void ComputeSurfaceInformation(PetscInt faceIndex, PetscReal &surfaceTemperature, PetscReal &heatFlux) const {
+        const PetscReal *profile = temperature.data() + faceIndex * numberNodes;
+        surfaceTemperature = profile[0];
+        heatFlux = -conductivity * (profile[1] - profile[0]) / dx;
+    }
+
+   public:
+    /**
+     * Create the batched 1D solid model for each face
+     * @param solverId the name used to save/restore
+     * @param properties the heat transfer properties (specificHeat, conductivity, density)
+     * @param initialization, math function to initialize the temperature
+     * @param faceIds the face ids that this model is solved over
+     * @param options the mesh/ts options
+     * @param maxSurfaceTemperature
+     * @param legacySolverIdPrefix the prefix of the per-face OneDimensionHeatTransfer solver ids used to restore older checkpoints
+     */
+    BatchedOneDimensionHeatTransfer(std::string solverId, const std::shared_ptr<ablate::parameters::Parameters> &properties,
+                                    const std::shared_ptr<ablate::mathFunctions::MathFunction> &initialization, const std::vector<PetscInt> &faceIds,
+                                    const std::shared_ptr<ablate::parameters::Parameters> &options = {}, PetscScalar maxSurfaceTemperature = PETSC_DEFAULT,
+                                    std::string legacySolverIdPrefix = {});
+
+    /**
+     * Advances the solver for this face in time and returns the computed surface state
+     * @param faceId
+     * @param heatFluxToSurface
+     * @param dt
+     * @param surfaceTemperature
+     * @param heatFlux
+     * @return
+     */
+    PetscErrorCode Solve(PetscInt faceId, PetscReal heatFluxToSurface, PetscReal dt, PetscReal &surfaceTemperature, PetscReal &heatFlux);
+
+    /**
+     * helper function to get the surface temperature
+     * @param faceId
+     * @param surfaceTemperature
+     * @return
+     */
+    PetscErrorCode GetSurfaceTemperature(PetscInt faceId, PetscReal &surfaceTemperature) const;
+
+    /**
+     * Return the face index in the contiguous arrays
+     * @param faceId
+     * @return
+     */
+    [[nodiscard]] PetscInt GetFaceIndex(PetscInt faceId) const;
+
+    /**
+     * The number of faces in this batch
+     * @return
+     */
+    [[nodiscard]] PetscInt GetNumberFaces() const { return (PetscInt)faceIndices.size(); }
+
+    /**
+     * The number of nodes in each profile
+     * @return
+     */
+    [[nodiscard]] PetscInt GetNumberNodes() const { return numberNodes; }
+
+    /**
+     * Return the temperature profile for this face, starting at the surface
+     * @param faceId
+     * @return
+     */
+    [[nodiscard]] const PetscReal *GetProfile(PetscInt faceId) const { return temperature.data() + GetFaceIndex(faceId) * numberNodes; }
+
+    /**
+     * The state of the profiles, this increases whenever any profile is advanced or restored
+     * @return
+     */
+    [[nodiscard]] PetscObjectState GetState() const { return state; }
+
+    /**
+     * Save the state to the PetscViewer
+     * @param viewer
+     * @param sequenceNumber
+     * @param time
+     */
+    PetscErrorCode Save(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time);
+
+    /**
+     * Restore the state from the PetscViewer
+     * @param viewer
+     * @param sequenceNumber
+     * @param time
+     */
+    PetscErrorCode Restore(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time);
+};
+
+}  // namespace ablate::boundarySolver::physics::subModels
+#endif  // ABLATELIBRARY_BATCHEDONEDIMENSIONHEATTRANSFER_HPP
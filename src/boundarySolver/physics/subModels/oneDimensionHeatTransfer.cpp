@@ -512,3 +512,44 @@ PetscErrorCode ablate::boundarySolver::physics::subModels::OneDimensionHeatTrans
     PetscCall(DMRestoreLocalVector(activeDM, &locVec));
     PetscFunctionReturn(PETSC_SUCCESS);
 }
+
+PetscErrorCode ablate::boundarySolver::physics::subModels::OneDimensionHeatTransfer::GetNodeTemperatures(std::vector<PetscReal> &coordinates, std::vector<PetscReal> &temperature) const {
+    PetscFunctionBegin;
+    DM activeDM;
+    PetscCall(TSGetDM(subModelTs, &activeDM));
+    PetscReal time;
+    PetscCall(TSGetTime(subModelTs, &time));
+    Vec globalSolutionVector;
+    PetscCall(TSGetSolution(subModelTs, &globalSolutionVector));
+
+    // insert the boundary values so the constrained nodes are also included
+    Vec locVec;
+    PetscCall(DMGetLocalVector(activeDM, &locVec));
+    PetscCall(DMPlexInsertBoundaryValues(activeDM, PETSC_TRUE, locVec, time, nullptr, nullptr, nullptr));
+    PetscCall(DMGlobalToLocal(activeDM, globalSolutionVector, INSERT_VALUES, locVec));
+
+    // the linear temperature field stores a single value at each vertex
+    DM coordinateDM;
+    PetscCall(DMGetCoordinateDM(activeDM, &coordinateDM));
+    Vec coordinateVec;
+    PetscCall(DMGetCoordinatesLocal(activeDM, &coordinateVec));
+    PetscInt vStart, vEnd;
+    PetscCall(DMPlexGetDepthStratum(activeDM, 0, &vStart, &vEnd));
+    coordinates.resize(vEnd - vStart);
+    temperature.resize(vEnd - vStart);
+
+    const PetscScalar *locArray, *coordinateArray;
+    PetscCall(VecGetArrayRead(locVec, &locArray));
+    PetscCall(VecGetArrayRead(coordinateVec, &coordinateArray));
+    for (PetscInt v = vStart; v < vEnd; ++v) {
+        const PetscScalar *vertexCoordinate, *vertexTemperature;
+        PetscCall(DMPlexPointLocalRead(coordinateDM, v, coordinateArray, &vertexCoordinate));
+        PetscCall(DMPlexPointLocalRead(activeDM, v, locArray, &vertexTemperature));
+        coordinates[v - vStart] = PetscRealPart(vertexCoordinate[0] - surfaceCoordinate[0]);
+        temperature[v - vStart] = PetscRealPart(vertexTemperature[0]);
+    }
+    PetscCall(VecRestoreArrayRead(coordinateVec, &coordinateArray));
+    PetscCall(VecRestoreArrayRead(locVec, &locArray));
+    PetscCall(DMRestoreLocalVector(activeDM, &locVec));
+    PetscFunctionReturn(PETSC_SUCCESS);
+}
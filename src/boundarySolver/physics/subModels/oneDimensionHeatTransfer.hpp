@@ -2,6 +2,7 @@
 #define ABLATELIBRARY_ONEDIMENSIONHEATTRANSFER_HPP
 
 #include <memory>
+#include <vector>
 #include "solver/cellSolver.hpp"
 #include "solver/timeStepper.hpp"
 
@@ -128,6 +129,14 @@ class OneDimensionHeatTransfer {
      */
     [[nodiscard]] PetscErrorCode GetSurfaceTemperature(PetscScalar &surfaceTemperature) const;
 
+    /**
+     * helper function to get the temperature at each mesh node, including the boundary nodes
+     * @param coordinates the distance of each node from the surface
+     * @param temperature
+     * @return
+     */
+    [[nodiscard]] PetscErrorCode GetNodeTemperatures(std::vector<PetscReal> &coordinates, std::vector<PetscReal> &temperature) const;
+
    private:
     /**
      * Compute the jacobian term g0 - integrand for the test and basis function term i
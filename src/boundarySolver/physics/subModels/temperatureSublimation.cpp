@@ -31,17 +31,24 @@ void ablate::boundarySolver::physics::subModels::TemperatureSublimation::Initial
     PetscScalar* temperatureArray;
     VecGetArray(temperatureVec, &temperatureArray) >> utilities::PetscUtilities::checkError;
 
-    /** Initialize the solid boundary heat transfer model */
+    /** Initialize the solid boundary heat transfer model for all faces at once */
+    std::vector<PetscInt> faceIds;
+    faceIds.reserve(bSolver.GetBoundaryGeometry().size());
     for (const auto& geom : bSolver.GetBoundaryGeometry()) {
-        // Create a unique name for this model based pon the faceId and rank
-        auto uniqueId = std::to_string(rank) + "-" + std::to_string(geom.geometry.faceId);
+        faceIds.push_back(geom.geometry.faceId);
+    }
+
+    // Create a unique name for this model based upon the rank, older checkpoints used the rank and face id for each face
+    auto uniqueId = "oneDimensionHeatTransfer-" + std::to_string(rank);
+    auto legacyIdPrefix = std::to_string(rank) + "-";
+    oneDimensionHeatTransfer = std::make_shared<BatchedOneDimensionHeatTransfer>(uniqueId, properties, initialization, faceIds, options, sublimationTemperature, legacyIdPrefix);
 
-        oneDimensionHeatTransfer[geom.geometry.faceId] = std::make_shared<OneDimensionHeatTransfer>(uniqueId, properties, initialization, options, sublimationTemperature);
+    for (const auto& geom : bSolver.GetBoundaryGeometry()) {
         heatFluxIntoSolid[geom.geometry.faceId] = 0.0;
 
         // Get the current surface temperature
         PetscReal currentSurfaceTemp;
-        oneDimensionHeatTransfer[geom.geometry.faceId]->GetSurfaceTemperature(currentSurfaceTemp) >> utilities::PetscUtilities::checkError;
+        oneDimensionHeatTransfer->GetSurfaceTemperature(geom.geometry.faceId, currentSurfaceTemp) >> utilities::PetscUtilities::checkError;
 
         // Get and set the temperature value
         PetscScalar* temperature;
@@ -56,7 +63,7 @@ PetscErrorCode ablate::boundarySolver::physics::subModels::TemperatureSublimatio
     PetscFunctionBegin;
 
     // Step the time stepper in time
-    PetscCall(oneDimensionHeatTransfer[faceId]->Solve(heatFluxToSurface, dt, temperature, heatFluxIntoSolid[faceId]));
+    PetscCall(oneDimensionHeatTransfer->Solve(faceId, heatFluxToSurface, dt, temperature, heatFluxIntoSolid[faceId]));
     PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -77,17 +84,13 @@ PetscErrorCode ablate::boundarySolver::physics::subModels::TemperatureSublimatio
 }
 PetscErrorCode ablate::boundarySolver::physics::subModels::TemperatureSublimation::Save(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) {
     PetscFunctionBeginUser;
-    for (auto& oneDimModel : oneDimensionHeatTransfer) {
-        oneDimModel.second->Save(viewer, sequenceNumber, time);
-    }
+    PetscCall(oneDimensionHeatTransfer->Save(viewer, sequenceNumber, time));
     PetscFunctionReturn(PETSC_SUCCESS);
 }
 
 PetscErrorCode ablate::boundarySolver::physics::subModels::TemperatureSublimation::Restore(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) {
     PetscFunctionBeginUser;
-    for (auto& oneDimModel : oneDimensionHeatTransfer) {
-        oneDimModel.second->Restore(viewer, sequenceNumber, time);
-    }
+    PetscCall(oneDimensionHeatTransfer->Restore(viewer, sequenceNumber, time));
     PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -3,7 +3,7 @@
 
 #include <map>
 #include <memory>
-#include "oneDimensionHeatTransfer.hpp"
+#include "batchedOneDimensionHeatTransfer.hpp"
 #include "solver/cellSolver.hpp"
 #include "solver/timeStepper.hpp"
 #include "sublimationModel.hpp"
@@ -12,8 +12,8 @@ namespace ablate::boundarySolver::physics::subModels {
 
 class TemperatureSublimation : public SublimationModel {
    private:
-    //! hold onto a map of solid heat transfer
-    std::map<PetscInt, std::shared_ptr<OneDimensionHeatTransfer>> oneDimensionHeatTransfer;
+    //! hold onto the solid heat transfer for every face
+    std::shared_ptr<BatchedOneDimensionHeatTransfer> oneDimensionHeatTransfer;
 
     //! hold onto a map of solid heat transfer flux, updated each time
     std::map<PetscInt, PetscReal> heatFluxIntoSolid;
@@ -84,6 +84,12 @@ class TemperatureSublimation : public SublimationModel {
      * @param time
      */
     PetscErrorCode Restore(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) override;
+
+    /**
+     * The 1D fields only change when they are advanced or restored
+     * @return
+     */
+    [[nodiscard]] PetscObjectState GetSerializableState() override { return oneDimensionHeatTransfer ? oneDimensionHeatTransfer->GetState() : -1; }
 };
 
 }  // namespace ablate::boundarySolver::physics::subModels
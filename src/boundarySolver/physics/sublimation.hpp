@@ -152,6 +152,12 @@ class Sublimation : public BoundaryProcess, public io::Serializable {
         PetscFunctionReturn(PETSC_SUCCESS);
     }
 
+    /**
+     * The serialized state is held by the sublimation model
+     * @return
+     */
+    [[nodiscard]] PetscObjectState GetSerializableState() override { return sublimationModel ? sublimationModel->GetSerializableState() : -1; }
+
     /**
      * Prestep to update the radiation solver
      * @param ts
@@ -1,5 +1,6 @@
 #include "rbf.hpp"
 #include <petsc/private/dmpleximpl.h>
+#include <vector>
 #include "utilities/petscSupport.hpp"
 
 using namespace ablate::domain::rbf;
@@ -408,18 +409,24 @@ PetscReal RBF::EvalDer(const ablate::domain::Field *field, PetscInt c, PetscInt
     return RBF::EvalDer(RBF::subDomain->GetFieldDM(*field), RBF::subDomain->GetVec(*field), field->id, c, dx, dy, dz);
 }
 
+PetscInt RBF::DerivativeIndex(PetscInt dx, PetscInt dy, PetscInt dz) const {
+    PetscInt derID = -1;
+    PetscBool hasKey = PETSC_FALSE;
+    PetscInt derKey = RBF::derivativeKey(dx, dy, dz);
+    if (RBF::hash) {
+        PetscHMapIHas(RBF::hash, derKey, &hasKey);
+    }
+    if (!hasKey) throw std::invalid_argument("RBF: Derivative of (" + std::to_string(dx) + ", " + std::to_string(dy) + ", " + std::to_string(dz) + ") is not setup.");
+    PetscHMapIGet(RBF::hash, derKey, &derID);
+    return derID;
+}
+
 PetscReal RBF::EvalDer(DM dm, Vec vec, const PetscInt fid, PetscInt c, PetscInt dx, PetscInt dy, PetscInt dz) {
     PetscReal *wt = nullptr;
     PetscScalar val = 0.0, *f;
     const PetscScalar *array;
     PetscInt nCells = -1, *lst = nullptr;
-    PetscInt derID = -1, numDer = RBF::nDer;
-
-    PetscBool hasKey;
-    PetscInt derKey = RBF::derivativeKey(dx, dy, dz);
-    PetscHMapIHas(RBF::hash, derKey, &hasKey);
-    if (!hasKey) throw std::invalid_argument("RBF: Derivative of (" + std::to_string(dx) + ", " + std::to_string(dy) + ", " + std::to_string(dz) + ") is not setup.");
-    PetscHMapIGet(RBF::hash, derKey, &derID);
+    PetscInt derID = RBF::DerivativeIndex(dx, dy, dz), numDer = RBF::nDer;
 
     // If the stencil hasn't been setup yet do so
     if (RBF::stencilWeights[c] == nullptr) {
@@ -446,6 +453,70 @@ PetscReal RBF::EvalDer(DM dm, Vec vec, const PetscInt fid, PetscInt c, PetscInt
 
     return val;
 }
+
+Mat RBF::GetDerivativeOperator(const ablate::domain::Field *field, PetscInt dx, PetscInt dy, PetscInt dz) {
+    RBF::CheckField(field);
+    const PetscInt derID = RBF::DerivativeIndex(dx, dy, dz), numDer = RBF::nDer;
+
+    // Check to see if this operator has already been assembled
+    const auto key = std::make_tuple((PetscInt)field->location, field->id, derID);
+    if (auto existing = RBF::derivativeOperators.find(key); existing != RBF::derivativeOperators.end()) {
+        return existing->second;
+    }
+
+    // The columns are the offsets of the field in the local vector
+    DM dm = RBF::subDomain->GetFieldDM(*field);
+    PetscSection section;
+    PetscInt localSize;
+    DMGetLocalSection(dm, &section) >> utilities::PetscUtilities::checkError;
+    PetscSectionGetStorageSize(section, &localSize) >> utilities::PetscUtilities::checkError;
+
+    // Make sure that every stencil is available so the exact preallocation is known
+    const PetscInt nRows = RBF::cEnd - RBF::cStart;
+    std::vector<PetscInt> nnz(nRows);
+    for (PetscInt c = RBF::cStart; c < RBF::cEnd; ++c) {
+        if (RBF::stencilWeights[c] == nullptr) {
+            RBF::SetupDerivativeStencils(c);
+        }
+        nnz[c - RBF::cStart] = RBF::nStencil[c];
+    }
+
+    Mat op;
+    MatCreateSeqAIJ(PETSC_COMM_SELF, nRows, localSize, 0, nnz.data(), &op) >> utilities::PetscUtilities::checkError;
+    PetscObjectSetName((PetscObject)op, "ablate::domain::rbf::RBF::derivativeOperator") >> utilities::PetscUtilities::checkError;
+
+    std::vector<PetscInt> columns;
+    std::vector<PetscScalar> weights;
+    for (PetscInt c = RBF::cStart; c < RBF::cEnd; ++c) {
+        const PetscInt nCells = RBF::nStencil[c];
+        const PetscInt *lst = RBF::stencilList[c];
+        const PetscReal *wt = RBF::stencilWeights[c];
+
+        columns.resize(nCells);
+        weights.resize(nCells);
+        for (PetscInt i = 0; i < nCells; ++i) {
+            if (field->id >= 0) {
+                PetscSectionGetFieldOffset(section, lst[i], field->id, &columns[i]) >> utilities::PetscUtilities::checkError;
+            } else {
+                PetscSectionGetOffset(section, lst[i], &columns[i]) >> utilities::PetscUtilities::checkError;
+            }
+            weights[i] = wt[i * numDer + derID];
+        }
+        const PetscInt row = c - RBF::cStart;
+        MatSetValues(op, 1, &row, nCells, columns.data(), weights.data(), ADD_VALUES) >> utilities::PetscUtilities::checkError;
+    }
+    MatAssemblyBegin(op, MAT_FINAL_ASSEMBLY) >> utilities::PetscUtilities::checkError;
+    MatAssemblyEnd(op, MAT_FINAL_ASSEMBLY) >> utilities::PetscUtilities::checkError;
+    MatViewFromOptions(op, NULL, "-ablate::domain::rbf::RBF::derivativeOperator_view") >> utilities::PetscUtilities::checkError;
+
+    RBF::derivativeOperators[key] = op;
+    return op;
+}
+
+void RBF::EvalDer(const ablate::domain::Field *field, Vec f, PetscInt dx, PetscInt dy, PetscInt dz, Vec derivative) {
+    Mat op = RBF::GetDerivativeOperator(field, dx, dy, dz);
+    MatMult(op, f, derivative) >> utilities::PetscUtilities::checkError;
+}
 /************ End Derivative Code **********************/
 
 /************ Begin Interpolation Code **********************/
@@ -587,6 +658,12 @@ RBF::~RBF() {
 }
 
 void RBF::FreeStencilData() {
+    // The assembled operators depend upon the stencils
+    for (auto &[key, op] : RBF::derivativeOperators) {
+        MatDestroy(&op);
+    }
+    RBF::derivativeOperators.clear();
+
     if ((RBF::cEnd - RBF::cStart) > 0) {
         for (PetscInt c = RBF::cStart; c < RBF::cEnd; ++c) {
             PetscFree(RBF::stencilList[c]);
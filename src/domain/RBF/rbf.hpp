@@ -2,6 +2,8 @@
 #define ABLATELIBRARY_RBF_HPP
 #include <petsc.h>
 #include <petsc/private/hashmapi.h>
+#include <map>
+#include <tuple>
 #include "domain/range.hpp"  // For domain::Range
 #include "domain/subDomain.hpp"
 
@@ -38,6 +40,12 @@ class RBF {
     // The derivative->key map for the hash
     PetscInt derivativeKey(PetscInt dx, PetscInt dy, PetscInt dz) const { return (100 * dx + 10 * dy + dz); };
 
+    // Return the index of a derivative that has been setup
+    PetscInt DerivativeIndex(PetscInt dx, PetscInt dy, PetscInt dz) const;
+
+    // Assembled sparse derivative operators, keyed by the field location, field id, and derivative index
+    std::map<std::tuple<PetscInt, PetscInt, PetscInt>, Mat> derivativeOperators;
+
     // Setup the derivative stencil at a point. There is no need for anyone outside of RBF to call this
     void SetupDerivativeStencils(PetscInt c);
 
@@ -87,7 +95,8 @@ class RBF {
     void SetupDerivativeStencils();  // Setup all derivative stencils. Useful if someone wants to remove setup cost when testing
 
     /**
-     * Return the derivative of a field at a given location
+     * Return the derivative of a field at a given location.  When the derivative is needed at every cell use the assembled operator (see
+     * GetDerivativeOperator) instead of calling this for each cell.
      * @param field - The field to take the derivative of
      * @param c - The location in ablate::domain::Range
      * @param dx, dy, dz - The derivative
@@ -104,6 +113,25 @@ class RBF {
      */
     PetscReal EvalDer(DM dm, Vec vec, const PetscInt fid, PetscInt c, PetscInt dx, PetscInt dy, PetscInt dz);  // Evaluate a derivative
 
+    /**
+     * Return the derivative weights of every cell assembled into a sparse (AIJ) operator. Row i is the cell at cStart + i and the columns are the offsets of the field
+     * in the local vector, so the derivative of the entire field (including ghost cell values) is a single MatMult with the local vector. The operator is assembled
+     * once for each field and derivative and is owned by the RBF.  Only the interface is provided; no solver or level set routine in the library evaluates
+     * RBF derivatives yet, so the per-cell EvalDer is only used by the tests.
+     * @param field - The field to take the derivative of
+     * @param dx, dy, dz - The derivative
+     */
+    Mat GetDerivativeOperator(const ablate::domain::Field *field, PetscInt dx, PetscInt dy, PetscInt dz);
+
+    /**
+     * Compute the derivative of a field at every cell using the assembled derivative operator
+     * @param field - The field to take the derivative of
+     * @param f - The local vector containing the data
+     * @param dx, dy, dz - The derivative
+     * @param derivative - Sequential vector of length cEnd - cStart, see MatCreateVecs of the GetDerivativeOperator
+     */
+    void EvalDer(const ablate::domain::Field *field, Vec f, PetscInt dx, PetscInt dy, PetscInt dz, Vec derivative);
+
     // Interpolation stuff
 
     /**
@@ -679,6 +679,20 @@ PetscErrorCode ablate::domain::SubDomain::Save(PetscViewer viewer, PetscInt sequ
     }
     PetscFunctionReturn(0);
 }
+PetscObjectState ablate::domain::SubDomain::GetSerializableState() {
+    if (!exactSolutions.empty()) {
+        return -1;
+    }
+
+    // the state of each vector only increases, so the sum changes whenever either vector changes
+    PetscObjectState solutionState = 0, auxState = 0;
+    PetscObjectStateGet((PetscObject)GetSolutionVector(), &solutionState) >> utilities::PetscUtilities::checkError;
+    if (auto auxVector = GetAuxVector()) {
+        PetscObjectStateGet((PetscObject)auxVector, &auxState) >> utilities::PetscUtilities::checkError;
+    }
+    return solutionState + auxState;
+}
+
 PetscErrorCode ablate::domain::SubDomain::Restore(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) {
     PetscFunctionBeginUser;
     // The only item that needs to be explicitly restored is the flowField
@@ -479,6 +479,12 @@ class SubDomain : public io::Serializable {
      */
     PetscErrorCode Restore(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) override;
 
+    /**
+     * The saved solution and aux fields only change when their vectors change.  The exact solution depends upon time, so it is always saved.
+     * @return
+     */
+    [[nodiscard]] PetscObjectState GetSerializableState() override;
+
     /**
      * This checks for whether the label describing the subdomain exists. If it does, use DMPlexFilter. If not, use DMClone to return new DM.
      * @param inDM
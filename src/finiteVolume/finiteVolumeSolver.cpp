@@ -1,6 +1,7 @@
 #include "finiteVolumeSolver.hpp"
 #include <utility>
 #include "cellInterpolant.hpp"
+#include "compressibleFlowFields.hpp"
 #include "faceInterpolant.hpp"
 #include "processes/process.hpp"
 #include "utilities/constants.hpp"
@@ -235,8 +236,9 @@ PetscErrorCode ablate::finiteVolume::FiniteVolumeSolver::ComputeRHSFunction(Pets
     ablate::domain::Range faceRange, cellRange;
     GetFaceRange(faceRange);
     GetCellRange(cellRange);
+    ScopedEvent rhsScope(*this, computeRhsEvent);
     try {
-        StartEvent("FiniteVolumeSolver::ComputeRHSFunction::discontinuousFluxFunction");
+        ScopedEvent discontinuousFluxScope(*this, discontinuousFluxEvent);
         if (!discontinuousFluxFunctionDescriptions.empty()) {
             if (cellInterpolant == nullptr) {
                 cellInterpolant = std::make_unique<CellInterpolant>(subDomain, GetRegion(), faceGeomVec, cellGeomVec);
@@ -244,13 +246,12 @@ PetscErrorCode ablate::finiteVolume::FiniteVolumeSolver::ComputeRHSFunction(Pets
 
             cellInterpolant->ComputeRHS(time, locXVec, subDomain->GetAuxVector(), locFVec, GetRegion(), discontinuousFluxFunctionDescriptions, faceRange, cellRange, cellGeomVec, faceGeomVec);
         }
-        EndEvent();
     } catch (std::exception& exception) {
         SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "Error in CellInterpolant discontinuousFluxFunction: %s", exception.what());
     }
 
     try {
-        StartEvent("FiniteVolumeSolver::ComputeRHSFunction::pointFunction");
+        ScopedEvent pointFunctionScope(*this, pointFunctionEvent);
         if (!pointFunctionDescriptions.empty()) {
             if (cellInterpolant == nullptr) {
                 cellInterpolant = std::make_unique<CellInterpolant>(subDomain, GetRegion(), faceGeomVec, cellGeomVec);
@@ -258,13 +259,12 @@ PetscErrorCode ablate::finiteVolume::FiniteVolumeSolver::ComputeRHSFunction(Pets
 
             cellInterpolant->ComputeRHS(time, locXVec, subDomain->GetAuxVector(), locFVec, GetRegion(), pointFunctionDescriptions, cellRange, cellGeomVec);
         }
-        EndEvent();
     } catch (std::exception& exception) {
         SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "Error in CellInterpolant pointFunctionDescriptions: %s", exception.what());
     }
 
     try {
-        StartEvent("FiniteVolumeSolver::ComputeRHSFunction::continuousFluxFunctionDescriptions");
+        ScopedEvent continuousFluxScope(*this, continuousFluxEvent);
         if (!continuousFluxFunctionDescriptions.empty()) {
             if (faceInterpolant == nullptr) {
                 faceInterpolant = std::make_unique<FaceInterpolant>(subDomain, GetRegion(), faceGeomVec, cellGeomVec);
@@ -272,7 +272,6 @@ PetscErrorCode ablate::finiteVolume::FiniteVolumeSolver::ComputeRHSFunction(Pets
 
             faceInterpolant->ComputeRHS(time, locXVec, subDomain->GetAuxVector(), locFVec, GetRegion(), continuousFluxFunctionDescriptions, faceRange, cellGeomVec, faceGeomVec);
         }
-        EndEvent();
     } catch (std::exception& exception) {
         SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "Error in FaceInterpolant continuousFluxFunctionDescriptions: %s", exception.what());
     }
@@ -281,11 +280,12 @@ PetscErrorCode ablate::finiteVolume::FiniteVolumeSolver::ComputeRHSFunction(Pets
     RestoreRange(cellRange);
 
     // iterate over any arbitrary RHS functions
-    StartEvent("FiniteVolumeSolver::ComputeRHSFunction::rhsArbitraryFunctions");
-    for (const auto& rhsFunction : rhsArbitraryFunctions) {
-        PetscCall(rhsFunction.first(*this, subDomain->GetDM(), time, locXVec, locFVec, rhsFunction.second));
+    {
+        ScopedEvent rhsArbitraryScope(*this, rhsArbitraryEvent);
+        for (const auto& rhsFunction : rhsArbitraryFunctions) {
+            PetscCall(rhsFunction.first(*this, subDomain->GetDM(), time, locXVec, locFVec, rhsFunction.second));
+        }
     }
-    EndEvent();
 
     PetscFunctionReturn(0);
 }
@@ -368,9 +368,158 @@ void ablate::finiteVolume::FiniteVolumeSolver::RegisterComputeTimeStepFunction(C
     timeStepFunctions.emplace_back(ComputeTimeStepDescription{.function = function, .context = ctx, .name = std::move(name)});
 }
 
+void ablate::finiteVolume::FiniteVolumeSolver::RegisterComputeTimeStepFunction(ComputeCellTimeStepFunction function, void* ctx, std::string name, const std::vector<std::string>& inputFields,
+                                                                               const std::vector<std::string>& auxFields) {
+    ComputeCellTimeStepDescription functionDescription{.function = function, .context = ctx, .name = std::move(name)};
+
+    for (const auto& inputField : inputFields) {
+        auto& fieldId = subDomain->GetField(inputField);
+        functionDescription.inputFields.push_back(fieldId.id);
+    }
+
+    for (const auto& auxField : auxFields) {
+        auto& fieldId = subDomain->GetField(auxField);
+        functionDescription.auxFields.push_back(fieldId.id);
+    }
+
+    cellTimeStepFunctions.push_back(functionDescription);
+}
+
+std::vector<PetscReal> ablate::finiteVolume::FiniteVolumeSolver::ComputeCellTimeSteps(TS ts, std::vector<PetscReal>* cellTimeSteps) {
+    std::vector<PetscReal> dtMin(cellTimeStepFunctions.size(), ablate::utilities::Constants::large);
+    if (cellTimeStepFunctions.empty()) {
+        if (cellTimeSteps) {
+            cellTimeSteps->clear();
+        }
+        return dtMin;
+    }
+    ScopedEvent cellTimeStepScope(*this, cellTimeStepEvent);
+
+    // Get the dm and current solution vector
+    DM dm;
+    TSGetDM(ts, &dm) >> utilities::PetscUtilities::checkError;
+    Vec v;
+    TSGetSolution(ts, &v) >> utilities::PetscUtilities::checkError;
+
+    // Precompute the offsets to pass into the cellTimeStepFunctions
+    std::vector<std::vector<PetscInt>> uOff(cellTimeStepFunctions.size());
+    std::vector<std::vector<PetscInt>> aOff(cellTimeStepFunctions.size());
+    PetscInt* uOffTotal;
+    PetscDSGetComponentOffsets(subDomain->GetDiscreteSystem(), &uOffTotal) >> utilities::PetscUtilities::checkError;
+    for (std::size_t fun = 0; fun < cellTimeStepFunctions.size(); fun++) {
+        for (const auto inputField : cellTimeStepFunctions[fun].inputFields) {
+            uOff[fun].push_back(uOffTotal[inputField]);
+        }
+    }
+    const DM auxDM = subDomain->GetAuxDM();
+    PetscInt* auxOffTotal = nullptr;
+    if (auxDM) {
+        PetscDSGetComponentOffsets(subDomain->GetAuxDiscreteSystem(), &auxOffTotal) >> utilities::PetscUtilities::checkError;
+        for (std::size_t fun = 0; fun < cellTimeStepFunctions.size(); fun++) {
+            for (const auto auxField : cellTimeStepFunctions[fun].auxFields) {
+                aOff[fun].push_back(auxOffTotal[auxField]);
+            }
+        }
+    }
+
+    // Determine where the shared primitive state is stored, -1 if the field is not available
+    PetscInt eulerOffset = -1;
+    if (subDomain->ContainsField(CompressibleFlowFields::EULER_FIELD)) {
+        const auto& eulerField = subDomain->GetField(CompressibleFlowFields::EULER_FIELD);
+        if (eulerField.location == domain::FieldLocation::SOL) {
+            eulerOffset = uOffTotal[eulerField.id];
+        }
+    }
+    PetscInt temperatureOffset = -1;
+    if (auxOffTotal && subDomain->ContainsField(CompressibleFlowFields::TEMPERATURE_FIELD)) {
+        const auto& temperatureField = subDomain->GetField(CompressibleFlowFields::TEMPERATURE_FIELD);
+        if (temperatureField.location == domain::FieldLocation::AUX) {
+            temperatureOffset = auxOffTotal[temperatureField.id];
+        }
+    }
+
+    // Get the fv geom
+    const PetscScalar* locCharacteristicsArray;
+    VecGetArrayRead(meshCharacteristicsLocalVec, &locCharacteristicsArray) >> utilities::PetscUtilities::checkError;
+
+    // Get the valid cell range over this region
+    ablate::domain::Range cellRange;
+    GetCellRangeWithoutGhost(cellRange);
+
+    // Get the solution and aux data
+    const PetscScalar* x;
+    VecGetArrayRead(v, &x) >> utilities::PetscUtilities::checkError;
+    const PetscScalar* auxArray = nullptr;
+    if (auxDM) {
+        VecGetArrayRead(subDomain->GetAuxGlobalVector(), &auxArray) >> utilities::PetscUtilities::checkError;
+    }
+
+    CellTimeStepState state{};
+    DMGetDimension(dm, &state.dim) >> utilities::PetscUtilities::checkError;
+
+    if (cellTimeSteps) {
+        cellTimeSteps->assign(cellRange.end - cellRange.start, ablate::utilities::Constants::large);
+    }
+
+    // March over each cell once, fetching the shared state before calling each function
+    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+        state.cell = cellRange.GetPoint(c);
+
+        state.conserved = nullptr;
+        DMPlexPointGlobalRead(dm, state.cell, x, &state.conserved) >> utilities::PetscUtilities::checkError;
+        if (!state.conserved) {  // must be real cell and not ghost
+            continue;
+        }
+
+        state.aux = nullptr;
+        if (auxArray) {
+            DMPlexPointLocalRead(auxDM, state.cell, auxArray, &state.aux) >> utilities::PetscUtilities::checkError;
+        }
+
+        const PetscReal* cellCharacteristics = nullptr;
+        DMPlexPointLocalRead(meshCharacteristicsDm, state.cell, locCharacteristicsArray, &cellCharacteristics) >> utilities::PetscUtilities::checkError;
+        state.minCellRadius = cellCharacteristics[MIN_CELL_RADIUS];
+
+        // Decode the primitive state shared by the functions
+        state.density = NAN;
+        state.velocity[0] = state.velocity[1] = state.velocity[2] = 0.0;
+        if (eulerOffset >= 0) {
+            const PetscScalar* euler = state.conserved + eulerOffset;
+            state.density = euler[CompressibleFlowFields::RHO];
+            for (PetscInt d = 0; d < state.dim; d++) {
+                state.velocity[d] = euler[CompressibleFlowFields::RHOU + d] / state.density;
+            }
+        }
+        state.temperature = (temperatureOffset >= 0 && state.aux) ? state.aux[temperatureOffset] : NAN;
+
+        for (std::size_t fun = 0; fun < cellTimeStepFunctions.size(); fun++) {
+            PetscReal dt;
+            cellTimeStepFunctions[fun].function(state, uOff[fun].data(), aOff[fun].data(), &dt, cellTimeStepFunctions[fun].context) >> utilities::PetscUtilities::checkError;
+            dtMin[fun] = PetscMin(dtMin[fun], dt);
+            if (cellTimeSteps) {
+                (*cellTimeSteps)[c - cellRange.start] = PetscMin((*cellTimeSteps)[c - cellRange.start], dt);
+            }
+        }
+    }
+
+    if (auxArray) {
+        VecRestoreArrayRead(subDomain->GetAuxGlobalVector(), &auxArray) >> utilities::PetscUtilities::checkError;
+    }
+    VecRestoreArrayRead(v, &x) >> utilities::PetscUtilities::checkError;
+    VecRestoreArrayRead(meshCharacteristicsLocalVec, &locCharacteristicsArray) >> utilities::PetscUtilities::checkError;
+    RestoreRange(cellRange);
+
+    return dtMin;
+}
+
 double ablate::finiteVolume::FiniteVolumeSolver::ComputePhysicsTimeStep(TS ts) {
-    // march over each calculator
+    // compute all per cell time steps in a single pass
     PetscReal dtMin = ablate::utilities::Constants::large;
+    for (const auto& dt : ComputeCellTimeSteps(ts)) {
+        dtMin = PetscMin(dtMin, dt);
+    }
+
+    // march over each calculator
     for (const auto& dtFunction : timeStepFunctions) {
         dtMin = PetscMin(dtMin, dtFunction.function(ts, *this, dtFunction.context));
     }
@@ -378,16 +527,78 @@ double ablate::finiteVolume::FiniteVolumeSolver::ComputePhysicsTimeStep(TS ts) {
     return dtMin;
 }
 
+void ablate::finiteVolume::FiniteVolumeSolver::ComputeLocalPhysicsTimeSteps(TS ts) {
+    ComputeCellTimeSteps(ts, &localTimeSteps);
+
+    // the functions that march over the cells can only provide a single limit
+    for (const auto& dtFunction : timeStepFunctions) {
+        const PetscReal dtLimit = dtFunction.function(ts, *this, dtFunction.context);
+        for (auto& dt : localTimeSteps) {
+            dt = PetscMin(dt, dtLimit);
+        }
+    }
+}
+
+PetscErrorCode ablate::finiteVolume::FiniteVolumeSolver::ScaleRHSByLocalPhysicsTimeSteps(PetscReal dt, Vec F) {
+    PetscFunctionBeginUser;
+    // Without any per cell time steps the global time step is used
+    if (localTimeSteps.empty()) {
+        PetscFunctionReturn(0);
+    }
+
+    DM dm = subDomain->GetDM();
+    PetscSection globalSection;
+    PetscCall(DMGetGlobalSection(dm, &globalSection));
+
+    // Get the valid cell range over this region
+    ablate::domain::Range cellRange;
+    GetCellRangeWithoutGhost(cellRange);
+
+    PetscScalar* fArray;
+    PetscCall(VecGetArray(F, &fArray));
+    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+        const PetscInt cell = cellRange.GetPoint(c);
+
+        PetscScalar* f = nullptr;
+        PetscCall(DMPlexPointGlobalRef(dm, cell, fArray, &f));
+        if (!f) {
+            continue;
+        }
+
+        // advance this cell by its own time step
+        PetscInt dof;
+        PetscCall(PetscSectionGetDof(globalSection, cell, &dof));
+        const PetscReal scale = localTimeSteps[c - cellRange.start] / dt;
+        for (PetscInt d = 0; d < dof; ++d) {
+            f[d] *= scale;
+        }
+    }
+    PetscCall(VecRestoreArray(F, &fArray));
+    RestoreRange(cellRange);
+
+    PetscFunctionReturn(0);
+}
+
 std::map<std::string, double> ablate::finiteVolume::FiniteVolumeSolver::ComputePhysicsTimeSteps(TS ts) {
+    // compute the local time steps
+    std::vector<PetscReal> dtLocal = ComputeCellTimeSteps(ts);
+    for (const auto& dtFunction : timeStepFunctions) {
+        dtLocal.push_back(dtFunction.function(ts, *this, dtFunction.context));
+    }
+
+    // reduce all time steps at once
+    std::vector<PetscReal> dtGlobal(dtLocal.size());
+    if (!dtLocal.empty()) {
+        MPI_Reduce(dtLocal.data(), dtGlobal.data(), (PetscMPIInt)dtLocal.size(), MPIU_REAL, MPI_MIN, 0, PetscObjectComm((PetscObject)ts)) >> ablate::utilities::MpiUtilities::checkError;
+    }
+
     // time steps
     std::map<std::string, double> timeSteps;
-
-    // march over each calculator
-    for (const auto& dtFunction : timeStepFunctions) {
-        double dt = dtFunction.function(ts, *this, dtFunction.context);
-        PetscReal dtMinGlobal;
-        MPI_Reduce(&dt, &dtMinGlobal, 1, MPIU_REAL, MPI_MIN, 0, PetscObjectComm((PetscObject)ts)) >> ablate::utilities::MpiUtilities::checkError;
-        timeSteps[dtFunction.name] = dtMinGlobal;
+    for (std::size_t i = 0; i < cellTimeStepFunctions.size(); i++) {
+        timeSteps[cellTimeStepFunctions[i].name] = dtGlobal[i];
+    }
+    for (std::size_t i = 0; i < timeStepFunctions.size(); i++) {
+        timeSteps[timeStepFunctions[i].name] = dtGlobal[cellTimeStepFunctions.size() + i];
     }
 
     return timeSteps;
@@ -470,7 +681,7 @@ PetscErrorCode ablate::finiteVolume::FiniteVolumeSolver::ComputeBoundary(PetscRe
 
 PetscErrorCode ablate::finiteVolume::FiniteVolumeSolver::PreRHSFunction(TS ts, PetscReal time, bool initialStage, Vec locX) {
     PetscFunctionBeginUser;
-    StartEvent("FiniteVolumeSolver::PreRHSFunction");
+    ScopedEvent preRhsScope(*this, preRhsEvent);
     try {
         // update any aux fields, including ghost cells
         UpdateAuxFields(time, locX, subDomain->GetAuxVector());
@@ -481,7 +692,6 @@ PetscErrorCode ablate::finiteVolume::FiniteVolumeSolver::PreRHSFunction(TS ts, P
     for (const auto& rhsFunction : preRhsFunctions) {
         PetscCall(rhsFunction.first(*this, ts, time, initialStage, locX, rhsFunction.second));
     }
-    EndEvent();
     PetscFunctionReturn(0);
 }
 
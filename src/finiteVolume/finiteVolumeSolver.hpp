@@ -31,6 +31,34 @@ class FiniteVolumeSolver : public solver::CellSolver,
     using RHSArbitraryFunction = PetscErrorCode (*)(const FiniteVolumeSolver&, DM dm, PetscReal time, Vec locXVec, Vec locFVec, void* ctx);
     using ComputeTimeStepFunction = double (*)(TS ts, FiniteVolumeSolver&, void* ctx);
 
+    /**
+     * The per cell values shared by every cell time step function.  These are fetched, and the primitive state decoded, once per cell so each
+     * function only evaluates the properties specific to its constraint.
+     */
+    struct CellTimeStepState {
+        //! the dimension of the problem
+        PetscInt dim;
+        //! the cell point
+        PetscInt cell;
+        //! all conserved values (solution fields) in the cell
+        const PetscScalar* conserved;
+        //! all aux values in the cell, nullptr if there is no aux dm
+        const PetscScalar* aux;
+        //! the min cell radius of this cell
+        PetscReal minCellRadius;
+        //! the density from the euler field, NAN if there is no euler solution field
+        PetscReal density;
+        //! the velocity from the euler field, zero if there is no euler solution field
+        PetscReal velocity[3];
+        //! the temperature from the temperature aux field, NAN if there is no temperature aux field
+        PetscReal temperature;
+    };
+
+    /**
+     * Computes the stable time step for a single cell.  The uOff and aOff are in the order of the input and aux fields passed into RegisterComputeTimeStepFunction
+     */
+    using ComputeCellTimeStepFunction = PetscErrorCode (*)(const CellTimeStepState& state, const PetscInt uOff[], const PetscInt aOff[], PetscReal* dt, void* ctx);
+
     //! store an enum for the fields in the meshCharacteristicsDm
     enum MeshCharacteristics { MIN_CELL_RADIUS = 0, MAX_CELL_RADIUS };
 
@@ -44,6 +72,17 @@ class FiniteVolumeSolver : public solver::CellSolver,
         std::string name; /**used for output**/
     };
 
+    /**
+     * struct to describe the per cell compute time step functions
+     */
+    struct ComputeCellTimeStepDescription {
+        ComputeCellTimeStepFunction function;
+        void* context;
+        std::string name; /**used for output**/
+        std::vector<PetscInt> inputFields;
+        std::vector<PetscInt> auxFields;
+    };
+
     // hold the update functions for flux and point sources
     std::vector<CellInterpolant::DiscontinuousFluxFunctionDescription> discontinuousFluxFunctionDescriptions;
     std::vector<FaceInterpolant::ContinuousFluxFunctionDescription> continuousFluxFunctionDescriptions;
@@ -58,6 +97,12 @@ class FiniteVolumeSolver : public solver::CellSolver,
     // functions to update the timestep
     std::vector<ComputeTimeStepDescription> timeStepFunctions;
 
+    // per cell functions to update the timestep, these are all evaluated in a single pass over the cells
+    std::vector<ComputeCellTimeStepDescription> cellTimeStepFunctions;
+
+    //! the stored time step for each cell in the range without ghost cells, used for local time stepping
+    std::vector<PetscReal> localTimeSteps;
+
     // Hold the flow processes.  This is mostly just to hold a pointer to them
     std::vector<std::shared_ptr<processes::Process>> processes;
 
@@ -79,6 +124,23 @@ class FiniteVolumeSolver : public solver::CellSolver,
     //! Store a dm, vec and array for mesh characteristics specific to the fvm
     Vec meshCharacteristicsLocalVec = nullptr;
 
+    //! pre-registered profiling events for the rhs evaluation, the component events are nested inside computeRhsEvent
+    const PetscLogEvent computeRhsEvent = RegisterEvent("FiniteVolumeSolver::ComputeRHSFunction");
+    const PetscLogEvent discontinuousFluxEvent = RegisterEvent("FiniteVolumeSolver::ComputeRHSFunction::discontinuousFluxFunction");
+    const PetscLogEvent pointFunctionEvent = RegisterEvent("FiniteVolumeSolver::ComputeRHSFunction::pointFunction");
+    const PetscLogEvent continuousFluxEvent = RegisterEvent("FiniteVolumeSolver::ComputeRHSFunction::continuousFluxFunctionDescriptions");
+    const PetscLogEvent rhsArbitraryEvent = RegisterEvent("FiniteVolumeSolver::ComputeRHSFunction::rhsArbitraryFunctions");
+    const PetscLogEvent preRhsEvent = RegisterEvent("FiniteVolumeSolver::PreRHSFunction");
+    const PetscLogEvent cellTimeStepEvent = RegisterEvent("FiniteVolumeSolver::ComputeCellTimeSteps");
+
+    /**
+     * March over the cells once and compute the local min time step for each of the cellTimeStepFunctions
+     * @param ts
+     * @param cellTimeSteps optional vector to store the min time step in each cell of the range without ghost cells
+     * @return the local min time step for each cellTimeStepFunction
+     */
+    std::vector<PetscReal> ComputeCellTimeSteps(TS ts, std::vector<PetscReal>* cellTimeSteps = nullptr);
+
    public:
     FiniteVolumeSolver(std::string solverId, std::shared_ptr<domain::Region>, std::shared_ptr<parameters::Parameters> options, std::vector<std::shared_ptr<processes::Process>> flowProcesses,
                        std::vector<std::shared_ptr<boundaryConditions::BoundaryCondition>> boundaryConditions);
@@ -158,14 +220,23 @@ class FiniteVolumeSolver : public solver::CellSolver,
     void RegisterPreRHSFunction(PreRHSFunctionDefinition function, void* context);
 
     /**
-     * Register a dtCalculator
+     * Register a dtCalculator that is responsible for marching over the cells
      * @param function
      * @param context
-     * @param field
+     * @param name
+     */
+    void RegisterComputeTimeStepFunction(ComputeTimeStepFunction function, void* ctx, std::string name);
+
+    /**
+     * Register a per cell dtCalculator.  All per cell functions are evaluated in a single pass over the cells.
+     * @param function
+     * @param context
+     * @param name
      * @param inputFields
      * @param auxFields
      */
-    void RegisterComputeTimeStepFunction(ComputeTimeStepFunction function, void* ctx, std::string name);
+    void RegisterComputeTimeStepFunction(ComputeCellTimeStepFunction function, void* ctx, std::string name, const std::vector<std::string>& inputFields,
+                                         const std::vector<std::string>& auxFields = {});
 
     /**
      * Computes the individual time steps useful for output/debugging.
@@ -177,6 +248,23 @@ class FiniteVolumeSolver : public solver::CellSolver,
      */
     double ComputePhysicsTimeStep(TS) override;
 
+    /**
+     * Only the per cell time step functions provide a time step in each cell
+     * @return true if any per cell time step functions are registered
+     */
+    [[nodiscard]] bool HasLocalPhysicsTimeSteps() const override { return !cellTimeStepFunctions.empty(); }
+
+    /**
+     * Computes and stores the time step in each cell from the per cell time step functions.  Functions that are responsible for marching over the cells
+     * limit every cell to their time step.
+     */
+    void ComputeLocalPhysicsTimeSteps(TS) override;
+
+    /**
+     * Scales the rhs in each cell by the ratio of the stored cell time step to the global time step
+     */
+    PetscErrorCode ScaleRHSByLocalPhysicsTimeSteps(PetscReal dt, Vec F) override;
+
     /**
      * Returns true if any of the processes are marked as serializable
      * @return
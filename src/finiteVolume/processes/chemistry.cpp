@@ -42,7 +42,7 @@ PetscErrorCode ablate::finiteVolume::processes::Chemistry::ChemistryPreStage(TS
         PetscFunctionReturn(0);
     }
 
-    StartEvent("ChemistryPreStage");
+    ScopedEvent preStageScope(*this, preStageEvent);
 
     // Get the valid cell range over this region
     auto& fvSolver = dynamic_cast<ablate::finiteVolume::FiniteVolumeSolver&>(solver);
@@ -66,14 +66,13 @@ PetscErrorCode ablate::finiteVolume::processes::Chemistry::ChemistryPreStage(TS
 
     // clean up
     solver.RestoreRange(cellRange);
-    EndEvent();
     PetscFunctionReturn(0);
 }
 
 PetscErrorCode ablate::finiteVolume::processes::Chemistry::AddChemistrySourceToFlow(const FiniteVolumeSolver& solver, DM dm, PetscReal time, Vec locX, Vec locFVec, void* ctx) {
     PetscFunctionBegin;
     auto process = (ablate::finiteVolume::processes::Chemistry*)ctx;
-    process->StartEvent("AddChemistrySourceToFlow");
+    ScopedEvent addSourceScope(*process, process->addSourceEvent);
     // get the cell range
     ablate::domain::Range cellRange;
     solver.GetCellRangeWithoutGhost(cellRange);
@@ -87,8 +86,6 @@ PetscErrorCode ablate::finiteVolume::processes::Chemistry::AddChemistrySourceToF
 
     // cleanup
     solver.RestoreRange(cellRange);
-
-    process->EndEvent();
     PetscFunctionReturn(0);
 }
 
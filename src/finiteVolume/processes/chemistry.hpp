@@ -15,6 +15,10 @@ class Chemistry : public Process, public ablate::utilities::Loggable<Chemistry>
     //! the current active chemistry calculator
     std::shared_ptr<ablate::eos::ChemistryModel::SourceCalculator> sourceCalculator;
 
+    //! pre-registered profiling events
+    const PetscLogEvent preStageEvent = RegisterEvent("ChemistryPreStage");
+    const PetscLogEvent addSourceEvent = RegisterEvent("AddChemistrySourceToFlow");
+
     /**
      * private function to compute the energy and densityYi source terms over the next dt
      * @param flowTs
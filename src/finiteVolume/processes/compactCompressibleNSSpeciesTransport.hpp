@@ -78,8 +78,6 @@ class CompactCompressibleNSSpeciesTransport : public FlowProcess {
         eos::ThermodynamicTemperatureFunction muFunction;
         /* specific heat*/
         eos::ThermodynamicTemperatureFunction specificHeat;
-        /* density */
-        eos::ThermodynamicTemperatureFunction density;
     };
     DiffusionTimeStepData diffusionTimeStepData;
 
@@ -167,13 +165,13 @@ class CompactCompressibleNSSpeciesTransport : public FlowProcess {
                                                                            const PetscScalar gradAux[], PetscScalar flux[], void* ctx);
 
     // static function to compute time step for euler advection
-    static double ComputeCflTimeStep(TS ts, ablate::finiteVolume::FiniteVolumeSolver& flow, void* ctx);
+    static PetscErrorCode ComputeCflTimeStep(const FiniteVolumeSolver::CellTimeStepState& state, const PetscInt uOff[], const PetscInt aOff[], PetscReal* dt, void* ctx);
     // static function to compute the conduction based time step
-    static double ComputeViscousDiffusionTimeStep(TS ts, ablate::finiteVolume::FiniteVolumeSolver& flow, void* ctx);
+    static PetscErrorCode ComputeViscousDiffusionTimeStep(const FiniteVolumeSolver::CellTimeStepState& state, const PetscInt uOff[], const PetscInt aOff[], PetscReal* dt, void* ctx);
     // static function to compute the conduction based time step
-    static double ComputeConductionTimeStep(TS ts, ablate::finiteVolume::FiniteVolumeSolver& flow, void* ctx);
+    static PetscErrorCode ComputeConductionTimeStep(const FiniteVolumeSolver::CellTimeStepState& state, const PetscInt uOff[], const PetscInt aOff[], PetscReal* dt, void* ctx);
     // static function to compute the conduction based time step
-    static double ComputeViscousSpeciesDiffusionTimeStep(TS ts, ablate::finiteVolume::FiniteVolumeSolver& flow, void* ctx);
+    static PetscErrorCode ComputeViscousSpeciesDiffusionTimeStep(const FiniteVolumeSolver::CellTimeStepState& state, const PetscInt uOff[], const PetscInt aOff[], PetscReal* dt, void* ctx);
 };
 
 }  // namespace ablate::finiteVolume::processes
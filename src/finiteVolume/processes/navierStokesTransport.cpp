@@ -40,7 +40,7 @@ void ablate::finiteVolume::processes::NavierStokesTransport::Setup(ablate::finit
         flow.RegisterRHSFunction(AdvectionFlux, &advectionData, {CompressibleFlowFields::EULER_FIELD}, {CompressibleFlowFields::EULER_FIELD}, {CompressibleFlowFields::TEMPERATURE_FIELD});
 
         // PetscErrorCode PetscOptionsGetBool(PetscOptions options,const char pre[],const char name[],PetscBool *ivalue,PetscBool *set)
-        flow.RegisterComputeTimeStepFunction(ComputeCflTimeStep, &timeStepData, "cfl");
+        flow.RegisterComputeTimeStepFunction(ComputeCflTimeStep, &timeStepData, "cfl", {CompressibleFlowFields::EULER_FIELD});
 
         advectionData.computeTemperature = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::Temperature, flow.GetSubDomain().GetFields());
         advectionData.computeInternalEnergy = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::InternalSensibleEnergy, flow.GetSubDomain().GetFields());
@@ -68,13 +68,12 @@ void ablate::finiteVolume::processes::NavierStokesTransport::Setup(ablate::finit
             diffusionTimeStepData.kFunction = diffusionData.kFunction;
             diffusionTimeStepData.muFunction = diffusionData.muFunction;
             diffusionTimeStepData.specificHeat = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::SpecificHeatConstantVolume, flow.GetSubDomain().GetFields());
-            diffusionTimeStepData.density = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::Density, flow.GetSubDomain().GetFields());
 
             if (diffusionTimeStepData.conductionStabilityFactor > 0) {
-                flow.RegisterComputeTimeStepFunction(ComputeConductionTimeStep, &diffusionTimeStepData, "cond");
+                flow.RegisterComputeTimeStepFunction(ComputeConductionTimeStep, &diffusionTimeStepData, "cond", {}, {CompressibleFlowFields::TEMPERATURE_FIELD});
             }
             if (diffusionTimeStepData.viscousStabilityFactor > 0) {
-                flow.RegisterComputeTimeStepFunction(ComputeViscousDiffusionTimeStep, &diffusionTimeStepData, "visc");
+                flow.RegisterComputeTimeStepFunction(ComputeViscousDiffusionTimeStep, &diffusionTimeStepData, "visc", {}, {CompressibleFlowFields::TEMPERATURE_FIELD});
             }
         }
     }
@@ -206,249 +205,84 @@ PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::Advection
     PetscFunctionReturn(0);
 }
 
-double ablate::finiteVolume::processes::NavierStokesTransport::ComputeCflTimeStep(TS ts, ablate::finiteVolume::FiniteVolumeSolver& flow, void* ctx) {
-    // Get the dm and current solution vector
-    DM dm;
-    TSGetDM(ts, &dm) >> utilities::PetscUtilities::checkError;
-    Vec v;
-    TSGetSolution(ts, &v) >> utilities::PetscUtilities::checkError;
-
+PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::ComputeCflTimeStep(const FiniteVolumeSolver::CellTimeStepState& state, const PetscInt uOff[], const PetscInt aOff[],
+                                                                                          PetscReal* dt, void* ctx) {
+    PetscFunctionBeginUser;
     // Get the flow param
     auto timeStepData = (CflTimeStepData*)ctx;
     auto advectionData = timeStepData->advectionData;
 
-    // Get the fv geom
-    Vec locCharacteristicsVec;
-    DM characteristicsDm;
-    const PetscScalar* locCharacteristicsArray;
-    flow.GetMeshCharacteristics(characteristicsDm, locCharacteristicsVec);
-    VecGetArrayRead(locCharacteristicsVec, &locCharacteristicsArray) >> utilities::PetscUtilities::checkError;
-
-    // Get the valid cell range over this region
-    ablate::domain::Range cellRange;
-    flow.GetCellRangeWithoutGhost(cellRange);
-
-    const PetscScalar* x;
-    VecGetArrayRead(v, &x) >> utilities::PetscUtilities::checkError;
-
-    // Get the dim from the dm
-    PetscInt dim;
-    DMGetDimension(dm, &dim) >> utilities::PetscUtilities::checkError;
-
-    // Get field location for euler and densityYi
-    auto eulerId = flow.GetSubDomain().GetField("euler").id;
-
     // Get alpha if provided
     PetscReal pgsAlpha = 1.0;
     if (timeStepData->pgs) {
         pgsAlpha = timeStepData->pgs->GetAlpha();
     }
 
-    // March over each cell
-    PetscReal dtMin = ablate::utilities::Constants::large;
-    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
-        auto cell = cellRange.GetPoint(c);
-
-        const PetscReal* euler;
-        const PetscReal* conserved = NULL;
-        const PetscReal* cellCharacteristics = NULL;
-        DMPlexPointGlobalFieldRead(dm, cell, eulerId, x, &euler) >> utilities::PetscUtilities::checkError;
-        DMPlexPointGlobalRead(dm, cell, x, &conserved) >> utilities::PetscUtilities::checkError;
-        DMPlexPointLocalRead(characteristicsDm, cell, locCharacteristicsArray, &cellCharacteristics) >> utilities::PetscUtilities::checkError;
-
-        if (euler) {  // must be real cell and not ghost
-            PetscReal rho = euler[CompressibleFlowFields::RHO];
-
-            // Get the speed of sound from the eos
-            // TODO:: Replace this with a better temperature guess (see compute conduction Time Step below)
-            PetscReal temperature;
-            advectionData->computeTemperature.function(conserved, 300, &temperature, advectionData->computeTemperature.context.get()) >> utilities::PetscUtilities::checkError;
-            PetscReal a;
-            advectionData->computeSpeedOfSound.function(conserved, temperature, &a, advectionData->computeSpeedOfSound.context.get()) >> utilities::PetscUtilities::checkError;
-
-            PetscReal dx = 2.0 * cellCharacteristics[FiniteVolumeSolver::MIN_CELL_RADIUS];
-
-            PetscReal velSum = 0.0;
-            for (PetscInt d = 0; d < dim; d++) {
-                velSum += PetscAbsReal(euler[CompressibleFlowFields::RHOU + d]) / rho;
-            }
-            PetscReal dt = advectionData->cfl * dx / (a / pgsAlpha + velSum);
-
-            dtMin = PetscMin(dtMin, dt);
-        }
-    }
-    VecRestoreArrayRead(v, &x) >> utilities::PetscUtilities::checkError;
-    flow.RestoreRange(cellRange);
-    VecRestoreArrayRead(locCharacteristicsVec, &locCharacteristicsArray) >> utilities::PetscUtilities::checkError;
-
-    return dtMin;
-}
-
-double ablate::finiteVolume::processes::NavierStokesTransport::ComputeConductionTimeStep(TS ts, ablate::finiteVolume::FiniteVolumeSolver& flow, void* ctx) {
-    // Get the dm and current solution vector
-    DM dm;
-    TSGetDM(ts, &dm) >> utilities::PetscUtilities::checkError;
-    Vec v;
-    TSGetSolution(ts, &v) >> utilities::PetscUtilities::checkError;
+    // Get the speed of sound from the eos, the shared temperature is a better guess when available
+    PetscReal temperature;
+    PetscCall(advectionData->computeTemperature.function(state.conserved, PetscIsNanReal(state.temperature) ? 300 : state.temperature, &temperature, advectionData->computeTemperature.context.get()));
+    PetscReal a;
+    PetscCall(advectionData->computeSpeedOfSound.function(state.conserved, temperature, &a, advectionData->computeSpeedOfSound.context.get()));
 
-    // Get the flow param
-    auto diffusionData = (DiffusionTimeStepData*)ctx;
+    PetscReal dx = 2.0 * state.minCellRadius;
 
-    // Get the fv geom
-    Vec locCharacteristicsVec;
-    DM characteristicsDm;
-    const PetscScalar* locCharacteristicsArray;
-    flow.GetMeshCharacteristics(characteristicsDm, locCharacteristicsVec);
-    VecGetArrayRead(locCharacteristicsVec, &locCharacteristicsArray) >> utilities::PetscUtilities::checkError;
-
-    // Get the valid cell range over this region
-    ablate::domain::Range cellRange;
-    flow.GetCellRangeWithoutGhost(cellRange);
-
-    // Get the solution data
-    const PetscScalar* x;
-    VecGetArrayRead(v, &x) >> utilities::PetscUtilities::checkError;
-
-    // Get the auxData
-    const PetscScalar* aux;
-    const DM auxDM = flow.GetSubDomain().GetAuxDM();
-    VecGetArrayRead(flow.GetSubDomain().GetAuxGlobalVector(), &aux) >> utilities::PetscUtilities::checkError;
-
-    // Get the dim from the dm
-    PetscInt dim;
-    DMGetDimension(dm, &dim) >> utilities::PetscUtilities::checkError;
-
-    // Get field location for temperature
-    auto temperatureField = flow.GetSubDomain().GetField(finiteVolume::CompressibleFlowFields::TEMPERATURE_FIELD).id;
-
-    // get functions
-    auto kFunction = diffusionData->kFunction.function;
-    auto kFunctionContext = diffusionData->kFunction.context.get();
-    auto cvFunction = diffusionData->specificHeat.function;
-    auto cvFunctionContext = diffusionData->specificHeat.context.get();
-    auto density = diffusionData->density.function;
-    auto densityContext = diffusionData->density.context.get();
-    auto stabFactor = diffusionData->conductionStabilityFactor;
-
-    // March over each cell
-    PetscReal dtMin = ablate::utilities::Constants::large;
-    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
-        auto cell = cellRange.GetPoint(c);
-
-        const PetscReal* conserved = NULL;
-        DMPlexPointGlobalRead(dm, cell, x, &conserved) >> utilities::PetscUtilities::checkError;
-
-        const PetscReal* temperature = NULL;
-        DMPlexPointLocalFieldRead(auxDM, cell, temperatureField, aux, &temperature) >> utilities::PetscUtilities::checkError;
-
-        const PetscReal* cellCharacteristics = NULL;
-        DMPlexPointLocalRead(characteristicsDm, cell, locCharacteristicsArray, &cellCharacteristics) >> utilities::PetscUtilities::checkError;
-
-        if (conserved) {  // must be real cell and not ghost
-            PetscReal k;
-            kFunction(conserved, *temperature, &k, kFunctionContext) >> utilities::PetscUtilities::checkError;
-            PetscReal cv;
-            cvFunction(conserved, *temperature, &cv, cvFunctionContext) >> utilities::PetscUtilities::checkError;
-            PetscReal rho;
-            density(conserved, *temperature, &rho, densityContext) >> utilities::PetscUtilities::checkError;
-
-            // Compute alpha
-            PetscReal alpha = k / (rho * cv);
-
-            PetscReal dx2 = PetscSqr(2.0 * cellCharacteristics[FiniteVolumeSolver::MIN_CELL_RADIUS]);
-
-            // compute dt
-            double dt = PetscAbs(stabFactor * dx2 / alpha);
-            dtMin = PetscMin(dtMin, dt);
-        }
+    PetscReal velSum = 0.0;
+    for (PetscInt d = 0; d < state.dim; d++) {
+        velSum += PetscAbsReal(state.velocity[d]);
     }
-    VecRestoreArrayRead(v, &x) >> utilities::PetscUtilities::checkError;
-    VecRestoreArrayRead(flow.GetSubDomain().GetAuxGlobalVector(), &aux) >> utilities::PetscUtilities::checkError;
-    VecRestoreArrayRead(locCharacteristicsVec, &locCharacteristicsArray) >> utilities::PetscUtilities::checkError;
-    flow.RestoreRange(cellRange);
+    *dt = advectionData->cfl * dx / (a / pgsAlpha + velSum);
 
-    return dtMin;
+    PetscFunctionReturn(0);
 }
 
-double ablate::finiteVolume::processes::NavierStokesTransport::ComputeViscousDiffusionTimeStep(TS ts, ablate::finiteVolume::FiniteVolumeSolver& flow, void* ctx) {
-    // Get the dm and current solution vector
-    DM dm;
-    TSGetDM(ts, &dm) >> utilities::PetscUtilities::checkError;
-    Vec v;
-    TSGetSolution(ts, &v) >> utilities::PetscUtilities::checkError;
+PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::ComputeConductionTimeStep(const FiniteVolumeSolver::CellTimeStepState& state, const PetscInt uOff[], const PetscInt aOff[],
+                                                                                                 PetscReal* dt, void* ctx) {
+    PetscFunctionBeginUser;
+    // this order is based upon the order that they are passed into RegisterComputeTimeStepFunction
+    const int T = 0;
 
     // Get the flow param
     auto diffusionData = (DiffusionTimeStepData*)ctx;
+    const PetscReal temperature = state.aux[aOff[T]];
 
-    // Get the fv geom
-    Vec locCharacteristicsVec;
-    DM characteristicsDm;
-    const PetscScalar* locCharacteristicsArray;
-    flow.GetMeshCharacteristics(characteristicsDm, locCharacteristicsVec);
-    VecGetArrayRead(locCharacteristicsVec, &locCharacteristicsArray) >> utilities::PetscUtilities::checkError;
+    PetscReal k;
+    PetscCall(diffusionData->kFunction.function(state.conserved, temperature, &k, diffusionData->kFunction.context.get()));
+    PetscReal cv;
+    PetscCall(diffusionData->specificHeat.function(state.conserved, temperature, &cv, diffusionData->specificHeat.context.get()));
 
-    // Get the valid cell range over this region
-    ablate::domain::Range cellRange;
-    flow.GetCellRangeWithoutGhost(cellRange);
+    // Compute alpha
+    PetscReal alpha = k / (state.density * cv);
 
-    // Get the solution data
-    const PetscScalar* x;
-    VecGetArrayRead(v, &x) >> utilities::PetscUtilities::checkError;
+    PetscReal dx2 = PetscSqr(2.0 * state.minCellRadius);
 
-    // Get the auxData
-    const PetscScalar* aux;
-    const DM auxDM = flow.GetSubDomain().GetAuxDM();
-    VecGetArrayRead(flow.GetSubDomain().GetAuxGlobalVector(), &aux) >> utilities::PetscUtilities::checkError;
+    // compute dt
+    *dt = PetscAbs(diffusionData->conductionStabilityFactor * dx2 / alpha);
 
-    // Get the dim from the dm
-    PetscInt dim;
-    DMGetDimension(dm, &dim) >> utilities::PetscUtilities::checkError;
-
-    // Get field location for temperature
-    auto temperatureField = flow.GetSubDomain().GetField(finiteVolume::CompressibleFlowFields::TEMPERATURE_FIELD).id;
-
-    // get functions
-    auto muFunction = diffusionData->muFunction.function;
-    auto muFunctionContext = diffusionData->muFunction.context.get();
-    auto density = diffusionData->density.function;
-    auto densityContext = diffusionData->density.context.get();
-    auto stabFactor = diffusionData->viscousStabilityFactor;
-
-    // March over each cell
-    PetscReal dtMin = ablate::utilities::Constants::large;
-    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
-        auto cell = cellRange.GetPoint(c);
+    PetscFunctionReturn(0);
+}
 
-        const PetscReal* conserved = NULL;
-        DMPlexPointGlobalRead(dm, cell, x, &conserved) >> utilities::PetscUtilities::checkError;
+PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::ComputeViscousDiffusionTimeStep(const FiniteVolumeSolver::CellTimeStepState& state, const PetscInt uOff[],
+                                                                                                       const PetscInt aOff[], PetscReal* dt, void* ctx) {
+    PetscFunctionBeginUser;
+    // this order is based upon the order that they are passed into RegisterComputeTimeStepFunction
+    const int T = 0;
 
-        const PetscReal* temperature = NULL;
-        DMPlexPointLocalFieldRead(auxDM, cell, temperatureField, aux, &temperature) >> utilities::PetscUtilities::checkError;
+    // Get the flow param
+    auto diffusionData = (DiffusionTimeStepData*)ctx;
+    const PetscReal temperature = state.aux[aOff[T]];
 
-        const PetscReal* cellCharacteristics = NULL;
-        DMPlexPointLocalRead(characteristicsDm, cell, locCharacteristicsArray, &cellCharacteristics) >> utilities::PetscUtilities::checkError;
+    PetscReal mu;
+    PetscCall(diffusionData->muFunction.function(state.conserved, temperature, &mu, diffusionData->muFunction.context.get()));
 
-        if (conserved) {  // must be real cell and not ghost
-            PetscReal mu;
-            muFunction(conserved, *temperature, &mu, muFunctionContext) >> utilities::PetscUtilities::checkError;
-            PetscReal rho;
-            density(conserved, *temperature, &rho, densityContext) >> utilities::PetscUtilities::checkError;
+    // Compute nu
+    PetscReal nu = mu / state.density;
 
-            // Compute nu
-            PetscReal nu = mu / rho;
+    PetscReal dx2 = PetscSqr(2.0 * state.minCellRadius);
 
-            PetscReal dx2 = PetscSqr(2.0 * cellCharacteristics[FiniteVolumeSolver::MIN_CELL_RADIUS]);
+    // compute dt
+    *dt = PetscAbs(diffusionData->viscousStabilityFactor * dx2 / nu);
 
-            // compute dt
-            double dt = PetscAbs(stabFactor * dx2 / nu);
-            dtMin = PetscMin(dtMin, dt);
-        }
-    }
-    VecRestoreArrayRead(v, &x) >> utilities::PetscUtilities::checkError;
-    VecRestoreArrayRead(flow.GetSubDomain().GetAuxGlobalVector(), &aux) >> utilities::PetscUtilities::checkError;
-    VecRestoreArrayRead(locCharacteristicsVec, &locCharacteristicsArray) >> utilities::PetscUtilities::checkError;
-    flow.RestoreRange(cellRange);
-    return dtMin;
+    PetscFunctionReturn(0);
 }
 
 PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::DiffusionFlux(PetscInt dim, const PetscFVFaceGeom* fg, const PetscInt uOff[], const PetscInt uOff_x[], const PetscScalar field[],
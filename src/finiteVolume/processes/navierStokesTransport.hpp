@@ -39,11 +39,11 @@ class NavierStokesTransport : public FlowProcess {
     };
 
     // static function to compute time step for euler advection
-    static double ComputeCflTimeStep(TS ts, ablate::finiteVolume::FiniteVolumeSolver& flow, void* ctx);
+    static PetscErrorCode ComputeCflTimeStep(const FiniteVolumeSolver::CellTimeStepState& state, const PetscInt uOff[], const PetscInt aOff[], PetscReal* dt, void* ctx);
     // static function to compute the conduction based time step
-    static double ComputeViscousDiffusionTimeStep(TS ts, ablate::finiteVolume::FiniteVolumeSolver& flow, void* ctx);
+    static PetscErrorCode ComputeViscousDiffusionTimeStep(const FiniteVolumeSolver::CellTimeStepState& state, const PetscInt uOff[], const PetscInt aOff[], PetscReal* dt, void* ctx);
     // static function to compute the conduction based time step
-    static double ComputeConductionTimeStep(TS ts, ablate::finiteVolume::FiniteVolumeSolver& flow, void* ctx);
+    static PetscErrorCode ComputeConductionTimeStep(const FiniteVolumeSolver::CellTimeStepState& state, const PetscInt uOff[], const PetscInt aOff[], PetscReal* dt, void* ctx);
 
    private:
     const std::shared_ptr<fluxCalculator::FluxCalculator> fluxCalculator;
@@ -83,8 +83,6 @@ class NavierStokesTransport : public FlowProcess {
         eos::ThermodynamicTemperatureFunction muFunction;
         /* specific heat*/
         eos::ThermodynamicTemperatureFunction specificHeat;
-        /* density */
-        eos::ThermodynamicTemperatureFunction density;
     };
     DiffusionTimeStepData diffusionTimeStepData;
 
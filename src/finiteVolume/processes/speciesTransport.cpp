@@ -82,7 +82,7 @@ void ablate::finiteVolume::processes::SpeciesTransport::Setup(ablate::finiteVolu
                     diffusionTimeStepData.numberSpecies = diffusionData.numberSpecies;
                     diffusionTimeStepData.diffFunction = diffusionData.diffFunction;
 
-                    flow.RegisterComputeTimeStepFunction(ComputeViscousDiffusionTimeStep, &diffusionTimeStepData, "spec");
+                    flow.RegisterComputeTimeStepFunction(ComputeViscousDiffusionTimeStep, &diffusionTimeStepData, "spec", {}, {CompressibleFlowFields::TEMPERATURE_FIELD});
                 }
             }
         }
@@ -402,72 +402,24 @@ void ablate::finiteVolume::processes::SpeciesTransport::NormalizeSpecies(TS ts,
     solver.RestoreRange(cellRange);
 }
 
-double ablate::finiteVolume::processes::SpeciesTransport::ComputeViscousDiffusionTimeStep(TS ts, ablate::finiteVolume::FiniteVolumeSolver &flow, void *ctx) {
-    // Get the dm and current solution vector
-    DM dm;
-    TSGetDM(ts, &dm) >> utilities::PetscUtilities::checkError;
-    Vec v;
-    TSGetSolution(ts, &v) >> utilities::PetscUtilities::checkError;
+PetscErrorCode ablate::finiteVolume::processes::SpeciesTransport::ComputeViscousDiffusionTimeStep(const FiniteVolumeSolver::CellTimeStepState &state, const PetscInt uOff[], const PetscInt aOff[],
+                                                                                                  PetscReal *dt, void *ctx) {
+    PetscFunctionBeginUser;
+    // this order is based upon the order that they are passed into RegisterComputeTimeStepFunction
+    const int T = 0;
 
     // Get the flow param
     auto diffusionData = (DiffusionTimeStepData *)ctx;
 
-    // Get the fv geom
-    PetscReal minCellRadius;
-    DMPlexGetGeometryFVM(dm, NULL, NULL, &minCellRadius) >> utilities::PetscUtilities::checkError;
-
-    // Get the valid cell range over this region
-    ablate::domain::Range cellRange;
-    flow.GetCellRangeWithoutGhost(cellRange);
-
-    // Get the solution data
-    const PetscScalar *x;
-    VecGetArrayRead(v, &x) >> utilities::PetscUtilities::checkError;
+    const PetscReal dx2 = PetscSqr(2.0 * state.minCellRadius);
 
-    // Get the auxData
-    const PetscScalar *aux;
-    const DM auxDM = flow.GetSubDomain().GetAuxDM();
-    VecGetArrayRead(flow.GetSubDomain().GetAuxGlobalVector(), &aux) >> utilities::PetscUtilities::checkError;
+    PetscReal diff;
+    PetscCall(diffusionData->diffFunction.function(state.conserved, state.aux[aOff[T]], &diff, diffusionData->diffFunction.context.get()));
 
-    // Get the dim from the dm
-    PetscInt dim;
-    DMGetDimension(dm, &dim) >> utilities::PetscUtilities::checkError;
+    // compute dt
+    *dt = PetscAbs(diffusionData->stabilityFactor * dx2 / diff);
 
-    // assume the smallest cell is the limiting factor for now
-    const PetscReal dx2 = PetscSqr(2.0 * minCellRadius);
-
-    // Get field location for temperature
-    auto temperatureField = flow.GetSubDomain().GetField(finiteVolume::CompressibleFlowFields::TEMPERATURE_FIELD).id;
-
-    // get functions
-    auto diffFunction = diffusionData->diffFunction.function;
-    auto diffFunctionContext = diffusionData->diffFunction.context.get();
-    auto stabFactor = diffusionData->stabilityFactor;
-
-    // March over each cell
-    PetscReal dtMin = ablate::utilities::Constants::large;
-    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
-        auto cell = cellRange.GetPoint(c);
-
-        const PetscReal *conserved = NULL;
-        DMPlexPointGlobalRead(dm, cell, x, &conserved) >> utilities::PetscUtilities::checkError;
-
-        const PetscReal *temperature = NULL;
-        DMPlexPointLocalFieldRead(auxDM, cell, temperatureField, aux, &temperature) >> utilities::PetscUtilities::checkError;
-
-        if (conserved) {  // must be real cell and not ghost
-            PetscReal diff;
-            diffFunction(conserved, *temperature, &diff, diffFunctionContext) >> utilities::PetscUtilities::checkError;
-
-            // compute dt
-            double dt = PetscAbs(stabFactor * dx2 / diff);
-            dtMin = PetscMin(dtMin, dt);
-        }
-    }
-    VecRestoreArrayRead(v, &x) >> utilities::PetscUtilities::checkError;
-    VecRestoreArrayRead(flow.GetSubDomain().GetAuxGlobalVector(), &aux) >> utilities::PetscUtilities::checkError;
-    flow.RestoreRange(cellRange);
-    return dtMin;
+    PetscFunctionReturn(0);
 }
 
 #include "registrar.hpp"
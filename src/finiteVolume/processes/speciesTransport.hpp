@@ -143,7 +143,7 @@ class SpeciesTransport : public FlowProcess {
                                         const PetscScalar auxL[], const PetscScalar auxR[], PetscScalar* flux, void* ctx);
 
     // static function to compute the conduction based time step
-    static double ComputeViscousDiffusionTimeStep(TS ts, ablate::finiteVolume::FiniteVolumeSolver& flow, void* ctx);
+    static PetscErrorCode ComputeViscousDiffusionTimeStep(const FiniteVolumeSolver::CellTimeStepState& state, const PetscInt uOff[], const PetscInt aOff[], PetscReal* dt, void* ctx);
 };
 
 }  // namespace ablate::finiteVolume::processes
@@ -4,16 +4,17 @@
 #include "utilities/constants.hpp"
 #include "utilities/mathUtilities.hpp"
 
-ablate::finiteVolume::processes::SurfaceForce::SurfaceForce(PetscReal sigma) : sigma(sigma) {}
+ablate::finiteVolume::processes::SurfaceForce::SurfaceForce(PetscReal sigma, int narrowBand, int narrowBandRebuildInterval)
+    : sigma(sigma), narrowBandLevels(narrowBand), narrowBandRebuildInterval(narrowBandRebuildInterval) {}
 
 void ablate::finiteVolume::processes::SurfaceForce::Setup(ablate::finiteVolume::FiniteVolumeSolver &flow) {
-    /** Make stencils for connected cells of each vertex and store them
-     * extract the vortices and get their coordinates
-     * march over each vertex and store the vertex point
-     * extract the cells in the domain then identify the connected cells to the vertex using "PETSc-Closure" and store
-     * extract the connected cells info and store
-     * calculate the weights for gradient by summing the distances of connected cells to the vertex and store
-     * push back for this vertex
+    /** Assemble the operators used to compute the curvature so no mesh queries are needed when computing the source
+     * march over each vertex and identify the connected cells to the vertex using "PETSc-Closure"
+     * the vertex normal is the sum of the alpha values of the connected cells, positive in front and negative behind the vertex, divided by the
+     * summed distances of the connected cells to the vertex
+     * march over each cell and identify the vertices of the cell using "PETSc-Closure"
+     * the divergence and gradient at the cell center are the sum of the vertex values, positive in front and negative behind the cell center,
+     * divided by the summed distances of the vertices to the cell center
      **/
     auto dim = flow.GetSubDomain().GetDimensions();
     auto dm = flow.GetSubDomain().GetDM();
@@ -21,16 +22,8 @@ void ablate::finiteVolume::processes::SurfaceForce::Setup(ablate::finiteVolume::
     DM dmCell;
     const PetscScalar *cellGeomArray;
     DMPlexGetGeometryFVM(dm, nullptr, &cellGeomVec, nullptr) >> utilities::PetscUtilities::checkError;
-    VecGetDM(cellGeomVec, &dmCell);
-    VecGetArrayRead(cellGeomVec, &cellGeomArray);
-    // create a domain function, dmData, to use it in main function for storing any calculated data/field. Here the vertex normals will be stored on vortices, therefore k = 1
-    PetscFE fe_coords;
-    PetscInt k = 1;
-    DMClone(dm, &dmData) >> utilities::PetscUtilities::checkError;
-    PetscFECreateLagrange(PETSC_COMM_SELF, dim, dim, PETSC_TRUE, k, PETSC_DETERMINE, &fe_coords) >> utilities::PetscUtilities::checkError;
-    DMSetField(dmData, 0, NULL, (PetscObject)fe_coords) >> utilities::PetscUtilities::checkError;
-    PetscFEDestroy(&fe_coords) >> utilities::PetscUtilities::checkError;
-    DMCreateDS(dmData) >> utilities::PetscUtilities::checkError;
+    VecGetDM(cellGeomVec, &dmCell) >> utilities::PetscUtilities::checkError;
+    VecGetArrayRead(cellGeomVec, &cellGeomArray) >> utilities::PetscUtilities::checkError;
 
     // extract the local coordinates array
     Vec localCoordsVector;
@@ -40,74 +33,163 @@ void ablate::finiteVolume::processes::SurfaceForce::Setup(ablate::finiteVolume::
     DMGetCoordinatesLocal(dm, &localCoordsVector) >> utilities::PetscUtilities::checkError;
     VecGetArray(localCoordsVector, &coordsArray) >> utilities::PetscUtilities::checkError;
 
-    PetscInt vStart, vEnd, cStart, cEnd, cl;
-    // extract vortices of domain
+    PetscInt vStart, vEnd, cStart, cEnd;
     DMPlexGetDepthStratum(dm, 0, &vStart, &vEnd) >> utilities::PetscUtilities::checkError;
+    DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> utilities::PetscUtilities::checkError;
+    auto &op = curvatureOperator;
+    op = CurvatureOperator{.cStart = cStart, .vStart = vStart};
 
-    // march over vortices
+    // march over vertices
+    op.vertexOffsets.reserve(vEnd - vStart + 1);
+    op.vertexOffsets.push_back(0);
     for (PetscInt v = vStart; v < vEnd; v++) {
-        auto newStencil = VertexStencil{};
-        // store the vertex point
-        newStencil.vertexId = v;
-        newStencil.stencilCoord = {0, 0, 0};
         PetscInt off;
-        PetscReal xyz[3];
-        // extract x, y, z values
         PetscSectionGetOffset(coordsSection, v, &off) >> utilities::PetscUtilities::checkError;
-        for (PetscInt d = 0; d < dim; ++d) {
-            xyz[d] = coordsArray[off + d];
-            // store coordinates of the vertex
-            newStencil.stencilCoord[d] = xyz[d];
-        }
+        const PetscScalar *xyz = coordsArray + off;
 
-        newStencil.gradientWeights = {0, 0, 0};
-        newStencil.stencilSize = 0;
-        // extract nodes of the vertex
+        // extract the connected cells
         PetscInt *star = nullptr;
         PetscInt numStar;
         DMPlexGetTransitiveClosure(dm, v, PETSC_FALSE, &numStar, &star) >> utilities::PetscUtilities::checkError;
-
-        // extract the connected cells and store them
-        DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> utilities::PetscUtilities::checkError;
-        PetscInt cell;
-        for (cl = 0; cl < numStar * 2; cl += 2) {
-            cell = star[cl];
+        const std::size_t rowStart = op.vertexColumns.size();
+        PetscReal gradientWeights[3] = {0, 0, 0};
+        for (PetscInt cl = 0; cl < numStar * 2; cl += 2) {
+            const PetscInt cell = star[cl];
             if (cell < cStart || cell >= cEnd) continue;
-            newStencil.stencil.push_back(cell);
             PetscFVCellGeom *cg;
             DMPlexPointLocalRead(dmCell, cell, cellGeomArray, &cg) >> utilities::PetscUtilities::checkError;
 
+            op.vertexColumns.push_back(cell);
             for (PetscInt d = 0; d < dim; ++d) {
-                // add up distance of cell centers to the vertex and store
-                newStencil.gradientWeights[d] += abs(cg->centroid[d] - xyz[d] + utilities::Constants::tiny);
+                // front cells have positive and back cells have negative contribution to the vertex normal
+                op.vertexWeights.push_back(cg->centroid[d] > xyz[d] ? 1.0 : (cg->centroid[d] < xyz[d] ? -1.0 : 0.0));
+                gradientWeights[d] += PetscAbsReal(cg->centroid[d] - xyz[d] + utilities::Constants::tiny);
             }
-            newStencil.stencilSize += 1;
         }
         DMPlexRestoreTransitiveClosure(dm, v, PETSC_FALSE, &numStar, &star) >> utilities::PetscUtilities::checkError;
-        // store the stencils of this vertex
-        vertexStencils.push_back(std::move(newStencil));
+
+        // scale by the summed distances of the connected cells
+        for (std::size_t e = rowStart; e < op.vertexColumns.size(); ++e) {
+            for (PetscInt d = 0; d < dim; ++d) {
+                op.vertexWeights[e * dim + d] /= gradientWeights[d];
+            }
+        }
+        op.vertexOffsets.push_back((PetscInt)op.vertexColumns.size());
+    }
+
+    // march over cells
+    op.cellOffsets.reserve(cEnd - cStart + 1);
+    op.cellOffsets.push_back(0);
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        PetscFVCellGeom *fcg;
+        DMPlexPointLocalRead(dmCell, c, cellGeomArray, &fcg) >> utilities::PetscUtilities::checkError;
+
+        // extract connected vertices to the cell
+        PetscInt *closure = nullptr;
+        PetscInt numClosure;
+        DMPlexGetTransitiveClosure(dm, c, PETSC_TRUE, &numClosure, &closure) >> utilities::PetscUtilities::checkError;
+        const std::size_t rowStart = op.cellColumns.size();
+        PetscReal distance[3] = {0, 0, 0};
+        for (PetscInt cl = 0; cl < numClosure * 2; cl += 2) {
+            const PetscInt vertex = closure[cl];
+            if (vertex < vStart || vertex >= vEnd) continue;
+            PetscInt off;
+            PetscSectionGetOffset(coordsSection, vertex, &off) >> utilities::PetscUtilities::checkError;
+            const PetscScalar *xyz = coordsArray + off;
+
+            op.cellColumns.push_back(vertex - vStart);
+            for (PetscInt d = 0; d < dim; ++d) {
+                // vertices in front of the cell center are positive and behind are negative
+                op.cellWeights.push_back(fcg->centroid[d] < xyz[d] ? 1.0 : (fcg->centroid[d] > xyz[d] ? -1.0 : 0.0));
+                distance[d] += PetscAbsReal(xyz[d] - fcg->centroid[d] + utilities::Constants::tiny);
+            }
+        }
+        DMPlexRestoreTransitiveClosure(dm, c, PETSC_TRUE, &numClosure, &closure) >> utilities::PetscUtilities::checkError;
+
+        // scale by the summed distances of the vertices
+        for (std::size_t e = rowStart; e < op.cellColumns.size(); ++e) {
+            for (PetscInt d = 0; d < dim; ++d) {
+                op.cellWeights[e * dim + d] /= distance[d];
+            }
+        }
+        op.cellOffsets.push_back((PetscInt)op.cellColumns.size());
     }
     VecRestoreArrayRead(cellGeomVec, &cellGeomArray) >> utilities::PetscUtilities::checkError;
     VecRestoreArray(localCoordsVector, &coordsArray) >> utilities::PetscUtilities::checkError;
 
+    vertexNormals.assign((vEnd - vStart) * dim, 0.0);
+    vertexNormalMagnitudes.assign(vEnd - vStart, 0.0);
+    volumeFractionOffsets.clear();
+
     flow.RegisterRHSFunction(ComputeSource, this);
 }
 
+void ablate::finiteVolume::processes::SurfaceForce::Initialize(ablate::finiteVolume::FiniteVolumeSolver &flow) {
+    if (narrowBandLevels <= 0) {
+        return;
+    }
+
+    // the band reports the cells without ghosts but uses every local cell to find the interface across partition and ghost boundaries
+    ablate::domain::Range cellRange;
+    flow.GetCellRangeWithoutGhost(cellRange);
+    narrowBand = std::make_unique<ablate::levelSet::NarrowBand>(flow.GetSubDomain().GetDM(), cellRange, narrowBandLevels, narrowBandRebuildInterval);
+    narrowBandBuilt = false;
+    flow.RestoreRange(cellRange);
+}
+
+void ablate::finiteVolume::processes::SurfaceForce::UpdateNarrowBand(const PetscScalar *solArray) {
+    std::vector<PetscInt> neighborCells;
+    auto isInterfaceCell = [&](PetscInt cell) {
+        const PetscInt alphaOffset = volumeFractionOffsets[cell - curvatureOperator.cStart];
+        if (alphaOffset < 0) {
+            return false;
+        }
+        const PetscReal alpha = solArray[alphaOffset];
+        if (alpha > utilities::Constants::small && alpha < 1.0 - utilities::Constants::small) {
+            return true;
+        }
+        narrowBand->GetNeighbors(cell, neighborCells);
+        for (const auto neighbor : neighborCells) {
+            const PetscInt neighborOffset = volumeFractionOffsets[neighbor - curvatureOperator.cStart];
+            if (neighborOffset >= 0 && PetscAbsReal(solArray[neighborOffset] - alpha) > utilities::Constants::small) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    if (narrowBandBuilt) {
+        narrowBand->Update(isInterfaceCell);
+    } else {
+        narrowBand->Rebuild(isInterfaceCell);
+        narrowBandBuilt = true;
+    }
+}
+
+void ablate::finiteVolume::processes::SurfaceForce::SetVolumeFractionOffsets(DM dm, PetscInt volumeFractionId, const PetscScalar *solArray) {
+    const auto numberCells = (PetscInt)curvatureOperator.cellOffsets.size() - 1;
+    volumeFractionOffsets.assign(numberCells, -1);
+    for (PetscInt c = 0; c < numberCells; ++c) {
+        const PetscScalar *alpha = nullptr;
+        DMPlexPointLocalFieldRead(dm, c + curvatureOperator.cStart, volumeFractionId, solArray, &alpha) >> utilities::PetscUtilities::checkError;
+        if (alpha) {
+            volumeFractionOffsets[c] = (PetscInt)(alpha - solArray);
+        }
+    }
+}
+
 PetscErrorCode ablate::finiteVolume::processes::SurfaceForce::ComputeSource(const FiniteVolumeSolver &solver, DM dm, PetscReal time, Vec locX, Vec locFVec, void *ctx) {
     PetscFunctionBegin;
 
-    /** Now use the stored vertex information to calculate curvature at each cell center
-     * march over the stored vortices to read the alpha values of connected cells
-     * calculate the normal at each vertex using alpha values of it's cells
-     * march over cells in the domain
-     * extract connected vortices to each cell using "closure" and read the saved normals of vortices
-     * calculate the normal at the cell center
+    /** Use the assembled operators to calculate curvature at each cell center
+     * calculate the normal at each vertex from the alpha values of it's cells
+     * calculate the normal at each cell center as the average of the vertex normals
      * calculate the gradient of magnitude of vertex normals and divergent of normals at the cell center
      * use the computed values to calculate the curvature at the center
      **/
 
     auto process = (ablate::finiteVolume::processes::SurfaceForce *)ctx;
-    auto fields = solver.GetSubDomain().GetFields();
+    const auto &op = process->curvatureOperator;
 
     // Look for the euler field and volume fraction (alpha)
     const auto &eulerField = solver.GetSubDomain().GetField(ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD);
@@ -125,176 +207,101 @@ PetscErrorCode ablate::finiteVolume::processes::SurfaceForce::ComputeSource(cons
     const PetscScalar *solArray;
     VecGetArrayRead(locX, &solArray) >> utilities::PetscUtilities::checkError;
 
-    // Get the cell geometry
-    Vec cellGeomVec;
-    DM dmCell;
-    const PetscScalar *cellGeomArray;
-    DMPlexGetGeometryFVM(dm, nullptr, &cellGeomVec, nullptr) >> utilities::PetscUtilities::checkError;
-    VecGetDM(cellGeomVec, &dmCell) >> utilities::PetscUtilities::checkError;
-    VecGetArrayRead(cellGeomVec, &cellGeomArray) >> utilities::PetscUtilities::checkError;
-
-    // get the coordinate domain
-    DM cdm;
-    DMGetCoordinateDM(dm, &cdm) >> utilities::PetscUtilities::checkError;
-    // create a domain to get a local vector to save normals
-    Vec localVec;
-    DMGetLocalVector(process->dmData, &localVec) >> utilities::PetscUtilities::checkError;
-    PetscScalar *normalArray = NULL;
-    VecGetArray(localVec, &normalArray);
-    PetscScalar *vertexNormal;
-    // extract the local coordinates array
-    Vec localCoordsVector;
-    PetscSection coordsSection;
-    PetscScalar *coordsArray = NULL;
-    DMGetCoordinateSection(dm, &coordsSection) >> utilities::PetscUtilities::checkError;
-    DMGetCoordinatesLocal(dm, &localCoordsVector) >> utilities::PetscUtilities::checkError;
-    VecGetArray(localCoordsVector, &coordsArray) >> utilities::PetscUtilities::checkError;
+    // the location of alpha in the solution only depends upon the section, so it is found once
+    if (process->volumeFractionOffsets.empty()) {
+        process->SetVolumeFractionOffsets(dm, VFfield.id, solArray);
+    }
+    const auto &alphaOffsets = process->volumeFractionOffsets;
 
-    // march over the stored vortices
-    for (const auto &info : process->vertexStencils) {
-        PetscReal totalAlpha[3] = {0, 0, 0};
-        // march over the connected cells to each vertex and get the cell info and filed value
-        for (PetscInt p = 0; p < info.stencilSize; p++) {
-            PetscFVCellGeom *cg = nullptr;
-            DMPlexPointLocalRead(dmCell, info.stencil[p], cellGeomArray, &cg) >> utilities::PetscUtilities::checkError;
-
-            const PetscScalar *alpha = nullptr;
-            DMPlexPointLocalFieldRead(dm, info.stencil[p], VFfield.id, solArray, &alpha) >> utilities::PetscUtilities::checkError;
-
-            // add up the contribution of the cell. Front cells have positive and back cells have negative contribution to the vertex normal
-            PetscReal alphaVal[3];
-            if (alpha) {
-                for (PetscInt d = 0; d < dim; ++d) {
-                    if (cg->centroid[d] > info.stencilCoord[d]) {
-                        alphaVal[d] = alpha[0];
-
-                    } else if (cg->centroid[d] < info.stencilCoord[d]) {
-                        alphaVal[d] = -alpha[0];
-                    }
-                    totalAlpha[d] += alphaVal[d];
-                }
-            }
-        }
-        // calculate and save the normal of the vertex
-        DMPlexPointLocalRef(cdm, info.vertexId, normalArray, &vertexNormal) >> utilities::PetscUtilities::checkError;
+    // when using a narrow band only the cells near the interface, and their vertices, are computed
+    const auto &narrowBand = process->narrowBand;
+    if (narrowBand) {
+        process->UpdateNarrowBand(solArray);
+    }
+    const auto numberVertices = narrowBand ? (PetscInt)narrowBand->GetVertices().size() : (PetscInt)op.vertexOffsets.size() - 1;
+    const auto numberCells = narrowBand ? (PetscInt)narrowBand->GetCells().size() : cellRange.end - cellRange.start;
+
+    // compute the normal at each vertex
+    auto &vertexNormals = process->vertexNormals;
+    auto &vertexNormalMagnitudes = process->vertexNormalMagnitudes;
+    for (PetscInt n = 0; n < numberVertices; ++n) {
+        const PetscInt v = narrowBand ? narrowBand->GetVertices()[n] - op.vStart : n;
+        PetscReal *vertexNormal = vertexNormals.data() + v * dim;
         for (PetscInt d = 0; d < dim; ++d) {
-            vertexNormal[d] = totalAlpha[d] / info.gradientWeights[d];
+            vertexNormal[d] = 0.0;
         }
+        for (PetscInt e = op.vertexOffsets[v]; e < op.vertexOffsets[v + 1]; ++e) {
+            const PetscInt alphaOffset = alphaOffsets[op.vertexColumns[e] - op.cStart];
+            if (alphaOffset < 0) continue;
+            const PetscReal alpha = solArray[alphaOffset];
+            for (PetscInt d = 0; d < dim; ++d) {
+                vertexNormal[d] += op.vertexWeights[e * dim + d] * alpha;
+            }
+        }
+        vertexNormalMagnitudes[v] = utilities::MathUtilities::MagVector(dim, vertexNormal);
     }
+
     // march over cells
-    for (PetscInt i = cellRange.start; i < cellRange.end; ++i) {
-        const PetscInt c = cellRange.points ? cellRange.points[i] : i;
+    for (PetscInt n = 0; n < numberCells; ++n) {
+        const PetscInt c = narrowBand ? narrowBand->GetCells()[n] : cellRange.GetPoint(cellRange.start + n);
         // get current euler solution here to get velocity
         const PetscScalar *euler = nullptr;
         DMPlexPointLocalFieldRead(dm, c, eulerField.id, solArray, &euler) >> utilities::PetscUtilities::checkError;
         auto density = euler[ablate::finiteVolume::CompressibleFlowFields::RHO];
 
-        PetscScalar vel[dim];
-        for (PetscInt d = 0; d < dim; d++) {
-            vel[d] = euler[ablate::finiteVolume::CompressibleFlowFields::RHOU + d] / density;
-        }
-
         // add calculated sources to euler
         PetscScalar *eulerSource = nullptr;
         DMPlexPointLocalFieldRef(dm, c, eulerField.id, fArray, &eulerSource) >> utilities::PetscUtilities::checkError;
 
-        PetscReal surfaceEnergy = 0;
-        PetscReal totalGradMagNormal = 0;
-        PetscReal divergentNormal[3] = {0, 0, 0};
-        PetscReal grad[3] = {0, 0, 0};
-        PetscReal gradMagNormal[dim];
-        PetscReal curvature;
-        PetscScalar surfaceForce[dim];
-
-        // get the centroid information for the cell
-        PetscFVCellGeom *fcg;
-        DMPlexPointLocalRead(dmCell, c, cellGeomArray, &fcg) >> utilities::PetscUtilities::checkError;
-
-        // extract connected vortices to the cell
-        PetscInt *closure = NULL;
-        PetscInt numClosure;
-        DMPlexGetTransitiveClosure(dm, c, PETSC_TRUE, &numClosure, &closure) >> utilities::PetscUtilities::checkError;
-        PetscInt cl, numVertex = 0;
-
-        PetscReal centerNormal[3] = {0, 0, 0};
-        PetscReal gradNormal[dim];
-        PetscReal cellCenterNormal[dim];
+        // apply the cell operator to the vertex normals --> Delta.ni,j=  [nx(i+1/2,j+1/2)-nx(i-1/2,j+1/2)+nx(i+1/2,j-1/2)-nx(i-1/2,j-1/2)]/2*deltaX +
+        // [ny(i+1/2,j+1/2)-ny(i+1/2,j-1/2)+ny(i-1/2,j+1/2)-ny(i-1/2,j-1/2)]/2*deltaY
+        const PetscInt row = c - op.cStart;
         PetscReal totalDivNormal = 0;
-        PetscInt vStart, vEnd;
-        DMPlexGetDepthStratum(dm, 0, &vStart, &vEnd) >> utilities::PetscUtilities::checkError;
-        PetscReal distance[3] = {0, 0, 0};
-        PetscReal xyz[3];
-        PetscInt offset;
-
-        for (cl = 0; cl < numClosure * 2; cl += 2) {
-            PetscInt vertex = closure[cl];
-
-            if (vertex < vStart || vertex >= vEnd) continue;
-            // sum up the number of connected vortices
-            numVertex += 1;
-            PetscSectionGetOffset(coordsSection, vertex, &offset) >> utilities::PetscUtilities::checkError;
-
+        PetscReal gradNormal[3] = {0, 0, 0};
+        PetscReal cellCenterNormal[3] = {0, 0, 0};
+        for (PetscInt e = op.cellOffsets[row]; e < op.cellOffsets[row + 1]; ++e) {
+            const PetscInt v = op.cellColumns[e];
+            const PetscReal *vertexNormal = vertexNormals.data() + v * dim;
             for (PetscInt d = 0; d < dim; ++d) {
-                // extract coordinates of vortices of this cell and calculate the distance to the center
-                DMPlexPointLocalRead(cdm, vertex, normalArray, &vertexNormal) >> utilities::PetscUtilities::checkError;
-                xyz[d] = coordsArray[offset + d];
-
-                // calculate normal at each cell center using normals of connected vortices to the cell
-                centerNormal[d] += vertexNormal[d];
-
-                // calculate divergence of normal for each cell center using vertex normals --> Delta.ni,j=  [nx(i+1/2,j+1/2)-nx(i-1/2,j+1/2)+nx(i+1/2,j-1/2)-nx(i-1/2,j-1/2)]/2*deltaX +
-                // [ny(i+1/2,j+1/2)-ny(i+1/2,j-1/2)+ny(i-1/2,j+1/2)-ny(i-1/2,j-1/2)]/2*deltaY
-                // get magnitude of normals at vortices to calculate the derivative of the magnitude of normals at the cell center
-                distance[d] += abs(xyz[d] - fcg->centroid[d] + utilities::Constants::tiny);
-                const PetscReal magVertexNormal = utilities::MathUtilities::MagVector(dim, vertexNormal);
-                if (fcg->centroid[d] < xyz[d]) {
-                    divergentNormal[d] += vertexNormal[d];
-                    grad[d] += magVertexNormal;
-
-                } else if (fcg->centroid[d] > xyz[d]) {
-                    divergentNormal[d] -= vertexNormal[d];
-                    grad[d] -= magVertexNormal;
-                }
+                totalDivNormal += op.cellWeights[e * dim + d] * vertexNormal[d];
+                gradNormal[d] += op.cellWeights[e * dim + d] * vertexNormalMagnitudes[v];
+                cellCenterNormal[d] += vertexNormal[d];
             }
         }
+        const PetscInt numVertex = op.cellOffsets[row + 1] - op.cellOffsets[row];
         for (PetscInt d = 0; d < dim; ++d) {
-            totalDivNormal += divergentNormal[d] / distance[d];
-            gradNormal[d] = grad[d] / distance[d];
-            cellCenterNormal[d] = centerNormal[d] / numVertex;
+            cellCenterNormal[d] /= numVertex;
         }
+
         // magnitude of normal at the center
         const PetscReal magCellNormal = utilities::MathUtilities::MagVector(dim, cellCenterNormal);
+        PetscReal totalGradMagNormal = 0;
         for (PetscInt d = 0; d < dim; ++d) {
             // (ni,j/ |ni,j| . Delta)
-            gradMagNormal[d] = (cellCenterNormal[d] / (magCellNormal + utilities::Constants::tiny)) * gradNormal[d];
-            totalGradMagNormal += gradMagNormal[d];
+            totalGradMagNormal += (cellCenterNormal[d] / (magCellNormal + utilities::Constants::tiny)) * gradNormal[d];
         }
         // calculate curvature -->  kappa = 1/n [(n/|n|. Delta) |n| - (Delta.n)]
-        curvature = (totalGradMagNormal - totalDivNormal) / (magCellNormal + utilities::Constants::tiny);
+        const PetscReal curvature = (totalGradMagNormal - totalDivNormal) / (magCellNormal + utilities::Constants::tiny);
 
+        PetscReal surfaceEnergy = 0;
         for (PetscInt d = 0; d < dim; ++d) {
             // calculate surface force and energy
-            surfaceForce[d] = process->sigma * curvature * cellCenterNormal[d];
-            surfaceEnergy += surfaceForce[d] * vel[d];
+            const PetscScalar surfaceForce = process->sigma * curvature * cellCenterNormal[d];
+            surfaceEnergy += surfaceForce * euler[ablate::finiteVolume::CompressibleFlowFields::RHOU + d] / density;
             // add in the contributions
-            eulerSource[ablate::finiteVolume::CompressibleFlowFields::RHOU + d] = surfaceForce[d];
+            eulerSource[ablate::finiteVolume::CompressibleFlowFields::RHOU + d] = surfaceForce;
             eulerSource[ablate::finiteVolume::CompressibleFlowFields::RHOE] = surfaceEnergy;
         }
-        DMPlexRestoreTransitiveClosure(dm, c, PETSC_TRUE, &numClosure, &closure) >> utilities::PetscUtilities::checkError;
     }
     // cleanup
     solver.RestoreRange(cellRange);
-    VecRestoreArrayRead(cellGeomVec, &cellGeomArray) >> utilities::PetscUtilities::checkError;
     VecRestoreArray(locFVec, &fArray) >> utilities::PetscUtilities::checkError;
-    VecRestoreArray(localCoordsVector, &coordsArray) >> utilities::PetscUtilities::checkError;
     VecRestoreArrayRead(locX, &solArray) >> utilities::PetscUtilities::checkError;
-    VecRestoreArray(localVec, &normalArray);
-    DMRestoreLocalVector(process->dmData, &localVec);
 
     PetscFunctionReturn(0);
 }
 
-ablate::finiteVolume::processes::SurfaceForce::~SurfaceForce() { DMDestroy(&dmData); }
-
 REGISTER(ablate::finiteVolume::processes::Process, ablate::finiteVolume::processes::SurfaceForce, "calculates surface tension force and adds source terms",
-         ARG(PetscReal, "sigma", "sigma, surface tension coefficient"));
+         ARG(PetscReal, "sigma", "sigma, surface tension coefficient"),
+         OPT(int, "narrowBand", "the number of cell layers around the interface to compute the surface force (default is 0, the entire domain)"),
+         OPT(int, "narrowBandRebuildInterval", "the number of evaluations between full rebuilds of the narrow band (default is 0, the band is only updated near the interface)"));
@@ -7,6 +7,7 @@
 #include "domain/range.hpp"
 #include "finiteVolume/fluxCalculator/fluxCalculator.hpp"
 #include "flowProcess.hpp"
+#include "levelSet/narrowBand.hpp"
 #include "process.hpp"
 #include "solver/solver.hpp"
 #include "twoPhaseEulerAdvection.hpp"
@@ -18,35 +19,73 @@ class SurfaceForce : public Process {
 
    private:
     /**
-     * struct to hold the vortex stencil
+     * The surface tension operators assembled once from the mesh geometry in compressed row format.  Each row holds dim weights per entry, so
+     * the normals and curvature for the whole field are a few sparse products per evaluation.
      */
-    struct VertexStencil {
-        /** The points in the stencil*/
-        std::vector<PetscInt> stencil;
-        /** The size of stencil*/
-        PetscInt stencilSize;
-        /** The point*/
-        PetscInt vertexId;
-        /** The weights */
-        std::vector<PetscScalar> gradientWeights;
-        /** Coordinate of the vertex */
-        std::vector<PetscScalar> stencilCoord;
+    struct CurvatureOperator {
+        //! the first cell and vertex point in the dm
+        PetscInt cStart, vStart;
+        //! vertex normal rows (v - vStart), the columns are cell points and the weights are +/-1 over the summed cell distance in each direction
+        std::vector<PetscInt> vertexOffsets;
+        std::vector<PetscInt> vertexColumns;
+        std::vector<PetscReal> vertexWeights;
+        //! cell rows (c - cStart), the columns are vertex indices (v - vStart) and the weights are +/-1 over the summed vertex distance in each direction
+        std::vector<PetscInt> cellOffsets;
+        std::vector<PetscInt> cellColumns;
+        std::vector<PetscReal> cellWeights;
     };
-    DM dmData;
+    CurvatureOperator curvatureOperator;
 
-   public:
-    // Hold a list of VortexStencils
-    std::vector<VertexStencil> vertexStencils;
+    //! the location of the volume fraction in the local solution array for each cell (c - cStart), -1 if not defined.  Computed on the first evaluation
+    std::vector<PetscInt> volumeFractionOffsets;
+
+    //! the normal and normal magnitude at each vertex (v - vStart), stored between evaluations to avoid reallocation
+    std::vector<PetscReal> vertexNormals;
+    std::vector<PetscReal> vertexNormalMagnitudes;
+
+    //! the number of cell layers around the interface to compute the surface force, 0 computes the force everywhere
+    const PetscInt narrowBandLevels;
+
+    //! the number of evaluations between full rebuilds of the narrow band, 0 never rebuilds the band after the first evaluation
+    const PetscInt narrowBandRebuildInterval;
+
+    //! the cells and vertices near the interface, only used when narrowBandLevels > 0
+    std::unique_ptr<ablate::levelSet::NarrowBand> narrowBand;
+
+    //! the band is built by checking every cell on the first evaluation and updated afterwards
+    bool narrowBandBuilt = false;
+
+    /**
+     * Store the location of the volume fraction in the local solution array for each cell
+     */
+    void SetVolumeFractionOffsets(DM dm, PetscInt volumeFractionId, const PetscScalar *solArray);
 
-    explicit SurfaceForce(PetscReal sigma);
+    /**
+     * Update the narrow band from the current volume fraction.  A cell contains the interface if it is mixed or if the volume fraction jumps across
+     * one of its neighbors.
+     */
+    void UpdateNarrowBand(const PetscScalar *solArray);
 
+   public:
     /**
-     * public function to link this process with the flow
-     * a@param flow
+     * @param sigma surface tension coefficient
+     * @param narrowBand the number of cell layers around the interface to compute the surface force, 0 (default) computes it everywhere
+     * @param narrowBandRebuildInterval the number of evaluations between full rebuilds of the narrow band, 0 (default) never rebuilds it
      */
-    ~SurfaceForce() override;
+    explicit SurfaceForce(PetscReal sigma, int narrowBand = 0, int narrowBandRebuildInterval = 0);
 
+    /**
+     * Assemble the vertex normal and curvature operators from the mesh geometry
+     * @param flow
+     */
     void Setup(ablate::finiteVolume::FiniteVolumeSolver &flow) override;
+
+    /**
+     * Build the narrow band connectivity for the local cells
+     * @param flow
+     */
+    void Initialize(ablate::finiteVolume::FiniteVolumeSolver &flow) override;
+
     /**
      * static function private function to compute surface force and add source to eulerset
      * @param solver
@@ -27,172 +27,6 @@ static inline PetscReal MagVector(PetscInt dim, const PetscReal *in) {
     return PetscSqrtReal(mag);
 }
 
-PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::FormFunctionGas(SNES snes, Vec x, Vec F, void *ctx) {
-    auto decodeDataStruct = (DecodeDataStructGas *)ctx;
-    const PetscReal *ax;
-    PetscReal *aF;
-    VecGetArrayRead(x, &ax);
-    // ax = [rhog, rhol, eg, el]
-    PetscReal rhoG = ax[0];
-    PetscReal rhoL = ax[1];
-    PetscReal eG = ax[2];
-    PetscReal eL = ax[3];
-
-    PetscReal gamma1 = decodeDataStruct->gam1;
-    PetscReal gamma2 = decodeDataStruct->gam2;
-    PetscReal Y1 = decodeDataStruct->Yg;
-    PetscReal Y2 = decodeDataStruct->Yl;
-    PetscReal rho = decodeDataStruct->rhotot;
-    PetscReal e = decodeDataStruct->etot;
-    PetscReal cv1 = decodeDataStruct->cvg;
-    PetscReal cp2 = decodeDataStruct->cpl;
-    PetscReal p02 = decodeDataStruct->p0l;
-
-    VecGetArray(F, &aF);
-    aF[0] = (gamma1 - 1) * eG * rhoG - (gamma2 - 1) * eL * rhoL + gamma2 * p02;  // pG - pL = 0, pressure equilibrium
-    // aF[0] = (gamma1 - 1) * eG * rhoG - (gamma2 - 1) * eL * rhoL + gamma2 * p02 + 1;  // pG - pL + sigma*kappa = 0, manual set sigmaKappa=1
-    aF[1] = eG * rhoL / cv1 - gamma2 / cp2 * (eL * rhoL - p02);  // TG - TL = 0, temperature equilibrium
-    aF[2] = Y1 * rho * rhoL + Y2 * rho * rhoG - rhoG * rhoL;
-    aF[3] = Y1 * eG + Y2 * eL - e;
-
-    VecRestoreArrayRead(x, &ax);
-    VecRestoreArray(F, &aF);
-    return 0;
-}
-
-PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::FormJacobianGas(SNES snes, Vec x, Mat J, Mat P, void *ctx) {
-    auto decodeDataStruct = (DecodeDataStructGas *)ctx;
-    const PetscReal *ax;
-    PetscReal v[16];
-    PetscInt row[4] = {0, 1, 2, 3}, col[4] = {0, 1, 2, 3};
-    VecGetArrayRead(x, &ax);
-    // ax = [rhog, rhol, eg, el]
-    PetscReal rhoG = ax[0];
-    PetscReal rhoL = ax[1];
-    PetscReal eG = ax[2];
-    PetscReal eL = ax[3];
-
-    PetscReal gamma1 = decodeDataStruct->gam1;
-    PetscReal gamma2 = decodeDataStruct->gam2;
-    PetscReal Y1 = decodeDataStruct->Yg;
-    PetscReal Y2 = decodeDataStruct->Yl;
-    PetscReal rho = decodeDataStruct->rhotot;
-    //    PetscReal e = decodeDataStruct->etot;
-    PetscReal cv1 = decodeDataStruct->cvg;
-    PetscReal cp2 = decodeDataStruct->cpl;
-    //    PetscReal p02 = decodeDataStruct->p0l;
-
-    v[0] = (gamma1 - 1) * eG;
-    v[1] = -(gamma2 - 1) * eL;
-    v[2] = (gamma1 - 1) * rhoG;
-    v[3] = -(gamma2 - 1) * rhoL;
-    v[4] = 0.0;
-    v[5] = eG / cv1 - gamma2 * eG / cp2;
-    v[6] = rhoL / cv1;
-    v[7] = -gamma2 * rhoL / cp2;
-    v[8] = Y2 * rho - rhoL;
-    v[9] = Y1 * rho - rhoG;
-    v[10] = 0.0;
-    v[11] = 0.0;
-    v[12] = 0.0;
-    v[13] = 0.0;
-    v[14] = Y1;
-    v[15] = Y2;
-    VecRestoreArrayRead(x, &ax);
-    MatSetValues(P, 4, row, 4, col, v, INSERT_VALUES);
-    MatAssemblyBegin(P, MAT_FINAL_ASSEMBLY);
-    MatAssemblyEnd(P, MAT_FINAL_ASSEMBLY);
-    if (J != P) {
-        MatAssemblyBegin(J, MAT_FINAL_ASSEMBLY);
-        MatAssemblyEnd(J, MAT_FINAL_ASSEMBLY);
-    }
-    return 0;
-}
-
-PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::FormFunctionStiff(SNES snes, Vec x, Vec F, void *ctx) {
-    auto decodeDataStruct = (DecodeDataStructStiff *)ctx;
-    const PetscReal *ax;
-    PetscReal *aF;
-    VecGetArrayRead(x, &ax);
-    // ax = [rhog, rhol, eg, el]
-    PetscReal rhoG = ax[0];
-    PetscReal rhoL = ax[1];
-    PetscReal eG = ax[2];
-    PetscReal eL = ax[3];
-
-    PetscReal gamma1 = decodeDataStruct->gam1;
-    PetscReal gamma2 = decodeDataStruct->gam2;
-    PetscReal Y1 = decodeDataStruct->Yg;
-    PetscReal Y2 = decodeDataStruct->Yl;
-    PetscReal rho = decodeDataStruct->rhotot;
-    PetscReal e = decodeDataStruct->etot;
-    PetscReal cp1 = decodeDataStruct->cpg;
-    PetscReal cp2 = decodeDataStruct->cpl;
-    PetscReal p01 = decodeDataStruct->p0g;
-    PetscReal p02 = decodeDataStruct->p0l;
-
-    VecGetArray(F, &aF);
-    aF[0] = (gamma1 - 1) * eG * rhoG - gamma1 * p01 - (gamma2 - 1) * eL * rhoL + gamma2 * p02;  // pG - pL = 0, pressure equilibrium
-    aF[1] = gamma1 / cp1 * rhoL * (eG * rhoG - p01) - gamma2 / cp2 * rhoG * (eL * rhoL - p02);  // TG - TL = 0, temperature equilibrium
-    aF[2] = Y1 * rho * rhoL + Y2 * rho * rhoG - rhoG * rhoL;
-    aF[3] = Y1 * eG + Y2 * eL - e;
-
-    VecRestoreArrayRead(x, &ax);
-    VecRestoreArray(F, &aF);
-    return 0;
-}
-
-PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::FormJacobianStiff(SNES snes, Vec x, Mat J, Mat P, void *ctx) {
-    auto decodeDataStruct = (DecodeDataStructStiff *)ctx;
-    const PetscReal *ax;
-    PetscReal v[16];
-    PetscInt row[4] = {0, 1, 2, 3}, col[4] = {0, 1, 2, 3};
-    VecGetArrayRead(x, &ax);
-    // ax = [rhog, rhol, eg, el]
-    PetscReal rhoG = ax[0];
-    PetscReal rhoL = ax[1];
-    PetscReal eG = ax[2];
-    PetscReal eL = ax[3];
-
-    PetscReal gamma1 = decodeDataStruct->gam1;
-    PetscReal gamma2 = decodeDataStruct->gam2;
-    PetscReal Y1 = decodeDataStruct->Yg;
-    PetscReal Y2 = decodeDataStruct->Yl;
-    PetscReal rho = decodeDataStruct->rhotot;
-    //    PetscReal e = decodeDataStruct->etot;
-    PetscReal cp1 = decodeDataStruct->cpg;
-    PetscReal cp2 = decodeDataStruct->cpl;
-    PetscReal p01 = decodeDataStruct->p0g;
-    PetscReal p02 = decodeDataStruct->p0l;
-
-    // need to check Jacobian, not getting correct solution
-    v[0] = (gamma1 - 1) * eG;
-    v[1] = -(gamma2 - 1) * eL;
-    v[2] = (gamma1 - 1) * rhoG;
-    v[3] = -(gamma2 - 1) * rhoL;
-    v[4] = gamma1 / cp1 * eG * rhoL - gamma2 / cp2 * eL * rhoL + gamma2 / cp2 * p02;
-    v[5] = gamma1 / cp1 * eG * rhoG - gamma1 / cp1 * p01 - gamma2 / cp2 * eL * rhoG;
-    v[6] = gamma1 / cp1 * rhoG * rhoL;
-    v[7] = -gamma2 / cp2 * rhoG * rhoL;
-    v[8] = Y2 * rho - rhoL;
-    v[9] = Y1 * rho - rhoG;
-    v[10] = 0.0;
-    v[11] = 0.0;
-    v[12] = 0.0;
-    v[13] = 0.0;
-    v[14] = Y1;
-    v[15] = Y2;
-    VecRestoreArrayRead(x, &ax);
-    MatSetValues(P, 4, row, 4, col, v, INSERT_VALUES);
-    MatAssemblyBegin(P, MAT_FINAL_ASSEMBLY);
-    MatAssemblyEnd(P, MAT_FINAL_ASSEMBLY);
-    if (J != P) {
-        MatAssemblyBegin(J, MAT_FINAL_ASSEMBLY);
-        MatAssemblyEnd(J, MAT_FINAL_ASSEMBLY);
-    }
-    return 0;
-}
-
 ablate::finiteVolume::processes::TwoPhaseEulerAdvection::TwoPhaseEulerAdvection(std::shared_ptr<eos::EOS> eosTwoPhase, const std::shared_ptr<parameters::Parameters> &parametersIn,
                                                                                 std::shared_ptr<fluxCalculator::FluxCalculator> fluxCalculatorGasGas,
                                                                                 std::shared_ptr<fluxCalculator::FluxCalculator> fluxCalculatorGasLiquid,
@@ -234,7 +68,7 @@ void ablate::finiteVolume::processes::TwoPhaseEulerAdvection::Setup(ablate::fini
     // Currently, no option for species advection
     flow.RegisterRHSFunction(CompressibleFlowComputeEulerFlux, this, {CompressibleFlowFields::EULER_FIELD}, {VOLUME_FRACTION_FIELD, DENSITY_VF_FIELD, CompressibleFlowFields::EULER_FIELD}, {});
     flow.RegisterRHSFunction(CompressibleFlowComputeVFFlux, this, {DENSITY_VF_FIELD}, {VOLUME_FRACTION_FIELD, DENSITY_VF_FIELD, CompressibleFlowFields::EULER_FIELD}, {});
-    flow.RegisterComputeTimeStepFunction(ComputeCflTimeStep, &timeStepData, "cfl");
+    flow.RegisterComputeTimeStepFunction(ComputeCflTimeStep, &timeStepData, "cfl", {CompressibleFlowFields::EULER_FIELD});
     timeStepData.computeSpeedOfSound = eosTwoPhase->GetThermodynamicFunction(eos::ThermodynamicProperty::SpeedOfSound, flow.GetSubDomain().GetFields());
 
     // check to see if auxFieldUpdates needed to be added
@@ -317,66 +151,25 @@ PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::Multipha
     PetscFunctionReturn(0);
 }
 
-double ablate::finiteVolume::processes::TwoPhaseEulerAdvection::ComputeCflTimeStep(TS ts, ablate::finiteVolume::FiniteVolumeSolver &flow, void *ctx) {
-    // Get the dm and current solution vector
-    DM dm;
-    TSGetDM(ts, &dm) >> utilities::PetscUtilities::checkError;
-    Vec v;
-    TSGetSolution(ts, &v) >> utilities::PetscUtilities::checkError;
-
+PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::ComputeCflTimeStep(const FiniteVolumeSolver::CellTimeStepState &state, const PetscInt uOff[], const PetscInt aOff[],
+                                                                                           PetscReal *dt, void *ctx) {
+    PetscFunctionBeginUser;
     // Get the flow param
     auto timeStepData = (TimeStepData *)ctx;
 
-    // Get the fv geom
-    PetscReal minCellRadius;
-    DMPlexGetGeometryFVM(dm, NULL, NULL, &minCellRadius) >> utilities::PetscUtilities::checkError;
-
-    // Get the valid cell range over this region
-    ablate::domain::Range cellRange;
-    flow.GetCellRange(cellRange);
-
-    const PetscScalar *x;
-    VecGetArrayRead(v, &x) >> utilities::PetscUtilities::checkError;
-
-    // Get the dim from the dm
-    PetscInt dim;
-    DMGetDimension(dm, &dim) >> utilities::PetscUtilities::checkError;
-
-    // assume the smallest cell is the limiting factor for now
-    const PetscReal dx = 2.0 * minCellRadius;
-
-    // Get field location for euler and densityYi
-    auto eulerId = flow.GetSubDomain().GetField(ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD).id;
-
-    // March over each cell
-    PetscReal dtMin = 1000.0;
-    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
-        PetscInt cell = cellRange.points ? cellRange.points[c] : c;
+    const PetscReal dx = 2.0 * state.minCellRadius;
 
-        const PetscReal *euler;
-        const PetscReal *conserved = NULL;
-        DMPlexPointGlobalFieldRead(dm, cell, eulerId, x, &euler) >> utilities::PetscUtilities::checkError;
-        DMPlexPointGlobalRead(dm, cell, x, &conserved) >> utilities::PetscUtilities::checkError;
-
-        if (euler) {  // must be real cell and not ghost
-            PetscReal rho = euler[CompressibleFlowFields::RHO];
-
-            // Get the speed of sound from the eos
-            PetscReal a;
-            timeStepData->computeSpeedOfSound.function(conserved, &a, timeStepData->computeSpeedOfSound.context.get()) >> utilities::PetscUtilities::checkError;
-
-            PetscReal velSum = 0.0;
-            for (PetscInt d = 0; d < dim; d++) {
-                velSum += PetscAbsReal(euler[CompressibleFlowFields::RHOU + d]) / rho;
-            }
-            PetscReal dt = timeStepData->cfl * dx / (a + velSum);
+    // Get the speed of sound from the eos
+    PetscReal a;
+    PetscCall(timeStepData->computeSpeedOfSound.function(state.conserved, &a, timeStepData->computeSpeedOfSound.context.get()));
 
-            dtMin = PetscMin(dtMin, dt);
-        }
+    PetscReal velSum = 0.0;
+    for (PetscInt d = 0; d < state.dim; d++) {
+        velSum += PetscAbsReal(state.velocity[d]);
     }
-    VecRestoreArrayRead(v, &x) >> utilities::PetscUtilities::checkError;
-    flow.RestoreRange(cellRange);
-    return dtMin;
+    *dt = timeStepData->cfl * dx / (a + velSum);
+
+    PetscFunctionReturn(0);
 }
 
 PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::CompressibleFlowComputeEulerFlux(PetscInt dim, const PetscFVFaceGeom *fg, const PetscInt *uOff, const PetscScalar *fieldL,
@@ -1198,50 +991,41 @@ void ablate::finiteVolume::processes::TwoPhaseEulerAdvection::StiffenedGasStiffe
     PetscReal gamma1 = eosGas->GetSpecificHeatRatio();
     PetscReal gamma2 = eosLiquid->GetSpecificHeatRatio();
 
-    SNES snes;
-    Vec x, r;
-    Mat J;
-    VecCreate(PETSC_COMM_SELF, &x);
-    VecSetSizes(x, PETSC_DECIDE, 4);
-    VecSetFromOptions(x);
-    VecSet(x, (*density));  // set initial guess to conserved density, [rho1, rho2, e1, e2] = [rho, rho, rho, rho]
-    VecDuplicate(x, &r);
-
-    MatCreate(PETSC_COMM_SELF, &J);
-    MatSetSizes(J, PETSC_DECIDE, PETSC_DECIDE, 4, 4);
-    MatSetFromOptions(J);
-    MatSetUp(J);
-
-    SNESCreate(PETSC_COMM_SELF, &snes);
-    DecodeDataStructStiff decodeDataStruct{
-        .etot = (*internalEnergy),
-        .rhotot = (*density),
-        .Yg = densityVF / (*density),
-        .Yl = ((*density) - densityVF) / (*density),
-        .gam1 = gamma1,
-        .gam2 = gamma2,
-        .cpg = cp1,
-        .cpl = cp2,
-        .p0g = p01,
-        .p0l = p02,
-    };
-    SNESSetFunction(snes, r, FormFunctionStiff, &decodeDataStruct);
-    SNESSetJacobian(snes, J, J, FormJacobianStiff, &decodeDataStruct);
-    SNESSetTolerances(snes, 1E-8, 1E-12, 1E-8, 100, 1000);  // refine relative tolerance for more accurate pressure value
-    SNESSetFromOptions(snes);
-    SNESSolve(snes, NULL, x);
-
-    const PetscScalar *ax;
-    VecGetArrayRead(x, &ax);
-    PetscReal rhoG = ax[0];
-    PetscReal rhoL = ax[1];
-    PetscReal eG = ax[2];
-    PetscReal eL = ax[3];
-
-    SNESDestroy(&snes);
-    VecDestroy(&x);
-    VecDestroy(&r);
-    MatDestroy(&J);
+    // The pressure/temperature equilibrium has a closed form solution.  For each phase k with cvk = cpk/gammak
+    //   1/rhok = (gammak - 1) cvk T / (p + p0k),   ek = cvk T (p + gammak p0k) / (p + p0k)
+    // so the mixture constraints, Yg/rhoG + Yl/rhoL = 1/rho and Yg eG + Yl eL = e, become
+    //   T S = 1/rho and (rho e + p) S = A + B,  with S = a1/(p + p01) + a2/(p + p02), ak = Yk (gammak - 1) cvk, A = a1 + a2, B = Yg cv1 + Yl cv2
+    // which is a quadratic in p.  The physical root is the larger root, where p + p0k > 0 for both phases.
+    PetscReal Yg = densityVF / (*density);
+    PetscReal Yl = ((*density) - densityVF) / (*density);
+    PetscReal cv1 = cp1 / gamma1;
+    PetscReal cv2 = cp2 / gamma2;
+    PetscReal a1k = Yg * (gamma1 - 1) * cv1;
+    PetscReal a2k = Yl * (gamma2 - 1) * cv2;
+    PetscReal A = a1k + a2k;
+    PetscReal B = Yg * cv1 + Yl * cv2;
+    PetscReal rhoE = (*density) * (*internalEnergy);
+
+    PetscReal a = B;
+    PetscReal b = (A + B) * (p01 + p02) - a1k * p02 - a2k * p01 - rhoE * A;
+    PetscReal c = (A + B) * p01 * p02 - rhoE * (a1k * p02 + a2k * p01);
+    PetscReal discriminant = PetscSqr(b) - 4 * a * c;
+    if (discriminant < 0) {
+        throw std::invalid_argument("ablate::finiteVolume::twoPhaseEulerAdvection StiffenedGas/StiffenedGas DecodeState cannot find an equilibrium pressure");
+    }
+    // avoid cancellation when computing the larger root
+    PetscReal pEq = b <= 0 ? (-b + PetscSqrtReal(discriminant)) / (2 * a) : 2 * c / (-b - PetscSqrtReal(discriminant));
+    PetscReal S = a1k / (pEq + p01) + a2k / (pEq + p02);
+    PetscReal TEq = 1.0 / ((*density) * S);
+    if (pEq + p01 <= 0 || pEq + p02 <= 0 || TEq <= 0) {
+        throw std::invalid_argument("ablate::finiteVolume::twoPhaseEulerAdvection StiffenedGas/StiffenedGas DecodeState cannot result in negative temperature or density");
+    }
+
+    // the phase densities/energies at the equilibrium state, these are defined even when a phase is not present
+    PetscReal rhoG = (pEq + p01) / ((gamma1 - 1) * cv1 * TEq);
+    PetscReal rhoL = (pEq + p02) / ((gamma2 - 1) * cv2 * TEq);
+    PetscReal eG = cv1 * TEq * (pEq + gamma1 * p01) / (pEq + p01);
+    PetscReal eL = cv2 * TEq * (pEq + gamma2 * p02) / (pEq + p02);
 
     PetscReal etG = eG + ke;
     PetscReal etL = eL + ke;
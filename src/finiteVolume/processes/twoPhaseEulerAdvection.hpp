@@ -23,34 +23,6 @@ class TwoPhaseEulerAdvection : public Process {
     TimeStepData timeStepData;
 
    private:
-    struct DecodeDataStructGas {
-        PetscReal etot;
-        PetscReal rhotot;
-        PetscReal Yg;
-        PetscReal Yl;
-        PetscReal gam1;
-        PetscReal gam2;
-        PetscReal cvg;
-        PetscReal cpl;
-        PetscReal p0l;
-    };
-    struct DecodeDataStructStiff {
-        PetscReal etot;
-        PetscReal rhotot;
-        PetscReal Yg;
-        PetscReal Yl;
-        PetscReal gam1;
-        PetscReal gam2;
-        PetscReal cpg;
-        PetscReal cpl;
-        PetscReal p0g;
-        PetscReal p0l;
-    };
-    static PetscErrorCode FormFunctionGas(SNES snes, Vec x, Vec F, void *ctx);
-    static PetscErrorCode FormJacobianGas(SNES snes, Vec x, Mat J, Mat P, void *ctx);
-    static PetscErrorCode FormFunctionStiff(SNES snes, Vec x, Vec F, void *ctx);
-    static PetscErrorCode FormJacobianStiff(SNES snes, Vec x, Mat J, Mat P, void *ctx);
-
     PetscErrorCode MultiphaseFlowPreStage(TS flowTs, ablate::solver::Solver &flow, PetscReal stagetime);
     /**
      * General two phase decoder interface
@@ -194,7 +166,7 @@ class TwoPhaseEulerAdvection : public Process {
 
    private:
     // static function to compute time step for twoPhase euler advection
-    static double ComputeCflTimeStep(TS ts, ablate::finiteVolume::FiniteVolumeSolver &flow, void *ctx);
+    static PetscErrorCode ComputeCflTimeStep(const FiniteVolumeSolver::CellTimeStepState &state, const PetscInt uOff[], const PetscInt aOff[], PetscReal *dt, void *ctx);
 
     static PetscErrorCode CompressibleFlowComputeEulerFlux(PetscInt dim, const PetscFVFaceGeom *fg, const PetscInt uOff[], const PetscScalar fieldL[], const PetscScalar fieldR[],
                                                            const PetscInt aOff[], const PetscScalar auxL[], const PetscScalar auxR[], PetscScalar *flux, void *ctx);
@@ -0,0 +1,141 @@
+#include "backgroundFileMover.hpp"
+#include <fstream>
+#include <stdexcept>
+#include "utilities/mpiUtilities.hpp"
+
+ablate::io::BackgroundFileMover::BackgroundFileMover(std::uintmax_t stagingLimit) : stagingLimit(stagingLimit), worker(&BackgroundFileMover::Run, this) {}
+
+ablate::io::BackgroundFileMover::~BackgroundFileMover() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+    }
+    workAvailable.notify_all();
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+void ablate::io::BackgroundFileMover::Run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        workAvailable.wait(lock, [this] { return stop || !queue.empty(); });
+        if (queue.empty()) {
+            // only exit once all pending work is done
+            return;
+        }
+        auto move = queue.front();
+
+        // move the file without holding the lock
+        lock.unlock();
+        std::string moveError;
+        try {
+            if (move.keepSource) {
+                // copy next to the destination and rename so that the destination is never partially written
+                auto copyDestination = move.destination;
+                copyDestination += ".copy";
+                std::filesystem::copy_file(move.source, copyDestination, std::filesystem::copy_options::overwrite_existing);
+                std::filesystem::rename(copyDestination, move.destination);
+            } else {
+                std::error_code renameError;
+                std::filesystem::rename(move.source, move.destination, renameError);
+                if (renameError) {
+                    // the staging directory is on a different file system
+                    std::filesystem::copy_file(move.source, move.destination, std::filesystem::copy_options::overwrite_existing);
+                    std::filesystem::remove(move.source);
+                }
+            }
+        } catch (const std::exception& exception) {
+            moveError = "Unable to move " + move.source.string() + " to " + move.destination.string() + ": " + exception.what();
+        }
+        lock.lock();
+
+        // record the result
+        if (!moveError.empty() && error.empty()) {
+            error = moveError;
+        }
+        queue.pop_front();
+        stagedBytes -= move.size;
+        if (--outstandingMoves[move.sequenceNumber] == 0) {
+            outstandingMoves.erase(move.sequenceNumber);
+        }
+        workFinished.notify_all();
+    }
+}
+
+void ablate::io::BackgroundFileMover::CheckError() const {
+    if (!error.empty()) {
+        throw std::runtime_error(error);
+    }
+}
+
+void ablate::io::BackgroundFileMover::Enqueue(const std::filesystem::path& source, const std::filesystem::path& destination, PetscInt sequenceNumber, bool keepSource) {
+    const auto size = std::filesystem::file_size(source);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    CheckError();
+
+    // apply back-pressure, always allow at least one file in staging
+    workFinished.wait(lock, [this, size] { return queue.empty() || stagedBytes + size <= stagingLimit || !error.empty(); });
+    CheckError();
+
+    queue.push_back(Move{.source = source, .destination = destination, .size = size, .sequenceNumber = sequenceNumber, .keepSource = keepSource});
+    stagedBytes += size;
+    outstandingMoves[sequenceNumber]++;
+    lock.unlock();
+    workAvailable.notify_one();
+}
+
+PetscInt ablate::io::BackgroundFileMover::GetCompletedSequenceNumber(PetscInt newestSequenceNumber) {
+    std::lock_guard<std::mutex> lock(mutex);
+    CheckError();
+    if (outstandingMoves.empty()) {
+        return newestSequenceNumber;
+    }
+    return outstandingMoves.begin()->first - 1;
+}
+
+void ablate::io::BackgroundFileMover::Wait() {
+    std::unique_lock<std::mutex> lock(mutex);
+    workFinished.wait(lock, [this] { return queue.empty(); });
+    CheckError();
+}
+
+void ablate::io::BackgroundFileMover::WaitAll(MPI_Comm comm) {
+    std::string localError;
+    try {
+        Wait();
+    } catch (const std::exception& exception) {
+        localError = exception.what();
+    }
+
+    // every rank must know if the output is complete
+    int error = !localError.empty();
+    MPI_Allreduce(MPI_IN_PLACE, &error, 1, MPI_INT, MPI_MAX, comm) >> utilities::MpiUtilities::checkError;
+    if (error) {
+        throw std::runtime_error(localError.empty() ? "Unable to move the staged files on another rank." : localError);
+    }
+}
+
+bool ablate::io::BackgroundFileMover::IsSharedDirectory(const std::filesystem::path& directory, MPI_Comm comm) {
+    int rank;
+    MPI_Comm_rank(comm, &rank) >> utilities::MpiUtilities::checkError;
+
+    // the first rank writes a marker that must be visible to every other rank
+    std::error_code createError;
+    std::filesystem::create_directories(directory, createError);
+    const auto markerPath = directory / ".sharedDirectoryMarker";
+    if (rank == 0) {
+        std::ofstream marker(markerPath);
+    }
+    MPI_Barrier(comm) >> utilities::MpiUtilities::checkError;
+
+    int shared = std::filesystem::exists(markerPath);
+    MPI_Allreduce(MPI_IN_PLACE, &shared, 1, MPI_INT, MPI_MIN, comm) >> utilities::MpiUtilities::checkError;
+
+    // every rank has checked once the reduction is complete
+    if (rank == 0) {
+        std::filesystem::remove(markerPath);
+    }
+    return shared;
+}
@@ -0,0 +1,126 @@
+#ifndef ABLATELIBRARY_BACKGROUNDFILEMOVER_HPP
+#define ABLATELIBRARY_BACKGROUNDFILEMOVER_HPP
+
+#include <petsc.h>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace ablate::io {
+
+/**
+ * Moves completed (staged) output files to their final location on a background thread so that the time stepper does not wait on the file system.
+ * Files that are still appended to can be copied instead of moved; the copy replaces the destination atomically.  Each file is associated with an output sequence number so the caller can determine when every file for a sequence has arrived.  When the staged
+ * bytes exceed the staging limit, Enqueue blocks until enough files have been moved (back-pressure).
+ *
+ * No PETSc or HDF5 calls are made on the background thread.
+ */
+class BackgroundFileMover {
+   private:
+    /**
+     * a single file waiting to be moved
+     */
+    struct Move {
+        std::filesystem::path source;
+        std::filesystem::path destination;
+        std::uintmax_t size;
+        PetscInt sequenceNumber;
+        bool keepSource;
+    };
+
+    //! the maximum number of bytes allowed in staging before Enqueue blocks
+    const std::uintmax_t stagingLimit;
+
+    //! the pending moves
+    std::deque<Move> queue;
+
+    //! the number of bytes currently staged, including the file being moved
+    std::uintmax_t stagedBytes = 0;
+
+    //! the number of outstanding moves for each sequence number
+    std::map<PetscInt, PetscInt> outstandingMoves;
+
+    //! the first error reported by the background thread
+    std::string error;
+
+    //! flag to stop the background thread
+    bool stop = false;
+
+    //! protect all shared state
+    std::mutex mutex;
+
+    //! signal the worker that there is new work
+    std::condition_variable workAvailable;
+
+    //! signal the main thread that work has finished
+    std::condition_variable workFinished;
+
+    //! the background thread
+    std::thread worker;
+
+    /**
+     * The function run by the background thread
+     */
+    void Run();
+
+    /**
+     * Rethrow any error from the background thread, mutex must be held
+     */
+    void CheckError() const;
+
+   public:
+    /**
+     * Start the background thread
+     * @param stagingLimit the maximum number of bytes allowed in staging
+     */
+    explicit BackgroundFileMover(std::uintmax_t stagingLimit);
+
+    /**
+     * Finish all pending moves and stop the background thread
+     */
+    ~BackgroundFileMover();
+
+    /**
+     * Queue a completed file to be moved.  This blocks if the staging limit has been reached.
+     * @param source the staged file
+     * @param destination the final location
+     * @param sequenceNumber the output sequence this file belongs to
+     * @param keepSource copy the file instead of moving it.  The source must not be changed until the copy is complete (see Wait).
+     */
+    void Enqueue(const std::filesystem::path& source, const std::filesystem::path& destination, PetscInt sequenceNumber, bool keepSource = false);
+
+    /**
+     * Returns the newest sequence number where this and all older sequences have been moved. All enqueued sequences are assumed to be increasing.
+     * @param newestSequenceNumber the newest sequence enqueued, returned if nothing is outstanding
+     * @return
+     */
+    PetscInt GetCompletedSequenceNumber(PetscInt newestSequenceNumber);
+
+    /**
+     * Block until every queued file has been moved
+     */
+    void Wait();
+
+    /**
+     * Block until every queued file on every rank has been moved.  If any rank failed to move a file, every rank throws.  This is collective.
+     * @param comm
+     */
+    void WaitAll(MPI_Comm comm);
+
+    /**
+     * Determine if every rank in the communicator can see the directory (e.g. a burst buffer), so that a collective file can be staged in it.
+     * This is collective.
+     * @param directory
+     * @param comm
+     * @return
+     */
+    static bool IsSharedDirectory(const std::filesystem::path& directory, MPI_Comm comm);
+};
+
+}  // namespace ablate::io
+#endif  // ABLATELIBRARY_BACKGROUNDFILEMOVER_HPP
@@ -0,0 +1,238 @@
+#include "hdf5Compression.hpp"
+#include <petscviewerhdf5.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+//! throw if an hdf5 call returned an error
+template <class T>
+T CheckHdf5(T result, const std::string& action) {
+    if (result < 0) {
+        throw std::runtime_error("Unable to " + action + " while repacking the hdf5 file.");
+    }
+    return result;
+}
+
+//! record the path of every hard link so that the file can be copied after the visit
+herr_t CollectLink(hid_t, const char* name, const H5L_info_t* info, void* linkNames) {
+    if (info->type == H5L_TYPE_HARD) {
+        ((std::vector<std::string>*)linkNames)->emplace_back(name);
+    }
+    return 0;
+}
+
+//! copy a single attribute to the destination object
+herr_t CopyAttribute(hid_t source, const char* name, const H5A_info_t*, void* destination) {
+    hid_t attribute = H5Aopen(source, name, H5P_DEFAULT);
+    if (attribute < 0) {
+        return -1;
+    }
+    hid_t type = H5Aget_type(attribute);
+    hid_t space = H5Aget_space(attribute);
+    std::vector<char> buffer(H5Sget_simple_extent_npoints(space) * H5Tget_size(type));
+    herr_t status = H5Aread(attribute, type, buffer.data());
+    if (status >= 0) {
+        hid_t copy = H5Acreate2(*(hid_t*)destination, name, type, space, H5P_DEFAULT, H5P_DEFAULT);
+        status = copy < 0 ? -1 : H5Awrite(copy, type, buffer.data());
+        H5Aclose(copy);
+
+        // variable length values (strings) are allocated by hdf5 during the read
+        if (H5Tdetect_class(type, H5T_VLEN) > 0 || H5Tis_variable_str(type) > 0) {
+#if H5_VERSION_GE(1, 12, 0)
+            H5Treclaim(type, space, H5P_DEFAULT, buffer.data());
+#else
+            H5Dvlen_reclaim(type, space, H5P_DEFAULT, buffer.data());
+#endif
+        }
+    }
+    H5Sclose(space);
+    H5Tclose(type);
+    H5Aclose(attribute);
+    return status < 0 ? -1 : 0;
+}
+
+void CopyAttributes(hid_t source, hid_t destination) {
+    CheckHdf5(H5Aiterate2(source, H5_INDEX_NAME, H5_ITER_INC, nullptr, CopyAttribute, &destination), "copy the attributes");
+}
+
+/**
+ * round the value to the nearest value with only mantissaBits bits in the (double) mantissa, this zeros the trailing bits so they compress well
+ */
+double RoundMantissa(double value, int mantissaBits) {
+    constexpr int doubleMantissaBits = 52;
+    if (mantissaBits <= 0 || mantissaBits >= doubleMantissaBits || !std::isfinite(value)) {
+        return value;
+    }
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const int droppedBits = doubleMantissaBits - mantissaBits;
+    const std::uint64_t half = std::uint64_t{1} << (droppedBits - 1);
+    const std::uint64_t mask = ~((std::uint64_t{1} << droppedBits) - 1);
+    bits = (bits + half) & mask;
+    std::memcpy(&value, &bits, sizeof(bits));
+    return value;
+}
+
+/**
+ * Write a copy of a floating point dataset using the chunk size, compression level, and bit rounding
+ */
+void RepackDataset(hid_t sourceDataset, hid_t destination, const std::string& name, hid_t linkCreate, int compressionLevel, int chunkSize, int mantissaBits) {
+    hid_t type = CheckHdf5(H5Dget_type(sourceDataset), "get the type of " + name);
+    hid_t space = CheckHdf5(H5Dget_space(sourceDataset), "get the space of " + name);
+    const int rank = H5Sget_simple_extent_ndims(space);
+    std::vector<hsize_t> dims(rank), maxDims(rank);
+    H5Sget_simple_extent_dims(space, dims.data(), maxDims.data());
+
+    // start from the properties petsc used so the fill value and other filters are kept
+    hid_t createProperties = CheckHdf5(H5Dget_create_plist(sourceDataset), "get the creation properties of " + name);
+    const bool chunked = H5Pget_layout(createProperties) == H5D_CHUNKED;
+    if (chunkSize > 0 || (!chunked && compressionLevel > 0)) {
+        // fill the chunk from the last dimension so that the leading (time and point) dimensions are split first, unlimited dimensions grow one entry at a time
+        hsize_t remaining = chunkSize > 0 ? (hsize_t)chunkSize : std::max<hsize_t>(H5Sget_simple_extent_npoints(space), 1);
+        std::vector<hsize_t> chunk(rank);
+        for (int d = rank - 1; d >= 0; --d) {
+            const hsize_t extent = maxDims[d] == H5S_UNLIMITED ? 1 : std::max<hsize_t>(dims[d], 1);
+            chunk[d] = std::clamp<hsize_t>(remaining, 1, extent);
+            remaining = std::max<hsize_t>(remaining / chunk[d], 1);
+        }
+        CheckHdf5(H5Pset_chunk(createProperties, rank, chunk.data()), "set the chunk size of " + name);
+    }
+    if (compressionLevel > 0) {
+        // replace the deflate filter set by petsc (if any)
+        H5E_BEGIN_TRY { H5Premove_filter(createProperties, H5Z_FILTER_DEFLATE); }
+        H5E_END_TRY;
+        CheckHdf5(H5Pset_deflate(createProperties, (unsigned)compressionLevel), "set the compression level of " + name);
+    }
+
+    hid_t destinationDataset = CheckHdf5(H5Dcreate2(destination, name.c_str(), type, space, linkCreate, createProperties, H5P_DEFAULT), "create " + name);
+    CopyAttributes(sourceDataset, destinationDataset);
+
+    // copy the values in blocks of the leading dimension to limit the memory used for large datasets
+    if (H5Sget_simple_extent_npoints(space) > 0) {
+        hsize_t rowSize = 1;
+        for (int d = 1; d < rank; ++d) {
+            rowSize *= dims[d];
+        }
+        const hsize_t rowsPerBlock = std::max<hsize_t>((hsize_t{1} << 20) / std::max<hsize_t>(rowSize, 1), 1);
+        std::vector<hsize_t> start(rank, 0), count(dims);
+        std::vector<double> values;
+        for (hsize_t row = 0; row < dims[0]; row += rowsPerBlock) {
+            start[0] = row;
+            count[0] = std::min(rowsPerBlock, dims[0] - row);
+            values.resize(count[0] * rowSize);
+
+            hid_t memorySpace = H5Screate_simple(rank, count.data(), nullptr);
+            CheckHdf5(H5Sselect_hyperslab(space, H5S_SELECT_SET, start.data(), nullptr, count.data(), nullptr), "select the values of " + name);
+            CheckHdf5(H5Dread(sourceDataset, H5T_NATIVE_DOUBLE, memorySpace, space, H5P_DEFAULT, values.data()), "read " + name);
+            if (mantissaBits > 0) {
+                std::transform(values.begin(), values.end(), values.begin(), [mantissaBits](double value) { return RoundMantissa(value, mantissaBits); });
+            }
+            CheckHdf5(H5Dwrite(destinationDataset, H5T_NATIVE_DOUBLE, memorySpace, space, H5P_DEFAULT, values.data()), "write " + name);
+            H5Sclose(memorySpace);
+        }
+    }
+
+    H5Dclose(destinationDataset);
+    H5Pclose(createProperties);
+    H5Sclose(space);
+    H5Tclose(type);
+}
+}  // namespace
+
+ablate::io::Hdf5Compression::Hdf5Compression(bool singlePrecision, int compressionLevel, int chunkSize, int mantissaBits)
+    : singlePrecision(singlePrecision), compressionLevel(compressionLevel), chunkSize(chunkSize), mantissaBits(mantissaBits) {
+    if (compressionLevel < 0 || compressionLevel > 9) {
+        throw std::invalid_argument("The Hdf5Compression compressionLevel must be between 1 and 9 (or 0 to keep the petsc level).");
+    }
+    if (chunkSize < 0) {
+        throw std::invalid_argument("The Hdf5Compression chunkSize must be positive.");
+    }
+    if (mantissaBits < 0 || mantissaBits > 52) {
+        throw std::invalid_argument("The Hdf5Compression mantissaBits must be between 0 and 52.");
+    }
+}
+
+PetscErrorCode ablate::io::Hdf5Compression::Apply(PetscViewer viewer) const {
+    PetscFunctionBeginUser;
+    // chunk and deflate each dataset, parallel filters require collective io
+    PetscCall(PetscViewerHDF5SetCompress(viewer, PETSC_TRUE));
+    PetscCall(PetscViewerHDF5SetCollective(viewer, PETSC_TRUE));
+    if (singlePrecision) {
+        PetscCall(PetscViewerHDF5SetSPOutput(viewer, PETSC_TRUE));
+    }
+    PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+void ablate::io::Hdf5Compression::Repack(const std::filesystem::path& filePath) const {
+    // write the repacked copy next to the file and replace the file once it is complete
+    auto repackFilePath = filePath;
+    repackFilePath += ".repack";
+
+    hid_t source = CheckHdf5(H5Fopen(filePath.string().c_str(), H5F_ACC_RDONLY, H5P_DEFAULT), "open " + filePath.string());
+    hid_t destination = H5Fcreate(repackFilePath.string().c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    hid_t linkCreate = H5Pcreate(H5P_LINK_CREATE);
+    try {
+        CheckHdf5(destination, "create " + repackFilePath.string());
+        CheckHdf5(H5Pset_create_intermediate_group(linkCreate, 1), "create the link properties");
+
+        // groups are always visited before their members
+        std::vector<std::string> linkNames;
+        CheckHdf5(H5Lvisit(source, H5_INDEX_NAME, H5_ITER_INC, CollectLink, &linkNames), "visit " + filePath.string());
+        CopyAttributes(source, destination);
+
+        for (const auto& name : linkNames) {
+            hid_t object = CheckHdf5(H5Oopen(source, name.c_str(), H5P_DEFAULT), "open " + name);
+            switch (H5Iget_type(object)) {
+                case H5I_GROUP: {
+                    hid_t group = H5Lexists(destination, name.c_str(), H5P_DEFAULT) > 0 ? H5Gopen2(destination, name.c_str(), H5P_DEFAULT)
+                                                                                          : H5Gcreate2(destination, name.c_str(), linkCreate, H5P_DEFAULT, H5P_DEFAULT);
+                    CopyAttributes(object, CheckHdf5(group, "create " + name));
+                    H5Gclose(group);
+                } break;
+                case H5I_DATASET: {
+                    // only floating point datasets are compressed/rounded, everything else (including complex values) is copied unchanged
+                    hid_t type = H5Dget_type(object);
+                    const bool floatingPoint = H5Tget_class(type) == H5T_FLOAT;
+                    H5Tclose(type);
+                    hid_t space = H5Dget_space(object);
+                    const bool array = H5Sget_simple_extent_ndims(space) > 0;
+                    H5Sclose(space);
+                    if (floatingPoint && array) {
+                        RepackDataset(object, destination, name, linkCreate, compressionLevel, chunkSize, mantissaBits);
+                    } else {
+                        CheckHdf5(H5Ocopy(source, name.c_str(), destination, name.c_str(), H5P_DEFAULT, linkCreate), "copy " + name);
+                    }
+                } break;
+                default:
+                    CheckHdf5(H5Ocopy(source, name.c_str(), destination, name.c_str(), H5P_DEFAULT, linkCreate), "copy " + name);
+            }
+            H5Oclose(object);
+        }
+    } catch (...) {
+        H5Pclose(linkCreate);
+        H5Fclose(source);
+        if (destination >= 0) {
+            H5Fclose(destination);
+            std::filesystem::remove(repackFilePath);
+        }
+        throw;
+    }
+    H5Pclose(linkCreate);
+    H5Fclose(source);
+    H5Fclose(destination);
+    std::filesystem::rename(repackFilePath, filePath);
+}
+
+#include "registrar.hpp"
+REGISTER_DEFAULT(ablate::io::Hdf5Compression, ablate::io::Hdf5Compression, "chunks and compresses (deflate) the serialized hdf5 datasets",
+                 OPT(bool, "singlePrecision", "write the datasets in single precision (lossy).  Single precision outputs are for visualization and are not used as restart checkpoints"),
+                 OPT(int, "compressionLevel", "the deflate level (1-9) used for each floating point dataset.  The default (0) keeps the level chosen by petsc and does not repack the file"),
+                 OPT(int, "chunkSize", "the maximum number of values in each chunk.  The default (0) keeps the chunks chosen by petsc and does not repack the file"),
+                 OPT(int, "mantissaBits",
+                     "the number of mantissa bits kept in each floating point value (bit rounding, lossy).  Rounded outputs are for visualization and are not used as restart checkpoints.  The "
+                     "default (0) keeps every bit"));
@@ -0,0 +1,69 @@
+#ifndef ABLATELIBRARY_HDF5COMPRESSION_HPP
+#define ABLATELIBRARY_HDF5COMPRESSION_HPP
+
+#include <petscviewer.h>
+#include <filesystem>
+
+namespace ablate::io {
+
+/**
+ * Describes how the hdf5 datasets written by a serializer are stored.  When provided, datasets are chunked and compressed with the
+ * lossless deflate filter available in standard hdf5 builds.  Collective io is enabled so that the filters can be used for parallel writes.
+ * An optional single precision output can be used for visualization outputs; these outputs are never used as restart checkpoints.
+ *
+ * The petsc hdf5 viewer picks the deflate level and chunk shape itself.  When a compression level, chunk size, or bit rounding is requested,
+ * each closed file is repacked with those settings (see Repack).
+ */
+class Hdf5Compression {
+   private:
+    //! write the datasets in single precision (lossy)
+    const bool singlePrecision;
+
+    //! the deflate level (1-9) used when repacking, zero keeps the level chosen by petsc
+    const int compressionLevel;
+
+    //! the maximum number of values in each chunk used when repacking, zero keeps the chunks chosen by petsc
+    const int chunkSize;
+
+    //! the number of mantissa bits kept when repacking floating point datasets (bit rounding), zero keeps every bit
+    const int mantissaBits;
+
+   public:
+    /**
+     * @param singlePrecision write the datasets in single precision (lossy, visualization only)
+     * @param compressionLevel the deflate level (1-9), zero keeps the level chosen by petsc
+     * @param chunkSize the maximum number of values in each chunk, zero keeps the chunks chosen by petsc
+     * @param mantissaBits the number of mantissa bits kept in floating point datasets (lossy, visualization only), zero keeps every bit
+     */
+    explicit Hdf5Compression(bool singlePrecision = false, int compressionLevel = 0, int chunkSize = 0, int mantissaBits = 0);
+
+    /**
+     * Apply the chunking/compression to an open hdf5 viewer
+     * @param viewer
+     * @return
+     */
+    PetscErrorCode Apply(PetscViewer viewer) const;
+
+    /**
+     * Lossless outputs can be used as restart checkpoints
+     * @return
+     */
+    [[nodiscard]] bool IsLossless() const { return !singlePrecision && mantissaBits == 0; }
+
+    /**
+     * The compression level, chunk size, and bit rounding cannot be set through the petsc viewer, so files must be repacked after they are closed
+     * @return
+     */
+    [[nodiscard]] bool RequiresRepack() const { return compressionLevel > 0 || chunkSize > 0 || mantissaBits > 0; }
+
+    /**
+     * Rewrites a closed hdf5 file so that every floating point dataset uses the compression level, chunk size, and bit rounding.  Other objects and all
+     * attributes are copied unchanged and unlimited dimensions are kept so that petsc can continue to append to the datasets.  This is not collective;
+     * it must be called by a single rank once the file is closed.
+     * @param filePath
+     */
+    void Repack(const std::filesystem::path& filePath) const;
+};
+
+}  // namespace ablate::io
+#endif  // ABLATELIBRARY_HDF5COMPRESSION_HPP
@@ -3,12 +3,18 @@
 #include <yaml-cpp/yaml.h>
 #include <fstream>
 #include <iostream>
+#include <iterator>
 #include <utility>
 #include "environment/runEnvironment.hpp"
 #include "generators.hpp"
+#include "utilities/mpiUtilities.hpp"
 
-ablate::io::Hdf5MultiFileSerializer::Hdf5MultiFileSerializer(std::shared_ptr<ablate::io::interval::Interval> interval, const std::shared_ptr<parameters::Parameters>& options)
-    : interval(std::move(interval)), rootOutputDirectory(environment::RunEnvironment::Get().GetOutputDirectory()) {
+ablate::io::Hdf5MultiFileSerializer::Hdf5MultiFileSerializer(std::shared_ptr<ablate::io::interval::Interval> interval, const std::shared_ptr<parameters::Parameters>& options,
+                                                             const std::string& stagingDirectory, double stagingLimit, std::shared_ptr<Hdf5Compression> compression)
+    : interval(std::move(interval)),
+      rootOutputDirectory(environment::RunEnvironment::Get().GetOutputDirectory()),
+      stagingDirectory(stagingDirectory),
+      compression(std::move(compression)) {
     // New petsc HDF5 Data Storage as of 09/23/24, for now we will default to the legacy version until I understand more of the different
     // outputting version available and how they mesh with ablate
     {
@@ -21,6 +27,9 @@ ablate::io::Hdf5MultiFileSerializer::Hdf5MultiFileSerializer(std::shared_ptr<abl
     auto restartFilePath = rootOutputDirectory / "restart.rst";
 
     if (std::filesystem::exists(restartFilePath)) {
+        if (this->compression && !this->compression->IsLossless()) {
+            throw std::invalid_argument("Cannot resume simulation using a lossy (single precision or bit rounded) Hdf5MultiFileSerializer.");
+        }
         resumed = true;
         auto yaml = YAML::LoadFile(restartFilePath);
         time = yaml["time"].as<PetscReal>();
@@ -48,10 +57,48 @@ ablate::io::Hdf5MultiFileSerializer::Hdf5MultiFileSerializer(std::shared_ptr<abl
         PetscOptionsCreate(&petscOptions) >> utilities::PetscUtilities::checkError;
         options->Fill(petscOptions);
     }
+
+    // start the background writer if staging
+    if (!this->stagingDirectory.empty()) {
+        fileMover = std::make_unique<BackgroundFileMover>((std::uintmax_t)(stagingLimit > 0.0 ? stagingLimit : 4.0E9));
+        sharedStaging = BackgroundFileMover::IsSharedDirectory(this->stagingDirectory, PETSC_COMM_WORLD);
+    }
 }
 
 ablate::io::Hdf5MultiFileSerializer::~Hdf5MultiFileSerializer() {
-    // save each serializer
+    // finish moving this rank's staged files, the restart file is only written by the collective Finalize
+    fileMover.reset();
+
+    // generate the xdmf files for any output written after the last Finalize
+    if (!finalized) {
+        GenerateXdmf();
+    }
+
+    if (petscOptions) {
+        ablate::utilities::PetscUtilities::PetscOptionsDestroyAndCheck("ablate::io::Hdf5MultiFileSerializer::Hdf5MultiFileSerializer", &petscOptions);
+    }
+}
+
+void ablate::io::Hdf5MultiFileSerializer::Finalize() {
+    if (finalized) {
+        return;
+    }
+
+    if (fileMover) {
+        // every rank must be done before the restart file is written
+        fileMover->WaitAll(PETSC_COMM_WORLD);
+        if (!pendingMetadata.empty()) {
+            const auto& [lastSequenceNumber, metadata] = *pendingMetadata.rbegin();
+            SaveMetadata(PETSC_COMM_WORLD, metadata.time, metadata.dt, metadata.timeStep, lastSequenceNumber);
+            pendingMetadata.clear();
+        }
+    }
+
+    GenerateXdmf();
+    finalized = true;
+}
+
+void ablate::io::Hdf5MultiFileSerializer::GenerateXdmf() const {
     for (const std::string& id : postProcessesIds) {
         std::vector<std::filesystem::path> inputFilePaths;
 
@@ -69,10 +116,6 @@ ablate::io::Hdf5MultiFileSerializer::~Hdf5MultiFileSerializer() {
         std::filesystem::path outputFile = directoryPath / (id + ".xmf");
         xdmfGenerator::Generate(inputFilePaths, outputFile);
     }
-
-    if (petscOptions) {
-        ablate::utilities::PetscUtilities::PetscOptionsDestroyAndCheck("ablate::io::Hdf5MultiFileSerializer::Hdf5MultiFileSerializer", &petscOptions);
-    }
 }
 
 void ablate::io::Hdf5MultiFileSerializer::Register(std::weak_ptr<Serializable> serializable) {
@@ -144,10 +187,17 @@ PetscErrorCode ablate::io::Hdf5MultiFileSerializer::Hdf5MultiFileSerializerSaveS
         hdf5Serializer->time = time;
         hdf5Serializer->timeStep = steps;
         hdf5Serializer->sequenceNumber++;
+        hdf5Serializer->finalized = false;
         TSGetTimeStep(ts, &(hdf5Serializer->dt)) >> utilities::PetscUtilities::checkError;
 
-        // Save this to a file
-        hdf5Serializer->SaveMetadata(ts);
+        // Save this to a file.  When staging, the metadata is only written once the files have been moved
+        if (!hdf5Serializer->fileMover) {
+            hdf5Serializer->SaveMetadata(
+                PetscObjectComm((PetscObject)ts), hdf5Serializer->time, hdf5Serializer->dt, hdf5Serializer->timeStep, hdf5Serializer->sequenceNumber);
+        }
+
+        PetscMPIInt rank;
+        PetscCallMPI(MPI_Comm_rank(PetscObjectComm((PetscObject)ts), &rank));
 
         // save each serializer
         for (auto& serializablePtr : hdf5Serializer->serializables) {
@@ -155,23 +205,35 @@ PetscErrorCode ablate::io::Hdf5MultiFileSerializer::Hdf5MultiFileSerializerSaveS
                 // Create an output path
 
                 PetscViewer petscViewer = nullptr;
-                hdf5Serializer->StartEvent("PetscViewerHDF5Open");
+                std::filesystem::path filePath;
+                MPI_Comm viewerComm;
                 switch (serializableObject->Serialize()) {
                     case Serializable::SerializerType::collective: {
-                        auto filePath = hdf5Serializer->GetOutputFilePath(serializableObject->GetId());
-                        PetscCall(PetscViewerHDF5Open(PETSC_COMM_WORLD, filePath.string().c_str(), FILE_MODE_WRITE, &petscViewer));
+                        filePath = hdf5Serializer->GetOutputFilePath(serializableObject->GetId());
+                        viewerComm = PETSC_COMM_WORLD;
                     } break;
                     case Serializable::SerializerType::serial: {
-                        PetscMPIInt rank;
-                        MPI_Comm_rank(PetscObjectComm((PetscObject)ts), &rank);
-                        auto filePath = hdf5Serializer->GetOutputFilePath(serializableObject->GetId(), rank);
-                        PetscCall(PetscViewerHDF5Open(PETSC_COMM_SELF, filePath.string().c_str(), FILE_MODE_WRITE, &petscViewer));
+                        filePath = hdf5Serializer->GetOutputFilePath(serializableObject->GetId(), rank);
+                        viewerComm = PETSC_COMM_SELF;
                     } break;
                     default:
                         throw std::invalid_argument("Unable to determine Serializer Type");
                 }
+
+                // A collective file is opened by every rank, so it is only staged when every rank can see the staging directory (e.g. a burst buffer).
+                // Otherwise (node local storage) it is written directly to the output directory
+                const bool staged = hdf5Serializer->fileMover && (viewerComm == PETSC_COMM_SELF || hdf5Serializer->sharedStaging);
+                auto writeFilePath = staged ? hdf5Serializer->GetStagingFilePath(filePath) : filePath;
+
+                hdf5Serializer->StartEvent("PetscViewerHDF5Open");
+                PetscCall(PetscViewerHDF5Open(viewerComm, writeFilePath.string().c_str(), FILE_MODE_WRITE, &petscViewer));
                 hdf5Serializer->EndEvent();
 
+                // apply the compression before the petsc options so that the options can override it
+                if (hdf5Serializer->compression) {
+                    PetscCall(hdf5Serializer->compression->Apply(petscViewer));
+                }
+
                 // set the petsc options if provided
                 PetscCall(PetscObjectSetOptions((PetscObject)petscViewer, hdf5Serializer->petscOptions));
                 PetscCall(PetscViewerSetFromOptions(petscViewer));
@@ -185,30 +247,72 @@ PetscErrorCode ablate::io::Hdf5MultiFileSerializer::Hdf5MultiFileSerializerSaveS
                 hdf5Serializer->StartEvent("PetscViewerHDF5Destroy");
                 PetscCall(PetscViewerDestroy(&petscViewer));
                 hdf5Serializer->EndEvent();
+
+                // apply the compression level, chunk size, and bit rounding to the closed file, a collective file is repacked by the first rank
+                PetscMPIInt viewerRank;
+                PetscCallMPI(MPI_Comm_rank(viewerComm, &viewerRank));
+                if (hdf5Serializer->compression && hdf5Serializer->compression->RequiresRepack() && viewerRank == 0) {
+                    hdf5Serializer->StartEvent("Repack");
+                    hdf5Serializer->compression->Repack(writeFilePath);
+                    hdf5Serializer->EndEvent();
+                }
+
+                // The file is now closed, so each rank queues its own file to be moved.  A collective file is moved by the first rank
+                if (staged && viewerRank == 0) {
+                    hdf5Serializer->StartEvent("Enqueue");
+                    hdf5Serializer->fileMover->Enqueue(writeFilePath, filePath, hdf5Serializer->sequenceNumber);
+                    hdf5Serializer->EndEvent();
+                }
             }
         }
+
+        // record the metadata so it can be written once every file for this sequence has been moved
+        if (hdf5Serializer->fileMover) {
+            hdf5Serializer->pendingMetadata[hdf5Serializer->sequenceNumber] =
+                Metadata{.time = hdf5Serializer->time, .dt = hdf5Serializer->dt, .timeStep = hdf5Serializer->timeStep};
+            hdf5Serializer->UpdateStagedMetadata(PetscObjectComm((PetscObject)ts));
+        }
     }
     PetscFunctionReturn(0);
 }
 
-void ablate::io::Hdf5MultiFileSerializer::SaveMetadata(TS ts) const {
+void ablate::io::Hdf5MultiFileSerializer::UpdateStagedMetadata(MPI_Comm comm) {
+    // determine the newest sequence that has been moved on every rank
+    PetscInt localCompletedSequenceNumber = fileMover->GetCompletedSequenceNumber(sequenceNumber);
+    PetscInt completedSequenceNumber;
+    MPI_Allreduce(&localCompletedSequenceNumber, &completedSequenceNumber, 1, MPIU_INT, MPI_MIN, comm) >> utilities::MpiUtilities::checkError;
+
+    // write the restart file for the newest complete sequence
+    auto completed = pendingMetadata.upper_bound(completedSequenceNumber);
+    if (completed != pendingMetadata.begin()) {
+        const auto& [completedSequence, metadata] = *std::prev(completed);
+        SaveMetadata(comm, metadata.time, metadata.dt, metadata.timeStep, completedSequence);
+        pendingMetadata.erase(pendingMetadata.begin(), completed);
+    }
+}
+
+void ablate::io::Hdf5MultiFileSerializer::SaveMetadata(MPI_Comm comm, PetscReal metadataTime, PetscReal metadataDt, PetscInt metadataTimeStep, PetscInt metadataSequenceNumber) const {
     PetscFunctionBeginUser;
+    // lossy outputs cannot be used to restart
+    if (compression && !compression->IsLossless()) {
+        PetscFunctionReturnVoid();
+    }
     YAML::Emitter out;
     out << YAML::BeginMap;
     out << YAML::Key << "time";
-    out << YAML::Value << time;
+    out << YAML::Value << metadataTime;
     out << YAML::Key << "dt";
-    out << YAML::Value << dt;
+    out << YAML::Value << metadataDt;
     out << YAML::Key << "timeStep";
-    out << YAML::Value << timeStep;
+    out << YAML::Value << metadataTimeStep;
     out << YAML::Key << "sequenceNumber";
-    out << YAML::Value << sequenceNumber;
+    out << YAML::Value << metadataSequenceNumber;
     out << YAML::Key << "version";
     out << YAML::Value << std::string(environment::RunEnvironment::GetVersion());
     out << YAML::EndMap;
 
     int rank;
-    MPI_Comm_rank(PetscObjectComm((PetscObject)ts), &rank) >> utilities::PetscUtilities::checkError;
+    MPI_Comm_rank(comm, &rank) >> utilities::MpiUtilities::checkError;
     if (rank == 0) {
         auto restartFilePath = rootOutputDirectory / "restart.rst";
         // keep a back of the restart file incase writing fails
@@ -244,6 +348,14 @@ std::filesystem::path ablate::io::Hdf5MultiFileSerializer::GetOutputFilePath(con
 }
 
 std::filesystem::path ablate::io::Hdf5MultiFileSerializer::GetOutputDirectoryPath(const std::string& objectId) const { return rootOutputDirectory / objectId; }
+
+std::filesystem::path ablate::io::Hdf5MultiFileSerializer::GetStagingFilePath(const std::filesystem::path& filePath) const {
+    // mirror the output directory structure in the staging directory
+    auto stagingFilePath = stagingDirectory / std::filesystem::relative(filePath, rootOutputDirectory);
+    std::error_code errorCode;
+    std::filesystem::create_directories(stagingFilePath.parent_path(), errorCode);
+    return stagingFilePath;
+}
 std::filesystem::path ablate::io::Hdf5MultiFileSerializer::GetOutputFilePath(const std::string& objectId, int rank) const {
     std::stringstream sequenceNumberOutputStream;
     sequenceNumberOutputStream << "." << std::setw(5) << std::setfill('0') << rank;
@@ -253,4 +365,9 @@ std::filesystem::path ablate::io::Hdf5MultiFileSerializer::GetOutputFilePath(con
 #include "registrar.hpp"
 REGISTER(ablate::io::Serializer, ablate::io::Hdf5MultiFileSerializer, "serializer for IO that writes each time to a separate hdf5 file",
          ARG(ablate::io::interval::Interval, "interval", "The interval object used to determine write interval."),
-         OPT(ablate::parameters::Parameters, "options", "options for the viewer passed directly to PETSc including (hdf5ViewerView, viewer_hdf5_collective, viewer_hdf5_sp_output"));
+         OPT(ablate::parameters::Parameters, "options", "options for the viewer passed directly to PETSc including (hdf5ViewerView, viewer_hdf5_collective, viewer_hdf5_sp_output"),
+         OPT(std::string, "stagingDirectory",
+             "optional fast directory (node local or burst buffer) used to write each file before it is moved to the output directory on a background thread.  Collective files are only "
+             "staged when every rank can see the directory."),
+         OPT(double, "stagingLimit", "the maximum bytes per rank held in the stagingDirectory before output waits on the background thread (default 4E9)"),
+         OPT(ablate::io::Hdf5Compression, "compression", "optional chunking/compression of the hdf5 datasets.  Lossy (single precision or bit rounded) outputs do not write restart information."));
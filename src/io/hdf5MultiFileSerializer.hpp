@@ -4,8 +4,11 @@
 #include <petscviewer.h>
 #include <filesystem>
 #include <io/interval/interval.hpp>
+#include <map>
 #include <memory>
 #include <vector>
+#include "backgroundFileMover.hpp"
+#include "hdf5Compression.hpp"
 #include "parameters/parameters.hpp"
 #include "serializable.hpp"
 #include "serializer.hpp"
@@ -40,11 +43,47 @@ class Hdf5MultiFileSerializer : public Serializer, private utilities::Loggable<H
     // an optional petscOptions that is used for this solver
     PetscOptions petscOptions = nullptr;
 
+    //! optional directory where the files are written before being moved to the output directory in the background
+    const std::filesystem::path stagingDirectory;
+
+    //! true when every rank can see the staging directory, so the collective files can also be staged
+    bool sharedStaging = false;
+
+    //! true once Finalize has completed every output that has been written
+    bool finalized = false;
+
+    //! optional chunking/compression applied to each file
+    const std::shared_ptr<Hdf5Compression> compression;
+
+    //! moves the staged files to the output directory, only created when using a staging directory
+    std::unique_ptr<BackgroundFileMover> fileMover;
+
+    /**
+     * The ts information needed to write the restart file
+     */
+    struct Metadata {
+        PetscReal time;
+        PetscReal dt;
+        PetscInt timeStep;
+    };
+
+    //! the metadata for each sequence that is still being moved to the output directory
+    std::map<PetscInt, Metadata> pendingMetadata;
+
     //! Petsc function used to save the system state
     static PetscErrorCode Hdf5MultiFileSerializerSaveStateFunction(TS ts, PetscInt steps, PetscReal time, Vec u, void* mctx);
 
     //! Private functions to load and save the ts metadata data
-    void SaveMetadata(TS ts) const;
+    void SaveMetadata(MPI_Comm comm, PetscReal metadataTime, PetscReal metadataDt, PetscInt metadataTimeStep, PetscInt metadataSequenceNumber) const;
+
+    //! Write the restart file for the newest sequence that has been completely moved on every rank
+    void UpdateStagedMetadata(MPI_Comm comm);
+
+    //! Generate the xdmf file for each serializable object, only the root rank has post processes ids
+    void GenerateXdmf() const;
+
+    //! Private function to determine where a file is written before being moved to the output filePath
+    [[nodiscard]] std::filesystem::path GetStagingFilePath(const std::filesystem::path& filePath) const;
 
     //! Private functions to determine the path name when using collective
     [[nodiscard]] std::filesystem::path GetOutputFilePath(const std::string& objectId) const;
@@ -58,11 +97,18 @@ class Hdf5MultiFileSerializer : public Serializer, private utilities::Loggable<H
    public:
     /**
      * Separates into multiple files to solve some io issues
+     * @param interval
+     * @param options
+     * @param stagingDirectory optional fast (node local or burst buffer) directory used to write the files before they are moved to the output directory on a
+     * background thread.  Collective files are only staged when every rank can see the staging directory, otherwise they are written directly to the output directory.
+     * @param stagingLimit the maximum number of bytes in the staging directory per rank before the output waits on the background thread
+     * @param compression optional chunking/compression of the datasets.  Lossy outputs do not write restart information.
      */
-    explicit Hdf5MultiFileSerializer(std::shared_ptr<ablate::io::interval::Interval>, const std::shared_ptr<parameters::Parameters>& options = nullptr);
+    explicit Hdf5MultiFileSerializer(std::shared_ptr<ablate::io::interval::Interval>, const std::shared_ptr<parameters::Parameters>& options = nullptr, const std::string& stagingDirectory = {},
+                                     double stagingLimit = 4.0E9, std::shared_ptr<Hdf5Compression> compression = {});
 
     /**
-     * Allow file cleanup
+     * Completes this rank's background moves without communicating, the restart file is only updated by Finalize
      */
     ~Hdf5MultiFileSerializer() override;
 
@@ -83,6 +129,11 @@ class Hdf5MultiFileSerializer : public Serializer, private utilities::Loggable<H
     PetscSerializeFunction GetSerializeFunction() override { return Hdf5MultiFileSerializerSaveStateFunction; }
 
     void RestoreTS(TS ts) override;
+
+    /**
+     * Waits for every staged file on every rank, writes the restart file for the last sequence, and generates the xdmf files.  This is collective.
+     */
+    void Finalize() override;
 };
 
 }  // namespace ablate::io
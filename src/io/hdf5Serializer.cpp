@@ -5,12 +5,15 @@
 #include <fstream>
 #include <io/interval/interval.hpp>
 #include <iostream>
+#include <limits>
 #include <utility>
 #include "generators.hpp"
 #include "utilities/mpiUtilities.hpp"
 #include "utilities/petscUtilities.hpp"
 
-ablate::io::Hdf5Serializer::Hdf5Serializer(std::shared_ptr<ablate::io::interval::Interval> interval) : interval(std::move(interval)) {
+ablate::io::Hdf5Serializer::Hdf5Serializer(std::shared_ptr<ablate::io::interval::Interval> interval, std::shared_ptr<Hdf5Compression> compression, PetscInt fullCheckpointInterval,
+                                           const std::string& stagingDirectory)
+    : interval(std::move(interval)), compression(std::move(compression)), fullCheckpointInterval(fullCheckpointInterval), stagingDirectory(stagingDirectory) {
     // New petsc HDF5 Data Storage as of 09/23/24, for now we will default to the legacy version until I understand more of the different
     // outputting version available and how they mesh with ablate
     {
@@ -23,6 +26,9 @@ ablate::io::Hdf5Serializer::Hdf5Serializer(std::shared_ptr<ablate::io::interval:
     auto restartFilePath = environment::RunEnvironment::Get().GetOutputDirectory() / "restart.rst";
 
     if (std::filesystem::exists(restartFilePath)) {
+        if (this->compression && !this->compression->IsLossless()) {
+            throw std::invalid_argument("Cannot resume simulation using a lossy (single precision or bit rounded) Hdf5Serializer.");
+        }
         resumed = true;
         auto yaml = YAML::LoadFile(restartFilePath);
         time = yaml["time"].as<PetscReal>();
@@ -30,6 +36,15 @@ ablate::io::Hdf5Serializer::Hdf5Serializer(std::shared_ptr<ablate::io::interval:
         timeStep = yaml["timeStep"].as<PetscInt>();
         sequenceNumber = yaml["sequenceNumber"].as<PetscInt>();
 
+        // incremental checkpoints reference older sequences for unchanged objects
+        fullSequenceNumber = yaml["fullSequenceNumber"] ? yaml["fullSequenceNumber"].as<PetscInt>() : sequenceNumber;
+        if (auto sequences = yaml["sequences"]) {
+            restoreSequenceNumbers = sequences.as<std::map<std::string, PetscInt>>();
+        }
+        if (auto sequenceTimes = yaml["sequenceTimes"]) {
+            restoreTimes = sequenceTimes.as<std::map<std::string, PetscReal>>();
+        }
+
         // check for restart info warning
         auto version = yaml["version"];
         if (version.IsDefined()) {
@@ -43,12 +58,30 @@ ablate::io::Hdf5Serializer::Hdf5Serializer(std::shared_ptr<ablate::io::interval:
         dt = NAN;
         timeStep = -1;
         sequenceNumber = -1;
+        fullSequenceNumber = -1;
+    }
+
+    // start the background copies if staging.  Each save waits for the previous copies, so there is no separate staging limit
+    if (!this->stagingDirectory.empty()) {
+        fileMover = std::make_unique<BackgroundFileMover>(std::numeric_limits<std::uintmax_t>::max());
+        sharedStaging = BackgroundFileMover::IsSharedDirectory(this->stagingDirectory, PETSC_COMM_WORLD);
     }
 }
 
 void ablate::io::Hdf5Serializer::Register(std::weak_ptr<Serializable> serializable) {
     // for each serializable object create a Hdf5ObjectSerializer
-    serializers.push_back(std::make_unique<Hdf5ObjectSerializer>(serializable, sequenceNumber, time, resumed));
+    // restore from the sequence (and its time) that holds the most recent copy of this object
+    auto restoreSequenceNumber = sequenceNumber;
+    auto restoreTime = time;
+    if (auto serializableObject = serializable.lock()) {
+        if (auto restoreSequence = restoreSequenceNumbers.find(serializableObject->GetId()); restoreSequence != restoreSequenceNumbers.end()) {
+            restoreSequenceNumber = restoreSequence->second;
+        }
+        if (auto restoreSequenceTime = restoreTimes.find(serializableObject->GetId()); restoreSequenceTime != restoreTimes.end()) {
+            restoreTime = restoreSequenceTime->second;
+        }
+    }
+    serializers.push_back(std::make_unique<Hdf5ObjectSerializer>(serializable, restoreSequenceNumber, restoreTime, resumed, compression, stagingDirectory, sharedStaging));
 }
 
 PetscErrorCode ablate::io::Hdf5Serializer::Hdf5SerializerSaveStateFunction(TS ts, PetscInt steps, PetscReal time, Vec u, void* ctx) {
@@ -61,24 +94,66 @@ PetscErrorCode ablate::io::Hdf5Serializer::Hdf5SerializerSaveStateFunction(TS ts
     }
 
     if (hdf5Serializer->interval->Check(PetscObjectComm((PetscObject)ts), steps, time)) {
+        // the staged files cannot be written again until the previous save has been copied to the output directory
+        if (hdf5Serializer->fileMover) {
+            hdf5Serializer->CompleteStagedSave(PetscObjectComm((PetscObject)ts));
+        }
+
         // Update all metadata
         hdf5Serializer->time = time;
         hdf5Serializer->timeStep = steps;
         hdf5Serializer->sequenceNumber++;
         TSGetTimeStep(ts, &(hdf5Serializer->dt)) >> utilities::PetscUtilities::checkError;
 
-        // Save this to a file
-        hdf5Serializer->SaveMetadata(ts);
+        // write every object for a full checkpoint, this bounds how far back an incremental checkpoint can reference
+        bool fullSave = hdf5Serializer->fullCheckpointInterval <= 0 || hdf5Serializer->fullSequenceNumber < 0 ||
+                        hdf5Serializer->sequenceNumber - hdf5Serializer->fullSequenceNumber >= hdf5Serializer->fullCheckpointInterval;
+        if (fullSave) {
+            hdf5Serializer->fullSequenceNumber = hdf5Serializer->sequenceNumber;
+        }
+
+        // every rank must agree to skip an object because the file may be shared, so check all objects with a single reduction
+        auto& serializers = hdf5Serializer->serializers;
+        std::vector<PetscInt> requiresSave(serializers.size());
+        for (std::size_t s = 0; s < serializers.size(); ++s) {
+            requiresSave[s] = serializers[s]->RequiresSave(fullSave);
+        }
+        PetscCallMPI(MPI_Allreduce(MPI_IN_PLACE, requiresSave.data(), (PetscMPIInt)requiresSave.size(), MPIU_INT, MPI_MAX, PETSC_COMM_WORLD));
+
+        // save each changed serializer
+        for (std::size_t s = 0; s < serializers.size(); ++s) {
+            if (requiresSave[s]) {
+                PetscCall(serializers[s]->Save(hdf5Serializer->sequenceNumber, time, hdf5Serializer->fileMover.get()));
+            }
+        }
 
-        // save each serializer
-        for (auto& serializer : hdf5Serializer->serializers) {
-            PetscCall(serializer->Save(hdf5Serializer->sequenceNumber, time));
+        // Save this to a file once every object has been written (or copied when staging), lossy outputs cannot be used to restart
+        if (!hdf5Serializer->compression || hdf5Serializer->compression->IsLossless()) {
+            if (hdf5Serializer->fileMover) {
+                hdf5Serializer->metadataPending = true;
+            } else {
+                hdf5Serializer->SaveMetadata(PetscObjectComm((PetscObject)ts));
+            }
         }
     }
     PetscFunctionReturn(0);
 }
 
-void ablate::io::Hdf5Serializer::SaveMetadata(TS ts) const {
+void ablate::io::Hdf5Serializer::CompleteStagedSave(MPI_Comm comm) {
+    fileMover->WaitAll(comm);
+    if (metadataPending) {
+        SaveMetadata(comm);
+        metadataPending = false;
+    }
+}
+
+void ablate::io::Hdf5Serializer::Finalize() {
+    if (fileMover) {
+        CompleteStagedSave(PETSC_COMM_WORLD);
+    }
+}
+
+void ablate::io::Hdf5Serializer::SaveMetadata(MPI_Comm comm) const {
     PetscFunctionBeginUser;
     YAML::Emitter out;
     out << YAML::BeginMap;
@@ -90,12 +165,34 @@ void ablate::io::Hdf5Serializer::SaveMetadata(TS ts) const {
     out << YAML::Value << timeStep;
     out << YAML::Key << "sequenceNumber";
     out << YAML::Value << sequenceNumber;
+    out << YAML::Key << "fullSequenceNumber";
+    out << YAML::Value << fullSequenceNumber;
+    // record the sequence holding the most recent copy of each object
+    out << YAML::Key << "sequences";
+    out << YAML::Value << YAML::BeginMap;
+    for (const auto& serializer : serializers) {
+        if (auto id = serializer->GetId(); !id.empty()) {
+            out << YAML::Key << id;
+            out << YAML::Value << serializer->GetSavedSequenceNumber();
+        }
+    }
+    out << YAML::EndMap;
+    // and the time of that sequence so unchanged objects are restored with the time they were saved
+    out << YAML::Key << "sequenceTimes";
+    out << YAML::Value << YAML::BeginMap;
+    for (const auto& serializer : serializers) {
+        if (auto id = serializer->GetId(); !id.empty()) {
+            out << YAML::Key << id;
+            out << YAML::Value << serializer->GetSavedTime();
+        }
+    }
+    out << YAML::EndMap;
     out << YAML::Key << "version";
     out << YAML::Value << std::string(environment::RunEnvironment::GetVersion());
     out << YAML::EndMap;
 
     int rank;
-    MPI_Comm_rank(PetscObjectComm((PetscObject)ts), &rank) >> utilities::MpiUtilities::checkError;
+    MPI_Comm_rank(comm, &rank) >> utilities::MpiUtilities::checkError;
     if (rank == 0) {
         auto restartFilePath = environment::RunEnvironment::Get().GetOutputDirectory() / "restart.rst";
         std::ofstream restartFile;
@@ -115,10 +212,10 @@ void ablate::io::Hdf5Serializer::RestoreTS(TS ts) {
 }
 
 ////////////// Hdf5ObjectSerializer Implementation //////////////
-ablate::io::Hdf5Serializer::Hdf5ObjectSerializer::Hdf5ObjectSerializer(std::weak_ptr<Serializable> serializableIn, PetscInt sequenceNumber, PetscReal time, bool resume)
-    : serializable(std::move(serializableIn)) {
+ablate::io::Hdf5Serializer::Hdf5ObjectSerializer::Hdf5ObjectSerializer(std::weak_ptr<Serializable> serializableIn, PetscInt sequenceNumber, PetscReal time, bool resume,
+                                                                       std::shared_ptr<Hdf5Compression> compressionIn, const std::filesystem::path& stagingDirectory, bool sharedStaging)
+    : serializable(std::move(serializableIn)), compression(std::move(compressionIn)), savedSequenceNumber(resume ? sequenceNumber : -1), savedTime(resume ? time : NAN) {
     if (auto serializableObject = serializable.lock()) {
-        MPI_Comm activeComm;
         switch (serializableObject->Serialize()) {
             case Serializable::SerializerType::collective: {
                 filePath = environment::RunEnvironment::Get().GetOutputDirectory() / (serializableObject->GetId() + extension);
@@ -134,11 +231,31 @@ ablate::io::Hdf5Serializer::Hdf5ObjectSerializer::Hdf5ObjectSerializer(std::weak
                 throw std::invalid_argument("Unable to determine Serializer Type");
         }
 
+        // a collective file is opened by every rank, so it is only staged when every rank can see the staging directory
+        if (!stagingDirectory.empty() && (activeComm == PETSC_COMM_SELF || sharedStaging)) {
+            stagingFilePath = stagingDirectory / filePath.filename();
+        }
+        const auto& writeFilePath = stagingFilePath.empty() ? filePath : stagingFilePath;
+
+        PetscMPIInt rank;
+        MPI_Comm_rank(activeComm, &rank) >> utilities::MpiUtilities::checkError;
+
         // Check to see if the viewer file exists
         if (resume) {
             if (std::filesystem::exists(filePath)) {
+                // continue appending to a staged copy of the output file
+                if (!stagingFilePath.empty()) {
+                    if (rank == 0) {
+                        std::filesystem::copy_file(filePath, stagingFilePath, std::filesystem::copy_options::overwrite_existing);
+                    }
+                    MPI_Barrier(activeComm) >> utilities::MpiUtilities::checkError;
+                }
+
                 StartEvent("PetscViewerHDF5Open");
-                PetscViewerHDF5Open(activeComm, filePath.string().c_str(), FILE_MODE_UPDATE, &petscViewer) >> utilities::PetscUtilities::checkError;
+                PetscViewerHDF5Open(activeComm, writeFilePath.string().c_str(), FILE_MODE_UPDATE, &petscViewer) >> utilities::PetscUtilities::checkError;
+                if (compression) {
+                    compression->Apply(petscViewer) >> utilities::PetscUtilities::checkError;
+                }
                 EndEvent();
 
                 // Restore the simulation
@@ -149,32 +266,101 @@ ablate::io::Hdf5Serializer::Hdf5ObjectSerializer::Hdf5ObjectSerializer(std::weak
                 throw std::runtime_error("Cannot resume simulation.  Unable to locate file: " + filePath.string());
             }
         } else {
-            PetscViewerHDF5Open(activeComm, filePath.string().c_str(), FILE_MODE_WRITE, &petscViewer) >> utilities::PetscUtilities::checkError;
+            PetscViewerHDF5Open(activeComm, writeFilePath.string().c_str(), FILE_MODE_WRITE, &petscViewer) >> utilities::PetscUtilities::checkError;
+            if (compression) {
+                compression->Apply(petscViewer) >> utilities::PetscUtilities::checkError;
+            }
         }
     }
 }
 
 ablate::io::Hdf5Serializer::Hdf5ObjectSerializer::~Hdf5ObjectSerializer() {
+    if (activeComm == MPI_COMM_NULL) {
+        return;
+    }
     if (petscViewer) {
-        // If this is the root process generate the xdmf file
-        PetscMPIInt rank;
-        MPI_Comm_rank(PetscObjectComm(PetscObject(petscViewer)), &rank);
         PetscViewerDestroy(&petscViewer) >> utilities::PetscUtilities::checkError;
+    }
 
-        if (rank == 0 && !filePath.empty() && std::filesystem::exists(filePath)) {
-            xdmfGenerator::Generate(filePath);
+    // If this is the root process generate the xdmf file.  Staged files have already been copied to the filePath
+    PetscMPIInt rank;
+    MPI_Comm_rank(activeComm, &rank);
+    if (rank == 0 && !filePath.empty() && std::filesystem::exists(filePath)) {
+        if (!stagingFilePath.empty()) {
+            std::error_code removeError;
+            std::filesystem::remove(stagingFilePath, removeError);
         }
+
+        // the compression level, chunk size, and bit rounding are applied once to the closed file, a resumed run appends to the repacked datasets
+        if (compression && compression->RequiresRepack()) {
+            StartEvent("Repack");
+            try {
+                compression->Repack(filePath);
+            } catch (const std::exception& exception) {
+                // the original file is left in place and is still valid
+                std::cerr << "Unable to repack " << filePath << ": " << exception.what() << std::endl;
+            }
+            EndEvent();
+        }
+        xdmfGenerator::Generate(filePath);
     }
 }
 
-PetscErrorCode ablate::io::Hdf5Serializer::Hdf5ObjectSerializer::Save(PetscInt sn, PetscReal t) {
+bool ablate::io::Hdf5Serializer::Hdf5ObjectSerializer::RequiresSave(bool fullSave) const {
+    if (auto serializableObject = serializable.lock()) {
+        auto state = serializableObject->GetSerializableState();
+        return fullSave || state < 0 || state != savedState;
+    }
+    return false;
+}
+
+PetscErrorCode ablate::io::Hdf5Serializer::Hdf5ObjectSerializer::Save(PetscInt sn, PetscReal t, BackgroundFileMover* fileMover) {
     PetscFunctionBeginUser;
     if (auto serializableObject = serializable.lock()) {
+        // staged files are closed between saves so that they can be copied
+        if (!petscViewer) {
+            StartEvent("PetscViewerHDF5Open");
+            PetscCall(PetscViewerHDF5Open(activeComm, stagingFilePath.string().c_str(), FILE_MODE_UPDATE, &petscViewer));
+            if (compression) {
+                PetscCall(compression->Apply(petscViewer));
+            }
+            EndEvent();
+        }
+
         PetscCall(serializableObject->Save(petscViewer, sn, t));
+        savedSequenceNumber = sn;
+        savedTime = t;
+
+        // record the state after saving, some objects compute their outputs during the save
+        savedState = serializableObject->GetSerializableState();
+
+        // close the staged file and copy it to the output directory in the background, a collective file is copied by the first rank
+        if (!stagingFilePath.empty() && fileMover) {
+            PetscCall(PetscViewerDestroy(&petscViewer));
+            PetscMPIInt rank;
+            PetscCallMPI(MPI_Comm_rank(activeComm, &rank));
+            if (rank == 0) {
+                fileMover->Enqueue(stagingFilePath, filePath, sn, true);
+            }
+        }
     }
     PetscFunctionReturn(0);
 }
 
+std::string ablate::io::Hdf5Serializer::Hdf5ObjectSerializer::GetId() const {
+    if (auto serializableObject = serializable.lock()) {
+        return serializableObject->GetId();
+    }
+    return {};
+}
+
 #include "registrar.hpp"
 REGISTER_DEFAULT(ablate::io::Serializer, ablate::io::Hdf5Serializer, "default serializer for IO",
-                 ARG(ablate::io::interval::Interval, "interval", "The interval object used to determine write interval."));
+                 ARG(ablate::io::interval::Interval, "interval", "The interval object used to determine write interval."),
+                 OPT(ablate::io::Hdf5Compression, "compression", "optional chunking/compression of the hdf5 datasets.  Lossy (single precision or bit rounded) outputs do not write restart information."),
+                 OPT(int, "fullCheckpointInterval",
+                     "when greater than zero, objects that have not changed since their last save are referenced instead of rewritten and a full checkpoint is written every n saves (default 0, "
+                     "always full)"),
+                 OPT(std::string, "stagingDirectory",
+                     "optional fast directory (node local or burst buffer) where each file is written.  After each save the files are copied to the output directory on a background thread and the "
+                     "next save waits for the copies.  Collective files are only staged when every rank can see the directory."));
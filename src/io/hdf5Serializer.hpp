@@ -4,8 +4,11 @@
 #include <petscviewer.h>
 #include <filesystem>
 #include <io/interval/interval.hpp>
+#include <map>
 #include <memory>
 #include <vector>
+#include "backgroundFileMover.hpp"
+#include "hdf5Compression.hpp"
 #include "serializable.hpp"
 #include "serializer.hpp"
 #include "utilities/loggable.hpp"
@@ -21,20 +24,78 @@ class Hdf5Serializer : public Serializer {
        private:
         PetscViewer petscViewer = nullptr;
         const std::weak_ptr<Serializable> serializable;
+        const std::shared_ptr<Hdf5Compression> compression;
 
         inline const static std::string extension = ".hdf5";
         std::filesystem::path filePath;
 
+        //! when staged, the file is written here and copied to the filePath after each save
+        std::filesystem::path stagingFilePath;
+
+        //! the communicator used to open the file
+        MPI_Comm activeComm = MPI_COMM_NULL;
+
+        //! the sequence number, time, and serializable state of the most recent save of this object
+        PetscInt savedSequenceNumber;
+        PetscReal savedTime;
+        PetscObjectState savedState = -1;
+
        public:
-        explicit Hdf5ObjectSerializer(std::weak_ptr<Serializable> serializable, PetscInt sequenceNumber, PetscReal time, bool resumed);
+        /**
+         * @param serializable
+         * @param sequenceNumber
+         * @param time
+         * @param resumed
+         * @param compression
+         * @param stagingDirectory optional directory used to write the file, a collective file is only staged when sharedStaging is true
+         * @param sharedStaging true when every rank can see the staging directory
+         */
+        explicit Hdf5ObjectSerializer(std::weak_ptr<Serializable> serializable, PetscInt sequenceNumber, PetscReal time, bool resumed, std::shared_ptr<Hdf5Compression> compression = {},
+                                      const std::filesystem::path& stagingDirectory = {}, bool sharedStaging = false);
         ~Hdf5ObjectSerializer();
 
-        PetscErrorCode Save(PetscInt sequenceNumber, PetscReal time);
+        /**
+         * Determine if the object must be written.  Unless a full save is requested, an object with an unchanged serializable state is not written again.
+         * @param fullSave
+         * @return
+         */
+        [[nodiscard]] bool RequiresSave(bool fullSave) const;
+
+        /**
+         * Save the object to the file.  A staged file is closed and queued to be copied to the output directory.
+         * @param sequenceNumber
+         * @param time
+         * @param fileMover copies the staged file, may be null when not staging
+         * @return
+         */
+        PetscErrorCode Save(PetscInt sequenceNumber, PetscReal time, BackgroundFileMover* fileMover);
+
+        //! the sequence number that holds the most recent copy of this object
+        [[nodiscard]] PetscInt GetSavedSequenceNumber() const { return savedSequenceNumber; }
+
+        //! the time of the sequence that holds the most recent copy of this object
+        [[nodiscard]] PetscReal GetSavedTime() const { return savedTime; }
+
+        //! the id of the serializable object, empty if it no longer exists
+        [[nodiscard]] std::string GetId() const;
     };
 
     // Use the interval class to determine when to write to file
     const std::shared_ptr<ablate::io::interval::Interval> interval;
 
+    // optional chunking/compression applied to each file
+    const std::shared_ptr<Hdf5Compression> compression;
+
+    //! when greater than zero, unchanged objects reference the previous save and every n-th save is a full checkpoint
+    const PetscInt fullCheckpointInterval;
+
+    //! the sequence number of the most recent full checkpoint
+    PetscInt fullSequenceNumber;
+
+    //! the sequence number and time to restore each object from, read from the restart file
+    std::map<std::string, PetscInt> restoreSequenceNumbers;
+    std::map<std::string, PetscReal> restoreTimes;
+
     // keep track of time and increments
     PetscReal time;
     PetscReal dt;
@@ -42,17 +103,40 @@ class Hdf5Serializer : public Serializer {
     PetscInt timeStep;
     bool resumed = false;
 
+    //! optional directory where the files are written before being copied to the output directory in the background
+    const std::filesystem::path stagingDirectory;
+
+    //! true when every rank can see the staging directory, so the collective files can also be staged
+    bool sharedStaging = false;
+
+    //! when staging, the restart file is only written once the files for the sequence have been copied
+    bool metadataPending = false;
+
     // Hold the pointer to each serializers;
     std::vector<std::unique_ptr<Hdf5ObjectSerializer>> serializers;
 
+    //! copies the staged files to the output directory, declared after the serializers so that it is drained before they are destroyed
+    std::unique_ptr<BackgroundFileMover> fileMover;
+
     // Petsc function used to save the system state
     static PetscErrorCode Hdf5SerializerSaveStateFunction(TS ts, PetscInt steps, PetscReal time, Vec u, void* mctx);
 
     // Private functions to load and save the ts metadata data
-    void SaveMetadata(TS ts) const;
+    void SaveMetadata(MPI_Comm comm) const;
+
+    //! wait for the previous copies on every rank and write their restart file, this is collective
+    void CompleteStagedSave(MPI_Comm comm);
 
    public:
-    explicit Hdf5Serializer(std::shared_ptr<ablate::io::interval::Interval>);
+    /**
+     * @param interval the interval object used to determine write interval
+     * @param compression optional chunking/compression of the datasets.  Lossy outputs do not write restart information.
+     * @param fullCheckpointInterval when greater than zero, objects with an unchanged state are not rewritten and a full checkpoint is written every n saves
+     * @param stagingDirectory optional fast (node local or burst buffer) directory where each file is written.  After each save the files are copied to the output
+     * directory on a background thread; the next save waits for the copies (back-pressure).  Collective files are only staged when every rank can see the directory.
+     */
+    explicit Hdf5Serializer(std::shared_ptr<ablate::io::interval::Interval> interval, std::shared_ptr<Hdf5Compression> compression = {}, PetscInt fullCheckpointInterval = 0,
+                            const std::string& stagingDirectory = {});
 
     /**
      * Handles registering the object and restore if available.
@@ -64,6 +148,11 @@ class Hdf5Serializer : public Serializer {
     PetscSerializeFunction GetSerializeFunction() override { return Hdf5SerializerSaveStateFunction; }
 
     void RestoreTS(TS ts) override;
+
+    /**
+     * Waits for the staged copies on every rank and writes the restart file for the last save.  This is collective.
+     */
+    void Finalize() override;
 };
 }  // namespace ablate::io
 
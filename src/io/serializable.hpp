@@ -46,6 +46,13 @@ class Serializable {
      */
     virtual PetscErrorCode Restore(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) = 0;
 
+    /**
+     * Optional state used for incremental checkpoints.  If the state is unchanged since the last save, the serializer may reference the
+     * previous save instead of writing the object again.  The default of -1 indicates the state is unknown and the object is always saved.
+     * @return
+     */
+    [[nodiscard]] virtual PetscObjectState GetSerializableState() { return -1; }
+
    protected:
     /**
      * helper function to save PetscScalar to a PetscViewer. It is assumed to be the same value across all mpi ranks
@@ -41,6 +41,12 @@ class Serializer {
      */
     virtual void RestoreTS(TS ts) = 0;
 
+    /**
+     * Complete any pending (background) output and write the final restart information.  This is collective and is called by the time stepper once it
+     * is done stepping so that the destructor never communicates.  Any output written after Finalize is completed by the next call.
+     */
+    virtual void Finalize() {}
+
     /**
      * Manually call the save for this seralizer
      */
@@ -0,0 +1,220 @@
+#include "interfaceReconstruction.hpp"
+#include <petscblaslapack.h>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include "LS-VOF.hpp"
+#include "utilities/petscSupport.hpp"
+#include "utilities/petscUtilities.hpp"
+
+ablate::levelSet::InterfaceReconstruction::InterfaceReconstruction(DM dm, const ablate::domain::Range &cellRange) : numberCells(cellRange.end - cellRange.start) {
+    DMGetDimension(dm, &dim) >> utilities::PetscUtilities::checkError;
+
+    // group the cells by type so each evaluation is a single loop per type
+    std::map<DMPolytopeType, std::size_t> blockIndex;
+    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+        const PetscInt cell = cellRange.GetPoint(c);
+
+        DMPolytopeType ct;
+        DMPlexGetCellType(dm, cell, &ct) >> utilities::PetscUtilities::checkError;
+        switch (ct) {
+            case DM_POLYTOPE_SEGMENT:
+            case DM_POLYTOPE_TRIANGLE:
+            case DM_POLYTOPE_QUADRILATERAL:
+            case DM_POLYTOPE_TETRAHEDRON:
+            case DM_POLYTOPE_HEXAHEDRON:
+                break;
+            default:
+                throw std::invalid_argument("No element geometry for cell " + std::to_string(cell) + " with type " + DMPolytopeTypes[ct]);
+        }
+
+        // Coordinates of the cell vertices
+        PetscInt nc;
+        PetscReal *coords = nullptr;
+        const PetscScalar *array;
+        PetscBool isDG;
+        DMPlexGetCellCoordinates(dm, cell, &isDG, &nc, &array, &coords) >> utilities::PetscUtilities::checkError;
+        const PetscInt nv = nc / dim;
+
+        if (!blockIndex.count(ct)) {
+            blockIndex[ct] = blocks.size();
+            blocks.push_back(CellBlock{.cellType = ct, .numberVertices = nv});
+        }
+        auto &block = blocks[blockIndex[ct]];
+        if (block.numberVertices != nv) {
+            throw std::invalid_argument("Cell " + std::to_string(cell) + " has an unexpected number of vertices (" + std::to_string(nv) + ")");
+        }
+        block.rangeIndices.push_back(c - cellRange.start);
+        block.coordinates.insert(block.coordinates.end(), coords, coords + nc);
+
+        // The vertices in the same order as the coordinates
+        PetscInt nVerts, *verts;
+        DMPlexCellGetVertices(dm, cell, &nVerts, &verts) >> utilities::PetscUtilities::checkError;
+        block.vertices.insert(block.vertices.end(), verts, verts + nVerts);
+        DMPlexCellRestoreVertices(dm, cell, &nVerts, &verts) >> utilities::PetscUtilities::checkError;
+
+        // The gradient is computed about the cell center
+        PetscReal x0[3];
+        DMPlexComputeCellGeometryFVM(dm, cell, nullptr, x0, nullptr) >> utilities::PetscUtilities::checkError;
+        block.gradientOperators.resize(block.gradientOperators.size() + (dim + 1) * nv);
+        ComputeGradientOperator(nv, x0, coords, block.gradientOperators.data() + block.gradientOperators.size() - (dim + 1) * nv);
+
+        DMPlexRestoreCellCoordinates(dm, cell, &isDG, &nc, &array, &coords) >> utilities::PetscUtilities::checkError;
+    }
+
+    // The cell sizes only depend upon the geometry
+    std::vector<std::vector<PetscReal>> vertexValues(blocks.size());
+    for (std::size_t b = 0; b < blocks.size(); ++b) {
+        vertexValues[b].assign(blocks[b].vertices.size(), 1.0);
+    }
+    std::vector<PetscReal> volumes(numberCells);
+    VOF(vertexValues, nullptr, nullptr, volumes.data());
+    for (auto &block : blocks) {
+        block.volumes.resize(block.rangeIndices.size());
+        for (std::size_t i = 0; i < block.rangeIndices.size(); ++i) {
+            block.volumes[i] = volumes[block.rangeIndices[i]];
+        }
+    }
+}
+
+void ablate::levelSet::InterfaceReconstruction::ComputeGradientOperator(PetscInt numberVertices, const PetscReal x0[], const PetscReal coords[], PetscReal gradientOperator[]) const {
+    // The Taylor-series system (one row per vertex) is solved in the least squares sense for the identity, giving the pseudo-inverse
+    PetscBLASInt m = (PetscBLASInt)numberVertices, n = (PetscBLASInt)(dim + 1), nrhs = m, info;
+    std::vector<PetscReal> A(m * n);
+    std::vector<PetscReal> x(m * m, 0.0);
+    for (PetscInt v = 0; v < numberVertices; ++v) {
+        A[v] = 1.0;
+        for (PetscInt d = 0; d < dim; ++d) {
+            A[v + (d + 1) * m] = coords[v * dim + d] - x0[d];
+        }
+        x[v + v * m] = 1.0;
+    }
+
+    char transpose = 'N';
+    PetscBLASInt worksize = -1;
+    PetscReal optimalWorksize;
+    LAPACKgels_(&transpose, &m, &n, &nrhs, A.data(), &m, x.data(), &m, &optimalWorksize, &worksize, &info);
+    worksize = (PetscBLASInt)optimalWorksize;
+    std::vector<PetscReal> work(worksize);
+    LAPACKgels_(&transpose, &m, &n, &nrhs, A.data(), &m, x.data(), &m, work.data(), &worksize, &info);
+    if (info != 0) {
+        throw std::runtime_error("Error while calling the Lapack routine DGELS in ablate::levelSet::InterfaceReconstruction");
+    }
+
+    // The solution is stored in the first n rows of each column
+    for (PetscInt v = 0; v < numberVertices; ++v) {
+        for (PetscInt r = 0; r < dim + 1; ++r) {
+            gradientOperator[r + v * (dim + 1)] = x[r + v * m];
+        }
+    }
+}
+
+void ablate::levelSet::InterfaceReconstruction::VOF(const std::vector<std::vector<PetscReal>> &vertexValues, PetscReal *vof, PetscReal *area, PetscReal *vol) const {
+    for (std::size_t b = 0; b < blocks.size(); ++b) {
+        const auto &block = blocks[b];
+        const PetscInt nv = block.numberVertices;
+        const PetscInt nCells = (PetscInt)block.rangeIndices.size();
+        const PetscReal *coords = block.coordinates.data();
+        const PetscReal *c = vertexValues[b].data();
+        const PetscInt *index = block.rangeIndices.data();
+
+        // The cell sizes are known after construction, so only compute them when still needed
+        const bool computeVolume = vol && block.volumes.empty();
+        if (vol && !computeVolume) {
+            for (PetscInt i = 0; i < nCells; ++i) {
+                vol[index[i]] = block.volumes[i];
+            }
+        }
+
+        // Select the kernel once per block
+        void (*kernel)(const PetscReal[], const PetscReal[], PetscReal *, PetscReal *, PetscReal *);
+        switch (block.cellType) {
+            case DM_POLYTOPE_SEGMENT:
+                kernel = VOF_1D;
+                break;
+            case DM_POLYTOPE_TRIANGLE:
+                kernel = VOF_2D_Tri;
+                break;
+            case DM_POLYTOPE_QUADRILATERAL:
+                kernel = VOF_2D_Quad;
+                break;
+            case DM_POLYTOPE_TETRAHEDRON:
+                kernel = VOF_3D_Tetra;
+                break;
+            case DM_POLYTOPE_HEXAHEDRON:
+                kernel = VOF_3D_Hex;
+                break;
+            default:
+                throw std::invalid_argument(std::string("No element geometry for cell type ") + DMPolytopeTypes[block.cellType]);
+        }
+
+        for (PetscInt i = 0; i < nCells; ++i) {
+            kernel(coords + i * nv * dim, c + i * nv, vof ? vof + index[i] : nullptr, area ? area + index[i] : nullptr, computeVolume ? vol + index[i] : nullptr);
+        }
+    }
+}
+
+void ablate::levelSet::InterfaceReconstruction::GetVertexValues(DM dm, Vec localVec, PetscInt fieldId, std::vector<std::vector<PetscReal>> &vertexValues) const {
+    const PetscScalar *array;
+    VecGetArrayRead(localVec, &array) >> utilities::PetscUtilities::checkError;
+    vertexValues.resize(blocks.size());
+    for (std::size_t b = 0; b < blocks.size(); ++b) {
+        const auto &vertices = blocks[b].vertices;
+        vertexValues[b].resize(vertices.size());
+        for (std::size_t v = 0; v < vertices.size(); ++v) {
+            const PetscScalar *val;
+            xDMPlexPointLocalRead(dm, vertices[v], fieldId, array, &val) >> utilities::PetscUtilities::checkError;
+            vertexValues[b][v] = *val;
+        }
+    }
+    VecRestoreArrayRead(localVec, &array) >> utilities::PetscUtilities::checkError;
+}
+
+void ablate::levelSet::InterfaceReconstruction::VOF(const std::shared_ptr<ablate::mathFunctions::MathFunction> &phi, PetscReal time, PetscReal *vof, PetscReal *area,
+                                                    PetscReal *vol) const {
+    std::vector<std::vector<PetscReal>> vertexValues(blocks.size());
+    for (std::size_t b = 0; b < blocks.size(); ++b) {
+        const auto &block = blocks[b];
+        vertexValues[b].resize(block.vertices.size());
+        phi->Eval(block.coordinates.data(), (int)dim, block.vertices.size(), time, vertexValues[b].data());
+    }
+    VOF(vertexValues, vof, area, vol);
+}
+
+void ablate::levelSet::InterfaceReconstruction::VOF(DM dm, Vec localVec, PetscInt fieldId, PetscReal *vof, PetscReal *area, PetscReal *vol) const {
+    std::vector<std::vector<PetscReal>> vertexValues;
+    GetVertexValues(dm, localVec, fieldId, vertexValues);
+    VOF(vertexValues, vof, area, vol);
+}
+
+void ablate::levelSet::InterfaceReconstruction::CellValGrad(DM dm, Vec localVec, PetscInt fieldId, PetscReal *c0, PetscReal *g) const {
+    std::vector<std::vector<PetscReal>> vertexValues;
+    GetVertexValues(dm, localVec, fieldId, vertexValues);
+
+    const PetscInt rows = dim + 1;
+    for (std::size_t b = 0; b < blocks.size(); ++b) {
+        const auto &block = blocks[b];
+        const PetscInt nv = block.numberVertices;
+        const PetscReal *c = vertexValues[b].data();
+
+        for (std::size_t i = 0; i < block.rangeIndices.size(); ++i) {
+            const PetscReal *op = block.gradientOperators.data() + i * rows * nv;
+            const PetscReal *cellValues = c + i * nv;
+
+            PetscReal result[4] = {0.0, 0.0, 0.0, 0.0};
+            for (PetscInt v = 0; v < nv; ++v) {
+                for (PetscInt r = 0; r < rows; ++r) {
+                    result[r] += op[r + v * rows] * cellValues[v];
+                }
+            }
+
+            const PetscInt index = block.rangeIndices[i];
+            if (c0) c0[index] = result[0];
+            if (g) {
+                for (PetscInt d = 0; d < dim; ++d) {
+                    g[index * dim + d] = result[d + 1];
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,115 @@
+#ifndef ABLATELIBRARY_INTERFACERECONSTRUCTION_HPP
+#define ABLATELIBRARY_INTERFACERECONSTRUCTION_HPP
+
+#include <petsc.h>
+#include <memory>
+#include <vector>
+#include "domain/range.hpp"
+#include "mathFunctions/mathFunction.hpp"
+
+namespace ablate::levelSet {
+
+/**
+ * Batched volume-of-fluid, interface area, and gradient evaluation over a range of cells.  The vertex points, vertex coordinates, cell volumes and
+ * Taylor-series gradient operators are gathered once at construction and grouped by cell type, so each evaluation is a tight loop over contiguous
+ * cell data without any per cell DMPlex calls.  The results match ablate::levelSet::Utilities::VOF and ablate::levelSet::Utilities::CellValGrad.
+ *
+ * Currently only the initialization (VOFMathFunction) uses the batched evaluation; the vertex field VOF and CellValGrad have no per step caller yet.
+ */
+class InterfaceReconstruction {
+   private:
+    /**
+     * The cells of a single cell type
+     */
+    struct CellBlock {
+        DMPolytopeType cellType;
+        //! the number of vertices per cell
+        PetscInt numberVertices;
+        //! the index of each cell in the range
+        std::vector<PetscInt> rangeIndices;
+        //! the vertex points of each cell, numberVertices per cell
+        std::vector<PetscInt> vertices;
+        //! the vertex coordinates of each cell, numberVertices*dim per cell ordered as DMPlexGetCellCoordinates
+        std::vector<PetscReal> coordinates;
+        //! the area (2D) or volume (3D) of each cell
+        std::vector<PetscReal> volumes;
+        //! the column major (dim+1) x numberVertices least squares operator from the vertex values to the cell center value and gradient, per cell
+        std::vector<PetscReal> gradientOperators;
+    };
+
+    //! the dimension of the mesh
+    PetscInt dim;
+
+    //! the number of cells in the range
+    PetscInt numberCells;
+
+    //! the cells grouped by type
+    std::vector<CellBlock> blocks;
+
+    /**
+     * Compute the pseudo-inverse of the Taylor-series system used by Grad_1D, Grad_2D_Tri, etc. for a single cell
+     * @param numberVertices
+     * @param x0 the cell center
+     * @param coords the vertex coordinates
+     * @param gradientOperator the resulting (dim+1) x numberVertices operator
+     */
+    void ComputeGradientOperator(PetscInt numberVertices, const PetscReal x0[], const PetscReal coords[], PetscReal gradientOperator[]) const;
+
+    /**
+     * Compute the vof for every cell given the level set values at the vertices of each cell in each block
+     * @param vertexValues the level set values for each block, numberVertices per cell
+     */
+    void VOF(const std::vector<std::vector<PetscReal>>& vertexValues, PetscReal* vof, PetscReal* area, PetscReal* vol) const;
+
+    /**
+     * Read the vertex values of every cell in each block from a local vector
+     */
+    void GetVertexValues(DM dm, Vec localVec, PetscInt fieldId, std::vector<std::vector<PetscReal>>& vertexValues) const;
+
+   public:
+    /**
+     * Gather the cell data
+     * @param dm the mesh
+     * @param cellRange the cells to evaluate, results are indexed by the location in the range (cell - cellRange.start)
+     */
+    InterfaceReconstruction(DM dm, const ablate::domain::Range& cellRange);
+
+    /**
+     * Compute the VOF for every cell given an analytic level set function
+     * @param phi function used to calculate the level set values at the vertices
+     * @param time the time passed to phi
+     * @param vof - The volume-of-fluid (may be null)
+     * @param area - The face length(2D) or area(3D) in the cell (may be null)
+     * @param vol - The area/volume of the entire cell (may be null)
+     */
+    void VOF(const std::shared_ptr<ablate::mathFunctions::MathFunction>& phi, PetscReal time, PetscReal* vof, PetscReal* area, PetscReal* vol) const;
+
+    /**
+     * Compute the VOF for every cell given a vertex based level set field
+     * @param dm - The DM of the level set data
+     * @param localVec - The local vector containing the level set
+     * @param fieldId - The field ID of the level set, -1 if the vector only holds the level set
+     * @param vof - The volume-of-fluid (may be null)
+     * @param area - The face length(2D) or area(3D) in the cell (may be null)
+     * @param vol - The area/volume of the entire cell (may be null)
+     */
+    void VOF(DM dm, Vec localVec, PetscInt fieldId, PetscReal* vof, PetscReal* area, PetscReal* vol) const;
+
+    /**
+     * Compute the cell center value and gradient of a vertex based field for every cell
+     * @param dm - The DM of the data
+     * @param localVec - The local vector containing the data
+     * @param fieldId - The field ID of the data, -1 if the vector only holds the data
+     * @param c0 - The function value at each cell center (may be null)
+     * @param g - The gradient at each cell center, dim per cell (may be null)
+     */
+    void CellValGrad(DM dm, Vec localVec, PetscInt fieldId, PetscReal* c0, PetscReal* g) const;
+
+    /**
+     * @return the number of cells in the range
+     */
+    [[nodiscard]] inline PetscInt GetNumberCells() const { return numberCells; }
+};
+
+}  // namespace ablate::levelSet
+#endif  // ABLATELIBRARY_INTERFACERECONSTRUCTION_HPP
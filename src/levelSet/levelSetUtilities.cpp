@@ -220,8 +220,8 @@ void ablate::levelSet::Utilities::VOF(DM dm, const PetscInt p, const PetscReal c
 
 // Returns the VOF for a given cell using an analytic level set equation
 // Refer to "Quadrature rules for triangular and tetrahedral elements with generalized functions"
-void ablate::levelSet::Utilities::VOF(DM dm, PetscInt p, const std::shared_ptr<ablate::mathFunctions::MathFunction> &phi, PetscReal *vof, PetscReal *area, PetscReal *vol) {
-    PetscInt dim, Nc, nVerts, i;
+void ablate::levelSet::Utilities::VOF(DM dm, PetscInt p, const std::shared_ptr<ablate::mathFunctions::MathFunction> &phi, PetscReal *vof, PetscReal *area, PetscReal *vol, PetscReal time) {
+    PetscInt dim, Nc, nVerts;
     PetscReal *c = NULL, *coords = NULL;
     const PetscScalar *array;
     PetscBool isDG;
@@ -238,9 +238,7 @@ void ablate::levelSet::Utilities::VOF(DM dm, PetscInt p, const std::shared_ptr<a
 
     // The level set value of each vertex. This assumes that the interface is a line/plane
     //    with the given unit normal.
-    for (i = 0; i < nVerts; ++i) {
-        c[i] = phi->Eval(&coords[i * dim], dim, 0.0);
-    }
+    phi->Eval(coords, (int)dim, (std::size_t)nVerts, time, c);
 
     DMPlexRestoreCellCoordinates(dm, p, &isDG, &Nc, &array, &coords) >> ablate::utilities::PetscUtilities::checkError;
 
@@ -37,8 +37,9 @@ void VOF(DM dm, const PetscInt p, PetscReal *c, PetscReal *vof, PetscReal *area,
  * @param vof - The volume-of-fluid
  * @param area - The face length(2D) or area(3D) in the cell
  * @param vol - The area/volume of the entire cell
+ * @param time - The time passed to phi
  */
-void VOF(DM dm, PetscInt p, const std::shared_ptr<ablate::mathFunctions::MathFunction> &phi, PetscReal *vof, PetscReal *area, PetscReal *vol);
+void VOF(DM dm, PetscInt p, const std::shared_ptr<ablate::mathFunctions::MathFunction> &phi, PetscReal *vof, PetscReal *area, PetscReal *vol, PetscReal time = 0.0);
 
 /**
  * Calculate the VOF for a cell given an analytic level set function
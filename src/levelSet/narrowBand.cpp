@@ -0,0 +1,168 @@
+#include "narrowBand.hpp"
+#include <algorithm>
+#include "utilities/petscUtilities.hpp"
+
+ablate::levelSet::NarrowBand::NarrowBand(DM dm, const ablate::domain::Range &cellRange, PetscInt numberLevels, PetscInt rebuildInterval)
+    : numberLevels(numberLevels), rebuildInterval(rebuildInterval) {
+    DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> utilities::PetscUtilities::checkError;
+    DMPlexGetDepthStratum(dm, 0, &vStart, &vEnd) >> utilities::PetscUtilities::checkError;
+    const PetscInt numberCells = cEnd - cStart;
+
+    // Mark the cells in the range, every other cell is an overlap or ghost cell that is only used to find the interface
+    inRange.assign(numberCells, false);
+    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+        inRange[cellRange.GetPoint(c) - cStart] = true;
+    }
+    for (PetscInt i = 0; i < numberCells; ++i) {
+        if (!inRange[i]) {
+            borderCells.push_back(i);
+        }
+    }
+
+    // The vertices of each cell.  The closure is used directly because the boundary ghost cells do not have a cell type with vertices.
+    vertexOffsets.reserve(numberCells + 1);
+    vertexOffsets.push_back(0);
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+        PetscInt *closure = nullptr;
+        PetscInt numClosure;
+        DMPlexGetTransitiveClosure(dm, cell, PETSC_TRUE, &numClosure, &closure) >> utilities::PetscUtilities::checkError;
+        for (PetscInt cl = 0; cl < numClosure * 2; cl += 2) {
+            if (closure[cl] >= vStart && closure[cl] < vEnd) {
+                vertices.push_back(closure[cl]);
+            }
+        }
+        DMPlexRestoreTransitiveClosure(dm, cell, PETSC_TRUE, &numClosure, &closure) >> utilities::PetscUtilities::checkError;
+        vertexOffsets.push_back((PetscInt)vertices.size());
+    }
+
+    // Invert the cell to vertex map
+    std::vector<PetscInt> vertexCellOffsets(vEnd - vStart + 1, 0);
+    for (const auto v : vertices) {
+        ++vertexCellOffsets[v - vStart + 1];
+    }
+    for (PetscInt v = 0; v < vEnd - vStart; ++v) {
+        vertexCellOffsets[v + 1] += vertexCellOffsets[v];
+    }
+    std::vector<PetscInt> vertexCells(vertices.size());
+    std::vector<PetscInt> vertexCellCount(vEnd - vStart, 0);
+    for (PetscInt i = 0; i < numberCells; ++i) {
+        for (PetscInt j = vertexOffsets[i]; j < vertexOffsets[i + 1]; ++j) {
+            const PetscInt v = vertices[j] - vStart;
+            vertexCells[vertexCellOffsets[v] + vertexCellCount[v]++] = i;
+        }
+    }
+
+    // Cells are neighbors if they share a vertex
+    std::vector<PetscInt> lastSeen(numberCells, -1);
+    neighborOffsets.reserve(numberCells + 1);
+    neighborOffsets.push_back(0);
+    for (PetscInt i = 0; i < numberCells; ++i) {
+        lastSeen[i] = i;
+        for (PetscInt j = vertexOffsets[i]; j < vertexOffsets[i + 1]; ++j) {
+            const PetscInt v = vertices[j] - vStart;
+            for (PetscInt k = vertexCellOffsets[v]; k < vertexCellOffsets[v + 1]; ++k) {
+                const PetscInt n = vertexCells[k];
+                if (lastSeen[n] != i) {
+                    lastSeen[n] = i;
+                    neighbors.push_back(n);
+                }
+            }
+        }
+        neighborOffsets.push_back((PetscInt)neighbors.size());
+    }
+
+    levels.assign(numberCells, -1);
+    vertexInBand.assign(vEnd - vStart, false);
+}
+
+void ablate::levelSet::NarrowBand::BuildBand(const std::vector<PetscInt> &interfaceCells) {
+    // Only reset the cells and vertices in the previous band
+    for (const auto i : bandCells) {
+        levels[i] = -1;
+    }
+    for (const auto v : bandVertexPoints) {
+        vertexInBand[v - vStart] = false;
+    }
+    bandCells.clear();
+    bandCellPoints.clear();
+    bandVertexPoints.clear();
+
+    // Breadth first search out from the interface cells
+    for (const auto i : interfaceCells) {
+        levels[i] = 0;
+        bandCells.push_back(i);
+    }
+    for (std::size_t b = 0; b < bandCells.size(); ++b) {
+        const PetscInt i = bandCells[b];
+        if (levels[i] >= numberLevels) {
+            continue;
+        }
+        for (PetscInt j = neighborOffsets[i]; j < neighborOffsets[i + 1]; ++j) {
+            const PetscInt n = neighbors[j];
+            if (levels[n] < 0) {
+                levels[n] = levels[i] + 1;
+                bandCells.push_back(n);
+            }
+        }
+    }
+
+    // Keep the band in mesh order so the cell data is accessed in order.  Only the cells in the range are reported.
+    std::sort(bandCells.begin(), bandCells.end());
+    for (const auto i : bandCells) {
+        if (!inRange[i]) {
+            continue;
+        }
+        bandCellPoints.push_back(cStart + i);
+        for (PetscInt j = vertexOffsets[i]; j < vertexOffsets[i + 1]; ++j) {
+            const PetscInt v = vertices[j];
+            if (!vertexInBand[v - vStart]) {
+                vertexInBand[v - vStart] = true;
+                bandVertexPoints.push_back(v);
+            }
+        }
+    }
+    std::sort(bandVertexPoints.begin(), bandVertexPoints.end());
+}
+
+void ablate::levelSet::NarrowBand::Rebuild(const std::function<bool(PetscInt)> &isInterfaceCell) {
+    std::vector<PetscInt> interfaceCells;
+    for (PetscInt i = 0; i < cEnd - cStart; ++i) {
+        if (isInterfaceCell(cStart + i)) {
+            interfaceCells.push_back(i);
+        }
+    }
+    updatesSinceRebuild = 0;
+    BuildBand(interfaceCells);
+}
+
+void ablate::levelSet::NarrowBand::Update(const std::function<bool(PetscInt)> &isInterfaceCell) {
+    if (rebuildInterval > 0 && ++updatesSinceRebuild >= rebuildInterval) {
+        Rebuild(isInterfaceCell);
+        return;
+    }
+
+    // The interface can only have moved within the current band or entered through the cells outside of the range
+    std::vector<PetscInt> interfaceCells;
+    for (const auto i : bandCells) {
+        if (isInterfaceCell(cStart + i)) {
+            interfaceCells.push_back(i);
+        }
+    }
+    for (const auto i : borderCells) {
+        if (levels[i] < 0 && isInterfaceCell(cStart + i)) {
+            interfaceCells.push_back(i);
+        }
+    }
+    BuildBand(interfaceCells);
+}
+
+void ablate::levelSet::NarrowBand::GetNeighbors(PetscInt cell, std::vector<PetscInt> &neighborCells) const {
+    neighborCells.clear();
+    if (cell < cStart || cell >= cEnd) {
+        return;
+    }
+    const PetscInt index = cell - cStart;
+    for (PetscInt j = neighborOffsets[index]; j < neighborOffsets[index + 1]; ++j) {
+        neighborCells.push_back(cStart + neighbors[j]);
+    }
+}
@@ -0,0 +1,120 @@
+#ifndef ABLATELIBRARY_NARROWBAND_HPP
+#define ABLATELIBRARY_NARROWBAND_HPP
+
+#include <petsc.h>
+#include <functional>
+#include <vector>
+#include "domain/range.hpp"
+
+namespace ablate::levelSet {
+
+/**
+ * Tracks the cells (and their vertices) within a number of cell layers of an interface so level set, VOF, and curvature work can be restricted to
+ * the cells that carry interface information.  The cell connectivity (cells sharing a vertex) is built once over every cell in the local dm, including
+ * the mpi overlap and boundary ghost cells, so an interface on the other side of a partition or ghost boundary is seen.  Only the cells in the range
+ * (and their vertices) are reported in the band.  After the first Rebuild the band is updated incrementally: only the cells in the current band and the
+ * cells outside of the range are checked for the interface, so the cost is proportional to the band and partition boundary size and not the mesh size.
+ * This assumes that the interface moves less than the number of levels between updates.
+ */
+class NarrowBand {
+   private:
+    //! the number of cell layers around the interface cells
+    const PetscInt numberLevels;
+
+    //! the number of updates between full rebuilds, 0 only rebuilds when Rebuild is called
+    const PetscInt rebuildInterval;
+
+    //! the number of updates since the last full rebuild
+    PetscInt updatesSinceRebuild = 0;
+
+    //! the first cell and vertex point in the dm
+    PetscInt cStart, cEnd, vStart, vEnd;
+
+    //! mark each cell (offset by cStart) in the range
+    std::vector<bool> inRange;
+
+    //! the cells (offset by cStart) outside of the range, i.e. the mpi overlap and boundary ghost cells
+    std::vector<PetscInt> borderCells;
+
+    //! the neighbors (sharing a vertex) of each cell in compressed row format, both offset by cStart
+    std::vector<PetscInt> neighborOffsets;
+    std::vector<PetscInt> neighbors;
+
+    //! the vertices of each cell (offset by cStart) in compressed row format using vertex points
+    std::vector<PetscInt> vertexOffsets;
+    std::vector<PetscInt> vertices;
+
+    //! the level of each cell (offset by cStart), 0 for interface cells and -1 for cells outside of the band
+    std::vector<PetscInt> levels;
+
+    //! the cells (offset by cStart) in the band, including the cells outside of the range
+    std::vector<PetscInt> bandCells;
+
+    //! the cell points in the range and their vertex points in the band
+    std::vector<PetscInt> bandCellPoints;
+    std::vector<PetscInt> bandVertexPoints;
+
+    //! mark each vertex (offset by vStart) in the band
+    std::vector<bool> vertexInBand;
+
+    /**
+     * Clear the current band and build it from the interface cells
+     */
+    void BuildBand(const std::vector<PetscInt>& interfaceCells);
+
+   public:
+    /**
+     * Build the connectivity for every cell in the dm
+     * @param dm the mesh
+     * @param cellRange the cells that are reported in the band
+     * @param numberLevels the number of cell layers to keep on each side of the interface
+     * @param rebuildInterval the number of updates between full rebuilds, 0 (default) only rebuilds when Rebuild is called
+     */
+    NarrowBand(DM dm, const ablate::domain::Range& cellRange, PetscInt numberLevels, PetscInt rebuildInterval = 0);
+
+    /**
+     * Rebuild the band by checking every cell in the dm
+     * @param isInterfaceCell returns true if the cell point contains the interface
+     */
+    void Rebuild(const std::function<bool(PetscInt cell)>& isInterfaceCell);
+
+    /**
+     * Update the band by only checking the cells in the current band and the cells outside of the range.  An interface can only enter a rank without
+     * an interface through the cells outside of the range, so an empty band stays empty until the interface reaches them.  The band is rebuilt
+     * every rebuildInterval updates.
+     * @param isInterfaceCell returns true if the cell point contains the interface
+     */
+    void Update(const std::function<bool(PetscInt cell)>& isInterfaceCell);
+
+    /**
+     * @return the cell points in the range that are in the band
+     */
+    [[nodiscard]] inline const std::vector<PetscInt>& GetCells() const { return bandCellPoints; }
+
+    /**
+     * @return the vertex points of the cells in the range that are in the band
+     */
+    [[nodiscard]] inline const std::vector<PetscInt>& GetVertices() const { return bandVertexPoints; }
+
+    /**
+     * @param cell the cell point
+     * @return the number of layers from the interface, 0 for interface cells and -1 for cells outside of the band
+     */
+    [[nodiscard]] inline PetscInt GetLevel(PetscInt cell) const { return (cell >= cStart && cell < cEnd) ? levels[cell - cStart] : -1; }
+
+    /**
+     * @param vertex the vertex point
+     * @return true if the vertex belongs to a cell in the band
+     */
+    [[nodiscard]] inline bool InBand(PetscInt vertex) const { return vertex >= vStart && vertex < vEnd && vertexInBand[vertex - vStart]; }
+
+    /**
+     * Get the neighboring cell points (sharing a vertex) of a cell, including the cells outside of the range
+     * @param cell the cell point
+     * @param neighborCells the resulting cell points
+     */
+    void GetNeighbors(PetscInt cell, std::vector<PetscInt>& neighborCells) const;
+};
+
+}  // namespace ablate::levelSet
+#endif  // ABLATELIBRARY_NARROWBAND_HPP
@@ -4,6 +4,7 @@
 #include "petscdmplex.h"
 #include "petscfe.h"
 #include "utilities/petscSupport.hpp"
+#include "utilities/petscUtilities.hpp"
 
 ablate::levelSet::VOFMathFunction::VOFMathFunction(std::shared_ptr<ablate::domain::Domain> domain, std::shared_ptr<ablate::mathFunctions::MathFunction> levelSet)
     : FunctionPointer(VOFMathFunctionPetscFunction, this), domain(std::move(domain)), levelSet(std::move(levelSet)) {}
@@ -29,9 +30,15 @@ PetscErrorCode ablate::levelSet::VOFMathFunction::VOFMathFunctionPetscFunction(P
         PetscCheck((cell >= cStart) && (cell < cEnd), PETSC_COMM_SELF, PETSC_ERR_ARG_OUTOFRANGE, "The DAG point found is not a cell.\n");
     }
 
-    // call the support call to compute vof in the cell
+    // look up the vof from the batched computation over every cell
     try {
-        ablate::levelSet::Utilities::VOF(dm, cell, vofMathFunction->levelSet, u, nullptr, nullptr);
+        vofMathFunction->UpdateCellVof(dm, time);
+        if (cell >= vofMathFunction->cellRange.start && cell < vofMathFunction->cellRange.end) {
+            u[0] = vofMathFunction->cellVof[cell - vofMathFunction->cellRange.start];
+        } else {
+            // call the support call to compute vof in the cell, phi is evaluated at the same time as the batched cells
+            ablate::levelSet::Utilities::VOF(dm, cell, vofMathFunction->levelSet, u, nullptr, nullptr, time);
+        }
     } catch (std::exception &exp) {
         SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exp.what());
     }
@@ -39,6 +46,35 @@ PetscErrorCode ablate::levelSet::VOFMathFunction::VOFMathFunctionPetscFunction(P
     PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+void ablate::levelSet::VOFMathFunction::UpdateCellVof(DM dm, PetscReal time) {
+    // the reconstruction holds the geometry, so it is rebuilt when the mesh or its coordinates change.  A new (or moved) mesh has a
+    // different coordinate vector id or state, even if it reuses the address of the old dm
+    Vec coordinates;
+    DMGetCoordinatesLocal(dm, &coordinates) >> utilities::PetscUtilities::checkError;
+    PetscObjectId coordinateId;
+    PetscObjectState coordinateState;
+    PetscObjectGetId((PetscObject)coordinates, &coordinateId) >> utilities::PetscUtilities::checkError;
+    PetscObjectStateGet((PetscObject)coordinates, &coordinateState) >> utilities::PetscUtilities::checkError;
+
+    if (!reconstruction || dm != reconstructionDm || coordinateId != reconstructionCoordinateId || coordinateState != reconstructionCoordinateState) {
+        // only the simplex and box cells have an element geometry (ghost cells are excluded)
+        cellRange = {};
+        DMPlexGetSimplexOrBoxCells(dm, 0, &cellRange.start, &cellRange.end) >> utilities::PetscUtilities::checkError;
+        reconstruction = std::make_unique<InterfaceReconstruction>(dm, cellRange);
+        reconstructionDm = dm;
+        reconstructionCoordinateId = coordinateId;
+        reconstructionCoordinateState = coordinateState;
+        cellVof.resize(reconstruction->GetNumberCells());
+        cellVofComputed = false;
+    }
+
+    if (!cellVofComputed || time != cellVofTime) {
+        reconstruction->VOF(levelSet, time, cellVof.data(), nullptr, nullptr);
+        cellVofComputed = true;
+        cellVofTime = time;
+    }
+}
+
 #include "registrar.hpp"
 REGISTER(ablate::mathFunctions::MathFunction, ablate::levelSet::VOFMathFunction, " Return the vertex level set values assuming a straight interface in the cell with a given normal vector.",
          ARG(ablate::domain::Domain, "domain", "domain to enable access to the cell information at a given point"),
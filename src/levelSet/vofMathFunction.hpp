@@ -2,7 +2,9 @@
 #define ABLATELIBRARY_VOFMATHFUNCTION_HPP
 
 #include <memory>
+#include <vector>
 #include "domain/domain.hpp"
+#include "interfaceReconstruction.hpp"
 #include "mathFunctions/functionPointer.hpp"
 #include "mathFunctions/mathFunction.hpp"
 
@@ -10,6 +12,10 @@ namespace ablate::levelSet {
 /**
  * Return the vertex level set values assuming a straight interface in the cell with a given normal vector.
  *
+ * The vof of every cell is computed in a single batched InterfaceReconstruction pass the first time a point is requested at a new time, so projecting the
+ * function onto the mesh does not repeat the per cell DMPlex queries.  The level set is evaluated at the projection time for every cell, including cells
+ * outside of the batched range.
+ *
  * This class extends FunctionPointer to reduce duplicate code
  */
 class VOFMathFunction : public mathFunctions::FunctionPointer {
@@ -20,6 +26,25 @@ class VOFMathFunction : public mathFunctions::FunctionPointer {
     //! function used to calculate the level set values at the vertices
     std::shared_ptr<ablate::mathFunctions::MathFunction> levelSet;
 
+    //! the batched reconstruction over the cells of the dm (and coordinates) it was built for
+    std::unique_ptr<InterfaceReconstruction> reconstruction;
+    DM reconstructionDm = nullptr;
+    PetscObjectId reconstructionCoordinateId = -1;
+    PetscObjectState reconstructionCoordinateState = -1;
+    ablate::domain::Range cellRange;
+
+    //! the vof of every cell in the cell range and the time it was computed at
+    std::vector<PetscReal> cellVof;
+    bool cellVofComputed = false;
+    PetscReal cellVofTime = 0.0;
+
+    /**
+     * Compute the vof for every cell at this time, rebuilding the reconstruction if the dm or its coordinates have changed
+     * @param dm
+     * @param time
+     */
+    void UpdateCellVof(DM dm, PetscReal time);
+
     /**
      * Static VOFMathFunctionPetscFunction that can be passed into petsc calls
      */
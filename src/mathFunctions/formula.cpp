@@ -13,6 +13,7 @@ ablate::mathFunctions::Formula::Formula(std::string functionString, const std::m
 
         // store the pointer
         nestedValues.push_back(std::make_unique<double>(0.0));
+        nestedNames.push_back(nestedFunction.first);
 
         // register this with the parser
         parser.DefineVar(nestedFunction.first, nestedValues.back().get());
@@ -20,7 +21,7 @@ ablate::mathFunctions::Formula::Formula(std::string functionString, const std::m
 
     // Test the function
     try {
-        parser.Eval();
+        parser.Eval(numberResults);
     } catch (mu::Parser::exception_type& exception) {
         throw ablate::mathFunctions::SimpleFormula::ConvertToException(exception);
     }
@@ -110,6 +111,31 @@ void ablate::mathFunctions::Formula::Eval(const double* xyz, const int& ndims, c
     }
 }
 
+void ablate::mathFunctions::Formula::DefineBulkVariables(mu::Parser& bulkParserToConfigure, std::size_t capacity) const {
+    bulkNestedValues.resize(nestedFunctions.size());
+    for (std::size_t i = 0; i < nestedFunctions.size(); i++) {
+        bulkNestedValues[i].assign(capacity, 0.0);
+        bulkParserToConfigure.DefineVar(nestedNames[i], bulkNestedValues[i].data());
+    }
+}
+
+void ablate::mathFunctions::Formula::Eval(const double* xyz, const int& ndims, std::size_t numberPoints, const double& t, double* result) const {
+    if (!CanEvalInBulk()) {
+        FormulaBase::Eval(xyz, ndims, numberPoints, t, result);
+        return;
+    }
+
+    auto& bulk = GetBulkParser(numberPoints);
+    SetBulkPoints(xyz, ndims, numberPoints, t);
+
+    // update the nested functions for every point, in bulk when the nested function supports it
+    for (std::size_t i = 0; i < nestedFunctions.size(); i++) {
+        nestedFunctions[i]->Eval(xyz, ndims, numberPoints, t, bulkNestedValues[i].data());
+    }
+
+    bulk.Eval(result, (int)numberPoints);
+}
+
 PetscErrorCode ablate::mathFunctions::Formula::ParsedPetscNested(PetscInt dim, PetscReal time, const PetscReal* x, PetscInt nf, PetscScalar* u, void* ctx) {
     // wrap in try, so we return petsc error code instead of c++ exception
     PetscFunctionBeginUser;
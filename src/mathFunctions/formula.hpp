@@ -12,16 +12,29 @@ class Formula : public FormulaBase {
     // store the scratch variables
     std::vector<std::unique_ptr<double>> nestedValues;
     std::vector<std::shared_ptr<MathFunction>> nestedFunctions;
+    std::vector<std::string> nestedNames;
+
+    //! the nested values for each point in a batch, linked to the bulk parser
+    mutable std::vector<std::vector<double>> bulkNestedValues;
 
    private:
     static PetscErrorCode ParsedPetscNested(PetscInt dim, PetscReal time, const PetscReal x[], PetscInt Nf, PetscScalar* u, void* ctx);
 
+   protected:
+    void DefineBulkVariables(mu::Parser& bulkParserToConfigure, std::size_t capacity) const override;
+
    public:
     Formula(const Formula&) = delete;
     void operator=(const Formula&) = delete;
 
     explicit Formula(std::string functionString, const std::map<std::string, std::shared_ptr<MathFunction>>& = {}, std::shared_ptr<ablate::parameters::Parameters> constants = {});
 
+    /**
+     * Evaluate the formula at many points.  The nested functions are evaluated once over the batch (in bulk when they support it) before the
+     * formula is evaluated with the bulk parser.
+     */
+    void Eval(const double* xyz, const int& ndims, std::size_t numberPoints, const double& t, double* result) const override;
+
     double Eval(const double& x, const double& y, const double& z, const double& t) const override;
 
     double Eval(const double* xyz, const int& ndims, const double& t) const override;
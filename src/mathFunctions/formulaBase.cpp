@@ -1,42 +1,88 @@
 #include "formulaBase.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <utility>
 #include "utilities/stringUtilities.hpp"
 
-ablate::mathFunctions::FormulaBase::FormulaBase(std::string functionString, const std::shared_ptr<ablate::parameters::Parameters>& constants) : formula(std::move(functionString)) {
+ablate::mathFunctions::FormulaBase::FormulaBase(std::string functionString, const std::shared_ptr<ablate::parameters::Parameters>& constants)
+    : constants(constants), randomFunctions(ablate::utilities::StringUtilities::Contains(functionString, "rand")), formula(std::move(functionString)) {
+    // check for random number
+    if (ablate::utilities::StringUtilities::Contains(formula, "rand")) {
+        std::random_device rd;
+        randomEngine = std::default_random_engine(rd());
+    }
+
+    ConfigureParser(parser, &coordinate[0], &coordinate[1], &coordinate[2], &time);
+}
+
+void ablate::mathFunctions::FormulaBase::ConfigureParser(mu::Parser& parserToConfigure, double* x, double* y, double* z, double* t) const {
     // define the x,y,z and t variables
-    parser.DefineVar("x", &coordinate[0]);
-    parser.DefineVar("y", &coordinate[1]);
-    parser.DefineVar("z", &coordinate[2]);
-    parser.DefineVar("t", &time);
+    parserToConfigure.DefineVar("x", x);
+    parserToConfigure.DefineVar("y", y);
+    parserToConfigure.DefineVar("z", z);
+    parserToConfigure.DefineVar("t", t);
 
     // Add in any provided constants
     if (constants) {
         for (const auto& key : constants->GetKeys()) {
-            parser.DefineConst(key, constants->GetExpect<double>(key));
+            parserToConfigure.DefineConst(key, constants->GetExpect<double>(key));
         }
     }
 
     // add in any additional helper functions
     if (ablate::utilities::StringUtilities::Contains(formula, "Power")) {
-        parser.DefineFun("Power", PowerFunction, true);
+        parserToConfigure.DefineFun("Power", PowerFunction, true);
     }
     // check for random number
     if (ablate::utilities::StringUtilities::Contains(formula, "pRand")) {
-        parser.DefineFunUserData("pRand", PseudoRandomFunction, reinterpret_cast<void*>(&pseudoRandomEngine), false);
+        parserToConfigure.DefineFunUserData("pRand", PseudoRandomFunction, reinterpret_cast<void*>(&pseudoRandomEngine), false);
     }
     if (ablate::utilities::StringUtilities::Contains(formula, "rand")) {
-        std::random_device rd;
-        randomEngine = std::default_random_engine(rd());
-        parser.DefineFunUserData("rand", RandomFunction, reinterpret_cast<void*>(&randomEngine), false);
+        parserToConfigure.DefineFunUserData("rand", RandomFunction, reinterpret_cast<void*>(&randomEngine), false);
     }
     if (ablate::utilities::StringUtilities::Contains(formula, "%")) {
-        parser.DefineOprt("%", ModulusOperator, mu::prADD_SUB, mu::oaLEFT, true);
+        parserToConfigure.DefineOprt("%", ModulusOperator, mu::prADD_SUB, mu::oaLEFT, true);
     }
 
     // set the expression
-    parser.SetExpr(formula);
+    parserToConfigure.SetExpr(formula);
+}
+
+mu::Parser& ablate::mathFunctions::FormulaBase::GetBulkParser(std::size_t numberPoints) const {
+    if (!bulkParser || numberPoints > bulkCapacity) {
+        // grow geometrically so the parser is rarely rebuilt
+        bulkCapacity = std::max(numberPoints, 2 * bulkCapacity);
+        for (auto& coordinateValues : bulkCoordinate) {
+            coordinateValues.assign(bulkCapacity, 0.0);
+        }
+        bulkTime.assign(bulkCapacity, 0.0);
+
+        bulkParser = std::make_unique<mu::Parser>();
+        ConfigureParser(*bulkParser, bulkCoordinate[0].data(), bulkCoordinate[1].data(), bulkCoordinate[2].data(), bulkTime.data());
+        DefineBulkVariables(*bulkParser, bulkCapacity);
+    }
+    return *bulkParser;
+}
+
+void ablate::mathFunctions::FormulaBase::SetBulkPoints(const double* xyz, int ndims, std::size_t numberPoints, double t) const {
+    for (std::size_t p = 0; p < numberPoints; p++) {
+        for (int d = 0; d < 3; d++) {
+            bulkCoordinate[d][p] = d < ndims ? xyz[p * ndims + d] : 0.0;
+        }
+        bulkTime[p] = t;
+    }
+}
+
+void ablate::mathFunctions::FormulaBase::Eval(const double* xyz, const int& ndims, std::size_t numberPoints, const double& t, double* result) const {
+    if (!CanEvalInBulk()) {
+        MathFunction::Eval(xyz, ndims, numberPoints, t, result);
+        return;
+    }
+
+    auto& bulk = GetBulkParser(numberPoints);
+    SetBulkPoints(xyz, ndims, numberPoints, t);
+    bulk.Eval(result, (int)numberPoints);
 }
 
 std::invalid_argument ablate::mathFunctions::FormulaBase::ConvertToException(mu::Parser::exception_type& exception) {
@@ -2,22 +2,42 @@
 #define ABLATELIBRARY_FORMULABASE_HPP
 
 #include <muParser.h>
+#include <memory>
 #include <random>
+#include <vector>
 #include "mathFunction.hpp"
 #include "parameters/parameters.hpp"
 
 namespace ablate::mathFunctions {
 
 /**
- * Formula base is the base abstract class shared by other formulas
+ * Formula base is the base abstract class shared by other formulas.  In addition to the single point parser, a second (bulk) parser links each
+ * variable to an array so that muparser can evaluate the compiled bytecode over a batch of points in a single call.
  */
 class FormulaBase : public MathFunction {
    private:
     //! Hold a random number engine always using the same seed
-    std::minstd_rand0 pseudoRandomEngine{0};
+    mutable std::minstd_rand0 pseudoRandomEngine{0};
 
     //! Hold a "real" random number engine
-    std::default_random_engine randomEngine{0};
+    mutable std::default_random_engine randomEngine{0};
+
+    //! the constants used to build each parser
+    const std::shared_ptr<ablate::parameters::Parameters> constants;
+
+    //! the parser linked to the bulk arrays, built on first use
+    mutable std::unique_ptr<mu::Parser> bulkParser;
+
+    //! the number of points the bulk arrays can hold
+    mutable std::size_t bulkCapacity = 0;
+
+    //! true if the formula calls the random number functions, these share an engine that is not safe to use from the (possibly threaded) bulk parser
+    const bool randomFunctions;
+
+    /**
+     * Define the variables, constants, helper functions, and expression for a parser
+     */
+    void ConfigureParser(mu::Parser& parserToConfigure, double* x, double* y, double* z, double* t) const;
 
    protected:
     //! The coordinate linked to the parser
@@ -32,6 +52,15 @@ class FormulaBase : public MathFunction {
     //! the formula output for debugging
     const std::string formula;
 
+    //! the number of values computed by the formula, set by each subclass when the expression is tested at construction
+    int numberResults = 0;
+
+    //! the coordinates (x, y, z) for each point in a batch, linked to the bulk parser
+    mutable std::vector<double> bulkCoordinate[3];
+
+    //! the time for each point in a batch, linked to the bulk parser
+    mutable std::vector<double> bulkTime;
+
     /**
      * protected constructor to build the formula base
      * @param functionString
@@ -46,7 +75,47 @@ class FormulaBase : public MathFunction {
      */
     static std::invalid_argument ConvertToException(mu::Parser::exception_type& exception);
 
+    /**
+     * Get the bulk parser sized to hold at least numberPoints points.  The parser is rebuilt when the capacity grows.
+     * @param numberPoints
+     * @return
+     */
+    mu::Parser& GetBulkParser(std::size_t numberPoints) const;
+
+    /**
+     * Allow subclasses to size and link any additional variables to the bulk parser
+     * @param bulkParserToConfigure
+     * @param capacity the number of points each variable must hold
+     */
+    virtual void DefineBulkVariables(mu::Parser& bulkParserToConfigure, std::size_t capacity) const {}
+
+    /**
+     * Copy the points and time into the bulk arrays, GetBulkParser must be called first
+     * @param xyz the point coordinates ordered by point (numberPoints * ndims)
+     * @param ndims
+     * @param numberPoints
+     * @param t
+     */
+    void SetBulkPoints(const double* xyz, int ndims, std::size_t numberPoints, double t) const;
+
+    /**
+     * @return true if the formula computes a single value without random numbers and can use the bulk parser
+     */
+    [[nodiscard]] bool CanEvalInBulk() const { return numberResults == 1 && !randomFunctions; }
+
    public:
+    using MathFunction::Eval;
+
+    /**
+     * Evaluate a scalar formula at many points using the bulk parser.  Formulas that return more than one value or use random numbers are evaluated one point at a time.
+     * @param xyz the point coordinates ordered by point (numberPoints * ndims)
+     * @param ndims the dimension of each point
+     * @param numberPoints the number of points
+     * @param t the time
+     * @param result the value at each point
+     */
+    void Eval(const double* xyz, const int& ndims, std::size_t numberPoints, const double& t, double* result) const override;
+
     //! prevent copy of this object
     FormulaBase(const FormulaBase&) = delete;
     //! prevent copy of this object
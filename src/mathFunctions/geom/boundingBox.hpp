@@ -0,0 +1,61 @@
+#ifndef ABLATELIBRARY_GEOM_BOUNDINGBOX_HPP
+#define ABLATELIBRARY_GEOM_BOUNDINGBOX_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+namespace ablate::mathFunctions::geom {
+
+/**
+ * An axis aligned box that contains every inside point of a geometry.  Directions where the geometry is not bounded use +/- infinity, so the
+ * default box is unbounded and never excludes a point.
+ */
+struct BoundingBox {
+    std::array<double, 3> lower = {-std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity()};
+    std::array<double, 3> upper = {std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity()};
+
+    /**
+     * An empty (inverted) box that can be grown with Merge
+     */
+    static inline BoundingBox Empty() {
+        BoundingBox box;
+        std::swap(box.lower, box.upper);
+        return box;
+    }
+
+    /**
+     * Check if the point could be inside the geometry.  Only the first ndims dimensions are compared, matching how the geometries ignore the
+     * dimensions that are not supplied.
+     */
+    [[nodiscard]] inline bool Contains(const double* xyz, int ndims) const {
+        for (int d = 0; d < std::min(ndims, 3); ++d) {
+            if (xyz[d] < lower[d] || xyz[d] > upper[d]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //! grow this box to include the other box
+    inline void Merge(const BoundingBox& other) {
+        for (std::size_t d = 0; d < 3; ++d) {
+            lower[d] = std::min(lower[d], other.lower[d]);
+            upper[d] = std::max(upper[d], other.upper[d]);
+        }
+    }
+
+    //! the center of the box in direction d, infinite directions use the finite side (or zero) so the value is always usable for sorting
+    [[nodiscard]] inline double Center(std::size_t d) const {
+        const bool finiteLower = std::isfinite(lower[d]);
+        const bool finiteUpper = std::isfinite(upper[d]);
+        if (finiteLower && finiteUpper) {
+            return 0.5 * (lower[d] + upper[d]);
+        }
+        return finiteLower ? lower[d] : (finiteUpper ? upper[d] : 0.0);
+    }
+};
+
+}  // namespace ablate::mathFunctions::geom
+#endif  // ABLATELIBRARY_GEOM_BOUNDINGBOX_HPP
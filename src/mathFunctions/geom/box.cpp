@@ -17,6 +17,15 @@ bool ablate::mathFunctions::geom::Box::InsideGeometry(const double *xyz, const i
     return true;
 }
 
+ablate::mathFunctions::geom::BoundingBox ablate::mathFunctions::geom::Box::GetBoundingBox() const {
+    BoundingBox bounds;
+    for (std::size_t i = 0; i < PetscMin(lower.size(), (std::size_t)3); i++) {
+        bounds.lower[i] = lower[i];
+        bounds.upper[i] = upper[i];
+    }
+    return bounds;
+}
+
 #include "registrar.hpp"
 REGISTER(ablate::mathFunctions::geom::Geometry, ablate::mathFunctions::geom::Box, "assigns a uniform value to all points inside the box", ARG(std::vector<double>, "lower", "the box lower corner"),
          ARG(std::vector<double>, "upper", "the box upper corner"), OPT(ablate::mathFunctions::MathFunction, "insideValues", "the values for inside the sphere, defaults to 1"),
@@ -51,6 +51,14 @@ bool ablate::mathFunctions::geom::ConvexPolygon::InsideGeometry(const double *xy
     return false;
 }
 
+ablate::mathFunctions::geom::BoundingBox ablate::mathFunctions::geom::ConvexPolygon::GetBoundingBox() const {
+    auto bounds = BoundingBox::Empty();
+    for (const auto &triangle : triangles) {
+        bounds.Merge(triangle.GetBoundingBox());
+    }
+    return bounds;
+}
+
 #include "registrar.hpp"
 REGISTER(ablate::mathFunctions::geom::Geometry, ablate::mathFunctions::geom::ConvexPolygon, "assigns a uniform value to all points inside a cylindrical shell",
          ARG(std::vector<std::vector<double>>, "points", "the center of the cylinder start"),
@@ -30,6 +30,8 @@ class ConvexPolygon : public Geometry {
                            const std::shared_ptr<mathFunctions::MathFunction>& outsideValues = {});
 
     bool InsideGeometry(const double* xyz, const int& ndims, const double& time) const override;
+
+    [[nodiscard]] BoundingBox GetBoundingBox() const override;
 };
 
 }  // namespace ablate::mathFunctions::geom
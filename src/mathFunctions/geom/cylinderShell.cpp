@@ -1,5 +1,6 @@
 #include "cylinderShell.hpp"
 
+#include <algorithm>
 #include <utility>
 #include "utilities/mathUtilities.hpp"
 
@@ -36,6 +37,16 @@ bool ablate::mathFunctions::geom::CylinderShell::InsideGeometry(const double *xy
     return !((dsq > (radiusMax * radiusMax)) || (radiusMin > 0.0 && dsq < (radiusMin * radiusMin)));
 }
 
+ablate::mathFunctions::geom::BoundingBox ablate::mathFunctions::geom::CylinderShell::GetBoundingBox() const {
+    // the box around the axis expanded by the outer radius contains the cylinder in any orientation
+    BoundingBox bounds;
+    for (std::size_t i = 0; i < std::min({start.size(), end.size(), (std::size_t)3}); i++) {
+        bounds.lower[i] = std::min(start[i], end[i]) - radiusMax;
+        bounds.upper[i] = std::max(start[i], end[i]) + radiusMax;
+    }
+    return bounds;
+}
+
 #include "registrar.hpp"
 REGISTER(ablate::mathFunctions::geom::Geometry, ablate::mathFunctions::geom::CylinderShell, "assigns a uniform value to all points inside a cylindrical shell",
          ARG(std::vector<double>, "start", "the center of the cylinder start"), ARG(std::vector<double>, "end", "the center of the cylinder end"),
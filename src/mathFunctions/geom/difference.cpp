@@ -4,10 +4,40 @@
 
 ablate::mathFunctions::geom::Difference::Difference(std::shared_ptr<ablate::mathFunctions::geom::Geometry> minuend, std::shared_ptr<ablate::mathFunctions::geom::Geometry> subtrahend,
                                                     const std::shared_ptr<mathFunctions::MathFunction> &insideValues, const std::shared_ptr<mathFunctions::MathFunction> &outsideValues)
-    : Geometry(insideValues, outsideValues), minuend(std::move(minuend)), subtrahend(std::move(subtrahend)) {}
+    : Geometry(insideValues, outsideValues),
+      minuend(std::move(minuend)),
+      subtrahend(std::move(subtrahend)),
+      minuendBounds(this->minuend->GetBoundingBox()),
+      subtrahendBounds(this->subtrahend->GetBoundingBox()) {}
 
 bool ablate::mathFunctions::geom::Difference::InsideGeometry(const double *xyz, const int &ndims, const double &time) const {
-    return minuend->InsideGeometry(xyz, ndims, time) && !subtrahend->InsideGeometry(xyz, ndims, time);
+    return minuendBounds.Contains(xyz, ndims) && minuend->InsideGeometry(xyz, ndims, time) &&
+           !(subtrahendBounds.Contains(xyz, ndims) && subtrahend->InsideGeometry(xyz, ndims, time));
+}
+
+void ablate::mathFunctions::geom::Difference::InsideGeometryBatch(const double *xyz, const int &ndims, std::size_t numberPoints, const double &time, std::vector<bool> &inside) const {
+    minuend->InsideGeometryBatch(xyz, ndims, numberPoints, time, inside);
+
+    // only the points inside the minuend and the subtrahend bounds need to be removed
+    std::vector<std::size_t> candidates;
+    std::vector<double> candidateXyz;
+    for (std::size_t p = 0; p < numberPoints; ++p) {
+        if (inside[p] && subtrahendBounds.Contains(xyz + p * ndims, ndims)) {
+            candidates.push_back(p);
+            candidateXyz.insert(candidateXyz.end(), xyz + p * ndims, xyz + (p + 1) * ndims);
+        }
+    }
+    if (candidates.empty()) {
+        return;
+    }
+
+    std::vector<bool> insideSubtrahend;
+    subtrahend->InsideGeometryBatch(candidateXyz.data(), ndims, candidates.size(), time, insideSubtrahend);
+    for (std::size_t c = 0; c < candidates.size(); ++c) {
+        if (insideSubtrahend[c]) {
+            inside[candidates[c]] = false;
+        }
+    }
 }
 
 #include "registrar.hpp"
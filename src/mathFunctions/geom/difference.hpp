@@ -10,11 +10,19 @@ class Difference : public Geometry {
     const std::shared_ptr<ablate::mathFunctions::geom::Geometry> minuend;
     const std::shared_ptr<ablate::mathFunctions::geom::Geometry> subtrahend;
 
+    //! the bounds of each geometry, computed once
+    const BoundingBox minuendBounds;
+    const BoundingBox subtrahendBounds;
+
    public:
     explicit Difference(std::shared_ptr<ablate::mathFunctions::geom::Geometry> minuend, std::shared_ptr<ablate::mathFunctions::geom::Geometry> subtrahend,
                         const std::shared_ptr<mathFunctions::MathFunction>& insideValues = {}, const std::shared_ptr<mathFunctions::MathFunction>& outsideValues = {});
 
     bool InsideGeometry(const double* xyz, const int& ndims, const double& time) const override;
+
+    void InsideGeometryBatch(const double* xyz, const int& ndims, std::size_t numberPoints, const double& time, std::vector<bool>& inside) const override;
+
+    [[nodiscard]] BoundingBox GetBoundingBox() const override { return minuendBounds; }
 };
 }  // namespace ablate::mathFunctions::geom
 
@@ -1,4 +1,5 @@
 #include "geometry.hpp"
+#include <vector>
 #include "mathFunctions/functionFactory.hpp"
 
 ablate::mathFunctions::geom::Geometry::Geometry(const std::shared_ptr<mathFunctions::MathFunction> &insideValuesIn, const std::shared_ptr<mathFunctions::MathFunction> &outsideValuesIn)
@@ -47,5 +48,40 @@ void ablate::mathFunctions::geom::Geometry::Eval(const double *xyz, const int &n
     }
 }
 
+void ablate::mathFunctions::geom::Geometry::Eval(const double *xyz, const int &ndims, std::size_t numberPoints, const double &t, double *result) const {
+    std::vector<bool> inside;
+    InsideGeometryBatch(xyz, ndims, numberPoints, t, inside);
+
+    // gather the inside and outside points so each values function is evaluated in a single batch
+    for (const bool insidePoints : {true, false}) {
+        std::vector<std::size_t> points;
+        std::vector<double> pointXyz;
+        for (std::size_t p = 0; p < numberPoints; ++p) {
+            if (inside[p] == insidePoints) {
+                points.push_back(p);
+                pointXyz.insert(pointXyz.end(), xyz + p * ndims, xyz + (p + 1) * ndims);
+            }
+        }
+        if (points.empty()) {
+            continue;
+        }
+
+        std::vector<double> values(points.size());
+        (insidePoints ? insideValues : outsideValues)->Eval(pointXyz.data(), ndims, points.size(), t, values.data());
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            result[points[i]] = values[i];
+        }
+    }
+}
+
+void ablate::mathFunctions::geom::Geometry::InsideGeometryBatch(const double *xyz, const int &ndims, std::size_t numberPoints, const double &time, std::vector<bool> &inside) const {
+    const auto bounds = GetBoundingBox();
+    inside.assign(numberPoints, false);
+    for (std::size_t p = 0; p < numberPoints; ++p) {
+        const double *point = xyz + p * ndims;
+        inside[p] = bounds.Contains(point, ndims) && InsideGeometry(point, ndims, time);
+    }
+}
+
 #include "registrar.hpp"
 REGISTER_DERIVED(ablate::mathFunctions::MathFunction, ablate::mathFunctions::geom::Geometry);
\ No newline at end of file
@@ -3,6 +3,8 @@
 
 #include <mathFunctions/mathFunction.hpp>
 #include <memory>
+#include <vector>
+#include "boundingBox.hpp"
 
 namespace ablate::mathFunctions::geom {
 
@@ -33,6 +35,11 @@ class Geometry : public MathFunction {
 
     void Eval(const double* xyz, const int& ndims, const double& t, std::vector<double>& result) const override;
 
+    /**
+     * Tests the whole batch with InsideGeometryBatch, then evaluates the inside and outside values over their points
+     */
+    void Eval(const double* xyz, const int& ndims, std::size_t numberPoints, const double& t, double* result) const override;
+
     void* GetContext() override { return this; }
 
     PetscFunction GetPetscFunction() override { return GeometryPetscFunction; }
@@ -46,6 +53,22 @@ class Geometry : public MathFunction {
      */
     virtual bool InsideGeometry(const double* xyz, const int& ndims, const double& time) const = 0;
 
+    /**
+     * determines if each point in a batch is inside geometry.  Points outside of the bounding box are not tested.
+     * @param xyz the coordinates of each point (x1, y1, z1, x2, y2, etc.)
+     * @param ndims the dimension of each point
+     * @param numberPoints
+     * @param time
+     * @param inside the result for each point
+     */
+    virtual void InsideGeometryBatch(const double* xyz, const int& ndims, std::size_t numberPoints, const double& time, std::vector<bool>& inside) const;
+
+    /**
+     * A box containing every point inside of this geometry.  Composite geometries use the box to skip geometries that cannot contain a point.
+     * The default box is unbounded.
+     */
+    [[nodiscard]] virtual BoundingBox GetBoundingBox() const { return {}; }
+
     /**
      * Returns the inside values function
      */
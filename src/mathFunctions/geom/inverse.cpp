@@ -5,6 +5,11 @@ ablate::mathFunctions::geom::Inverse::Inverse(const std::shared_ptr<ablate::math
 
 bool ablate::mathFunctions::geom::Inverse::InsideGeometry(const double *xyz, const int &ndims, const double &time) const { return !geometry->InsideGeometry(xyz, ndims, time); }
 
+void ablate::mathFunctions::geom::Inverse::InsideGeometryBatch(const double *xyz, const int &ndims, std::size_t numberPoints, const double &time, std::vector<bool> &inside) const {
+    geometry->InsideGeometryBatch(xyz, ndims, numberPoints, time, inside);
+    inside.flip();
+}
+
 #include "registrar.hpp"
 REGISTER(ablate::mathFunctions::geom::Geometry, ablate::mathFunctions::geom::Inverse, "Inverses the supplied geometry.",
          ARG(ablate::mathFunctions::geom::Geometry, "geometry", "the base geometry to be inversed"));
\ No newline at end of file
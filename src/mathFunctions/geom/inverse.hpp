@@ -13,6 +13,8 @@ class Inverse : public Geometry {
     explicit Inverse(const std::shared_ptr<ablate::mathFunctions::geom::Geometry>& geometry);
 
     bool InsideGeometry(const double* xyz, const int& ndims, const double& time) const override;
+
+    void InsideGeometryBatch(const double* xyz, const int& ndims, std::size_t numberPoints, const double& time, std::vector<bool>& inside) const override;
 };
 }  // namespace ablate::mathFunctions::geom
 
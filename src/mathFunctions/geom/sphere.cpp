@@ -21,6 +21,15 @@ bool ablate::mathFunctions::geom::Sphere::InsideGeometry(const double *xyz, cons
     return dist <= radius;
 }
 
+ablate::mathFunctions::geom::BoundingBox ablate::mathFunctions::geom::Sphere::GetBoundingBox() const {
+    BoundingBox bounds;
+    for (std::size_t i = 0; i < PetscMin(center.size(), (std::size_t)3); i++) {
+        bounds.lower[i] = center[i] - radius;
+        bounds.upper[i] = center[i] + radius;
+    }
+    return bounds;
+}
+
 #include "registrar.hpp"
 REGISTER(ablate::mathFunctions::geom::Geometry, ablate::mathFunctions::geom::Sphere, "assigns a uniform value to all points inside the sphere", ARG(std::vector<double>, "center", "the sphere center"),
          OPT(double, "radius", "the sphere radius"), OPT(ablate::mathFunctions::MathFunction, "insideValues", "the values for inside the sphere, defaults to 1"),
@@ -1,10 +1,13 @@
 #include "surface.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <stdexcept>
 #include "utilities/petscUtilities.hpp"
 
 ablate::mathFunctions::geom::Surface::Surface(const std::filesystem::path &meshPath, const std::shared_ptr<mathFunctions::MathFunction> &insideValues,
-                                              const std::shared_ptr<mathFunctions::MathFunction> &outsideValues, int egadsVerboseLevel)
-    : Geometry(insideValues, outsideValues) {
+                                              const std::shared_ptr<mathFunctions::MathFunction> &outsideValues, int egadsVerboseLevel, double toleranceIn)
+    : Geometry(insideValues, outsideValues), tolerance(toleranceIn) {
     // Create a surface from the meshFile
     if (!exists(meshPath)) {
         throw std::runtime_error("Cannot locate ablate::mathFunctions::geom::Surface::Surface file " + meshPath.string());
@@ -12,6 +15,66 @@ ablate::mathFunctions::geom::Surface::Surface(const std::filesystem::path &meshP
     EG_open(&context) >> utilities::PetscUtilities::checkError;
     EG_setOutLevel(context, egadsVerboseLevel);
     EG_loadModel(context, 0, meshPath.c_str(), &model) >> utilities::PetscUtilities::checkError;
+
+    // Get all the bodies in this domain
+    ego geom, *modelBodies;
+    int numberBodies;
+    int oclass, mtype, *senses;
+    EG_getTopology(model, &geom, &oclass, &mtype, nullptr, &numberBodies, &modelBodies, &senses) >> utilities::PetscUtilities::checkError;
+    bodies.assign(modelBodies, modelBodies + numberBodies);
+
+    // without a tolerance every point uses the exact query
+    if (tolerance <= 0) {
+        return;
+    }
+
+    // tessellate each body once and build the hierarchy over the triangles
+    for (const auto &body : bodies) {
+        // the ray parity test is only valid for closed (solid) bodies
+        ego bodyGeom, *bodyChildren;
+        int bodyClass, bodyType, numberBodyChildren, *bodySenses;
+        EG_getTopology(body, &bodyGeom, &bodyClass, &bodyType, nullptr, &numberBodyChildren, &bodyChildren, &bodySenses) >> utilities::PetscUtilities::checkError;
+        if (bodyType != SOLIDBODY) {
+            throw std::invalid_argument("The ablate::mathFunctions::geom::Surface tolerance requires every body in " + meshPath.string() +
+                                        " to be a solid body, sheet, face, and wire bodies must use the exact query (tolerance of 0).");
+        }
+
+        double boundingBox[6];
+        EG_getBoundingBox(body, boundingBox) >> utilities::PetscUtilities::checkError;
+        const double size =
+            std::sqrt(PetscSqr(boundingBox[3] - boundingBox[0]) + PetscSqr(boundingBox[4] - boundingBox[1]) + PetscSqr(boundingBox[5] - boundingBox[2]));
+
+        // the tessellation (max edge length, max sag, max dihedral angle) must stay well inside the tolerance band
+        double tessellationParameters[3] = {0.05 * size, 0.25 * tolerance, 15.0};
+        ego tessellation;
+        EG_makeTessBody(body, tessellationParameters, &tessellation) >> utilities::PetscUtilities::checkError;
+
+        int numberFaces;
+        ego *faces;
+        EG_getBodyTopos(body, nullptr, FACE, &numberFaces, &faces) >> utilities::PetscUtilities::checkError;
+        EG_free(faces);
+
+        // merge the triangles from each face
+        std::vector<double> vertices;
+        std::vector<std::size_t> triangles;
+        for (int f = 1; f <= numberFaces; f++) {
+            int numberPoints, numberTriangles;
+            const double *xyz, *uv;
+            const int *pointType, *pointIndex, *faceTriangles, *triangleNeighbors;
+            EG_getTessFace(tessellation, f, &numberPoints, &xyz, &uv, &pointType, &pointIndex, &numberTriangles, &faceTriangles, &triangleNeighbors) >>
+                utilities::PetscUtilities::checkError;
+
+            // the face triangles use one based indices into the face points
+            const std::size_t offset = vertices.size() / 3;
+            vertices.insert(vertices.end(), xyz, xyz + 3 * numberPoints);
+            for (int t = 0; t < 3 * numberTriangles; t++) {
+                triangles.push_back(offset + faceTriangles[t] - 1);
+            }
+        }
+        EG_deleteObject(tessellation);
+
+        bodyTrees.emplace_back(vertices, triangles);
+    }
 }
 
 ablate::mathFunctions::geom::Surface::~Surface() {
@@ -24,20 +87,34 @@ ablate::mathFunctions::geom::Surface::~Surface() {
 }
 
 bool ablate::mathFunctions::geom::Surface::InsideGeometry(const double *xyz, const int &ndims, const double &time) const {
-    // Get all the bod`ies in this domain
-    ego geom, *bodies;
-    int numberBodies;
-    int oclass, mtype, *senses;
-
-    EG_getTopology(model, &geom, &oclass, &mtype, nullptr, &numberBodies, &bodies, &senses) >> utilities::PetscUtilities::checkError;
-
     // Make sure always supply 3D array
     double coord[3] = {0.0, 0.0, 0.0};
     PetscArraycpy(coord, xyz, ndims);
 
     // March over each body
     bool inside = false;
-    for (int b = 0; b < numberBodies; b++) {
+    for (std::size_t b = 0; b < bodies.size() && !inside; b++) {
+        if (!bodyTrees.empty()) {
+            const auto &tree = bodyTrees[b];
+
+            // points outside of the expanded bounding box cannot be inside the body
+            bool outsideBox = false;
+            for (int d = 0; d < 3; d++) {
+                outsideBox = outsideBox || coord[d] < tree.GetLower()[d] - tolerance || coord[d] > tree.GetUpper()[d] + tolerance;
+            }
+            if (outsideBox) {
+                continue;
+            }
+
+            // points away from the surface can use the tessellation
+            bool insideBody;
+            if (!tree.WithinDistance(coord, tolerance) && tree.Inside(coord, insideBody)) {
+                inside = insideBody;
+                continue;
+            }
+        }
+
+        // fall back to the exact query
         int result = EG_inTopology(bodies[b], coord);
         if (result == 0) {
             inside = true;
@@ -49,8 +126,42 @@ bool ablate::mathFunctions::geom::Surface::InsideGeometry(const double *xyz, con
     return inside;
 }
 
+double ablate::mathFunctions::geom::Surface::Distance(const double *xyz, const int &ndims) const {
+    if (bodyTrees.empty()) {
+        throw std::runtime_error("ablate::mathFunctions::geom::Surface::Distance requires the tessellation, set a positive tolerance");
+    }
+    double coord[3] = {0.0, 0.0, 0.0};
+    PetscArraycpy(coord, xyz, ndims);
+
+    double distance = std::numeric_limits<double>::max();
+    for (const auto &tree : bodyTrees) {
+        distance = std::min(distance, tree.Distance(coord));
+    }
+    return distance;
+}
+
+ablate::mathFunctions::geom::BoundingBox ablate::mathFunctions::geom::Surface::GetBoundingBox() const {
+    // without the tessellation there are no cheap bounds
+    if (bodyTrees.empty()) {
+        return {};
+    }
+    auto bounds = BoundingBox::Empty();
+    for (const auto &tree : bodyTrees) {
+        BoundingBox bodyBounds;
+        for (std::size_t d = 0; d < 3; d++) {
+            bodyBounds.lower[d] = tree.GetLower()[d] - tolerance;
+            bodyBounds.upper[d] = tree.GetUpper()[d] + tolerance;
+        }
+        bounds.Merge(bodyBounds);
+    }
+    return bounds;
+}
+
 #include "registrar.hpp"
 REGISTER(ablate::mathFunctions::geom::Geometry, ablate::mathFunctions::geom::Surface, "Assigned a unified number to all points inside of cad geometry file.",
          ARG(std::filesystem::path, "path", "the path to the step/stp file"), OPT(ablate::mathFunctions::MathFunction, "insideValues", "the values for inside the sphere, defaults to 1"),
          OPT(ablate::mathFunctions::MathFunction, "outsideValues", "the outside values, defaults to zero"),
-         OPT(int, "egadsVerboseLevel", "the egads verbose level for output (default is 0, max is 3)"));
\ No newline at end of file
+         OPT(int, "egadsVerboseLevel", "the egads verbose level for output (default is 0, max is 3)"),
+         OPT(double, "tolerance",
+             "when positive, the bodies are tessellated and only points within this distance of the tessellated surface use the exact (expensive) cad query.  The "
+             "default (0) uses the exact query for every point"));
@@ -4,21 +4,55 @@
 #include <egads.h>
 #include <petsc.h>
 #include <filesystem>
+#include <vector>
 #include "geometry.hpp"
+#include "triangleBvh.hpp"
 
 namespace ablate::mathFunctions::geom {
 
+/**
+ * Determines if a point is inside of the bodies in a cad file.  By default every point uses the exact EGADS query.  When a tolerance is provided, each
+ * (solid) body is tessellated once and a bounding volume hierarchy over the triangles answers the inside/outside and distance queries.  Only points
+ * within the tolerance band of the tessellated surface then fall back to the exact (and expensive) EGADS query.
+ */
 class Surface : public Geometry {
    private:
     ego context = nullptr;
     ego model = nullptr;
 
+    //! the bodies in the model, owned by the model
+    std::vector<ego> bodies;
+
+    //! the hierarchy over the tessellation of each body
+    std::vector<TriangleBvh> bodyTrees;
+
+    //! points closer than the tolerance to the tessellation use the exact EGADS query
+    double tolerance = 0.0;
+
    public:
+    /**
+     * @param meshPath the path to the step/stp file
+     * @param insideValues
+     * @param outsideValues
+     * @param egadsVerboseLevel
+     * @param tolerance when positive, the solid bodies are tessellated and only points within this distance of the tessellated surface use the exact
+     * EGADS query.  The default (0) uses the exact query for every point.
+     */
     explicit Surface(const std::filesystem::path& meshPath, const std::shared_ptr<mathFunctions::MathFunction>& insideValues = {},
-                     const std::shared_ptr<mathFunctions::MathFunction>& outsideValues = {}, int egadsVerboseLevel = 0);
+                     const std::shared_ptr<mathFunctions::MathFunction>& outsideValues = {}, int egadsVerboseLevel = 0, double tolerance = {});
     ~Surface() override;
 
     bool InsideGeometry(const double* xyz, const int& ndims, const double& time) const override;
+
+    [[nodiscard]] BoundingBox GetBoundingBox() const override;
+
+    /**
+     * The distance from the point to the nearest tessellated body surface.  The tessellation is within the tolerance of the exact surface.
+     * @param xyz
+     * @param ndims
+     * @return
+     */
+    double Distance(const double* xyz, const int& ndims) const;
 };
 }  // namespace ablate::mathFunctions::geom
 
@@ -1,5 +1,6 @@
 #include "triangle.hpp"
 #include <algorithm>
+#include <cmath>
 #include "utilities/constants.hpp"
 #include "utilities/mathUtilities.hpp"
 
@@ -67,6 +68,21 @@ bool ablate::mathFunctions::geom::Triangle::InsideGeometry(const double* xyz, co
     return std::abs(disVecMag) < maxDistance;
 }
 
+ablate::mathFunctions::geom::BoundingBox ablate::mathFunctions::geom::Triangle::GetBoundingBox() const {
+    // inside points are the triangle moved along the normal, so the prism is only bounded in the directions normal to the triangle normal unless
+    // there is a max distance
+    BoundingBox bounds;
+    for (std::size_t d = 0; d < 3; d++) {
+        if (maxDistance == 0.0 && triangleNorm[d] != 0.0) {
+            continue;
+        }
+        const double offset = maxDistance * std::abs(triangleNorm[d]) + ablate::utilities::Constants::small;
+        bounds.lower[d] = std::min({point1[d], point2[d], point3[d]}) - offset;
+        bounds.upper[d] = std::max({point1[d], point2[d], point3[d]}) + offset;
+    }
+    return bounds;
+}
+
 #include "registrar.hpp"
 REGISTER(ablate::mathFunctions::geom::Geometry, ablate::mathFunctions::geom::Triangle, "Creates a 3D triangle including all projected space up to the maxDistance (on either side)",
          ARG(std::vector<double>, "point1", "the first point of the triangle"), ARG(std::vector<double>, "point2", "the second point of the triangle"),
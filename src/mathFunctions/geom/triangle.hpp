@@ -34,6 +34,8 @@ class Triangle : public Geometry {
              const std::shared_ptr<mathFunctions::MathFunction>& outsideValues = {});
 
     bool InsideGeometry(const double* xyz, const int& ndims, const double& time) const override;
+
+    [[nodiscard]] BoundingBox GetBoundingBox() const override;
 };
 
 }  // namespace ablate::mathFunctions::geom
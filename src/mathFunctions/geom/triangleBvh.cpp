@@ -0,0 +1,284 @@
+#include "triangleBvh.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+ablate::mathFunctions::geom::TriangleBvh::TriangleBvh(const std::vector<double>& vertices, const std::vector<std::size_t>& triangleVertices) {
+    if (triangleVertices.empty() || triangleVertices.size() % 3 != 0) {
+        throw std::invalid_argument("The TriangleBvh requires three vertices for each triangle");
+    }
+
+    // copy the vertices for each triangle
+    triangles.resize(triangleVertices.size() / 3);
+    for (std::size_t t = 0; t < triangles.size(); t++) {
+        for (std::size_t v = 0; v < 3; v++) {
+            const auto vertex = triangleVertices[t * 3 + v];
+            if ((vertex + 1) * 3 > vertices.size()) {
+                throw std::invalid_argument("The TriangleBvh vertex index " + std::to_string(vertex) + " is out of range");
+            }
+            std::copy_n(&vertices[vertex * 3], 3, &triangles[t][v * 3]);
+        }
+    }
+
+    order.resize(triangles.size());
+    for (std::size_t t = 0; t < triangles.size(); t++) {
+        order[t] = t;
+    }
+    nodes.reserve(2 * triangles.size() / leafSize + 1);
+    Build(0, triangles.size());
+}
+
+std::size_t ablate::mathFunctions::geom::TriangleBvh::Build(std::size_t start, std::size_t end) {
+    const std::size_t nodeIndex = nodes.size();
+    nodes.emplace_back();
+
+    // compute the bounds of the triangles and their centroids
+    std::array<double, 3> lower, upper, centroidLower, centroidUpper;
+    lower.fill(std::numeric_limits<double>::max());
+    upper.fill(std::numeric_limits<double>::lowest());
+    centroidLower = lower;
+    centroidUpper = upper;
+    for (std::size_t i = start; i < end; i++) {
+        const auto& triangle = triangles[order[i]];
+        for (std::size_t d = 0; d < 3; d++) {
+            const double centroid = (triangle[d] + triangle[3 + d] + triangle[6 + d]) / 3.0;
+            centroidLower[d] = std::min(centroidLower[d], centroid);
+            centroidUpper[d] = std::max(centroidUpper[d], centroid);
+            for (std::size_t v = 0; v < 3; v++) {
+                lower[d] = std::min(lower[d], triangle[v * 3 + d]);
+                upper[d] = std::max(upper[d], triangle[v * 3 + d]);
+            }
+        }
+    }
+    nodes[nodeIndex].lower = lower;
+    nodes[nodeIndex].upper = upper;
+
+    if (end - start <= leafSize) {
+        nodes[nodeIndex].start = start;
+        nodes[nodeIndex].count = end - start;
+        return nodeIndex;
+    }
+
+    // split at the median centroid along the longest axis
+    std::size_t axis = 0;
+    for (std::size_t d = 1; d < 3; d++) {
+        if (centroidUpper[d] - centroidLower[d] > centroidUpper[axis] - centroidLower[axis]) {
+            axis = d;
+        }
+    }
+    const std::size_t mid = start + (end - start) / 2;
+    std::nth_element(order.begin() + start, order.begin() + mid, order.begin() + end, [this, axis](std::size_t a, std::size_t b) {
+        const auto& triangleA = triangles[a];
+        const auto& triangleB = triangles[b];
+        return triangleA[axis] + triangleA[3 + axis] + triangleA[6 + axis] < triangleB[axis] + triangleB[3 + axis] + triangleB[6 + axis];
+    });
+
+    // the left child always directly follows this node
+    Build(start, mid);
+    const std::size_t right = Build(mid, end);
+    nodes[nodeIndex].right = right;
+    return nodeIndex;
+}
+
+double ablate::mathFunctions::geom::TriangleBvh::BoxDistanceSquared(const Node& node, const double xyz[3]) {
+    double distance = 0.0;
+    for (std::size_t d = 0; d < 3; d++) {
+        const double delta = std::max({node.lower[d] - xyz[d], 0.0, xyz[d] - node.upper[d]});
+        distance += delta * delta;
+    }
+    return distance;
+}
+
+double ablate::mathFunctions::geom::TriangleBvh::TriangleDistanceSquared(const std::array<double, 9>& triangle, const double xyz[3]) {
+    // find the closest point on the triangle by checking the voronoi regions of the vertices, edges, and face
+    const double* a = &triangle[0];
+    const double* b = &triangle[3];
+    const double* c = &triangle[6];
+    double ab[3], ac[3], ap[3], bp[3], cp[3];
+    for (std::size_t d = 0; d < 3; d++) {
+        ab[d] = b[d] - a[d];
+        ac[d] = c[d] - a[d];
+        ap[d] = xyz[d] - a[d];
+        bp[d] = xyz[d] - b[d];
+        cp[d] = xyz[d] - c[d];
+    }
+    auto dot = [](const double* u, const double* v) { return u[0] * v[0] + u[1] * v[1] + u[2] * v[2]; };
+    auto distanceTo = [xyz](const double* base, const double* direction, double scale) {
+        double distance = 0.0;
+        for (std::size_t d = 0; d < 3; d++) {
+            const double delta = xyz[d] - (base[d] + scale * (direction ? direction[d] : 0.0));
+            distance += delta * delta;
+        }
+        return distance;
+    };
+
+    const double d1 = dot(ab, ap);
+    const double d2 = dot(ac, ap);
+    if (d1 <= 0.0 && d2 <= 0.0) {
+        return distanceTo(a, nullptr, 0.0);
+    }
+    const double d3 = dot(ab, bp);
+    const double d4 = dot(ac, bp);
+    if (d3 >= 0.0 && d4 <= d3) {
+        return distanceTo(b, nullptr, 0.0);
+    }
+    const double vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0) {
+        return distanceTo(a, ab, d1 / (d1 - d3));
+    }
+    const double d5 = dot(ab, cp);
+    const double d6 = dot(ac, cp);
+    if (d6 >= 0.0 && d5 <= d6) {
+        return distanceTo(c, nullptr, 0.0);
+    }
+    const double vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0) {
+        return distanceTo(a, ac, d2 / (d2 - d6));
+    }
+    const double va = d3 * d6 - d5 * d4;
+    if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0) {
+        const double bc[3] = {c[0] - b[0], c[1] - b[1], c[2] - b[2]};
+        return distanceTo(b, bc, (d4 - d3) / ((d4 - d3) + (d5 - d6)));
+    }
+
+    // the closest point is inside the face
+    const double denominator = va + vb + vc;
+    if (denominator <= 0.0) {
+        // degenerate triangle, the closest point has already been found on an edge or vertex
+        return std::min({distanceTo(a, nullptr, 0.0), distanceTo(b, nullptr, 0.0), distanceTo(c, nullptr, 0.0)});
+    }
+    const double v = vb / denominator;
+    const double w = vc / denominator;
+    double distance = 0.0;
+    for (std::size_t d = 0; d < 3; d++) {
+        const double delta = xyz[d] - (a[d] + ab[d] * v + ac[d] * w);
+        distance += delta * delta;
+    }
+    return distance;
+}
+
+double ablate::mathFunctions::geom::TriangleBvh::Distance(const double xyz[3]) const {
+    double best = std::numeric_limits<double>::max();
+    std::vector<std::size_t> stack{0};
+    while (!stack.empty()) {
+        const auto& node = nodes[stack.back()];
+        const std::size_t nodeIndex = stack.back();
+        stack.pop_back();
+        if (BoxDistanceSquared(node, xyz) >= best) {
+            continue;
+        }
+        if (node.count) {
+            for (std::size_t i = node.start; i < node.start + node.count; i++) {
+                best = std::min(best, TriangleDistanceSquared(triangles[order[i]], xyz));
+            }
+        } else {
+            // visit the closer child first
+            const std::size_t left = nodeIndex + 1;
+            if (BoxDistanceSquared(nodes[left], xyz) < BoxDistanceSquared(nodes[node.right], xyz)) {
+                stack.push_back(node.right);
+                stack.push_back(left);
+            } else {
+                stack.push_back(left);
+                stack.push_back(node.right);
+            }
+        }
+    }
+    return std::sqrt(best);
+}
+
+bool ablate::mathFunctions::geom::TriangleBvh::WithinDistance(const double xyz[3], double distance) const {
+    const double distanceSquared = distance * distance;
+    std::vector<std::size_t> stack{0};
+    while (!stack.empty()) {
+        const std::size_t nodeIndex = stack.back();
+        const auto& node = nodes[nodeIndex];
+        stack.pop_back();
+        if (BoxDistanceSquared(node, xyz) > distanceSquared) {
+            continue;
+        }
+        if (node.count) {
+            for (std::size_t i = node.start; i < node.start + node.count; i++) {
+                if (TriangleDistanceSquared(triangles[order[i]], xyz) <= distanceSquared) {
+                    return true;
+                }
+            }
+        } else {
+            stack.push_back(node.right);
+            stack.push_back(nodeIndex + 1);
+        }
+    }
+    return false;
+}
+
+bool ablate::mathFunctions::geom::TriangleBvh::Inside(const double xyz[3], bool& inside) const {
+    // cast the ray in a direction unlikely to align with the geometry
+    static const double direction[3] = {0.5773502691896258 + 1.234E-3, 0.5773502691896258 - 2.345E-3, 0.5773502691896258 + 0.456E-3};
+    static const double inverseDirection[3] = {1.0 / direction[0], 1.0 / direction[1], 1.0 / direction[2]};
+    constexpr double tolerance = 1E-9;
+
+    std::size_t crossings = 0;
+    std::vector<std::size_t> stack{0};
+    while (!stack.empty()) {
+        const std::size_t nodeIndex = stack.back();
+        const auto& node = nodes[nodeIndex];
+        stack.pop_back();
+
+        // slab test for the ray (t >= 0) against the node box
+        double tMin = 0.0;
+        double tMax = std::numeric_limits<double>::max();
+        for (std::size_t d = 0; d < 3; d++) {
+            double t0 = (node.lower[d] - xyz[d]) * inverseDirection[d];
+            double t1 = (node.upper[d] - xyz[d]) * inverseDirection[d];
+            if (t0 > t1) {
+                std::swap(t0, t1);
+            }
+            tMin = std::max(tMin, t0);
+            tMax = std::min(tMax, t1);
+        }
+        if (tMin > tMax) {
+            continue;
+        }
+
+        if (node.count) {
+            for (std::size_t i = node.start; i < node.start + node.count; i++) {
+                // moller-trumbore intersection
+                const auto& triangle = triangles[order[i]];
+                double edge1[3], edge2[3], s[3];
+                for (std::size_t d = 0; d < 3; d++) {
+                    edge1[d] = triangle[3 + d] - triangle[d];
+                    edge2[d] = triangle[6 + d] - triangle[d];
+                    s[d] = xyz[d] - triangle[d];
+                }
+                const double h[3] = {direction[1] * edge2[2] - direction[2] * edge2[1], direction[2] * edge2[0] - direction[0] * edge2[2], direction[0] * edge2[1] - direction[1] * edge2[0]};
+                const double determinant = edge1[0] * h[0] + edge1[1] * h[1] + edge1[2] * h[2];
+                const double scale = std::sqrt(edge1[0] * edge1[0] + edge1[1] * edge1[1] + edge1[2] * edge1[2]) * std::sqrt(edge2[0] * edge2[0] + edge2[1] * edge2[1] + edge2[2] * edge2[2]);
+                if (std::abs(determinant) <= tolerance * scale) {
+                    // the ray is parallel to the triangle, it can only matter if the point is in the plane
+                    continue;
+                }
+                const double u = (s[0] * h[0] + s[1] * h[1] + s[2] * h[2]) / determinant;
+                const double q[3] = {s[1] * edge1[2] - s[2] * edge1[1], s[2] * edge1[0] - s[0] * edge1[2], s[0] * edge1[1] - s[1] * edge1[0]};
+                const double v = (direction[0] * q[0] + direction[1] * q[1] + direction[2] * q[2]) / determinant;
+                const double t = (edge2[0] * q[0] + edge2[1] * q[1] + edge2[2] * q[2]) / determinant;
+
+                // clear misses
+                if (u < -tolerance || v < -tolerance || u + v > 1.0 + tolerance || t < -tolerance * std::sqrt(scale)) {
+                    continue;
+                }
+                // hits too close to an edge, vertex, or the point itself are not reliable
+                if (u < tolerance || v < tolerance || u + v > 1.0 - tolerance || t < tolerance * std::sqrt(scale)) {
+                    return false;
+                }
+                crossings++;
+            }
+        } else {
+            stack.push_back(node.right);
+            stack.push_back(nodeIndex + 1);
+        }
+    }
+
+    inside = crossings % 2 == 1;
+    return true;
+}
@@ -0,0 +1,107 @@
+#ifndef ABLATELIBRARY_GEOM_TRIANGLEBVH_HPP
+#define ABLATELIBRARY_GEOM_TRIANGLEBVH_HPP
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace ablate::mathFunctions::geom {
+
+/**
+ * A bounding volume hierarchy over a closed triangulated surface used to accelerate inside/outside and distance queries.  The hierarchy is built
+ * once by recursively splitting the triangles at the median centroid along the longest axis.  Inside/outside is determined by counting the
+ * crossings of a ray from the point (parity), so the triangle orientation does not matter, but the surface must be closed.
+ */
+class TriangleBvh {
+   private:
+    /**
+     * A single node in the hierarchy.  Leaf nodes hold a range of triangles, interior nodes have the left child directly after the node.
+     */
+    struct Node {
+        std::array<double, 3> lower;
+        std::array<double, 3> upper;
+        //! the first triangle (in order) for leaf nodes
+        std::size_t start = 0;
+        //! the number of triangles, zero for interior nodes
+        std::size_t count = 0;
+        //! the index of the right child for interior nodes
+        std::size_t right = 0;
+    };
+
+    //! the maximum number of triangles in a leaf node
+    static constexpr std::size_t leafSize = 4;
+
+    //! the triangle vertices (x, y, z) stored by triangle so each triangle is contiguous
+    std::vector<std::array<double, 9>> triangles;
+
+    //! the triangle indices ordered by the hierarchy
+    std::vector<std::size_t> order;
+
+    //! the nodes in depth first order, the root is the first node
+    std::vector<Node> nodes;
+
+    /**
+     * recursively build the node for the range of triangles
+     * @return the index of the new node
+     */
+    std::size_t Build(std::size_t start, std::size_t end);
+
+    /**
+     * the squared distance from the point to the node bounding box, zero if inside
+     */
+    static double BoxDistanceSquared(const Node& node, const double xyz[3]);
+
+    /**
+     * the squared distance from the point to a single triangle
+     */
+    static double TriangleDistanceSquared(const std::array<double, 9>& triangle, const double xyz[3]);
+
+   public:
+    /**
+     * Build the hierarchy
+     * @param vertices the vertex coordinates (x1, y1, z1, x2, y2, etc.)
+     * @param triangleVertices the three (zero based) vertex indices for each triangle
+     */
+    TriangleBvh(const std::vector<double>& vertices, const std::vector<std::size_t>& triangleVertices);
+
+    /**
+     * The unsigned distance from the point to the nearest triangle
+     * @param xyz
+     * @return
+     */
+    [[nodiscard]] double Distance(const double xyz[3]) const;
+
+    /**
+     * Check if any triangle is within the distance of the point, this stops at the first triangle found
+     * @param xyz
+     * @param distance
+     * @return
+     */
+    [[nodiscard]] bool WithinDistance(const double xyz[3], double distance) const;
+
+    /**
+     * Determine if the point is inside the closed surface
+     * @param xyz
+     * @param inside set to true if the point is inside
+     * @return false if the ray passes too close to a triangle edge or vertex to give a reliable answer
+     */
+    bool Inside(const double xyz[3], bool& inside) const;
+
+    /**
+     * @return the lower corner of the bounding box of all triangles
+     */
+    [[nodiscard]] const std::array<double, 3>& GetLower() const { return nodes.front().lower; }
+
+    /**
+     * @return the upper corner of the bounding box of all triangles
+     */
+    [[nodiscard]] const std::array<double, 3>& GetUpper() const { return nodes.front().upper; }
+
+    /**
+     * @return the number of triangles in the hierarchy
+     */
+    [[nodiscard]] std::size_t Size() const { return triangles.size(); }
+};
+
+}  // namespace ablate::mathFunctions::geom
+#endif  // ABLATELIBRARY_GEOM_TRIANGLEBVH_HPP
@@ -2,12 +2,150 @@
 #include <algorithm>
 #include <utility>
 
-ablate::mathFunctions::geom::Union::Union(std::vector<std::shared_ptr<ablate::mathFunctions::geom::Geometry>> geometries, const std::shared_ptr<mathFunctions::MathFunction> &insideValues,
+ablate::mathFunctions::geom::Union::Union(std::vector<std::shared_ptr<ablate::mathFunctions::geom::Geometry>> geometriesIn, const std::shared_ptr<mathFunctions::MathFunction> &insideValues,
                                           const std::shared_ptr<mathFunctions::MathFunction> &outsideValues)
-    : Geometry(insideValues, outsideValues), geometries(std::move(geometries)) {}
+    : Geometry(insideValues, outsideValues), geometries(std::move(geometriesIn)), bounds(BoundingBox::Empty()) {
+    // compute the bounds once.  Geometries that are unbounded in some directions are still placed in the hierarchy, the nodes holding them are
+    // simply unbounded in those directions
+    for (std::size_t g = 0; g < geometries.size(); ++g) {
+        geometryBounds.push_back(geometries[g]->GetBoundingBox());
+        bounds.Merge(geometryBounds.back());
+        order.push_back(g);
+    }
+
+    if (!order.empty()) {
+        Build(0, order.size());
+    }
+}
+
+std::size_t ablate::mathFunctions::geom::Union::Build(std::size_t start, std::size_t end) {
+    const std::size_t nodeIndex = nodes.size();
+    nodes.emplace_back();
+
+    // compute the bounds of the geometries and their centers
+    auto nodeBounds = BoundingBox::Empty();
+    auto centerBounds = BoundingBox::Empty();
+    for (std::size_t i = start; i < end; i++) {
+        const auto &geometryBound = geometryBounds[order[i]];
+        nodeBounds.Merge(geometryBound);
+        for (std::size_t d = 0; d < 3; d++) {
+            const double center = geometryBound.Center(d);
+            centerBounds.lower[d] = std::min(centerBounds.lower[d], center);
+            centerBounds.upper[d] = std::max(centerBounds.upper[d], center);
+        }
+    }
+    nodes[nodeIndex].bounds = nodeBounds;
+
+    if (end - start <= leafSize) {
+        nodes[nodeIndex].start = start;
+        nodes[nodeIndex].count = end - start;
+        return nodeIndex;
+    }
+
+    // split at the median center along the longest axis
+    std::size_t axis = 0;
+    for (std::size_t d = 1; d < 3; d++) {
+        if (centerBounds.upper[d] - centerBounds.lower[d] > centerBounds.upper[axis] - centerBounds.lower[axis]) {
+            axis = d;
+        }
+    }
+    const std::size_t mid = start + (end - start) / 2;
+    std::nth_element(order.begin() + start, order.begin() + mid, order.begin() + end, [this, axis](std::size_t a, std::size_t b) {
+        return geometryBounds[a].Center(axis) < geometryBounds[b].Center(axis);
+    });
+
+    // the left child always directly follows this node
+    Build(start, mid);
+    const std::size_t right = Build(mid, end);
+    nodes[nodeIndex].right = right;
+    return nodeIndex;
+}
 
 bool ablate::mathFunctions::geom::Union::InsideGeometry(const double *xyz, const int &ndims, const double &time) const {
-    return std::any_of(geometries.begin(), geometries.end(), [&](const auto &geometry) { return geometry->InsideGeometry(xyz, ndims, time); });
+    if (nodes.empty()) {
+        return false;
+    }
+
+    // only descend into nodes that could contain the point
+    std::vector<std::size_t> stack{0};
+    while (!stack.empty()) {
+        const std::size_t nodeIndex = stack.back();
+        const auto &node = nodes[nodeIndex];
+        stack.pop_back();
+        if (!node.bounds.Contains(xyz, ndims)) {
+            continue;
+        }
+        if (node.count) {
+            for (std::size_t i = node.start; i < node.start + node.count; i++) {
+                const std::size_t g = order[i];
+                if (geometryBounds[g].Contains(xyz, ndims) && geometries[g]->InsideGeometry(xyz, ndims, time)) {
+                    return true;
+                }
+            }
+        } else {
+            stack.push_back(node.right);
+            stack.push_back(nodeIndex + 1);
+        }
+    }
+    return false;
+}
+
+void ablate::mathFunctions::geom::Union::InsideGeometryBatch(const double *xyz, const int &ndims, std::size_t numberPoints, const double &time, std::vector<bool> &inside) const {
+    inside.assign(numberPoints, false);
+    std::vector<std::size_t> candidates(numberPoints);
+    for (std::size_t p = 0; p < numberPoints; ++p) {
+        candidates[p] = p;
+    }
+    if (nodes.empty()) {
+        return;
+    }
+
+    // walk the hierarchy with the points that are not yet inside and are within each node, so every geometry is evaluated once for its batch of points
+    std::vector<std::pair<std::size_t, std::vector<std::size_t>>> stack;
+    stack.emplace_back(0, std::move(candidates));
+    while (!stack.empty()) {
+        auto [nodeIndex, nodeCandidates] = std::move(stack.back());
+        stack.pop_back();
+        const auto &node = nodes[nodeIndex];
+
+        nodeCandidates.erase(std::remove_if(nodeCandidates.begin(), nodeCandidates.end(), [&](std::size_t p) { return inside[p] || !node.bounds.Contains(xyz + p * ndims, ndims); }),
+                             nodeCandidates.end());
+        if (nodeCandidates.empty()) {
+            continue;
+        }
+
+        if (node.count) {
+            for (std::size_t i = node.start; i < node.start + node.count; i++) {
+                TestGeometry(order[i], xyz, ndims, nodeCandidates, time, inside);
+            }
+        } else {
+            stack.emplace_back(node.right, nodeCandidates);
+            stack.emplace_back(nodeIndex + 1, std::move(nodeCandidates));
+        }
+    }
+}
+
+void ablate::mathFunctions::geom::Union::TestGeometry(std::size_t geometry, const double *xyz, const int &ndims, const std::vector<std::size_t> &candidates, const double &time,
+                                                      std::vector<bool> &inside) const {
+    std::vector<std::size_t> points;
+    std::vector<double> pointXyz;
+    for (const auto p : candidates) {
+        if (!inside[p] && geometryBounds[geometry].Contains(xyz + p * ndims, ndims)) {
+            points.push_back(p);
+            pointXyz.insert(pointXyz.end(), xyz + p * ndims, xyz + (p + 1) * ndims);
+        }
+    }
+    if (points.empty()) {
+        return;
+    }
+
+    std::vector<bool> insideGeometry;
+    geometries[geometry]->InsideGeometryBatch(pointXyz.data(), ndims, points.size(), time, insideGeometry);
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        if (insideGeometry[i]) {
+            inside[points[i]] = true;
+        }
+    }
 }
 
 #include "registrar.hpp"
@@ -5,15 +5,62 @@
 
 namespace ablate::mathFunctions::geom {
 
+/**
+ * Merges multiple geometries.  A bounding volume hierarchy over the bounds of the geometries is built once so each point is only tested against
+ * the geometries whose bounds contain it, reducing the cost of large unions (such as a packed bed of spheres) from O(geometries) per point.
+ */
 class Union : public Geometry {
    private:
+    /**
+     * A single node in the hierarchy.  Leaf nodes hold a range of geometries, interior nodes have the left child directly after the node.
+     */
+    struct Node {
+        BoundingBox bounds;
+        //! the first geometry (in order) for leaf nodes
+        std::size_t start = 0;
+        //! the number of geometries, zero for interior nodes
+        std::size_t count = 0;
+        //! the index of the right child for interior nodes
+        std::size_t right = 0;
+    };
+
+    //! the maximum number of geometries in a leaf node
+    static constexpr std::size_t leafSize = 2;
+
     const std::vector<std::shared_ptr<ablate::mathFunctions::geom::Geometry>> geometries;
 
+    //! the bounds of each geometry, computed once
+    std::vector<BoundingBox> geometryBounds;
+
+    //! the bounds of all geometries
+    BoundingBox bounds;
+
+    //! the geometry indices ordered by the hierarchy
+    std::vector<std::size_t> order;
+
+    //! the nodes in depth first order, the root is the first node
+    std::vector<Node> nodes;
+
+    /**
+     * recursively build the node for the range of geometries
+     * @return the index of the new node
+     */
+    std::size_t Build(std::size_t start, std::size_t end);
+
+    /**
+     * Test the candidate points that are not yet inside and are within the geometry bounds against a single geometry
+     */
+    void TestGeometry(std::size_t geometry, const double* xyz, const int& ndims, const std::vector<std::size_t>& candidates, const double& time, std::vector<bool>& inside) const;
+
    public:
     explicit Union(std::vector<std::shared_ptr<ablate::mathFunctions::geom::Geometry>> geometries, const std::shared_ptr<mathFunctions::MathFunction>& insideValues = {},
                    const std::shared_ptr<mathFunctions::MathFunction>& outsideValues = {});
 
     bool InsideGeometry(const double* xyz, const int& ndims, const double& time) const override;
+
+    void InsideGeometryBatch(const double* xyz, const int& ndims, std::size_t numberPoints, const double& time, std::vector<bool>& inside) const override;
+
+    [[nodiscard]] BoundingBox GetBoundingBox() const override { return bounds; }
 };
 }  // namespace ablate::mathFunctions::geom
 
@@ -0,0 +1,87 @@
+#include "inverseDistanceWeighted.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+ablate::mathFunctions::InverseDistanceWeighted::InverseDistanceWeighted(const std::vector<double> &coordinatesIn, const std::vector<double> &valuesIn, int neighbors, double power,
+                                                                        double radius)
+    : values(valuesIn),
+      tree(coordinatesIn, valuesIn.empty() ? 0 : coordinatesIn.size() / valuesIn.size()),
+      neighbors(neighbors > 0 ? (std::size_t)neighbors : 8),
+      power(power > 0 ? power : 2.0),
+      radius(radius) {
+    if (tree.Size() != values.size()) {
+        throw std::invalid_argument("The number of coordinates must be the dimension times the number of values");
+    }
+}
+
+double ablate::mathFunctions::InverseDistanceWeighted::Interpolate(const double *xyz, std::size_t xyzDimension) const {
+    // find the neighbors
+    std::vector<std::size_t> indices;
+    std::vector<double> distancesSquared;
+    if (radius > 0) {
+        tree.Radius(xyz, xyzDimension, radius, indices);
+        if (indices.empty()) {
+            // fall back to the nearest point when nothing is inside the radius
+            return values[tree.Nearest(xyz, xyzDimension)];
+        }
+    } else {
+        tree.KNearest(xyz, xyzDimension, neighbors, indices, distancesSquared);
+    }
+
+    // weight each value by 1/d^power, returning the data value directly when the query is on a point
+    const std::size_t dimensionToCheck = std::min(xyzDimension, tree.Dimension());
+    double weightedSum = 0.0;
+    double weightSum = 0.0;
+    for (std::size_t i = 0; i < indices.size(); ++i) {
+        double distanceSquared;
+        if (distancesSquared.empty()) {
+            distanceSquared = 0.0;
+            const double *point = tree.GetPoint(indices[i]);
+            for (std::size_t d = 0; d < dimensionToCheck; ++d) {
+                distanceSquared += (xyz[d] - point[d]) * (xyz[d] - point[d]);
+            }
+        } else {
+            distanceSquared = distancesSquared[i];
+        }
+        if (distanceSquared == 0.0) {
+            return values[indices[i]];
+        }
+        const double weight = std::pow(distanceSquared, -0.5 * power);
+        weightedSum += weight * values[indices[i]];
+        weightSum += weight;
+    }
+    return weightedSum / weightSum;
+}
+
+PetscErrorCode ablate::mathFunctions::InverseDistanceWeighted::InverseDistanceWeightedPetscFunction(PetscInt dim, PetscReal time, const PetscReal *x, PetscInt Nf, PetscScalar *u, void *ctx) {
+    PetscFunctionBegin;
+    auto function = (InverseDistanceWeighted *)ctx;
+    u[0] = function->Interpolate(x, dim);
+    PetscFunctionReturn(PETSC_SUCCESS);
+}
+double ablate::mathFunctions::InverseDistanceWeighted::Eval(const double &x, const double &y, const double &z, const double &t) const {
+    double xyz[3] = {x, y, z};
+    return Interpolate(xyz, 3);
+}
+double ablate::mathFunctions::InverseDistanceWeighted::Eval(const double *xyz, const int &ndims, const double &t) const { return Interpolate(xyz, ndims); }
+void ablate::mathFunctions::InverseDistanceWeighted::Eval(const double &x, const double &y, const double &z, const double &t, std::vector<double> &result) const {
+    if (result.size() != 1) {
+        throw std::invalid_argument("The ablate::mathFunctions::InverseDistanceWeighted only support scalar values");
+    }
+    double xyz[3] = {x, y, z};
+    result[0] = Interpolate(xyz, 3);
+}
+void ablate::mathFunctions::InverseDistanceWeighted::Eval(const double *xyz, const int &ndims, const double &t, std::vector<double> &result) const {
+    if (result.size() != 1) {
+        throw std::invalid_argument("The ablate::mathFunctions::InverseDistanceWeighted only support scalar values");
+    }
+    result[0] = Interpolate(xyz, ndims);
+}
+
+#include "registrar.hpp"
+REGISTER(ablate::mathFunctions::MathFunction, ablate::mathFunctions::InverseDistanceWeighted,
+         "Create a math function that returns the inverse distance weighted average of the nearby points", ARG(std::vector<double>, "coordinates", "list of coordinates (x1, y1, z1, x2, y2, etc.)"),
+         ARG(std::vector<double>, "values", "list of values in the same order as the coordinates"), OPT(int, "neighbors", "the number of nearest neighbors to average (default 8)"),
+         OPT(double, "power", "the power applied to the inverse distance (default 2)"),
+         OPT(double, "radius", "optional search radius, when set all points within the radius are averaged instead of the nearest neighbors"));
@@ -0,0 +1,74 @@
+#ifndef ABLATELIBRARY_INVERSEDISTANCEWEIGHTED_HPP
+#define ABLATELIBRARY_INVERSEDISTANCEWEIGHTED_HPP
+
+#include <vector>
+#include "mathFunction.hpp"
+#include "utilities/kdTree.hpp"
+namespace ablate::mathFunctions {
+
+/**
+ * Math function that takes a list of points/values and returns the inverse distance weighted (Shepard) average of the nearby values.  The neighbors
+ * are either the k nearest points or every point within a search radius, found using a kd-tree built at construction.
+ */
+class InverseDistanceWeighted : public MathFunction {
+   private:
+    //! List of values
+    const std::vector<double> values;
+
+    //! The spatial search tree over the coordinates
+    const utilities::KdTree tree;
+
+    //! the number of nearest neighbors to average when no radius is specified
+    const std::size_t neighbors;
+
+    //! the power applied to the inverse distance
+    const double power;
+
+    //! optional search radius, all points within the radius are averaged when greater than zero
+    const double radius;
+
+    /**
+     * static call to be called from petsc
+     * @param dim
+     * @param time
+     * @param x
+     * @param Nf
+     * @param u
+     * @param ctx
+     * @return
+     */
+    static PetscErrorCode InverseDistanceWeightedPetscFunction(PetscInt dim, PetscReal time, const PetscReal x[], PetscInt Nf, PetscScalar* u, void* ctx);
+
+    /**
+     * Compute the weighted value at xyz
+     * @param xyz
+     * @param xyzDimension
+     * @return
+     */
+    double Interpolate(const double* xyz, std::size_t xyzDimension) const;
+
+   public:
+    /**
+     * Create an inverse distance weighted function from the list of points
+     * @param coordinates list of coordinates (x1, y1, z1, x2, y2, etc.)
+     * @param values List of values
+     * @param neighbors the number of nearest neighbors to average (default 8)
+     * @param power the power applied to the inverse distance (default 2)
+     * @param radius optional search radius, when set all points within the radius are averaged instead of the nearest neighbors
+     */
+    InverseDistanceWeighted(const std::vector<double>& coordinates, const std::vector<double>& values, int neighbors = {}, double power = {}, double radius = {});
+
+    double Eval(const double& x, const double& y, const double& z, const double& t) const override;
+
+    double Eval(const double* xyz, const int& ndims, const double& t) const override;
+
+    void Eval(const double& x, const double& y, const double& z, const double& t, std::vector<double>& result) const override;
+
+    void Eval(const double* xyz, const int& ndims, const double& t, std::vector<double>& result) const override;
+
+    void* GetContext() override { return this; }
+
+    PetscFunction GetPetscFunction() override { return InverseDistanceWeightedPetscFunction; }
+};
+}  // namespace ablate::mathFunctions
+#endif  // ABLATELIBRARY_INVERSEDISTANCEWEIGHTED_HPP
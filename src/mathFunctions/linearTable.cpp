@@ -2,6 +2,7 @@
 #include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <sstream>
 #include <string>
 
 ablate::mathFunctions::LinearTable::LinearTable(std::filesystem::path inputFile, std::string xAxisColumn, std::vector<std::string> yColumns, std::shared_ptr<MathFunction> locationToXCoordFunction)
@@ -24,7 +25,7 @@ static inline void trim(std::string& s) {
     s.erase(std::find_if(s.rbegin(), s.rend(), [](unsigned char ch) { return !std::isspace(ch); }).base(), s.end());
 }
 
-void ablate::mathFunctions::LinearTable::ParseInputData(std::istream& inputStream) {
+std::vector<std::vector<double>> ablate::mathFunctions::LinearTable::ReadColumns(std::istream& inputStream, const std::vector<std::string>& columnNames) {
     // determine the headers from the first row
     std::vector<std::string> headers;
     std::string line;
@@ -40,25 +41,18 @@ void ablate::mathFunctions::LinearTable::ParseInputData(std::istream& inputStrea
     }
 
     // record the column index for each requested value
-    auto xIndexIt = std::find(headers.begin(), headers.end(), independentColumnName);
-    if (xIndexIt == headers.end()) {
-        throw std::invalid_argument("Cannot locate column " + independentColumnName);
-    }
-    auto xIndex = std::distance(headers.begin(), xIndexIt);
-
-    // repeat for each y column
-    std::vector<std::size_t> yIndexes;
-    for (const auto& yColumnName : dependentColumnsNames) {
-        auto yIndexIt = std::find(headers.begin(), headers.end(), yColumnName);
-        if (yIndexIt == headers.end()) {
-            throw std::invalid_argument("Cannot locate column " + yColumnName);
+    std::vector<std::size_t> columnIndexes;
+    for (const auto& columnName : columnNames) {
+        auto columnIndexIt = std::find(headers.begin(), headers.end(), columnName);
+        if (columnIndexIt == headers.end()) {
+            throw std::invalid_argument("Cannot locate column " + columnName);
         }
-        yIndexes.push_back(std::distance(headers.begin(), yIndexIt));
+        columnIndexes.push_back(std::distance(headers.begin(), columnIndexIt));
     }
 
     // size up a double array to hold the values
     std::vector<double> rowValues(headers.size());
-    dependentValues.resize(yIndexes.size());
+    std::vector<std::vector<double>> columns(columnIndexes.size());
 
     // Now parse each line
     while (std::getline(inputStream, line)) {
@@ -69,40 +63,80 @@ void ablate::mathFunctions::LinearTable::ParseInputData(std::istream& inputStrea
             rowValues[c] = std::stod(lineNumber);
         }
 
-        // now extract the values and place in the columns/xvalues
-        independentValues.push_back(rowValues[xIndex]);
-        for (std::size_t v = 0; v < yIndexes.size(); v++) {
-            dependentValues[v].push_back(rowValues[yIndexes[v]]);
+        // now extract the values and place in the columns
+        for (std::size_t v = 0; v < columnIndexes.size(); v++) {
+            columns[v].push_back(rowValues[columnIndexes[v]]);
         }
     }
+    return columns;
 }
-void ablate::mathFunctions::LinearTable::Interpolate(double x, size_t numInterpolations, double* result) const {
-    // Determine the upper index
-    std::size_t upIndex = 0;
-    for (upIndex = 1; upIndex < independentValues.size() - 1; upIndex++) {
-        // If the inquiry value is less then this, we have the right index
-        if (x < independentValues[upIndex]) {
-            break;
+
+void ablate::mathFunctions::LinearTable::ParseInputData(std::istream& inputStream) {
+    // read the independent column followed by the dependent columns
+    std::vector<std::string> columnNames{independentColumnName};
+    columnNames.insert(columnNames.end(), dependentColumnsNames.begin(), dependentColumnsNames.end());
+    auto columns = ReadColumns(inputStream, columnNames);
+
+    // store decreasing tables in increasing order
+    if (columns[0].size() > 1 && columns[0].front() > columns[0].back()) {
+        for (auto& column : columns) {
+            std::reverse(column.begin(), column.end());
         }
     }
-
-    // We need the x-x0 and deltaX
-    double x_x0 = x - independentValues[upIndex - 1];
-    double deltaX = independentValues[upIndex] - independentValues[upIndex - 1];
-
-    // Bound the interpolation to the first and last values, i.e. don't extrapolate
-    if (x < independentValues[upIndex - 1]) {
-        x_x0 = 0.0;
+    if (!std::is_sorted(columns[0].begin(), columns[0].end())) {
+        throw std::invalid_argument("The independent column " + independentColumnName + " must be monotonic");
     }
-    if (x > independentValues[upIndex]) {
-        x_x0 = deltaX;
+    independentAxis = TableAxis(columns[0]);
+    dependentValues.assign(columns.begin() + 1, columns.end());
+
+    // interleave the dependent values by row
+    const std::size_t numberDependent = dependentValues.size();
+    dependentRows.resize(independentAxis.GetValues().size() * numberDependent);
+    for (std::size_t r = 0; r < independentAxis.GetValues().size(); r++) {
+        for (std::size_t v = 0; v < numberDependent; v++) {
+            dependentRows[r * numberDependent + v] = dependentValues[v][r];
+        }
     }
+}
+
+void ablate::mathFunctions::LinearTable::Interpolate(double x, size_t numInterpolations, double* result) const {
+    // Determine the interval, bounding the interpolation to the first and last values, i.e. don't extrapolate
+    std::size_t lowIndex;
+    double fraction;
+    independentAxis.Locate(x, lowIndex, fraction);
 
     // Do the linear interpolation for each variable
+    const std::size_t numberDependent = dependentValues.size();
+    const double* lowRow = &dependentRows[lowIndex * numberDependent];
+    const double* upRow = &dependentRows[independentAxis.Upper(lowIndex) * numberDependent];
     for (std::size_t s = 0; s < numInterpolations; s++) {
-        result[s] = dependentValues[s][upIndex - 1] + (x_x0 / deltaX) * (dependentValues[s][upIndex] - dependentValues[s][upIndex - 1]);
+        result[s] = lowRow[s] + fraction * (upRow[s] - lowRow[s]);
+    }
+}
+
+void ablate::mathFunctions::LinearTable::Interpolate(const double* independentValues, std::size_t numberValues, double* result) const {
+    const std::size_t numberDependent = dependentValues.size();
+    for (std::size_t i = 0; i < numberValues; i++) {
+        Interpolate(independentValues[i], numberDependent, result + i * numberDependent);
+    }
+}
+
+void ablate::mathFunctions::LinearTable::Eval(const double* xyz, const int& ndims, std::size_t numberPoints, const double& t, double* result) const {
+    // map all points to the independent variable, then interpolate the first column
+    std::vector<double> independentValues(numberPoints);
+    independentValueFunction->Eval(xyz, ndims, numberPoints, t, independentValues.data());
+    for (std::size_t p = 0; p < numberPoints; p++) {
+        Interpolate(independentValues[p], 1, result + p);
     }
 }
+
+void ablate::mathFunctions::LinearTable::EvalAllColumns(const double* xyz, const int& ndims, std::size_t numberPoints, const double& t, double* result) const {
+    // map all points to the independent variable, then interpolate every column
+    std::vector<double> independentValues(numberPoints);
+    independentValueFunction->Eval(xyz, ndims, numberPoints, t, independentValues.data());
+    Interpolate(independentValues.data(), numberPoints, result);
+}
+
 double ablate::mathFunctions::LinearTable::Eval(const double& x, const double& y, const double& z, const double& t) const {
     double independentValue = independentValueFunction->Eval(x, y, z, t);
     double result;
@@ -5,10 +5,12 @@
 #include <istream>
 #include <vector>
 #include "mathFunction.hpp"
+#include "tableAxis.hpp"
 namespace ablate::mathFunctions {
 
 /**
- * a simple table that reads a text file and interpolates the value.  The xAxisColumn is assumed to be monotonic.
+ * a simple table that reads a text file and interpolates the value.  The xAxisColumn must be monotonic (increasing or decreasing), the interval is
+ * located with a binary search (or directly for uniformly spaced tables) and all dependent columns are interpolated together.
  * An example input would look like
  * x,y,z
  * 1,2,3
@@ -16,8 +18,12 @@ namespace ablate::mathFunctions {
  */
 class LinearTable : public MathFunction {
    private:
-    std::vector<double> independentValues;
+    //! the increasing independent values
+    TableAxis independentAxis;
+    //! the dependent values for each column
     std::vector<std::vector<double>> dependentValues;
+    //! the dependent values stored by row (row * numberDependent + column) so every column is interpolated from contiguous memory
+    std::vector<double> dependentRows;
     const std::string independentColumnName;
     const std::vector<std::string> dependentColumnsNames;
     const std::shared_ptr<MathFunction> independentValueFunction;
@@ -30,6 +36,14 @@ class LinearTable : public MathFunction {
     static PetscErrorCode LinearInterpolatorPetscFunction(PetscInt dim, PetscReal time, const PetscReal x[], PetscInt Nf, PetscScalar* u, void* ctx);
 
    public:
+    /**
+     * Read the requested columns from a csv stream with a header row
+     * @param inputStream
+     * @param columnNames
+     * @return the values for each requested column
+     */
+    static std::vector<std::vector<double>> ReadColumns(std::istream& inputStream, const std::vector<std::string>& columnNames);
+
     LinearTable(std::filesystem::path inputFile, std::string independentColumnName, std::vector<std::string> dependentColumnsNames, std::shared_ptr<MathFunction> independentValueFunction);
     LinearTable(std::istream& inputStream, std::string independentColumnName, std::vector<std::string> dependentColumnsNames, std::shared_ptr<MathFunction> independentValueFunction);
 
@@ -45,7 +59,35 @@ class LinearTable : public MathFunction {
 
     PetscFunction GetPetscFunction() override { return LinearInterpolatorPetscFunction; }
 
-    const std::vector<double>& GetIndependentValues() const { return independentValues; }
+    /**
+     * Interpolate every dependent column at many independent values in a single pass
+     * @param independentValues the independent values
+     * @param numberValues the number of independent values
+     * @param result the interpolated values ordered by value then dependent column (numberValues * GetDependentValues().size())
+     */
+    void Interpolate(const double* independentValues, std::size_t numberValues, double* result) const;
+
+    /**
+     * Map and interpolate the first dependent column at many points in a single pass.  Like the single value Eval, this returns one value per point.
+     * @param xyz the point coordinates ordered by point (numberPoints * ndims)
+     * @param ndims the dimension of each point
+     * @param numberPoints the number of points
+     * @param t the time
+     * @param result the interpolated value at each point (numberPoints)
+     */
+    void Eval(const double* xyz, const int& ndims, std::size_t numberPoints, const double& t, double* result) const override;
+
+    /**
+     * Map and interpolate every dependent column at many points in a single pass
+     * @param xyz the point coordinates ordered by point (numberPoints * ndims)
+     * @param ndims the dimension of each point
+     * @param numberPoints the number of points
+     * @param t the time
+     * @param result the interpolated values ordered by point then dependent column (numberPoints * GetDependentValues().size())
+     */
+    void EvalAllColumns(const double* xyz, const int& ndims, std::size_t numberPoints, const double& t, double* result) const;
+
+    const std::vector<double>& GetIndependentValues() const { return independentAxis.GetValues(); }
 
     const std::vector<std::vector<double>>& GetDependentValues() const { return dependentValues; }
 };
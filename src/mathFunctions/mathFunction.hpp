@@ -1,6 +1,7 @@
 #ifndef ABLATELIBRARY_MATHFUNCTION_HPP
 #define ABLATELIBRARY_MATHFUNCTION_HPP
 #include <petsc.h>
+#include <cstddef>
 #include <vector>
 
 namespace ablate::mathFunctions {
@@ -50,6 +51,21 @@ class MathFunction {
      */
     virtual void Eval(const double* xyz, const int& ndims, const double& t, std::vector<double>& result) const = 0;
 
+    /**
+     * Populate a result array for many points, ordered by point then value.  By default each point is evaluated one at a time with the single value Eval;
+     * functions that can evaluate a batch faster (e.g. formulas and tables) override this.
+     * @param xyz the point coordinates ordered by point (numberPoints * ndims)
+     * @param ndims the dimension of each point
+     * @param numberPoints the number of points
+     * @param t the time
+     * @param result the values at each point
+     */
+    virtual void Eval(const double* xyz, const int& ndims, std::size_t numberPoints, const double& t, double* result) const {
+        for (std::size_t p = 0; p < numberPoints; p++) {
+            result[p] = Eval(xyz + p * ndims, ndims, t);
+        }
+    }
+
     /**
      * Return a raw petsc style function to evaluate this math function
      * @return
@@ -0,0 +1,164 @@
+#include "multilinearTable.hpp"
+#include <algorithm>
+#include <fstream>
+#include "linearTable.hpp"
+
+ablate::mathFunctions::MultilinearTable::MultilinearTable(std::filesystem::path inputFile, std::vector<std::string> independentColumns, std::vector<std::string> dependentColumns,
+                                                          std::shared_ptr<MathFunction> independentValueFunction)
+    : independentColumnsNames(std::move(independentColumns)), dependentColumnsNames(std::move(dependentColumns)), independentValueFunction(std::move(independentValueFunction)) {
+    // open the file
+    std::fstream inputFileStream;
+    inputFileStream.open(inputFile, std::ios::in);
+    ParseInputData(inputFileStream);
+    inputFileStream.close();
+}
+
+ablate::mathFunctions::MultilinearTable::MultilinearTable(std::istream& inputStream, std::vector<std::string> independentColumns, std::vector<std::string> dependentColumns,
+                                                          std::shared_ptr<MathFunction> independentValueFunction)
+    : independentColumnsNames(std::move(independentColumns)), dependentColumnsNames(std::move(dependentColumns)), independentValueFunction(std::move(independentValueFunction)) {
+    ParseInputData(inputStream);
+}
+
+void ablate::mathFunctions::MultilinearTable::ParseInputData(std::istream& inputStream) {
+    if (independentColumnsNames.empty() || independentColumnsNames.size() > 3) {
+        throw std::invalid_argument("The MultilinearTable requires between 1 and 3 independent columns");
+    }
+
+    // read the independent columns followed by the dependent columns
+    std::vector<std::string> columnNames(independentColumnsNames);
+    columnNames.insert(columnNames.end(), dependentColumnsNames.begin(), dependentColumnsNames.end());
+    auto columns = LinearTable::ReadColumns(inputStream, columnNames);
+    const std::size_t numberRows = columns[0].size();
+
+    // each axis is the sorted unique values in the column
+    std::size_t numberNodes = 1;
+    for (std::size_t i = 0; i < independentColumnsNames.size(); i++) {
+        std::vector<double> axisValues(columns[i]);
+        std::sort(axisValues.begin(), axisValues.end());
+        axisValues.erase(std::unique(axisValues.begin(), axisValues.end()), axisValues.end());
+        numberNodes *= axisValues.size();
+        independentAxes.emplace_back(axisValues);
+    }
+    if (numberNodes != numberRows) {
+        throw std::invalid_argument("The MultilinearTable rows (" + std::to_string(numberRows) + ") do not form a complete grid (" + std::to_string(numberNodes) + " nodes)");
+    }
+
+    // place each row in the grid
+    const std::size_t numberDependent = dependentColumnsNames.size();
+    dependentValues.resize(numberNodes * numberDependent);
+    std::vector<bool> filled(numberNodes, false);
+    for (std::size_t r = 0; r < numberRows; r++) {
+        std::size_t node = 0;
+        std::size_t stride = 1;
+        for (std::size_t i = 0; i < independentAxes.size(); i++) {
+            const auto& axisValues = independentAxes[i].GetValues();
+            node += stride * (std::lower_bound(axisValues.begin(), axisValues.end(), columns[i][r]) - axisValues.begin());
+            stride *= axisValues.size();
+        }
+        if (filled[node]) {
+            throw std::invalid_argument("The MultilinearTable contains a duplicate row at row " + std::to_string(r));
+        }
+        filled[node] = true;
+        for (std::size_t v = 0; v < numberDependent; v++) {
+            dependentValues[node * numberDependent + v] = columns[independentAxes.size() + v][r];
+        }
+    }
+}
+
+void ablate::mathFunctions::MultilinearTable::Interpolate(const double* independentValues, size_t numInterpolations, double* result) const {
+    // locate the cell in each direction
+    const std::size_t numberAxes = independentAxes.size();
+    std::size_t lower[3];
+    std::size_t upper[3];
+    double fraction[3];
+    std::size_t strides[3];
+    std::size_t stride = 1;
+    for (std::size_t i = 0; i < numberAxes; i++) {
+        independentAxes[i].Locate(independentValues[i], lower[i], fraction[i]);
+        upper[i] = independentAxes[i].Upper(lower[i]);
+        strides[i] = stride;
+        stride *= independentAxes[i].GetValues().size();
+    }
+
+    // blend the values at each corner of the cell
+    const std::size_t numberDependent = dependentColumnsNames.size();
+    std::fill(result, result + numInterpolations, 0.0);
+    for (std::size_t corner = 0; corner < (1u << numberAxes); corner++) {
+        double weight = 1.0;
+        std::size_t node = 0;
+        for (std::size_t i = 0; i < numberAxes; i++) {
+            const bool isUpper = corner & (1u << i);
+            weight *= isUpper ? fraction[i] : 1.0 - fraction[i];
+            node += strides[i] * (isUpper ? upper[i] : lower[i]);
+        }
+        if (weight == 0.0) {
+            continue;
+        }
+        const double* nodeValues = &dependentValues[node * numberDependent];
+        for (std::size_t s = 0; s < numInterpolations; s++) {
+            result[s] += weight * nodeValues[s];
+        }
+    }
+}
+
+double ablate::mathFunctions::MultilinearTable::Eval(const double& x, const double& y, const double& z, const double& t) const {
+    std::vector<double> independentValues(independentAxes.size());
+    independentValueFunction->Eval(x, y, z, t, independentValues);
+    double result;
+    Interpolate(independentValues.data(), 1, &result);
+    return result;
+}
+double ablate::mathFunctions::MultilinearTable::Eval(const double* xyz, const int& ndims, const double& t) const {
+    std::vector<double> independentValues(independentAxes.size());
+    independentValueFunction->Eval(xyz, ndims, t, independentValues);
+    double result;
+    Interpolate(independentValues.data(), 1, &result);
+    return result;
+}
+void ablate::mathFunctions::MultilinearTable::Eval(const double& x, const double& y, const double& z, const double& t, std::vector<double>& result) const {
+    std::vector<double> independentValues(independentAxes.size());
+    independentValueFunction->Eval(x, y, z, t, independentValues);
+    Interpolate(independentValues.data(), std::min(result.size(), dependentColumnsNames.size()), result.data());
+}
+void ablate::mathFunctions::MultilinearTable::Eval(const double* xyz, const int& ndims, const double& t, std::vector<double>& result) const {
+    std::vector<double> independentValues(independentAxes.size());
+    independentValueFunction->Eval(xyz, ndims, t, independentValues);
+    Interpolate(independentValues.data(), std::min(result.size(), dependentColumnsNames.size()), result.data());
+}
+void ablate::mathFunctions::MultilinearTable::Eval(const double* xyz, const int& ndims, std::size_t numberPoints, const double& t, double* result) const {
+    std::vector<double> independentValues(independentAxes.size());
+    for (std::size_t p = 0; p < numberPoints; p++) {
+        independentValueFunction->Eval(xyz + p * ndims, ndims, t, independentValues);
+        Interpolate(independentValues.data(), 1, result + p);
+    }
+}
+void ablate::mathFunctions::MultilinearTable::EvalAllColumns(const double* xyz, const int& ndims, std::size_t numberPoints, const double& t, double* result) const {
+    const std::size_t numberDependent = dependentColumnsNames.size();
+    std::vector<double> independentValues(independentAxes.size());
+    for (std::size_t p = 0; p < numberPoints; p++) {
+        independentValueFunction->Eval(xyz + p * ndims, ndims, t, independentValues);
+        Interpolate(independentValues.data(), numberDependent, result + p * numberDependent);
+    }
+}
+PetscErrorCode ablate::mathFunctions::MultilinearTable::MultilinearTablePetscFunction(PetscInt dim, PetscReal time, const PetscReal* x, PetscInt nf, PetscScalar* u, void* ctx) {
+    // wrap in try, so we return petsc error code instead of c++ exception
+    PetscFunctionBeginUser;
+    try {
+        auto table = (MultilinearTable*)ctx;
+
+        std::vector<double> independentValues(table->independentAxes.size());
+        table->independentValueFunction->Eval(x, dim, time, independentValues);
+        table->Interpolate(independentValues.data(), std::min((std::size_t)nf, table->dependentColumnsNames.size()), u);
+    } catch (std::exception& exception) {
+        SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exception.what());
+    }
+    PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+#include "registrar.hpp"
+REGISTER(ablate::mathFunctions::MathFunction, ablate::mathFunctions::MultilinearTable,
+         "A table that is built from a spreadsheet on a rectilinear grid of independent variables that allows multilinear interpolation of variables",
+         ARG(std::filesystem::path, "file", "a file with csv data and header"),
+         ARG(std::vector<std::string>, "independent", "the names of the independent columns (up to 3) as defined in the header"),
+         ARG(std::vector<std::string>, "dependent", "the names of the dependent column in the order in which to apply them"),
+         ARG(ablate::mathFunctions::MathFunction, "mappingFunction", "the function that maps from the physical x,y,z, and t space to the table independent variables (one per independent column)"));
@@ -0,0 +1,79 @@
+#ifndef ABLATELIBRARY_MULTILINEARTABLE_HPP
+#define ABLATELIBRARY_MULTILINEARTABLE_HPP
+
+#include <filesystem>
+#include <istream>
+#include <vector>
+#include "mathFunction.hpp"
+#include "tableAxis.hpp"
+namespace ablate::mathFunctions {
+
+/**
+ * A multi-dimensional table that reads a text file and multilinearly interpolates the value.  The rows must form a complete rectilinear grid over
+ * the independent columns (every combination of the unique independent values appears once) but may be listed in any order.
+ * An example input would look like
+ * x,y,z
+ * 0,0,3
+ * 1,0,2
+ * 0,1,1
+ * 1,1,0
+ */
+class MultilinearTable : public MathFunction {
+   private:
+    //! the axis for each independent column
+    std::vector<TableAxis> independentAxes;
+    //! the dependent values stored by grid node (node * numberDependent + column), with the first independent axis varying fastest
+    std::vector<double> dependentValues;
+    const std::vector<std::string> independentColumnsNames;
+    const std::vector<std::string> dependentColumnsNames;
+    const std::shared_ptr<MathFunction> independentValueFunction;
+
+   private:
+    void ParseInputData(std::istream& inputFile);
+
+    void Interpolate(const double* independentValues, size_t numInterpolations, double* result) const;
+
+    static PetscErrorCode MultilinearTablePetscFunction(PetscInt dim, PetscReal time, const PetscReal x[], PetscInt Nf, PetscScalar* u, void* ctx);
+
+   public:
+    MultilinearTable(std::filesystem::path inputFile, std::vector<std::string> independentColumnsNames, std::vector<std::string> dependentColumnsNames,
+                     std::shared_ptr<MathFunction> independentValueFunction);
+    MultilinearTable(std::istream& inputStream, std::vector<std::string> independentColumnsNames, std::vector<std::string> dependentColumnsNames,
+                     std::shared_ptr<MathFunction> independentValueFunction);
+
+    double Eval(const double& x, const double& y, const double& z, const double& t) const override;
+
+    double Eval(const double* xyz, const int& ndims, const double& t) const override;
+
+    void Eval(const double& x, const double& y, const double& z, const double& t, std::vector<double>& result) const override;
+
+    void Eval(const double* xyz, const int& ndims, const double& t, std::vector<double>& result) const override;
+
+    /**
+     * Map and interpolate the first dependent column at many points.  Like the single value Eval, this returns one value per point.
+     * @param xyz the point coordinates ordered by point (numberPoints * ndims)
+     * @param ndims the dimension of each point
+     * @param numberPoints the number of points
+     * @param t the time
+     * @param result the interpolated value at each point (numberPoints)
+     */
+    void Eval(const double* xyz, const int& ndims, std::size_t numberPoints, const double& t, double* result) const override;
+
+    /**
+     * Map and interpolate every dependent column at many points
+     * @param xyz the point coordinates ordered by point (numberPoints * ndims)
+     * @param ndims the dimension of each point
+     * @param numberPoints the number of points
+     * @param t the time
+     * @param result the interpolated values ordered by point then dependent column (numberPoints * number of dependent columns)
+     */
+    void EvalAllColumns(const double* xyz, const int& ndims, std::size_t numberPoints, const double& t, double* result) const;
+
+    void* GetContext() override { return this; }
+
+    PetscFunction GetPetscFunction() override { return MultilinearTablePetscFunction; }
+
+    const std::vector<TableAxis>& GetIndependentAxes() const { return independentAxes; }
+};
+}  // namespace ablate::mathFunctions
+#endif  // ABLATELIBRARY_MULTILINEARTABLE_HPP
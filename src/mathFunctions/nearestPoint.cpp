@@ -1,34 +1,13 @@
 #include "nearestPoint.hpp"
 
 ablate::mathFunctions::NearestPoint::NearestPoint(const std::vector<double> &coordinatesIn, const std::vector<double> &valuesIn)
-    : coordinates(coordinatesIn), values(valuesIn), dimension(coordinatesIn.size() / valuesIn.size()), numberPoints(valuesIn.size()) {
-    if (dimension < 1 || dimension > 3) {
-        throw std::invalid_argument("The dimension (coordinates.size()/values.size()) must be 0, 1, or 3");
+    : values(valuesIn), tree(coordinatesIn, valuesIn.empty() ? 0 : coordinatesIn.size() / valuesIn.size()) {
+    if (tree.Size() != values.size()) {
+        throw std::invalid_argument("The number of coordinates must be the dimension times the number of values");
     }
 }
 
-std::size_t ablate::mathFunctions::NearestPoint::FindNearestPoint(const double *xyz, std::size_t xyzDimension) const {
-    std::size_t index = 0;
-    double nearestDistance = 1E10;
-
-    // Determine the dimensions to check from the min of this class and xyz
-    std::size_t dimensionToCheck = PetscMin(xyzDimension, dimension);
-    // check each point
-    for (std::size_t p = 0; p < numberPoints; ++p) {
-        PetscReal distance = 0.0;
-
-        for (std::size_t d = 0; d < dimensionToCheck; ++d) {
-            distance += PetscSqr(xyz[d] - coordinates[p * dimension + d]);
-        }
-        distance = PetscSqrtReal(distance);
-        if (distance < nearestDistance) {
-            index = p;
-            nearestDistance = distance;
-        }
-    }
-
-    return index;
-}
+std::size_t ablate::mathFunctions::NearestPoint::FindNearestPoint(const double *xyz, std::size_t xyzDimension) const { return tree.Nearest(xyz, xyzDimension); }
 
 PetscErrorCode ablate::mathFunctions::NearestPoint::NearestPointPetscFunction(PetscInt dim, PetscReal time, const PetscReal *x, PetscInt Nf, PetscScalar *u, void *ctx) {
     PetscFunctionBegin;
@@ -5,24 +5,20 @@
 #include <istream>
 #include <vector>
 #include "mathFunction.hpp"
+#include "utilities/kdTree.hpp"
 namespace ablate::mathFunctions {
 
 /**
- * Simple math function that takes a list of a points/values and returns the value associated with the nearest point
+ * Simple math function that takes a list of a points/values and returns the value associated with the nearest point.  The points are stored in a kd-tree
+ * built at construction so each evaluation is O(log N).
  */
 class NearestPoint : public MathFunction {
    private:
-    //! list of coordinates (x1, y1, z1, x2, y2, etc.)
-    const std::vector<double> coordinates;
-
     //! List of values
     const std::vector<double> values;
 
-    //! The dimension of the coordinates
-    const std::size_t dimension;
-
-    //! The dimension of the coordinates
-    const std::size_t numberPoints;
+    //! The spatial search tree over the coordinates
+    const utilities::KdTree tree;
 
    private:
     /**
@@ -12,13 +12,69 @@ ablate::mathFunctions::ParsedSeries::ParsedSeries(std::string functionString, in
 
     // Test the function
     try {
-        parser.Eval();
+        parser.Eval(numberResults);
     } catch (mu::Parser::exception_type& exception) {
         throw ablate::mathFunctions::SimpleFormula::ConvertToException(exception);
     }
 }
 
+void ablate::mathFunctions::ParsedSeries::DefineBulkVariables(mu::Parser& bulkParserToConfigure, std::size_t capacity) const {
+    bulkIndex.assign(capacity, 0.0);
+    bulkTerms.assign(capacity, 0.0);
+    bulkParserToConfigure.DefineVar("i", bulkIndex.data());
+}
+
+double ablate::mathFunctions::ParsedSeries::EvalScalarSeries(const double* xyz, int ndims, double t) const {
+    if (upperBound < lowerBound) {
+        return 0.0;
+    }
+
+    // evaluate every term at this point in a single call
+    const auto numberTerms = (std::size_t)(upperBound - lowerBound + 1);
+    auto& bulk = GetBulkParser(numberTerms);
+    for (std::size_t n = 0; n < numberTerms; n++) {
+        for (int d = 0; d < 3; d++) {
+            bulkCoordinate[d][n] = d < ndims ? xyz[d] : 0.0;
+        }
+        bulkTime[n] = t;
+        bulkIndex[n] = lowerBound + (double)n;
+    }
+    bulk.Eval(bulkTerms.data(), (int)numberTerms);
+
+    // sum in the same order as the term by term evaluation
+    double sum = 0.0;
+    for (std::size_t n = 0; n < numberTerms; n++) {
+        sum += bulkTerms[n];
+    }
+    return sum;
+}
+
+void ablate::mathFunctions::ParsedSeries::Eval(const double* xyz, const int& ndims, std::size_t numberPoints, const double& t, double* result) const {
+    if (!CanEvalInBulk()) {
+        FormulaBase::Eval(xyz, ndims, numberPoints, t, result);
+        return;
+    }
+
+    auto& bulk = GetBulkParser(numberPoints);
+    SetBulkPoints(xyz, ndims, numberPoints, t);
+    std::fill(result, result + numberPoints, 0.0);
+
+    // evaluate each term over every point
+    for (int n = lowerBound; n <= upperBound; n++) {
+        std::fill(bulkIndex.begin(), bulkIndex.begin() + numberPoints, (double)n);
+        bulk.Eval(bulkTerms.data(), (int)numberPoints);
+        for (std::size_t p = 0; p < numberPoints; p++) {
+            result[p] += bulkTerms[p];
+        }
+    }
+}
+
 double ablate::mathFunctions::ParsedSeries::Eval(const double& x, const double& y, const double& z, const double& t) const {
+    if (CanEvalInBulk()) {
+        const double xyz[3] = {x, y, z};
+        return EvalScalarSeries(xyz, 3, t);
+    }
+
     coordinate[0] = x;
     coordinate[1] = y;
     coordinate[2] = z;
@@ -33,6 +89,10 @@ double ablate::mathFunctions::ParsedSeries::Eval(const double& x, const double&
 }
 
 double ablate::mathFunctions::ParsedSeries::Eval(const double* xyz, const int& ndims, const double& t) const {
+    if (CanEvalInBulk()) {
+        return EvalScalarSeries(xyz, ndims, t);
+    }
+
     coordinate[0] = 0;
     coordinate[1] = 0;
     coordinate[2] = 0;
@@ -110,6 +170,12 @@ PetscErrorCode ablate::mathFunctions::ParsedSeries::ParsedPetscSeries(PetscInt d
     try {
         auto parser = (ParsedSeries*)ctx;
 
+        // scalar series sum every term in a single bulk evaluation
+        if (nf == 1 && parser->CanEvalInBulk()) {
+            u[0] = parser->EvalScalarSeries(x, dim, time);
+            PetscFunctionReturn(0);
+        }
+
         // update the coordinates
         parser->coordinate[0] = 0;
         parser->coordinate[1] = 0;
@@ -7,7 +7,8 @@
 namespace ablate::mathFunctions {
 /**
  * computes a series result from a string function with variables x, y, z, t, and n where i index of summation. See the ParsedFunction for details on the string formatting.
- * Note that the lower and upper bound are inclusive.
+ * Note that the lower and upper bound are inclusive.  Scalar series are evaluated with the bulk parser, either over every term at a single point or
+ * term by term over a batch of points.
  */
 
 class ParsedSeries : public FormulaBase {
@@ -21,9 +22,27 @@ class ParsedSeries : public FormulaBase {
     //! the lower bound for the series
     const int upperBound;
 
+    //! the summation index for each point in a batch, linked to the bulk parser
+    mutable std::vector<double> bulkIndex;
+
+    //! scratch space for the bulk evaluation of each term
+    mutable std::vector<double> bulkTerms;
+
    private:
     static PetscErrorCode ParsedPetscSeries(PetscInt dim, PetscReal time, const PetscReal x[], PetscInt Nf, PetscScalar* u, void* ctx);
 
+    /**
+     * Sum a scalar series at a single point by evaluating every term in a single bulk call
+     * @param xyz
+     * @param ndims
+     * @param t
+     * @return
+     */
+    double EvalScalarSeries(const double* xyz, int ndims, double t) const;
+
+   protected:
+    void DefineBulkVariables(mu::Parser& bulkParserToConfigure, std::size_t capacity) const override;
+
    public:
     ParsedSeries(const ParsedSeries&) = delete;
     void operator=(const ParsedSeries&) = delete;
@@ -37,6 +56,11 @@ class ParsedSeries : public FormulaBase {
      */
     explicit ParsedSeries(std::string functionString, int lowerBound = 1, int upperBound = 1000, const std::shared_ptr<ablate::parameters::Parameters>& constants = {});
 
+    /**
+     * Sum the series at many points, each term is evaluated over the batch with the bulk parser
+     */
+    void Eval(const double* xyz, const int& ndims, std::size_t numberPoints, const double& t, double* result) const override;
+
     double Eval(const double& x, const double& y, const double& z, const double& t) const override;
 
     double Eval(const double* xyz, const int& ndims, const double& t) const override;
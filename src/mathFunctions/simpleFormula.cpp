@@ -6,7 +6,7 @@
 ablate::mathFunctions::SimpleFormula::SimpleFormula(std::string functionString) : FormulaBase(functionString, {}) {
     // Test the function
     try {
-        parser.Eval();
+        parser.Eval(numberResults);
     } catch (mu::Parser::exception_type& exception) {
         throw ablate::mathFunctions::FormulaBase::ConvertToException(exception);
     }
@@ -19,6 +19,8 @@ class SimpleFormula : public FormulaBase {
 
     explicit SimpleFormula(std::string functionString);
 
+    using FormulaBase::Eval;
+
     double Eval(const double& x, const double& y, const double& z, const double& t) const override;
 
     double Eval(const double* xyz, const int& ndims, const double& t) const override;
@@ -0,0 +1,22 @@
+#include "tableAxis.hpp"
+#include <cmath>
+#include <stdexcept>
+
+ablate::mathFunctions::TableAxis::TableAxis(std::vector<double> valuesIn) : values(std::move(valuesIn)) {
+    if (values.empty()) {
+        throw std::invalid_argument("The table axis must contain at least one value");
+    }
+    if (!std::is_sorted(values.begin(), values.end())) {
+        throw std::invalid_argument("The table axis values must be monotonic");
+    }
+
+    // check for uniform spacing so the interval can be computed directly
+    if (values.size() > 1 && values.back() > values.front()) {
+        const double spacing = (values.back() - values.front()) / (double)(values.size() - 1);
+        uniform = true;
+        for (std::size_t i = 0; i < values.size() && uniform; ++i) {
+            uniform = std::abs(values[i] - (values.front() + (double)i * spacing)) <= 1E-8 * spacing;
+        }
+        inverseSpacing = 1.0 / spacing;
+    }
+}
@@ -0,0 +1,85 @@
+#ifndef ABLATELIBRARY_TABLEAXIS_HPP
+#define ABLATELIBRARY_TABLEAXIS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace ablate::mathFunctions {
+
+/**
+ * A single monotonically increasing axis of an interpolation table.  The interval containing a value is located with a binary search, or directly
+ * from the spacing when the axis is uniform, so lookups are O(log N) or O(1) instead of a linear scan.
+ */
+class TableAxis {
+   private:
+    //! the increasing axis values
+    std::vector<double> values;
+
+    //! true if the values are uniformly spaced
+    bool uniform = false;
+
+    //! one over the uniform spacing
+    double inverseSpacing = 0.0;
+
+   public:
+    TableAxis() = default;
+
+    /**
+     * @param values the non-decreasing axis values
+     */
+    explicit TableAxis(std::vector<double> values);
+
+    /**
+     * Locate the interval containing x.  Values outside of the axis are clamped to the first/last value, i.e. no extrapolation.
+     * @param x the value to locate
+     * @param lower the lower index of the interval, the upper index is lower + 1 unless the axis has a single value
+     * @param fraction the fraction (0 to 1) of the distance from lower to upper
+     */
+    inline void Locate(double x, std::size_t& lower, double& fraction) const {
+        const std::size_t size = values.size();
+        if (size < 2 || x <= values.front()) {
+            lower = 0;
+            fraction = 0.0;
+            return;
+        }
+        if (x >= values.back()) {
+            lower = size - 2;
+            fraction = 1.0;
+            return;
+        }
+
+        if (uniform) {
+            lower = std::min((std::size_t)((x - values.front()) * inverseSpacing), size - 2);
+            // correct any round off in the computed index
+            if (x < values[lower]) {
+                --lower;
+            } else if (x >= values[lower + 1] && lower < size - 2) {
+                ++lower;
+            }
+        } else {
+            lower = std::min((std::size_t)(std::upper_bound(values.begin(), values.end(), x) - values.begin()) - 1, size - 2);
+        }
+
+        const double delta = values[lower + 1] - values[lower];
+        fraction = delta > 0.0 ? (x - values[lower]) / delta : 0.0;
+    }
+
+    /**
+     * @return the upper index for the interval starting at lower
+     */
+    [[nodiscard]] inline std::size_t Upper(std::size_t lower) const { return std::min(lower + 1, values.size() - 1); }
+
+    /**
+     * @return the axis values
+     */
+    [[nodiscard]] const std::vector<double>& GetValues() const { return values; }
+
+    /**
+     * @return true if the axis values are uniformly spaced
+     */
+    [[nodiscard]] bool IsUniform() const { return uniform; }
+};
+
+}  // namespace ablate::mathFunctions
+#endif  // ABLATELIBRARY_TABLEAXIS_HPP
@@ -44,3 +44,5 @@ PetscErrorCode ablate::monitors::FieldMonitor::Restore(PetscViewer viewer, Petsc
     PetscCall(monitorSubDomain->Restore(viewer, sequenceNumber, time));
     PetscFunctionReturn(0);
 }
+
+PetscObjectState ablate::monitors::FieldMonitor::GetSerializableState() { return monitorSubDomain->GetSerializableState(); }
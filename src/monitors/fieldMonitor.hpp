@@ -55,6 +55,12 @@ class FieldMonitor : public Monitor, public io::Serializable {
      * @param time
      */
     PetscErrorCode Restore(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) override;
+
+    /**
+     * The monitor fields only change when the monitor updates them, so report the vector state for incremental checkpoints
+     * @return
+     */
+    [[nodiscard]] PetscObjectState GetSerializableState() override;
 };
 
 }  // namespace ablate::monitors
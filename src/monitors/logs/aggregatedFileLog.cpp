@@ -0,0 +1,92 @@
+#include "aggregatedFileLog.hpp"
+#include <cstdarg>
+#include <cstdio>
+#include "environment/runEnvironment.hpp"
+#include "utilities/mpiUtilities.hpp"
+
+ablate::monitors::logs::AggregatedFileLog::AggregatedFileLog(std::string fileName, int bufferSize, double flushInterval)
+    : outputPath(std::filesystem::path(fileName).is_absolute() ? std::filesystem::path(fileName) : ablate::environment::RunEnvironment::Get().GetOutputDirectory() / fileName),
+      bufferSize(bufferSize > 0 ? (std::size_t)bufferSize : 1048576),
+      flushInterval(flushInterval > 0.0 ? flushInterval : 10.0) {}
+
+ablate::monitors::logs::AggregatedFileLog::~AggregatedFileLog() {
+    if (file != MPI_FILE_NULL) {
+        int finalized;
+        MPI_Finalized(&finalized);
+        if (!finalized) {
+            // collectively write the remaining records in rank order
+            MPI_File_write_ordered(file, buffer.data(), (int)buffer.size(), MPI_CHAR, MPI_STATUS_IGNORE);
+            MPI_File_close(&file);
+        }
+    }
+}
+
+void ablate::monitors::logs::AggregatedFileLog::Initialize(MPI_Comm commIn) {
+    Log::Initialize(commIn);
+
+    int rank;
+    MPI_Comm_rank(commIn, &rank) >> utilities::MpiUtilities::checkError;
+    rankTag = "[" + std::to_string(rank) + "] ";
+    buffer.reserve(bufferSize);
+    lastWrite = std::chrono::steady_clock::now();
+
+    // a single collective open replaces the file per rank
+    MPI_File_open(commIn, outputPath.c_str(), MPI_MODE_WRONLY | MPI_MODE_CREATE | MPI_MODE_APPEND, MPI_INFO_NULL, &file) >> utilities::MpiUtilities::checkError;
+}
+
+void ablate::monitors::logs::AggregatedFileLog::Printf(const char* format, ...) {
+    if (file == MPI_FILE_NULL) {
+        return;
+    }
+
+    // format the record into the reused buffer
+    va_list args;
+    va_start(args, format);
+    va_list sizeArgs;
+    va_copy(sizeArgs, args);
+    const auto size = std::vsnprintf(nullptr, 0, format, sizeArgs);
+    va_end(sizeArgs);
+    if (size > 0) {
+        formatBuffer.resize(size + 1);
+        std::vsnprintf(formatBuffer.data(), formatBuffer.size(), format, args);
+    }
+    va_end(args);
+
+    // tag each line with the rank
+    for (int i = 0; i < size; i++) {
+        if (lineStart) {
+            buffer += rankTag;
+            lineStart = false;
+        }
+        buffer.push_back(formatBuffer[i]);
+        lineStart = formatBuffer[i] == '\n';
+    }
+
+    // write when the buffer is full or the records have been held too long, so the file stays current for long or failed runs
+    if (buffer.size() >= bufferSize || std::chrono::steady_clock::now() - lastWrite >= flushInterval) {
+        WriteCompleteLines();
+    }
+}
+
+void ablate::monitors::logs::AggregatedFileLog::WriteCompleteLines() {
+    // only write complete lines so that records from different ranks are not interleaved
+    const auto lastLine = buffer.rfind('\n');
+    if (lastLine == std::string::npos) {
+        return;
+    }
+    MPI_File_write_shared(file, buffer.data(), (int)(lastLine + 1), MPI_CHAR, MPI_STATUS_IGNORE) >> utilities::MpiUtilities::checkError;
+    buffer.erase(0, lastLine + 1);
+    lastWrite = std::chrono::steady_clock::now();
+}
+
+void ablate::monitors::logs::AggregatedFileLog::Sync() {
+    if (file != MPI_FILE_NULL) {
+        MPI_File_sync(file) >> utilities::MpiUtilities::checkError;
+    }
+}
+
+#include "registrar.hpp"
+REGISTER(ablate::monitors::logs::Log, ablate::monitors::logs::AggregatedFileLog,
+         "Writes the log of every rank to a single shared file with each line tagged by rank (\"[rank] ...\").  The records are buffered and written in large blocks.",
+         ARG(std::string, "name", "the name of the shared log file"), OPT(int, "bufferSize", "the number of bytes buffered on each rank before writing (default 1MB)"),
+         OPT(double, "flushInterval", "the maximum number of seconds records are buffered before writing (default 10s)"));
@@ -0,0 +1,74 @@
+#ifndef ABLATELIBRARY_AGGREGATEDFILELOG_HPP
+#define ABLATELIBRARY_AGGREGATEDFILELOG_HPP
+
+#include <petsc.h>
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include "log.hpp"
+
+namespace ablate::monitors::logs {
+
+/**
+ * Writes the log of every rank to a single shared file.  Each line is tagged with the rank (file.txt => "[rank] ...") and buffered in memory.  Complete lines are
+ * written as a single large block through the MPI-IO shared file pointer once the buffer is full or the flush interval has elapsed, and the remaining records are
+ * written collectively in rank order when the log is destroyed.  This avoids the file per rank pattern of the MpiFileLog on large allocations.
+ */
+class AggregatedFileLog : public Log {
+   private:
+    //! the path to the shared file
+    std::filesystem::path outputPath;
+
+    //! the number of bytes buffered on each rank before writing
+    const std::size_t bufferSize;
+
+    //! the maximum time records are held in the buffer before they are written
+    const std::chrono::duration<double> flushInterval;
+
+    //! the time of the last write from this rank
+    std::chrono::steady_clock::time_point lastWrite;
+
+    //! the shared file
+    MPI_File file = MPI_FILE_NULL;
+
+    //! the tag added to the start of each line
+    std::string rankTag;
+
+    //! the buffered records for this rank
+    std::string buffer;
+
+    //! reused buffer to format each Printf
+    std::vector<char> formatBuffer;
+
+    //! true if the next character starts a new line
+    bool lineStart = true;
+
+    /**
+     * Write all complete lines in the buffer to the file
+     */
+    void WriteCompleteLines();
+
+   public:
+    /**
+     * @param fileName the name of the shared log file
+     * @param bufferSize the number of bytes buffered on each rank before writing (default 1MB)
+     * @param flushInterval the maximum number of seconds records are buffered before writing (default 10s)
+     */
+    explicit AggregatedFileLog(std::string fileName, int bufferSize = 0, double flushInterval = 0.0);
+    ~AggregatedFileLog() override;
+
+    // allow access to all print from base
+    using Log::Print;
+    void Printf(const char *, ...) final;
+    void Initialize(MPI_Comm comm) final;
+
+    /**
+     * Flushes the records already written by every rank to the storage device so they can be read back.  Records still held in the buffer are not written.
+     * This must be called by every rank.
+     */
+    void Sync();
+};
+}  // namespace ablate::monitors::logs
+
+#endif  // ABLATELIBRARY_AGGREGATEDFILELOG_HPP
@@ -32,6 +32,11 @@ class Monitor {
      */
     virtual void* GetContext() { return this; }
 
+    /**
+     * Called collectively by the time stepper once the solve is complete so that the monitor can write and post process its output
+     */
+    virtual void Finalize() {}
+
    protected:
     std::shared_ptr<solver::Solver> GetSolver() { return solver; }
 };
@@ -1,16 +1,23 @@
 #include "probes.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <fstream>
+#include <limits>
+#include <map>
 #include <regex>
 #include "io/interval/fixedInterval.hpp"
 #include "utilities/mpiUtilities.hpp"
 #include "utilities/vectorUtilities.hpp"
 
 ablate::monitors::Probes::Probes(const std::shared_ptr<ablate::monitors::probes::ProbeInitializer> &initializer, std::vector<std::string> variableNames,
-                                 const std::shared_ptr<io::interval::Interval> &intervalIn, const int bufferSize)
+                                 const std::shared_ptr<io::interval::Interval> &intervalIn, const int bufferSize, OutputFormat outputFormat, bool convertToCsv)
     : initializer(initializer),
       variableNames(std::move(variableNames)),
       interval(intervalIn ? intervalIn : std::make_shared<io::interval::FixedInterval>()),
-      bufferSize(bufferSize == 0 ? 100 : bufferSize) {}
+      bufferSize(bufferSize == 0 ? 100 : bufferSize),
+      outputFormat(outputFormat),
+      convertToCsv(convertToCsv) {}
 
 void ablate::monitors::Probes::Register(std::shared_ptr<solver::Solver> solver) {
     Monitor::Register(solver);
@@ -91,7 +98,7 @@ void ablate::monitors::Probes::Register(std::shared_ptr<solver::Solver> solver)
     PetscInt variableFieldOffset = 0;
     std::vector<std::string> componentNames;
 
-    // Create an interpolant for each variable
+    // Store each field and its output offset
     for (const auto &variableName : variableNames) {
         // Get the field information
         const auto &field = solver->GetSubDomain().GetField(variableName);
@@ -99,29 +106,6 @@ void ablate::monitors::Probes::Register(std::shared_ptr<solver::Solver> solver)
         // Store this field
         fields.push_back(field);
 
-        // Create the interpolant.  This uses PETSC_COMM_SELF because it should only work over local variables
-        DMInterpolationInfo interpolant;
-        DMInterpolationCreate(PETSC_COMM_SELF, &interpolant) >> utilities::PetscUtilities::checkError;
-        DMInterpolationSetDim(interpolant, dim) >> utilities::PetscUtilities::checkError;
-        DMInterpolationSetDof(interpolant, field.numberComponents) >> utilities::PetscUtilities::checkError;
-
-        // Add all local points to the interpolant
-        DMInterpolationAddPoints(interpolant, (PetscInt)localProbes.size(), coordinates.data()) >> utilities::PetscUtilities::checkError;
-
-        // Get the subfield dm
-        IS subIs;
-        DM subDm;
-        Vec locVec;
-        solver->GetSubDomain().GetFieldLocalVector(field, 0.0, &subIs, &locVec, &subDm) >> utilities::PetscUtilities::checkError;
-
-        // Finish the one time set up
-        // The redundantPoints flag should not really matter because PETSC_COMM_SELF was used to init the interpolant
-        DMInterpolationSetUp(interpolant, subDm, PETSC_FALSE, PETSC_FALSE) >> utilities::PetscUtilities::checkError;
-        interpolants.push_back(interpolant);
-
-        // restore
-        solver->GetSubDomain().RestoreFieldLocalVector(field, &subIs, &locVec, &subDm) >> utilities::PetscUtilities::checkError;
-
         // convert the variable names to the variable names with components
         if (field.numberComponents > 0) {
             for (const auto &componentName : field.components) {
@@ -134,16 +118,155 @@ void ablate::monitors::Probes::Register(std::shared_ptr<solver::Solver> solver)
         variableFieldOffset += field.numberComponents;
     }
 
-    // Build a ProbeRecorder for each probe
-    for (const auto &probe : localProbes) {
-        std::filesystem::path probePath = initializer->GetDirectory() / (probe.name + ".csv");
-        recorders.emplace_back(bufferSize, componentNames, probePath);
+    // Create a single interpolant for all fields at each location so that every probe is located once and the fields are interpolated in a single pass
+    for (const auto location : {domain::FieldLocation::SOL, domain::FieldLocation::AUX}) {
+        // determine the unique fields at this location
+        std::vector<PetscInt> fieldIds;
+        for (const auto &field : fields) {
+            if (field.location == location) {
+                fieldIds.push_back(field.id);
+            }
+        }
+        std::sort(fieldIds.begin(), fieldIds.end());
+        fieldIds.erase(std::unique(fieldIds.begin(), fieldIds.end()), fieldIds.end());
+        if (fieldIds.empty()) {
+            continue;
+        }
+
+        InterpolationGroup group{.location = location};
+
+        // Create a subDM with every field at this location.  This is reused for each sample
+        auto entireDm = location == domain::FieldLocation::SOL ? solver->GetSubDomain().GetDM() : solver->GetSubDomain().GetAuxDM();
+        DMCreateSubDM(entireDm, (PetscInt)fieldIds.size(), fieldIds.data(), &group.subIs, &group.subDm) >> utilities::PetscUtilities::checkError;
+
+        // The interpolated values are ordered by field in the subDM
+        std::map<PetscInt, PetscInt> groupOffsets;
+        for (const auto &fieldId : fieldIds) {
+            const auto &field = *std::find_if(fields.begin(), fields.end(), [location, fieldId](const auto &f) { return f.location == location && f.id == fieldId; });
+            groupOffsets[fieldId] = group.dof;
+            group.dof += field.numberComponents;
+        }
+        for (std::size_t f = 0; f < fields.size(); f++) {
+            if (fields[f].location == location) {
+                for (PetscInt c = 0; c < fields[f].numberComponents; c++) {
+                    group.outputIndices.emplace_back(groupOffsets[fields[f].id] + c, fieldOffset[f] + c);
+                }
+            }
+        }
+
+        // Create the interpolant.  This uses PETSC_COMM_SELF because it should only work over local variables
+        DMInterpolationCreate(PETSC_COMM_SELF, &group.interpolant) >> utilities::PetscUtilities::checkError;
+        DMInterpolationSetDim(group.interpolant, dim) >> utilities::PetscUtilities::checkError;
+        DMInterpolationSetDof(group.interpolant, group.dof) >> utilities::PetscUtilities::checkError;
+
+        // Add all local points to the interpolant
+        DMInterpolationAddPoints(group.interpolant, (PetscInt)localProbes.size(), coordinates.data()) >> utilities::PetscUtilities::checkError;
+
+        // Finish the one time set up
+        // The redundantPoints flag should not really matter because PETSC_COMM_SELF was used to init the interpolant
+        DMInterpolationSetUp(group.interpolant, group.subDm, PETSC_FALSE, PETSC_FALSE) >> utilities::PetscUtilities::checkError;
+        interpolationGroups.push_back(group);
+    }
+
+    // Build the recorders for the local probes
+    if (outputFormat == OutputFormat::BINARY) {
+        auto comm = solver->GetSubDomain().GetComm();
+        PetscMPIInt rank, size;
+        MPI_Comm_rank(comm, &rank) >> utilities::MpiUtilities::checkError;
+        MPI_Comm_size(comm, &size) >> utilities::MpiUtilities::checkError;
+
+        std::vector<std::string> probeNames;
+        for (const auto &probe : localProbes) {
+            probeNames.push_back(probe.name);
+        }
+        const auto &directory = initializer->GetDirectory();
+        std::filesystem::path probePath = directory / ("probes." + std::to_string(rank) + ".bin");
+
+        // The existing per rank files can only be appended if every rank owns the same probes as the previous run
+        int compatible = std::filesystem::exists(probePath) ? BinaryProbeRecorder::IsCompatible(probePath, probeNames, componentNames) : localProbes.empty();
+        if (rank == 0) {
+            const auto rankFileRegex = std::regex(R"(probes\.([0-9]+)\.bin)");
+            for (const auto &file : BinaryProbeRecorder::GetBinaryFiles(directory)) {
+                std::smatch m;
+                const auto fileName = file.filename().string();
+                if (std::regex_match(fileName, m, rankFileRegex) && std::stoi(m[1].str()) >= size) {
+                    compatible = false;
+                }
+            }
+        }
+        MPI_Allreduce(MPI_IN_PLACE, &compatible, 1, MPI_INT, MPI_MIN, comm) >> utilities::MpiUtilities::checkError;
+
+        // Otherwise, merge the previous output into a single file keyed by probe name and start a new file on each rank
+        double restartTime = PETSC_MIN_REAL;
+        if (!compatible) {
+            int merged = true;
+            std::string mergeError = "Unable to merge the existing binary probe files in " + directory.string();
+            if (rank == 0) {
+                try {
+                    const auto files = BinaryProbeRecorder::GetBinaryFiles(directory);
+                    if (!files.empty()) {
+                        const auto historyPath = directory / "probes.bin";
+                        const auto mergePath = directory / "probes.bin.merge";
+                        restartTime = BinaryProbeRecorder::Merge(files, mergePath);
+                        std::filesystem::rename(mergePath, historyPath);
+                        for (const auto &file : files) {
+                            if (file != historyPath) {
+                                std::filesystem::remove(file);
+                            }
+                        }
+                    }
+                } catch (std::exception &exception) {
+                    std::error_code errorCode;
+                    std::filesystem::remove(directory / "probes.bin.merge", errorCode);
+                    merged = false;
+                    mergeError += ": " + std::string(exception.what());
+                }
+            }
+            MPI_Bcast(&merged, 1, MPI_INT, 0, comm) >> utilities::MpiUtilities::checkError;
+            if (!merged) {
+                throw std::invalid_argument(mergeError);
+            }
+            MPI_Bcast(&restartTime, 1, MPI_DOUBLE, 0, comm) >> utilities::MpiUtilities::checkError;
+        }
+
+        if (!localProbes.empty()) {
+            binaryRecorder = std::make_unique<BinaryProbeRecorder>(bufferSize, probeNames, componentNames, probePath, restartTime);
+        }
+    } else {
+        // Build a ProbeRecorder for each probe
+        for (const auto &probe : localProbes) {
+            std::filesystem::path probePath = initializer->GetDirectory() / (probe.name + ".csv");
+            recorders.emplace_back(bufferSize, componentNames, probePath);
+        }
     }
 }
 
 ablate::monitors::Probes::~Probes() {
-    for (auto &interpolant : interpolants) {
-        DMInterpolationDestroy(&interpolant) >> utilities::PetscUtilities::checkError;
+    for (auto &group : interpolationGroups) {
+        DMInterpolationDestroy(&group.interpolant) >> utilities::PetscUtilities::checkError;
+        ISDestroy(&group.subIs) >> utilities::PetscUtilities::checkError;
+        DMDestroy(&group.subDm) >> utilities::PetscUtilities::checkError;
+    }
+}
+
+void ablate::monitors::Probes::Finalize() {
+    for (auto &recorder : recorders) {
+        recorder.WriteBuffer();
+    }
+    if (binaryRecorder) {
+        binaryRecorder->WriteBuffer();
+    }
+
+    if (outputFormat == OutputFormat::BINARY && convertToCsv && GetSolver()) {
+        // every rank must write its file before the files are converted
+        auto comm = GetSolver()->GetSubDomain().GetComm();
+        MPI_Barrier(comm) >> utilities::MpiUtilities::checkError;
+
+        PetscMPIInt rank;
+        MPI_Comm_rank(comm, &rank) >> utilities::MpiUtilities::checkError;
+        if (rank == 0) {
+            BinaryProbeRecorder::ConvertToCsv(BinaryProbeRecorder::GetBinaryFiles(initializer->GetDirectory()), initializer->GetDirectory());
+        }
     }
 }
 
@@ -157,40 +280,58 @@ PetscErrorCode ablate::monitors::Probes::UpdateProbes(TS ts, PetscInt step, Pets
         for (auto &recorder : monitor->recorders) {
             recorder.AdvanceTime(time);
         }
+        if (monitor->binaryRecorder) {
+            monitor->binaryRecorder->AdvanceTime(time);
+        }
 
-        // March over each field
-        for (std::size_t it = 0; it < monitor->fields.size(); it++) {
-            // determine the field
-            const auto &field = monitor->fields[it];
-
-            // Get the sub vector
-            IS subIs;
-            DM subDm;
+        // March over each group of fields
+        auto &subDomain = monitor->GetSolver()->GetSubDomain();
+        for (auto &group : monitor->interpolationGroups) {
+            // Get the local vector holding every field in the group
             Vec locVec;
-            PetscCall(monitor->GetSolver()->GetSubDomain().GetFieldLocalVector(field, 0.0, &subIs, &locVec, &subDm));
+            if (group.location == domain::FieldLocation::SOL) {
+                Vec subGlobalVector;
+                PetscCall(VecGetSubVector(subDomain.GetSolutionVector(), group.subIs, &subGlobalVector));
+                PetscCall(DMGetLocalVector(group.subDm, &locVec));
+                PetscCall(DMPlexInsertBoundaryValues(group.subDm, PETSC_TRUE, locVec, time, nullptr, nullptr, nullptr));
+                PetscCall(DMGlobalToLocalBegin(group.subDm, subGlobalVector, INSERT_VALUES, locVec));
+                PetscCall(DMGlobalToLocalEnd(group.subDm, subGlobalVector, INSERT_VALUES, locVec));
+                PetscCall(VecRestoreSubVector(subDomain.GetSolutionVector(), group.subIs, &subGlobalVector));
+            } else {
+                PetscCall(VecGetSubVector(subDomain.GetAuxVector(), group.subIs, &locVec));
+            }
 
             // get a temp vector
             Vec interpValues;
-            PetscCall(DMInterpolationGetVector(monitor->interpolants[it], &interpValues));
+            PetscCall(DMInterpolationGetVector(group.interpolant, &interpValues));
 
             // Interpolate
-            PetscCall(DMInterpolationEvaluate(monitor->interpolants[it], subDm, locVec, interpValues));
+            PetscCall(DMInterpolationEvaluate(group.interpolant, group.subDm, locVec, interpValues));
 
             // Record each value
             const PetscScalar *interValuesArray;
-            VecGetArrayRead(interpValues, &interValuesArray);
-            PetscInt offset = 0;
-            const int &fieldOffset = monitor->fieldOffset[it];
-            for (auto &recorder : monitor->recorders) {
-                for (PetscInt c = 0; c < field.numberComponents; c++) {
-                    recorder.SetValue(fieldOffset + c, interValuesArray[offset++]);
+            PetscCall(VecGetArrayRead(interpValues, &interValuesArray));
+            for (std::size_t p = 0; p < monitor->localProbes.size(); p++) {
+                const PetscScalar *probeValues = interValuesArray + p * group.dof;
+                if (monitor->binaryRecorder) {
+                    for (const auto &[groupIndex, outputIndex] : group.outputIndices) {
+                        monitor->binaryRecorder->SetValue(p, outputIndex, probeValues[groupIndex]);
+                    }
+                } else {
+                    for (const auto &[groupIndex, outputIndex] : group.outputIndices) {
+                        monitor->recorders[p].SetValue(outputIndex, probeValues[groupIndex]);
+                    }
                 }
             }
 
             // restore
-            VecRestoreArrayRead(interpValues, &interValuesArray);
-            PetscCall(DMInterpolationRestoreVector(monitor->interpolants[it], &interpValues));
-            PetscCall(monitor->GetSolver()->GetSubDomain().RestoreFieldLocalVector(field, &subIs, &locVec, &subDm));
+            PetscCall(VecRestoreArrayRead(interpValues, &interValuesArray));
+            PetscCall(DMInterpolationRestoreVector(group.interpolant, &interpValues));
+            if (group.location == domain::FieldLocation::SOL) {
+                PetscCall(DMRestoreLocalVector(group.subDm, &locVec));
+            } else {
+                PetscCall(VecRestoreSubVector(subDomain.GetAuxVector(), group.subIs, &locVec));
+            }
         }
     }
 
@@ -269,7 +410,280 @@ void ablate::monitors::Probes::ProbeRecorder::WriteBuffer() {
     activeIndex = -1;
 }
 
+ablate::monitors::Probes::BinaryProbeRecorder::BinaryProbeRecorder(int bufferSizeIn, const std::vector<std::string> &probeNames, const std::vector<std::string> &variables,
+                                                                   const std::filesystem::path &outputPath, double restartTime)
+    : bufferSize(PetscMax(bufferSizeIn, 1)), numberProbes(probeNames.size()), numberVariables(variables.size()), outputPath(outputPath), lastOutputTime(restartTime) {
+    // size up the buffer
+    buffer.resize(bufferSize * RecordSize());
+
+    // check to see if the file exists
+    if (std::filesystem::exists(outputPath)) {
+        std::ifstream oldFile(outputPath, std::ios::binary);
+        if (ReadHeader(oldFile, outputPath) != std::make_pair(probeNames, variables)) {
+            throw std::invalid_argument("The existing probe file " + outputPath.string() + " does not match the requested probes and variables.");
+        }
+        const auto headerSize = (std::uintmax_t)oldFile.tellg();
+        oldFile.close();
+
+        // remove any partially written record and find the last recorded time
+        const auto recordBytes = RecordSize() * sizeof(double);
+        const auto numberRecords = (std::filesystem::file_size(outputPath) - headerSize) / recordBytes;
+        std::filesystem::resize_file(outputPath, headerSize + numberRecords * recordBytes);
+        if (numberRecords > 0) {
+            oldFile.open(outputPath, std::ios::binary);
+            oldFile.seekg((std::streamoff)(headerSize + (numberRecords - 1) * recordBytes));
+            double lastTime;
+            oldFile.read(reinterpret_cast<char *>(&lastTime), sizeof(double));
+            lastOutputTime = PetscMax(lastOutputTime, lastTime);
+        }
+    } else {
+        // write the header
+        std::ofstream probeFile(outputPath, std::ios::binary);
+        probeFile.write(magic.data(), (std::streamsize)magic.size());
+        WriteNames(probeFile, probeNames);
+        WriteNames(probeFile, variables);
+    }
+}
+
+ablate::monitors::Probes::BinaryProbeRecorder::~BinaryProbeRecorder() { WriteBuffer(); }
+
+void ablate::monitors::Probes::BinaryProbeRecorder::WriteNames(std::ostream &stream, const std::vector<std::string> &names) {
+    auto numberNames = (std::uint64_t)names.size();
+    stream.write(reinterpret_cast<const char *>(&numberNames), sizeof(numberNames));
+    for (const auto &name : names) {
+        auto length = (std::uint64_t)name.size();
+        stream.write(reinterpret_cast<const char *>(&length), sizeof(length));
+        stream.write(name.data(), (std::streamsize)length);
+    }
+}
+
+std::vector<std::string> ablate::monitors::Probes::BinaryProbeRecorder::ReadNames(std::istream &stream) {
+    std::uint64_t numberNames = 0;
+    stream.read(reinterpret_cast<char *>(&numberNames), sizeof(numberNames));
+    std::vector<std::string> names;
+    for (std::uint64_t n = 0; n < numberNames && stream; n++) {
+        std::uint64_t length = 0;
+        stream.read(reinterpret_cast<char *>(&length), sizeof(length));
+        std::string name(length, '\0');
+        stream.read(name.data(), (std::streamsize)length);
+        names.push_back(name);
+    }
+    if (!stream) {
+        throw std::invalid_argument("Unable to read the binary probe file header.");
+    }
+    return names;
+}
+
+std::pair<std::vector<std::string>, std::vector<std::string>> ablate::monitors::Probes::BinaryProbeRecorder::ReadHeader(std::istream &stream, const std::filesystem::path &binaryPath) {
+    std::string fileMagic(magic.size(), '\0');
+    stream.read(fileMagic.data(), (std::streamsize)fileMagic.size());
+    if (fileMagic != magic) {
+        throw std::invalid_argument("The file " + binaryPath.string() + " is not a binary probe file.");
+    }
+    auto probeNames = ReadNames(stream);
+    auto variables = ReadNames(stream);
+    return {probeNames, variables};
+}
+
+bool ablate::monitors::Probes::BinaryProbeRecorder::IsCompatible(const std::filesystem::path &binaryPath, const std::vector<std::string> &probeNames, const std::vector<std::string> &variables) {
+    try {
+        std::ifstream binaryFile(binaryPath, std::ios::binary);
+        return ReadHeader(binaryFile, binaryPath) == std::make_pair(probeNames, variables);
+    } catch (std::invalid_argument &) {
+        return false;
+    }
+}
+
+std::vector<std::filesystem::path> ablate::monitors::Probes::BinaryProbeRecorder::GetBinaryFiles(const std::filesystem::path &directory) {
+    std::vector<std::filesystem::path> binaryFiles;
+    if (std::filesystem::is_directory(directory)) {
+        const auto binaryFileRegex = std::regex(R"(probes(\.[0-9]+)?\.bin)");
+        for (const auto &entry : std::filesystem::directory_iterator(directory)) {
+            if (entry.is_regular_file() && std::regex_match(entry.path().filename().string(), binaryFileRegex)) {
+                binaryFiles.push_back(entry.path());
+            }
+        }
+    }
+    std::sort(binaryFiles.begin(), binaryFiles.end());
+    return binaryFiles;
+}
+
+void ablate::monitors::Probes::BinaryProbeRecorder::ReadMerged(const std::vector<std::filesystem::path> &binaryPaths,
+                                                               const std::function<void(const std::vector<std::string> &, const std::vector<std::string> &)> &header,
+                                                               const std::function<void(const std::vector<double> &)> &record) {
+    // each file holds a subset of the probes, each sorted in time
+    struct Input {
+        std::ifstream stream;
+        std::vector<std::size_t> probeIndices;
+        std::vector<double> record;
+        bool valid = false;
+    };
+    std::vector<Input> inputs(binaryPaths.size());
+    std::vector<std::string> probeNames;
+    std::map<std::string, std::size_t> probeIndices;
+    std::vector<std::string> variables;
+    for (std::size_t i = 0; i < binaryPaths.size(); i++) {
+        auto &input = inputs[i];
+        input.stream.open(binaryPaths[i], std::ios::binary);
+        auto [fileProbeNames, fileVariables] = ReadHeader(input.stream, binaryPaths[i]);
+        if (i == 0) {
+            variables = fileVariables;
+        } else if (fileVariables != variables) {
+            throw std::invalid_argument("The probe file " + binaryPaths[i].string() + " does not record the same variables as " + binaryPaths.front().string());
+        }
+
+        // key each probe by name
+        for (const auto &probeName : fileProbeNames) {
+            auto [probeIndex, inserted] = probeIndices.emplace(probeName, probeNames.size());
+            if (inserted) {
+                probeNames.push_back(probeName);
+            }
+            input.probeIndices.push_back(probeIndex->second);
+        }
+        input.record.resize(1 + fileProbeNames.size() * variables.size());
+        input.valid = (bool)input.stream.read(reinterpret_cast<char *>(input.record.data()), (std::streamsize)(input.record.size() * sizeof(double)));
+    }
+    header(probeNames, variables);
+
+    // march over each time recorded in any file, an incomplete record at the end of a file is ignored
+    std::vector<double> mergedRecord(1 + probeNames.size() * variables.size());
+    while (true) {
+        double time = std::numeric_limits<double>::max();
+        bool anyValid = false;
+        for (const auto &input : inputs) {
+            if (input.valid) {
+                time = std::min(time, input.record[0]);
+                anyValid = true;
+            }
+        }
+        if (!anyValid) {
+            break;
+        }
+
+        std::fill(mergedRecord.begin(), mergedRecord.end(), std::numeric_limits<double>::quiet_NaN());
+        mergedRecord[0] = time;
+        for (auto &input : inputs) {
+            if (input.valid && input.record[0] == time) {
+                for (std::size_t p = 0; p < input.probeIndices.size(); p++) {
+                    std::copy_n(input.record.begin() + 1 + p * variables.size(), variables.size(), mergedRecord.begin() + 1 + input.probeIndices[p] * variables.size());
+                }
+                input.valid = (bool)input.stream.read(reinterpret_cast<char *>(input.record.data()), (std::streamsize)(input.record.size() * sizeof(double)));
+            }
+        }
+        record(mergedRecord);
+    }
+}
+
+double ablate::monitors::Probes::BinaryProbeRecorder::Merge(const std::vector<std::filesystem::path> &binaryPaths, const std::filesystem::path &outputPath) {
+    std::ofstream mergedFile(outputPath, std::ios::binary);
+    double lastTime = PETSC_MIN_REAL;
+    ReadMerged(
+        binaryPaths,
+        [&mergedFile](const auto &probeNames, const auto &variables) {
+            mergedFile.write(magic.data(), (std::streamsize)magic.size());
+            WriteNames(mergedFile, probeNames);
+            WriteNames(mergedFile, variables);
+        },
+        [&mergedFile, &lastTime](const auto &record) {
+            mergedFile.write(reinterpret_cast<const char *>(record.data()), (std::streamsize)(record.size() * sizeof(double)));
+            lastTime = record[0];
+        });
+    if (!mergedFile) {
+        throw std::runtime_error("Unable to write the merged probe file " + outputPath.string());
+    }
+    return lastTime;
+}
+
+void ablate::monitors::Probes::BinaryProbeRecorder::AdvanceTime(double time) {
+    if (time > lastOutputTime) {
+        if (activeIndex + 1 >= bufferSize) {
+            WriteBuffer();
+        }
+
+        activeIndex++;
+        lastOutputTime = time;
+        buffer[activeIndex * RecordSize()] = time;
+    }
+}
+
+void ablate::monitors::Probes::BinaryProbeRecorder::SetValue(std::size_t probe, std::size_t index, double value) {
+    if (activeIndex >= 0) {
+        buffer[activeIndex * RecordSize() + 1 + probe * numberVariables + index] = value;
+    }
+}
+
+void ablate::monitors::Probes::BinaryProbeRecorder::WriteBuffer() {
+    if (activeIndex >= 0) {
+        // every record is written in a single block
+        std::ofstream probeFile(outputPath, std::ios::binary | std::ios::app);
+        probeFile.write(reinterpret_cast<const char *>(buffer.data()), (std::streamsize)((activeIndex + 1) * RecordSize() * sizeof(double)));
+    }
+    activeIndex = -1;
+}
+
+void ablate::monitors::Probes::BinaryProbeRecorder::ConvertToCsv(const std::vector<std::filesystem::path> &binaryPaths, const std::filesystem::path &outputDirectory) {
+    std::vector<std::ofstream> probeFiles;
+    std::size_t numberVariables = 0;
+    ReadMerged(
+        binaryPaths,
+        [&probeFiles, &numberVariables, &outputDirectory](const auto &probeNames, const auto &variables) {
+            // open a csv file for each probe
+            numberVariables = variables.size();
+            probeFiles.resize(probeNames.size());
+            for (std::size_t p = 0; p < probeNames.size(); p++) {
+                probeFiles[p].open(outputDirectory / (probeNames[p] + ".csv"));
+                probeFiles[p] << "time,";
+                for (const auto &variable : variables) {
+                    probeFiles[p] << variable << ",";
+                }
+                probeFiles[p] << std::endl;
+            }
+        },
+        [&probeFiles, &numberVariables](const auto &record) {
+            // only output the probes recorded at this time, probes recorded by another file are NaN
+            for (std::size_t p = 0; p < probeFiles.size(); p++) {
+                const auto values = record.begin() + 1 + p * numberVariables;
+                if (numberVariables > 0 && std::all_of(values, values + numberVariables, [](double value) { return std::isnan(value); })) {
+                    continue;
+                }
+                probeFiles[p] << record[0] << ",";
+                for (std::size_t v = 0; v < numberVariables; v++) {
+                    probeFiles[p] << record[1 + p * numberVariables + v] << ",";
+                }
+                probeFiles[p] << "\n";
+            }
+        });
+}
+
+std::ostream &ablate::monitors::operator<<(std::ostream &os, const ablate::monitors::Probes::OutputFormat &v) {
+    switch (v) {
+        case Probes::OutputFormat::CSV:
+            return os << "csv";
+        case Probes::OutputFormat::BINARY:
+            return os << "binary";
+        default:
+            return os;
+    }
+}
+
+std::istream &ablate::monitors::operator>>(std::istream &is, ablate::monitors::Probes::OutputFormat &v) {
+    std::string enumString;
+    is >> enumString;
+
+    if (enumString.empty() || enumString == "csv") {
+        v = Probes::OutputFormat::CSV;
+    } else if (enumString == "binary") {
+        v = Probes::OutputFormat::BINARY;
+    } else {
+        throw std::invalid_argument("Unknown OutputFormat type " + enumString);
+    }
+    return is;
+}
+
 #include "registrar.hpp"
 REGISTER(ablate::monitors::Monitor, ablate::monitors::Probes, "Records the values of the specified variables at a specific point in space",
          ARG(ablate::monitors::probes::ProbeInitializer, "probes", "where to record log (default is stdout)"), ARG(std::vector<std::string>, "variables", "list of variables to output"),
-         OPT(ablate::io::interval::Interval, "interval", "report interval object, defaults to every"), OPT(int, "bufferSize", "how often the probe file is written (default is 100, must be > 0)"));
+         OPT(ablate::io::interval::Interval, "interval", "report interval object, defaults to every"), OPT(int, "bufferSize", "how often the probe file is written (default is 100, must be > 0)"),
+         ENUM(ablate::monitors::Probes::OutputFormat, "outputFormat",
+              "the probe output format, 'csv' for a file per probe (default) or 'binary' for a single file per rank"),
+         OPT(bool, "convertToCsv", "when using the binary output format, merge and convert the binary files to a csv file per probe at the end of the run (default is false)"));
@@ -1,6 +1,9 @@
 #ifndef ABLATELIBRARY_PROBES_HPP
 #define ABLATELIBRARY_PROBES_HPP
 
+#include <filesystem>
+#include <functional>
+#include <memory>
 #include <utility>
 #include "io/interval/interval.hpp"
 #include "monitor.hpp"
@@ -14,6 +17,13 @@ namespace ablate::monitors {
  */
 class Probes : public Monitor {
    public:
+    /**
+     * The format used to record the probe output
+     * CSV: a separate csv file for each probe
+     * BINARY: a single binary time-series file per rank holding every local probe.  The files can be converted to a csv file per probe at the end of the run.
+     */
+    enum class OutputFormat { CSV, BINARY };
+
     /**
      * Private class for recording the the probe output
      */
@@ -68,6 +78,152 @@ class Probes : public Monitor {
         void WriteBuffer();
     };
 
+    /**
+     * Records every local probe to a single binary file.  The file holds a header (magic, probe names, variable names) followed by fixed size
+     * records of the time and the values for each probe/variable as doubles.
+     */
+    class BinaryProbeRecorder {
+       private:
+        //! identify the binary probe file
+        inline static const std::string magic = "ABLPRB01";
+
+        //! The amount of data to store before writing
+        const int bufferSize;
+
+        //! the size of each record
+        const std::size_t numberProbes;
+        const std::size_t numberVariables;
+
+        //! The output path for the binary file
+        std::filesystem::path outputPath;
+
+        //! The last output, useful for restart
+        PetscReal lastOutputTime = PETSC_MIN_REAL;
+
+        //! The current location in the buffer to record
+        int activeIndex = -1;
+
+        //! store the output buffer [buffer][time, probe 0 variables, probe 1 variables, ...]
+        std::vector<double> buffer;
+
+        //! the number of doubles in each record
+        [[nodiscard]] inline std::size_t RecordSize() const { return 1 + numberProbes * numberVariables; }
+
+        /**
+         * Write/read the names to the header
+         */
+        static void WriteNames(std::ostream& stream, const std::vector<std::string>& names);
+        static std::vector<std::string> ReadNames(std::istream& stream);
+
+        /**
+         * Reads the magic, probe names, and variable names from the start of a binary probe file
+         * @param stream
+         * @param binaryPath used for error messages
+         * @return the probe names and variable names
+         */
+        static std::pair<std::vector<std::string>, std::vector<std::string>> ReadHeader(std::istream& stream, const std::filesystem::path& binaryPath);
+
+        /**
+         * Reads every record from a list of binary probe files keyed by probe name.  Each record holds the time and the values for every probe/variable
+         * in the combined probe list; values not recorded at that time are NaN.  Every file must record the same variables.
+         * @param binaryPaths
+         * @param header called once with the combined probe names and the variable names
+         * @param record called for each time in increasing order
+         */
+        static void ReadMerged(const std::vector<std::filesystem::path>& binaryPaths,
+                               const std::function<void(const std::vector<std::string>&, const std::vector<std::string>&)>& header,
+                               const std::function<void(const std::vector<double>&)>& record);
+
+       public:
+        /**
+         * List of probes and variables to output in the order that they will be set
+         * @param bufferSize
+         * @param probeNames
+         * @param variables
+         * @param outputPath
+         * @param restartTime only times after this are recorded to a new file, used when the previous output was merged on restart
+         */
+        BinaryProbeRecorder(int bufferSize, const std::vector<std::string>& probeNames, const std::vector<std::string>& variables, const std::filesystem::path& outputPath,
+                            double restartTime = PETSC_MIN_REAL);
+
+        /**
+         * Catch close and output the buffer
+         */
+        ~BinaryProbeRecorder();
+
+        /**
+         * Advance and record the next time.  Output the buffer if needed
+         * @param time
+         */
+        void AdvanceTime(double time);
+
+        /**
+         * Record the value for a probe at the current time
+         * @param probe
+         * @param index
+         * @param value
+         */
+        void SetValue(std::size_t probe, std::size_t index, double value);
+
+        /**
+         * Writes and resets the buffer
+         */
+        void WriteBuffer();
+
+        /**
+         * Checks if an existing binary probe file records the same probes and variables so that it can be appended
+         * @param binaryPath
+         * @param probeNames
+         * @param variables
+         * @return
+         */
+        static bool IsCompatible(const std::filesystem::path& binaryPath, const std::vector<std::string>& probeNames, const std::vector<std::string>& variables);
+
+        /**
+         * Lists the binary probe files (probes.bin and probes.[rank].bin) in a directory
+         * @param directory
+         * @return
+         */
+        static std::vector<std::filesystem::path> GetBinaryFiles(const std::filesystem::path& directory);
+
+        /**
+         * Merges binary probe files, written with any number of ranks, into a single binary probe file keyed by probe name
+         * @param binaryPaths
+         * @param outputPath
+         * @return the last recorded time, PETSC_MIN_REAL if nothing was recorded
+         */
+        static double Merge(const std::vector<std::filesystem::path>& binaryPaths, const std::filesystem::path& outputPath);
+
+        /**
+         * Converts binary probe files, written with any number of ranks, into a csv file for each probe using the same format as the ProbeRecorder
+         * @param binaryPaths
+         * @param outputDirectory
+         */
+        static void ConvertToCsv(const std::vector<std::filesystem::path>& binaryPaths, const std::filesystem::path& outputDirectory);
+    };
+
+   private:
+    /**
+     * All requested fields at the same location (solution or aux) are extracted and interpolated together in a single pass
+     */
+    struct InterpolationGroup {
+        //! the location of each field in this group
+        domain::FieldLocation location;
+
+        //! the sub dm and index set holding every requested field at this location
+        DM subDm = nullptr;
+        IS subIs = nullptr;
+
+        //! the petsc interpolant for every local probe
+        DMInterpolationInfo interpolant = nullptr;
+
+        //! the number of components interpolated at each probe
+        PetscInt dof = 0;
+
+        //! map from each interpolated component to the output index
+        std::vector<std::pair<PetscInt, PetscInt>> outputIndices;
+    };
+
     //! Original list of all requested probe locations by name
     const std::shared_ptr<ablate::monitors::probes::ProbeInitializer> initializer;
 
@@ -80,6 +236,12 @@ class Probes : public Monitor {
     //!  output bufferSize
     const int bufferSize;
 
+    //! the format used to record the probes
+    const OutputFormat outputFormat;
+
+    //! convert the binary probe files to a csv file per probe at the end of the run
+    const bool convertToCsv;
+
     //! list of local probes on this rank
     std::vector<probes::Probe> localProbes;
 
@@ -89,12 +251,15 @@ class Probes : public Monitor {
     //! store the offset for the field in the output (needed for multiple components)
     std::vector<int> fieldOffset;
 
-    //! list of petsc intepolants
-    std::vector<DMInterpolationInfo> interpolants;
+    //! the interpolation for each field location
+    std::vector<InterpolationGroup> interpolationGroups;
 
     //! list of probe recorders that goe
     std::vector<ProbeRecorder> recorders;
 
+    //! a single recorder for every local probe when using the binary output format
+    std::unique_ptr<BinaryProbeRecorder> binaryRecorder;
+
     static PetscErrorCode UpdateProbes(TS ts, PetscInt step, PetscReal crtime, Vec u, void* ctx);
 
    public:
@@ -104,9 +269,11 @@ class Probes : public Monitor {
      * @param variables a list of output variables
      * @param bufferSize the buffer size between writes
      * @param interval the sampling interval
+     * @param outputFormat the format used to record the probes
+     * @param convertToCsv convert the binary probe files to a csv file per probe at the end of the run
      */
     Probes(const std::shared_ptr<ablate::monitors::probes::ProbeInitializer>&, std::vector<std::string> variableNames, const std::shared_ptr<io::interval::Interval>& interval = {},
-           const int bufferSize = 0);
+           const int bufferSize = 0, OutputFormat outputFormat = OutputFormat::CSV, bool convertToCsv = false);
 
     ~Probes() override;
 
@@ -116,6 +283,11 @@ class Probes : public Monitor {
      */
     void Register(std::shared_ptr<solver::Solver> solver) override;
 
+    /**
+     * Writes the buffered probe values and, when requested, converts the binary probe files to csv files
+     */
+    void Finalize() override;
+
     /**
      * Returns the petsc function used to update the monitor.
      * @return
@@ -123,6 +295,21 @@ class Probes : public Monitor {
     PetscMonitorFunction GetPetscFunction() override { return UpdateProbes; }
 };
 
+/**
+ * Support function for the OutputFormat Enum
+ * @param os
+ * @param v
+ * @return
+ */
+std::ostream& operator<<(std::ostream& os, const Probes::OutputFormat& v);
+/**
+ * Support function for the OutputFormat Enum
+ * @param os
+ * @param v
+ * @return
+ */
+std::istream& operator>>(std::istream& is, Probes::OutputFormat& v);
+
 }  // namespace ablate::monitors
 
 #endif  // ABLATELIBRARY_PROBES_HPP
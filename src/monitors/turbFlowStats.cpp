@@ -1,4 +1,5 @@
 #include "monitors/turbFlowStats.hpp"
+#include <algorithm>
 #include <iostream>
 #include "domain/range.hpp"
 #include "io/interval/fixedInterval.hpp"
@@ -10,8 +11,9 @@ using fLoc = ablate::domain::FieldLocation;
 using Constant = ablate::utilities::Constants;
 typedef ablate::domain::Range Range;
 
-ablate::monitors::TurbFlowStats::TurbFlowStats(const std::vector<std::string> nameIn, const std::shared_ptr<ablate::eos::EOS> eosIn, std::shared_ptr<io::interval::Interval> intervalIn)
-    : fieldNames(nameIn), eos(eosIn), interval(intervalIn ? intervalIn : std::make_shared<io::interval::FixedInterval>()) {
+ablate::monitors::TurbFlowStats::TurbFlowStats(const std::vector<std::string> nameIn, const std::shared_ptr<ablate::eos::EOS> eosIn, std::shared_ptr<io::interval::Interval> intervalIn,
+                                               std::vector<std::string> covariances)
+    : fieldNames(nameIn), eos(eosIn), interval(intervalIn ? intervalIn : std::make_shared<io::interval::FixedInterval>()), covarianceNames(std::move(covariances)) {
     step = 0;
 }
 
@@ -24,12 +26,14 @@ PetscErrorCode ablate::monitors::TurbFlowStats::MonitorTurbFlowStats(TS ts, Pets
     if (monitor->interval->Check(PetscObjectComm((PetscObject)ts), step, crtime)) {
         // Increment the number of steps taken so far
         monitor->step += 1;
+        const auto numberSamples = (PetscReal)monitor->step;
 
         // Extract all fields to be monitored
-        std::vector<Vec> vec(monitor->fieldNames.size(), nullptr);
-        std::vector<IS> vecIS(monitor->fieldNames.size(), nullptr);
-        std::vector<DM> fieldDM(monitor->fieldNames.size(), nullptr);
-        for (std::size_t f = 0; f < monitor->fieldNames.size(); f++) {
+        const auto numberFields = monitor->fieldNames.size();
+        std::vector<Vec> vec(numberFields, nullptr);
+        std::vector<IS> vecIS(numberFields, nullptr);
+        std::vector<DM> fieldDM(numberFields, nullptr);
+        for (std::size_t f = 0; f < numberFields; f++) {
             const auto& field = monitor->GetSolver()->GetSubDomain().GetField(monitor->fieldNames[f]);
             PetscCall(monitor->GetSolver()->GetSubDomain().GetFieldGlobalVector(field, &vecIS[f], &vec[f], &fieldDM[f]));
         }
@@ -45,6 +49,15 @@ PetscErrorCode ablate::monitors::TurbFlowStats::MonitorTurbFlowStats(TS ts, Pets
         Vec monitorVec = monitor->monitorSubDomain->GetSolutionVector();
         auto& monitorFields = monitor->monitorSubDomain->GetFields();
 
+        // Precompute the offset of each monitored field in the monitor point data
+        const PetscInt densitySumOffset = monitorFields[FieldPlacements::densitySum].offset;
+        const PetscInt densityDtSumOffset = monitorFields[FieldPlacements::densityDtSum].offset;
+        std::vector<PetscInt> statsOffsets(numberFields);
+        for (std::size_t f = 0; f < numberFields; f++) {
+            statsOffsets[f] = monitorFields[FieldPlacements::fieldsStart + f].offset;
+        }
+        const PetscInt covarianceOffset = monitor->covariancePairs.empty() ? 0 : monitorFields[FieldPlacements::fieldsStart + numberFields].offset;
+
         // Get the local cell range
         PetscInt cStart, cEnd;
         DMPlexGetHeightStratum(monitor->monitorSubDomain->GetSubDM(), 0, &cStart, &cEnd);
@@ -63,79 +76,99 @@ PetscErrorCode ablate::monitors::TurbFlowStats::MonitorTurbFlowStats(TS ts, Pets
         PetscScalar* monitorDat;
         PetscCall(VecGetArray(monitorVec, &monitorDat));
 
+        // Extract each field array
+        std::vector<const PetscScalar*> fieldDat(numberFields, nullptr);
+        std::vector<const PetscScalar*> fieldPt(numberFields, nullptr);
+        for (std::size_t f = 0; f < numberFields; f++) {
+            PetscCall(VecGetArrayRead(vec[f], &fieldDat[f]));
+        }
+
         // Get the timestep from the TS
         PetscReal dt;
         PetscCall(TSGetTimeStep(ts, &dt));
 
-        // Create pointers to the field and monitor data exterior to loop
-        const PetscScalar* fieldDat;
         //! Iterator guide
-        // f - field iterator
         // c - cell iterator
+        // f - field iterator
         // p - field component iterator
-        for (std::size_t f = 0; f < monitor->fieldNames.size(); f++) {
-            // Extract the field vector global array
-            PetscCall(VecGetArrayRead(vec[f], &fieldDat));
-
-            //! Compute measures
-            for (PetscInt c = cStart; c < cEnd; c++) {
-                PetscInt monitorCell = c;
-                PetscInt masterCell = subpointIndices[monitorCell];
-                const PetscScalar* fieldPt;
-                const PetscScalar* solPt;
-                PetscScalar* monitorPt;
-
-                // Get field point data
-                PetscCall(DMPlexPointLocalRead(fieldDM[f], masterCell, fieldDat, &fieldPt));
-
-                // Get solution point data
-                PetscCall(DMPlexPointLocalRead(solDM, masterCell, solDat, &solPt));
-
-                // Get read/write access to point in monitor array
-                PetscCall(DMPlexPointGlobalRef(monitorDM, monitorCell, monitorDat, &monitorPt));
-
-                if (monitorPt && solPt) {
-                    // Get the density data from solution point data
-                    PetscReal densLoc;
-                    monitor->densityFunc.function(solPt, &densLoc, monitor->densityFunc.context.get());
-
-                    // Perform actual calculations now
-                    monitorPt[monitorFields[FieldPlacements::densitySum].offset] += densLoc;
-                    monitorPt[monitorFields[FieldPlacements::densityDtSum].offset] += densLoc * dt;
-
-                    // Get fields to be monitored here
-                    const auto& field = monitor->GetSolver()->GetSubDomain().GetField(monitor->fieldNames[f]);
-
-                    // March over each field component
-                    for (int p = 0; p < field.numberComponents; p++) {
-                        // Set the offset. The first two offset places are reserved for "field placements". Each field component takes " SectionLabels::END" number of offset placements.
-                        // the next field starts the offset counter from where the last field stops.
-                        PetscInt offset = SectionLabels::END * p + monitorFields[FieldPlacements::fieldsStart + f].offset;
-
-                        monitorPt[offset + SectionLabels::densityMult] += fieldPt[p] * densLoc;
-                        monitorPt[offset + SectionLabels::densityDtMult] += fieldPt[p] * densLoc * dt;
-                        monitorPt[offset + SectionLabels::densitySqr] += fieldPt[p] * fieldPt[p] * densLoc;
-                        monitorPt[offset + SectionLabels::sum] += fieldPt[p];
-                        monitorPt[offset + SectionLabels::sumSqr] += fieldPt[p] * fieldPt[p];
-                        monitorPt[offset + SectionLabels::favreAvg] =
-                            monitorPt[offset + SectionLabels::densityDtMult] / (monitorPt[monitorFields[FieldPlacements::densityDtSum].offset] + Constant::tiny);
-                        monitorPt[offset + SectionLabels::rms] = PetscSqrtReal(monitorPt[offset + SectionLabels::sumSqr] / (monitor->step + Constant::tiny) -
-                                                                               PetscPowReal(monitorPt[offset + SectionLabels::sum] / (monitor->step + Constant::tiny), 2));
-                        monitorPt[offset + SectionLabels::mRms] =
-                            PetscSqrtReal(monitorPt[offset + SectionLabels::densitySqr] / (monitorPt[monitorFields[FieldPlacements::densitySum].offset] + Constant::tiny) -
-                                          PetscPowReal(monitorPt[offset + SectionLabels::densityMult] / (monitorPt[monitorFields[FieldPlacements::densitySum].offset] + Constant::tiny), 2));
-                    }
+        for (PetscInt c = cStart; c < cEnd; c++) {
+            PetscInt monitorCell = c;
+            PetscInt masterCell = subpointIndices[monitorCell];
+            const PetscScalar* solPt;
+            PetscScalar* monitorPt;
+
+            // Get solution point data
+            PetscCall(DMPlexPointLocalRead(solDM, masterCell, solDat, &solPt));
+
+            // Get read/write access to point in monitor array
+            PetscCall(DMPlexPointGlobalRef(monitorDM, monitorCell, monitorDat, &monitorPt));
+
+            if (!monitorPt || !solPt) {
+                continue;
+            }
+
+            // Get field point data
+            for (std::size_t f = 0; f < numberFields; f++) {
+                PetscCall(DMPlexPointLocalRead(fieldDM[f], masterCell, fieldDat[f], &fieldPt[f]));
+            }
+
+            // Compute the density once for each cell
+            PetscReal densLoc;
+            monitor->densityFunc.function(solPt, &densLoc, monitor->densityFunc.context.get());
+
+            // Update the weights used for the density weighted statistics
+            monitorPt[densitySumOffset] += densLoc;
+            monitorPt[densityDtSumOffset] += densLoc * dt;
+            const PetscReal favreWeight = densLoc / (monitorPt[densitySumOffset] + Constant::tiny);
+            const PetscReal favreDtWeight = densLoc * dt / (monitorPt[densityDtSumOffset] + Constant::tiny);
+
+            // Update the covariance co-moments using the means before this sample is added
+            for (std::size_t k = 0; k < monitor->covariancePairs.size(); k++) {
+                const auto& [a, b] = monitor->covariancePairs[k];
+                const PetscScalar* aStats = monitorPt + statsOffsets[a.field] + SectionLabels::END * a.component;
+                const PetscScalar* bStats = monitorPt + statsOffsets[b.field] + SectionLabels::END * b.component;
+                const PetscScalar aValue = fieldPt[a.field][a.component];
+                const PetscScalar bValue = fieldPt[b.field][b.component];
+                PetscScalar* covariancePt = monitorPt + covarianceOffset + CovarianceLabels::COVARIANCE_END * k;
+
+                covariancePt[CovarianceLabels::coMoment] += (aValue - aStats[SectionLabels::mean]) * (bValue - bStats[SectionLabels::mean]) * (numberSamples - 1.0) / numberSamples;
+                covariancePt[CovarianceLabels::favreCoMoment] +=
+                    densLoc * (1.0 - favreWeight) * (aValue - aStats[SectionLabels::favreMean]) * (bValue - bStats[SectionLabels::favreMean]);
+            }
+
+            // March over each field component
+            for (std::size_t f = 0; f < numberFields; f++) {
+                for (PetscInt p = 0; p < monitor->fieldComponents[f]; p++) {
+                    // Each field component takes SectionLabels::END offset placements
+                    PetscScalar* stats = monitorPt + statsOffsets[f] + SectionLabels::END * p;
+                    const PetscScalar value = fieldPt[f][p];
+
+                    // Welford update for the arithmetic mean and second moment
+                    const PetscScalar delta = value - stats[SectionLabels::mean];
+                    stats[SectionLabels::mean] += delta / numberSamples;
+                    stats[SectionLabels::m2] += delta * (value - stats[SectionLabels::mean]);
+
+                    // Weighted (West) update for the density weighted mean and second moment
+                    const PetscScalar favreDelta = value - stats[SectionLabels::favreMean];
+                    stats[SectionLabels::favreMean] += favreWeight * favreDelta;
+                    stats[SectionLabels::favreM2] += densLoc * favreDelta * (value - stats[SectionLabels::favreMean]);
+
+                    // The density and time weighted average
+                    stats[SectionLabels::favreAvg] += favreDtWeight * (value - stats[SectionLabels::favreAvg]);
                 }
             }
-            PetscCall(VecRestoreArrayRead(vec[f], &fieldDat));
         }
+
         // Cleanup
         // Restore arrays
+        for (std::size_t f = 0; f < numberFields; f++) {
+            PetscCall(VecRestoreArrayRead(vec[f], &fieldDat[f]));
+        }
         PetscCall(ISRestoreIndices(subpointIS, &subpointIndices));
         PetscCall(VecRestoreArrayRead(solVec, &solDat));
         PetscCall(VecRestoreArray(monitorVec, &monitorDat));
         // Restore field vectors
-        for (std::size_t f = 0; f < monitor->fieldNames.size(); f++) {
+        for (std::size_t f = 0; f < numberFields; f++) {
             const auto& field = monitor->GetSolver()->GetSubDomain().GetField(monitor->fieldNames[f]);
             PetscCall(monitor->GetSolver()->GetSubDomain().RestoreFieldGlobalVector(field, &vecIS[f], &vec[f], &fieldDM[f]));
         }
@@ -143,15 +176,85 @@ PetscErrorCode ablate::monitors::TurbFlowStats::MonitorTurbFlowStats(TS ts, Pets
     PetscFunctionReturn(0);
 }
 
+PetscErrorCode ablate::monitors::TurbFlowStats::ComputeOutputs() {
+    PetscFunctionBeginUser;
+    DM monitorDM = monitorSubDomain->GetSubDM();
+    Vec monitorVec = monitorSubDomain->GetSolutionVector();
+    auto& monitorFields = monitorSubDomain->GetFields();
+    const auto numberFields = fieldNames.size();
+    const PetscReal numberSamples = step + Constant::tiny;
+
+    PetscInt cStart, cEnd;
+    PetscCall(DMPlexGetHeightStratum(monitorDM, 0, &cStart, &cEnd));
+
+    PetscScalar* monitorDat;
+    PetscCall(VecGetArray(monitorVec, &monitorDat));
+    for (PetscInt c = cStart; c < cEnd; c++) {
+        PetscScalar* monitorPt;
+        PetscCall(DMPlexPointGlobalRef(monitorDM, c, monitorDat, &monitorPt));
+        if (!monitorPt) {
+            continue;
+        }
+        const PetscReal densitySumValue = monitorPt[monitorFields[FieldPlacements::densitySum].offset] + Constant::tiny;
+
+        for (std::size_t f = 0; f < numberFields; f++) {
+            for (PetscInt p = 0; p < fieldComponents[f]; p++) {
+                PetscScalar* stats = monitorPt + monitorFields[FieldPlacements::fieldsStart + f].offset + SectionLabels::END * p;
+                stats[SectionLabels::rms] = PetscSqrtReal(PetscMax(stats[SectionLabels::m2], 0.0) / numberSamples);
+                stats[SectionLabels::mRms] = PetscSqrtReal(PetscMax(stats[SectionLabels::favreM2], 0.0) / densitySumValue);
+            }
+        }
+
+        if (!covariancePairs.empty()) {
+            PetscScalar* covariancePt = monitorPt + monitorFields[FieldPlacements::fieldsStart + numberFields].offset;
+            for (std::size_t k = 0; k < covariancePairs.size(); k++) {
+                covariancePt[CovarianceLabels::covariance] = covariancePt[CovarianceLabels::coMoment] / numberSamples;
+                covariancePt[CovarianceLabels::favreCovariance] = covariancePt[CovarianceLabels::favreCoMoment] / densitySumValue;
+                covariancePt += CovarianceLabels::COVARIANCE_END;
+            }
+        }
+    }
+    PetscCall(VecRestoreArray(monitorVec, &monitorDat));
+    PetscFunctionReturn(0);
+}
+
+ablate::monitors::TurbFlowStats::ComponentIndex ablate::monitors::TurbFlowStats::FindComponent(const std::shared_ptr<ablate::solver::Solver>& solverIn, const std::string& name) const {
+    // split into the field and component
+    const auto separator = name.find('.');
+    const auto fieldName = name.substr(0, separator);
+
+    auto fieldIt = std::find(fieldNames.begin(), fieldNames.end(), fieldName);
+    if (fieldIt == fieldNames.end()) {
+        throw std::invalid_argument("The TurbFlowStats covariance field " + fieldName + " must be one of the monitored fields.");
+    }
+    const auto& field = solverIn->GetSubDomain().GetField(fieldName);
+
+    ComponentIndex index{.field = (std::size_t)std::distance(fieldNames.begin(), fieldIt), .component = 0};
+    if (separator == std::string::npos) {
+        if (field.numberComponents != 1) {
+            throw std::invalid_argument("The TurbFlowStats covariance " + name + " must specify a component (field.component).");
+        }
+    } else {
+        const auto componentName = name.substr(separator + 1);
+        auto componentIt = std::find(field.components.begin(), field.components.end(), componentName);
+        if (componentIt == field.components.end()) {
+            throw std::invalid_argument("Unable to locate component " + componentName + " in field " + fieldName + ".");
+        }
+        index.component = (PetscInt)std::distance(field.components.begin(), componentIt);
+    }
+    return index;
+}
+
 void ablate::monitors::TurbFlowStats::Register(std::shared_ptr<ablate::solver::Solver> solverIn) {
     // Create the monitor name
     std::string dmID = solverIn->GetSolverId() + "_turbulenceFlowStats";
 
     // Create suffix vector
-    std::vector<std::string> suffix{"rhoMult", "rhoDtMult", "rhoSqr", "sum", "sumSqr", "favreAvg", "rms", "mRms"};
+    std::vector<std::string> suffix{"mean", "m2", "favreAvg", "favreMean", "favreM2", "rms", "mRms"};
 
     // Create vectors of names for all components of all fields
     std::vector<std::vector<std::string>> processedCompNames;
+    fieldComponents.clear();
     for (std::size_t f = 0; f < fieldNames.size(); f++) {
         const auto& field = solverIn->GetSubDomain().GetField(fieldNames[f]);
         std::vector<std::string> innerCompNames(SectionLabels::END * field.numberComponents);
@@ -161,6 +264,26 @@ void ablate::monitors::TurbFlowStats::Register(std::shared_ptr<ablate::solver::S
             }
         }
         processedCompNames.push_back(innerCompNames);
+        fieldComponents.push_back(field.numberComponents);
+    }
+
+    // Determine each of the requested covariances
+    std::vector<std::string> covarianceSuffix{"coMoment", "favreCoMoment", "cov", "favreCov"};
+    std::vector<std::string> covarianceCompNames;
+    covariancePairs.clear();
+    for (const auto& covarianceName : covarianceNames) {
+        const auto separator = covarianceName.find(',');
+        if (separator == std::string::npos) {
+            throw std::invalid_argument("The TurbFlowStats covariance " + covarianceName + " must be specified as a pair (field.component,field.component).");
+        }
+        covariancePairs.emplace_back(FindComponent(solverIn, covarianceName.substr(0, separator)), FindComponent(solverIn, covarianceName.substr(separator + 1)));
+
+        auto prefix = covarianceName;
+        std::replace(prefix.begin(), prefix.end(), ',', '_');
+        std::replace(prefix.begin(), prefix.end(), '.', '_');
+        for (const auto& covarianceSuffixName : covarianceSuffix) {
+            covarianceCompNames.push_back(prefix + "_" + covarianceSuffixName);
+        }
     }
 
     // Create all FieldDescription objects
@@ -173,6 +296,9 @@ void ablate::monitors::TurbFlowStats::Register(std::shared_ptr<ablate::solver::S
     for (std::size_t f = 0; f < fieldNames.size(); f++) {
         fields[FieldPlacements::fieldsStart + f] = std::make_shared<domain::FieldDescription>(fieldNames[f], fieldNames[f], processedCompNames[f], domain::FieldLocation::SOL, domain::FieldType::FVM);
     }
+    if (!covarianceCompNames.empty()) {
+        fields.push_back(std::make_shared<domain::FieldDescription>("covariance", "covariance", covarianceCompNames, domain::FieldLocation::SOL, domain::FieldType::FVM));
+    }
 
     // Register all fields with the monitorDomain
     ablate::monitors::FieldMonitor::Register(dmID, solverIn, fields);
@@ -183,6 +309,9 @@ void ablate::monitors::TurbFlowStats::Register(std::shared_ptr<ablate::solver::S
 
 PetscErrorCode ablate::monitors::TurbFlowStats::Save(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) {
     PetscFunctionBeginUser;
+    // The rms and covariances are only computed when needed
+    PetscCall(ComputeOutputs());
+
     // Perform the principal save
     PetscCall(ablate::monitors::FieldMonitor::Save(viewer, sequenceNumber, time));
 
@@ -203,4 +332,5 @@ PetscErrorCode ablate::monitors::TurbFlowStats::Restore(PetscViewer viewer, Pets
 
 #include <registrar.hpp>
 REGISTER(ablate::monitors::Monitor, ablate::monitors::TurbFlowStats, "Computes turbulent flow statistics", ARG(std::vector<std::string>, "fields", "The name of the field"),
-         ARG(ablate::eos::EOS, "eos", "The equation of state"), OPT(ablate::io::interval::Interval, "interval", "The monitor output interval"));
+         ARG(ablate::eos::EOS, "eos", "The equation of state"), OPT(ablate::io::interval::Interval, "interval", "The monitor output interval"),
+         OPT(std::vector<std::string>, "covariances", "optional list of component pairs (field.component,field.component) to compute the covariance"));
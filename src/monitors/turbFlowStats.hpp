@@ -9,30 +9,77 @@
 
 namespace ablate::monitors {
 
+/**
+ * Computes the running turbulent flow statistics in a single pass over the cells for each sample.  The means, second moments and optional covariances
+ * are updated with numerically stable Welford (arithmetic) and West (density weighted) updates.  The rms and covariance outputs are only computed when saved.
+ */
 class TurbFlowStats : public FieldMonitor {
     using ttf = ablate::eos::ThermodynamicFunction;
 
     enum FieldPlacements { densitySum, densityDtSum, fieldsStart };
-    enum SectionLabels { densityMult, densityDtMult, densitySqr, sum, sumSqr, favreAvg, rms, mRms, END };
+    enum SectionLabels { mean, m2, favreAvg, favreMean, favreM2, rms, mRms, END };
+    enum CovarianceLabels { coMoment, favreCoMoment, covariance, favreCovariance, COVARIANCE_END };
+
+    /**
+     * Identify a single component of a monitored field
+     */
+    struct ComponentIndex {
+        std::size_t field;
+        PetscInt component;
+    };
 
    private:
     const std::vector<std::string> fieldNames;
     const std::shared_ptr<ablate::eos::EOS> eos;
     const std::shared_ptr<io::interval::Interval> interval;
+    //! list of component pairs ("field.component,field.component") for the optional covariances
+    const std::vector<std::string> covarianceNames;
     ttf densityFunc;
     PetscInt step;
 
+    //! the number of components in each monitored field
+    std::vector<PetscInt> fieldComponents;
+
+    //! the pair of components for each covariance
+    std::vector<std::pair<ComponentIndex, ComponentIndex>> covariancePairs;
+
+    /**
+     * Determine the field and component from "field" or "field.component"
+     * @param solverIn
+     * @param name
+     * @return
+     */
+    ComponentIndex FindComponent(const std::shared_ptr<ablate::solver::Solver>& solverIn, const std::string& name) const;
+
+    /**
+     * Compute the rms and covariance from the accumulated moments
+     */
+    PetscErrorCode ComputeOutputs();
+
     static PetscErrorCode MonitorTurbFlowStats(TS ts, PetscInt step, PetscReal crtime, Vec u, void* ctx);
 
    public:
-    explicit TurbFlowStats(const std::vector<std::string> nameIn, const std::shared_ptr<ablate::eos::EOS> eosIn, std::shared_ptr<io::interval::Interval> intervalIn = {});
+    /**
+     * @param nameIn the fields to compute the statistics for
+     * @param eosIn the equation of state used to compute density
+     * @param intervalIn the sampling interval
+     * @param covariances optional list of component pairs ("field.component,field.component") for the covariances
+     */
+    explicit TurbFlowStats(const std::vector<std::string> nameIn, const std::shared_ptr<ablate::eos::EOS> eosIn, std::shared_ptr<io::interval::Interval> intervalIn = {},
+                           std::vector<std::string> covariances = {});
     PetscMonitorFunction GetPetscFunction() override { return MonitorTurbFlowStats; }
     void Register(std::shared_ptr<ablate::solver::Solver> solverIn) override;
 
     PetscErrorCode Save(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) override;
     PetscErrorCode Restore(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) override;
+
+    /**
+     * The accumulated moments only change when a sample is added, so the number of samples is used as the state for incremental checkpoints
+     * @return
+     */
+    [[nodiscard]] PetscObjectState GetSerializableState() override { return step; }
 };
 
 }  // namespace ablate::monitors
 
-#endif  // ABLATELIBRARY_TURBFLOWSTATS_HPP
\ No newline at end of file
+#endif  // ABLATELIBRARY_TURBFLOWSTATS_HPP
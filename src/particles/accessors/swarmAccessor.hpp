@@ -25,9 +25,24 @@ class SwarmAccessor : public Accessor<const PetscReal> {
     //! the array for the solution values
     const PetscScalar* solutionValues{};
 
+    //! the first local particle accessed, the solution vector is assumed to start at this particle
+    const PetscInt particleStart;
+
+    //! the number of particles accessed, if negative all local particles after particleStart are used
+    const PetscInt numberParticles;
+
    public:
-    SwarmAccessor(bool cachePointData, const DM& swarmDm, const std::map<std::string, Field>& fieldsMap, Vec solutionVec)
-        : Accessor(cachePointData), swarmDm(swarmDm), fieldsMap(fieldsMap), solutionVec(solutionVec) {
+    /**
+     * Create the swarm accessor
+     * @param cachePointData
+     * @param swarmDm
+     * @param fieldsMap
+     * @param solutionVec the solution vector, this starts at particleStart
+     * @param particleStart the first local particle to access (default is 0)
+     * @param numberParticles the number of particles to access (default is all local particles)
+     */
+    SwarmAccessor(bool cachePointData, const DM& swarmDm, const std::map<std::string, Field>& fieldsMap, Vec solutionVec, PetscInt particleStart = 0, PetscInt numberParticles = -1)
+        : Accessor(cachePointData), swarmDm(swarmDm), fieldsMap(fieldsMap), solutionVec(solutionVec), particleStart(particleStart), numberParticles(numberParticles) {
         // extract the array from the vector
         VecGetArrayRead(solutionVec, &solutionValues) >> utilities::PetscUtilities::checkError;
     }
@@ -39,9 +54,12 @@ class SwarmAccessor : public Accessor<const PetscReal> {
      * @return
      */
     [[nodiscard]] inline PetscInt GetNumberParticles() const {
+        if (numberParticles >= 0) {
+            return numberParticles;
+        }
         PetscInt size;
         DMSwarmGetLocalSize(swarmDm, &size) >> utilities::PetscUtilities::checkError;
-        return size;
+        return size - particleStart;
     }
 
     /**
@@ -70,7 +88,7 @@ class SwarmAccessor : public Accessor<const PetscReal> {
                 DMSwarmRestoreField(swarmDm, name.c_str(), nullptr, nullptr, (void**)&values) >> utilities::PetscUtilities::checkError;
             });
 
-            return {values, field};
+            return {values + particleStart * field.dataSize, field};
         }
     }
 };
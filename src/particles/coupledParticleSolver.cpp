@@ -1,5 +1,6 @@
 #include "coupledParticleSolver.hpp"
 
+#include <algorithm>
 #include <utility>
 #include "accessors/eulerianSourceAccessor.hpp"
 #include "utilities/vectorUtilities.hpp"
@@ -7,9 +8,10 @@
 ablate::particles::CoupledParticleSolver::CoupledParticleSolver(std::string solverId, std::shared_ptr<domain::Region> region, std::shared_ptr<parameters::Parameters> options,
                                                                 std::vector<FieldDescription> fields, std::vector<std::shared_ptr<processes::Process>> processesIn,
                                                                 std::shared_ptr<initializers::Initializer> initializer, std::vector<std::shared_ptr<mathFunctions::FieldFunction>> fieldInitialization,
-                                                                std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions, const std::vector<std::string>& coupledFields)
+                                                                std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions, const std::vector<std::string>& coupledFields,
+                                                                SortOrder sortOrder, std::shared_ptr<Multirate> multirate)
     : ParticleSolver(std::move(solverId), std::move(region), std::move(options), std::move(fields), std::move(processesIn), std::move(initializer), std::move(fieldInitialization),
-                     std::move(exactSolutions)),
+                     std::move(exactSolutions), sortOrder, std::move(multirate)),
       coupledFieldsNames(coupledFields) {
     // filter through the list of processes for those that are coupled
     coupledProcesses = ablate::utilities::VectorUtilities::Filter<processes::CoupledProcess>(processes);
@@ -18,9 +20,10 @@ ablate::particles::CoupledParticleSolver::CoupledParticleSolver(std::string solv
 ablate::particles::CoupledParticleSolver::CoupledParticleSolver(std::string solverId, std::shared_ptr<domain::Region> region, std::shared_ptr<parameters::Parameters> options,
                                                                 const std::vector<std::shared_ptr<FieldDescription>>& fields, std::vector<std::shared_ptr<processes::Process>> processes,
                                                                 std::shared_ptr<initializers::Initializer> initializer, std::vector<std::shared_ptr<mathFunctions::FieldFunction>> fieldInitialization,
-                                                                std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions, const std::vector<std::string>& coupledFields)
+                                                                std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions, const std::vector<std::string>& coupledFields,
+                                                                SortOrder sortOrder, std::shared_ptr<Multirate> multirate)
     : CoupledParticleSolver(std::move(solverId), std::move(region), std::move(options), ablate::utilities::VectorUtilities::Copy(fields), std::move(processes), std::move(initializer),
-                            std::move(fieldInitialization), std::move(exactSolutions), coupledFields) {}
+                            std::move(fieldInitialization), std::move(exactSolutions), coupledFields, sortOrder, std::move(multirate)) {}
 
 ablate::particles::CoupledParticleSolver::~CoupledParticleSolver() {
     if (localEulerianSourceVec) {
@@ -29,6 +32,7 @@ ablate::particles::CoupledParticleSolver::~CoupledParticleSolver() {
     if (localEulerianVolumeFactor) {
         VecDestroy(&localEulerianVolumeFactor) >> utilities::PetscUtilities::checkError;
     }
+    DestroyProjectionCache();
 }
 
 /**
@@ -41,45 +45,126 @@ PetscErrorCode ablate::particles::CoupledParticleSolver::PreRHSFunction(TS ts, P
     PetscFunctionBeginUser;
     PetscCall(RHSFunction::PreRHSFunction(ts, time, initialStage, locX));
 
-    // march over every coupled field
-    for (std::size_t f = 0; f < coupledFields.size(); ++f) {
-        const auto& coupledField = coupledFields[f];
+    // rebuild the cached source data if the mesh has changed since it was built
+    PetscSection localSection;
+    PetscObjectState localSectionState;
+    PetscCall(DMGetLocalSection(subDomain->GetDM(), &localSection));
+    PetscCall(PetscObjectStateGet((PetscObject)localSection, &localSectionState));
+    if (localSection != cachedLocalSection || localSectionState != cachedLocalSectionState) {
+        try {
+            BuildEulerianSourceCache();
+        } catch (std::exception& exception) {
+            SETERRQ(PetscObjectComm((PetscObject)ts), PETSC_ERR_LIB, "%s", exception.what());
+        }
+    }
+
+    // push the particle source terms to the eulerian source vector
+    if (batchedProjection) {
+        PetscCall(DepositEulerianSource());
+    } else {
+        PetscCall(ProjectEulerianSource());
+    }
+
+    // Scale the source vector by the current dt so that when integrated the total is the same
+    PetscReal flowTimeStep;
+    PetscCall(TSGetTimeStep(ts, &flowTimeStep));
+    PetscCall(VecScale(localEulerianSourceVec, 1.0 / flowTimeStep));
+    PetscFunctionReturn(PETSC_SUCCESS);
+}
 
-        // Create the subDM for only this field
-        DM coupledFieldDM;
-        IS coupledFieldIS;
-        PetscInt fieldId[1] = {coupledField.id};
-        PetscCall(DMCreateSubDM(subDomain->GetDM(), 1, fieldId, &coupledFieldIS, &coupledFieldDM));
+PetscErrorCode ablate::particles::CoupledParticleSolver::DepositEulerianSource() {
+    PetscFunctionBeginUser;
+    PetscCall(VecZeroEntries(localEulerianSourceVec));
+
+    // Get the cell id for each particle, this is updated during migration
+    DMSwarmCellDM cellDm;
+    const char* cellIdName;
+    PetscCall(DMSwarmGetCellDMActive(swarmDm, &cellDm));
+    PetscCall(DMSwarmCellDMGetCellID(cellDm, &cellIdName));
+    PetscInt* cellIds;
+    PetscCall(DMSwarmGetField(swarmDm, cellIdName, nullptr, nullptr, (void**)&cellIds));
+
+    // Get the raw access to each of the particle source fields
+    const auto numberCoupledFields = (PetscInt)coupledFields.size();
+    std::vector<const PetscReal*> sourceArrays(numberCoupledFields);
+    for (PetscInt f = 0; f < numberCoupledFields; ++f) {
+        PetscCall(DMSwarmGetField(swarmDm, coupledParticleFieldsNames[f].c_str(), nullptr, nullptr, (void**)&sourceArrays[f]));
+    }
+
+    PetscScalar* localEulerianSourceArray;
+    PetscCall(VecGetArray(localEulerianSourceVec, &localEulerianSourceArray));
+
+    // Because the Eulerian fields are cell averaged, M_f u_f = M_p u_p reduces to summing the particle values in each cell
+    PetscInt np;
+    PetscCall(DMSwarmGetLocalSize(swarmDm, &np));
+    const auto numberCachedCells = (PetscInt)(coupledFieldCellOffsets.size() / PetscMax(numberCoupledFields, 1));
+    for (PetscInt p = 0; p < np; ++p) {
+        const PetscInt cellIndex = cellIds[p] - coupledFieldCellStart;
+        if (cellIndex < 0 || cellIndex >= numberCachedCells) {
+            continue;
+        }
+        const PetscInt* cellOffsets = coupledFieldCellOffsets.data() + cellIndex * numberCoupledFields;
+
+        for (PetscInt f = 0; f < numberCoupledFields; ++f) {
+            if (cellOffsets[f] < 0) {
+                continue;
+            }
+            const PetscInt numberComponents = coupledFields[f].numberComponents;
+            const PetscReal* particleSource = sourceArrays[f] + p * numberComponents;
+            PetscScalar* cellSource = localEulerianSourceArray + cellOffsets[f];
+            for (PetscInt c = 0; c < numberComponents; ++c) {
+                cellSource[c] += particleSource[c];
+            }
+        }
+    }
 
+    // cleanup
+    PetscCall(VecRestoreArray(localEulerianSourceVec, &localEulerianSourceArray));
+    for (PetscInt f = 0; f < numberCoupledFields; ++f) {
+        PetscCall(DMSwarmRestoreField(swarmDm, coupledParticleFieldsNames[f].c_str(), nullptr, nullptr, (void**)&sourceArrays[f]));
+    }
+    PetscCall(DMSwarmRestoreField(swarmDm, cellIdName, nullptr, nullptr, (void**)&cellIds));
+    PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+PetscErrorCode ablate::particles::CoupledParticleSolver::ProjectEulerianSource() {
+    PetscFunctionBeginUser;
+    // march over every coupled field
+    for (std::size_t f = 0; f < coupledFields.size(); ++f) {
         // Create a global vector for this subDM to interpolate/push into from the particles
         Vec eulerianFieldSourceVec;
-        PetscCall(DMGetGlobalVector(coupledFieldDM, &eulerianFieldSourceVec));
+        PetscCall(DMGetGlobalVector(coupledFieldDMs[f], &eulerianFieldSourceVec));
 
         // project from the particle to the subDM vec
         // project the source terms to the global array
         const char* fieldnames[1] = {coupledParticleFieldsNames[f].c_str()};
         Vec fields[1] = {eulerianFieldSourceVec};
-        PetscCall(DMSwarmProjectFields(swarmDm, coupledFieldDM, 1, fieldnames, fields, SCATTER_FORWARD));
+        PetscCall(DMSwarmProjectFields(swarmDm, coupledFieldDMs[f], 1, fieldnames, fields, SCATTER_FORWARD));
 
         // Bring back to the global source vector
-        PetscCall(VecISCopy(localEulerianSourceVec, coupledFieldIS, SCATTER_FORWARD, eulerianFieldSourceVec));
+        PetscCall(VecISCopy(localEulerianSourceVec, coupledFieldISs[f], SCATTER_FORWARD, eulerianFieldSourceVec));
 
-        PetscCall(DMRestoreGlobalVector(coupledFieldDM, &eulerianFieldSourceVec));
-        PetscCall(DMDestroy(&coupledFieldDM));
-        PetscCall(ISDestroy(&coupledFieldIS));
+        PetscCall(DMRestoreGlobalVector(coupledFieldDMs[f], &eulerianFieldSourceVec));
     }
 
-    // Scale the source vector by the current dt so that when integrated the total is the same
-    PetscReal flowTimeStep;
-    PetscCall(TSGetTimeStep(ts, &flowTimeStep));
-    PetscCall(VecScale(localEulerianSourceVec, 1.0 / flowTimeStep));
-
     // Scale each source term by the volume of the cell because the project is
     //   M_f u_f = M_p u_p and the M_f includes the volume of the cell
     PetscCall(VecPointwiseMult(localEulerianSourceVec, localEulerianSourceVec, localEulerianVolumeFactor));
     PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+void ablate::particles::CoupledParticleSolver::DestroyProjectionCache() {
+    for (auto& coupledFieldDM : coupledFieldDMs) {
+        DMDestroy(&coupledFieldDM) >> utilities::PetscUtilities::checkError;
+    }
+    for (auto& coupledFieldIS : coupledFieldISs) {
+        ISDestroy(&coupledFieldIS) >> utilities::PetscUtilities::checkError;
+    }
+    coupledFieldDMs.clear();
+    coupledFieldISs.clear();
+    coupledFieldCellOffsets.clear();
+}
+
 /**
  * Called to compute the RHS source term for the flow/macro TS
  * @param time
@@ -137,6 +222,20 @@ void ablate::particles::CoupledParticleSolver::Initialize() {
     // Call the main particle initialize
     ParticleSolver::Initialize();
 
+    // Cache the data needed to push the particle sources to the flow field
+    BuildEulerianSourceCache();
+}
+
+void ablate::particles::CoupledParticleSolver::BuildEulerianSourceCache() {
+    // cleanup any data built for a previous mesh
+    if (localEulerianSourceVec) {
+        VecDestroy(&localEulerianSourceVec) >> utilities::PetscUtilities::checkError;
+    }
+    if (localEulerianVolumeFactor) {
+        VecDestroy(&localEulerianVolumeFactor) >> utilities::PetscUtilities::checkError;
+    }
+    DestroyProjectionCache();
+
     // Get the global vector of the domain we will copy to
     DMCreateLocalVector(subDomain->GetDM(), &localEulerianSourceVec) >> utilities::PetscUtilities::checkError;
     VecZeroEntries(localEulerianSourceVec) >> utilities::PetscUtilities::checkError;
@@ -179,6 +278,42 @@ void ablate::particles::CoupledParticleSolver::Initialize() {
     // Cleanup
     VecRestoreArray(localEulerianVolumeFactor, &localEulerianVolumeFactorArray);
     RestoreRange(cellRange);
+
+    // Cache the data needed to push the particle sources to the flow field, this is rebuilt if the local section changes
+    batchedProjection = std::all_of(coupledFields.begin(), coupledFields.end(), [](const auto& field) { return field.type == domain::FieldType::FVM; });
+    if (batchedProjection) {
+        // store the local offset of every coupled field in every cell so the particles can deposit directly into the source vector
+        PetscSection section;
+        DMGetLocalSection(subDomain->GetDM(), &section) >> utilities::PetscUtilities::checkError;
+        PetscInt cEnd;
+        DMPlexGetHeightStratum(subDomain->GetDM(), 0, &coupledFieldCellStart, &cEnd) >> utilities::PetscUtilities::checkError;
+
+        coupledFieldCellOffsets.resize((cEnd - coupledFieldCellStart) * coupledFields.size(), -1);
+        for (PetscInt c = coupledFieldCellStart; c < cEnd; ++c) {
+            for (std::size_t f = 0; f < coupledFields.size(); ++f) {
+                PetscInt dof;
+                PetscSectionGetFieldDof(section, c, coupledFields[f].id, &dof) >> utilities::PetscUtilities::checkError;
+                if (dof == coupledFields[f].numberComponents) {
+                    PetscSectionGetFieldOffset(section, c, coupledFields[f].id, &coupledFieldCellOffsets[(c - coupledFieldCellStart) * coupledFields.size() + f]) >>
+                        utilities::PetscUtilities::checkError;
+                }
+            }
+        }
+    } else {
+        // Create the subDM for each coupled field once
+        for (const auto& coupledField : coupledFields) {
+            DM coupledFieldDM;
+            IS coupledFieldIS;
+            PetscInt fieldId[1] = {coupledField.id};
+            DMCreateSubDM(subDomain->GetDM(), 1, fieldId, &coupledFieldIS, &coupledFieldDM) >> utilities::PetscUtilities::checkError;
+            coupledFieldDMs.push_back(coupledFieldDM);
+            coupledFieldISs.push_back(coupledFieldIS);
+        }
+    }
+
+    // record the section used to build the cache
+    DMGetLocalSection(subDomain->GetDM(), &cachedLocalSection) >> utilities::PetscUtilities::checkError;
+    PetscObjectStateGet((PetscObject)cachedLocalSection, &cachedLocalSectionState) >> utilities::PetscUtilities::checkError;
 }
 
 void ablate::particles::CoupledParticleSolver::MacroStepParticles(TS macroTS, bool swarmMigrate) {
@@ -254,4 +389,6 @@ REGISTER(ablate::solver::Solver, ablate::particles::CoupledParticleSolver, "Coup
          ARG(ablate::particles::initializers::Initializer, "initializer", "the initial particle setup methods"),
          OPT(std::vector<ablate::mathFunctions::FieldFunction>, "fieldInitialization", "the initial particle fields values"),
          OPT(std::vector<ablate::mathFunctions::FieldFunction>, "exactSolutions", "particle fields (SOL) exact solutions"),
-         OPT(std::vector<std::string>, "coupledFields", "list of fields to couple with Eulerian TS.  If empty or not specified all fields are coupled."));
\ No newline at end of file
+         OPT(std::vector<std::string>, "coupledFields", "list of fields to couple with Eulerian TS.  If empty or not specified all fields are coupled."),
+         ENUM(ablate::particles::ParticleSolver::SortOrder, "sortOrder", "optional order used to store the particles after each migration ('none', 'cell', 'curve').  Default is none"),
+         OPT(ablate::particles::Multirate, "multirate", "optional multirate binning used to sub-cycle the particles based upon relaxation time"));
\ No newline at end of file
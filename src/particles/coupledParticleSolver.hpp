@@ -26,11 +26,14 @@ class CoupledParticleSolver : public ParticleSolver, public ablate::solver::RHSF
      * @param fieldInitialization
      * @param exactSolutions
      * @param coupledFields the fields to couple to the flow solver.  If not specified all solution fields will be coupled
+     * @param sortOrder the order used to store the particles after each migration
+     * @param multirate optional multirate binning used to sub-cycle the particles based upon relaxation time
      */
     CoupledParticleSolver(std::string solverId, std::shared_ptr<domain::Region>, std::shared_ptr<parameters::Parameters> options, std::vector<FieldDescription> fields,
                           std::vector<std::shared_ptr<processes::Process>> processes, std::shared_ptr<initializers::Initializer> initializer,
                           std::vector<std::shared_ptr<mathFunctions::FieldFunction>> fieldInitialization, std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions = {},
-                          const std::vector<std::string>& coupledFields = {});
+                          const std::vector<std::string>& coupledFields = {}, SortOrder sortOrder = SortOrder::NONE,
+                          std::shared_ptr<Multirate> multirate = {});
 
     /**
      * shared pointer version of the constructor
@@ -42,11 +45,14 @@ class CoupledParticleSolver : public ParticleSolver, public ablate::solver::RHSF
      * @param fieldInitialization
      * @param exactSolutions
      * @param coupledFields the fields to couple to the flow solver.  If not specified all solution fields will be coupled
+     * @param sortOrder the order used to store the particles after each migration
+     * @param multirate optional multirate binning used to sub-cycle the particles based upon relaxation time
      */
     CoupledParticleSolver(std::string solverId, std::shared_ptr<domain::Region>, std::shared_ptr<parameters::Parameters> options, const std::vector<std::shared_ptr<FieldDescription>>& fields,
                           std::vector<std::shared_ptr<processes::Process>> processes, std::shared_ptr<initializers::Initializer> initializer,
                           std::vector<std::shared_ptr<mathFunctions::FieldFunction>> fieldInitialization, std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions = {},
-                          const std::vector<std::string>& = {});
+                          const std::vector<std::string>& = {}, SortOrder sortOrder = SortOrder::NONE,
+                          std::shared_ptr<Multirate> multirate = {});
 
     //! cleanup any petsc objects
     ~CoupledParticleSolver() override;
@@ -99,8 +105,47 @@ class CoupledParticleSolver : public ParticleSolver, public ablate::solver::RHSF
     //! store a local vector the same size as the localEulerianSourceVec so we can include volume/mass scaling
     Vec localEulerianVolumeFactor{};
 
+    //! when all coupled fields are FVM the particle sources are deposited directly into the owning cell in a single pass over the particles
+    bool batchedProjection = false;
+
+    //! the first cell in the cached cell offsets
+    PetscInt coupledFieldCellStart = 0;
+
+    //! cached offsets into the localEulerianSourceVec for each cell (row) and coupled field (column), -1 if the field is not defined on that cell
+    std::vector<PetscInt> coupledFieldCellOffsets;
+
+    //! cached sub DMs and index sets used to project each coupled field when the batched projection cannot be used
+    std::vector<DM> coupledFieldDMs;
+    std::vector<IS> coupledFieldISs;
+
+    //! the subDomain local section used to build the cached source data, the cache is rebuilt when the section changes
+    PetscSection cachedLocalSection = nullptr;
+
+    //! the state of the cachedLocalSection when the cache was built
+    PetscObjectState cachedLocalSectionState = -1;
+
     //! private function to compute/update the source terms used by the flowfield
     void ComputeEulerianSource(PetscReal startTime, PetscReal endTime);
+
+    /**
+     * Deposit all coupled particle source fields into the localEulerianSourceVec using a single pass over the particles and the cached cell ids
+     * @return
+     */
+    PetscErrorCode DepositEulerianSource();
+
+    /**
+     * Project each coupled particle source field into the localEulerianSourceVec using the cached sub dms
+     * @return
+     */
+    PetscErrorCode ProjectEulerianSource();
+
+    /**
+     * Create the localEulerianSourceVec, volume factors, and projection data for the current subDomain dm
+     */
+    void BuildEulerianSourceCache();
+
+    //! cleanup the cached projection data
+    void DestroyProjectionCache();
 };
 
 }  // namespace ablate::particles
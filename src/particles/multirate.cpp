@@ -0,0 +1,41 @@
+#include "multirate.hpp"
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+ablate::particles::Multirate::Multirate(std::shared_ptr<eos::transport::TransportModel> transportModelIn, const std::shared_ptr<ablate::parameters::Parameters>& options)
+    : transportModel(std::move(transportModelIn)),
+      maxLevel(options ? options->Get<PetscInt>("maxLevel", DefaultMaxLevel) : DefaultMaxLevel),
+      relaxationTimeFactor(options ? options->Get<PetscReal>("relaxationTimeFactor", DefaultRelaxationTimeFactor) : DefaultRelaxationTimeFactor) {
+    if (!transportModel) {
+        throw std::invalid_argument("The Multirate requires a transportModel to compute the fluid viscosity");
+    }
+    if (maxLevel < 0 || maxLevel > 30) {
+        throw std::invalid_argument("The Multirate maxLevel must be between 0 and 30");
+    }
+    if (relaxationTimeFactor <= 0.0) {
+        throw std::invalid_argument("The Multirate relaxationTimeFactor must be positive");
+    }
+}
+
+PetscInt ablate::particles::Multirate::ComputeLevel(PetscReal flowTimeStep, PetscReal density, PetscReal diameter, PetscReal fluidViscosity) const {
+    const PetscReal maxSubStep = relaxationTimeFactor * ComputeRelaxationTime(density, diameter, fluidViscosity);
+    if (maxSubStep <= 0.0 || !std::isfinite(maxSubStep)) {
+        return maxLevel;
+    }
+
+    // find the smallest level where flowTimeStep/2^level <= maxSubStep
+    const PetscReal requiredSubSteps = flowTimeStep / maxSubStep;
+    if (requiredSubSteps <= 1.0) {
+        return 0;
+    }
+    auto level = (PetscInt)PetscCeilReal(PetscLog2Real(requiredSubSteps));
+    return PetscMin(level, maxLevel);
+}
+
+#include "registrar.hpp"
+REGISTER_DEFAULT(ablate::particles::Multirate, ablate::particles::Multirate, "Bins particles by relaxation time so that each bin takes sub-steps no larger than the flow step/2^level",
+                 ARG(ablate::eos::transport::TransportModel, "transport", "the fluid transport model used to compute the viscosity at each particle"),
+                 OPT(ablate::parameters::Parameters, "options",
+                     "maxLevel: the maximum level allowed, particles in this level take 2^maxLevel sub-steps (default is 6, 0 disables sub-cycling); relaxationTimeFactor: the particle sub-step is "
+                     "limited to relaxationTimeFactor*tauP (default is 1.0)"));
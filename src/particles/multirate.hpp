@@ -0,0 +1,83 @@
+#ifndef ABLATELIBRARY_PARTICLEMULTIRATE_HPP
+#define ABLATELIBRARY_PARTICLEMULTIRATE_HPP
+
+#include <petsc.h>
+#include <memory>
+#include "eos/transport/transportModel.hpp"
+#include "parameters/parameters.hpp"
+
+namespace ablate::particles {
+
+/**
+ * Bins particles into levels based upon their Stokes relaxation time so that each level can be advanced with its own number of sub-steps per flow step.
+ * Particles in level l take sub-steps no larger than flowTimeStep/2^l against the frozen Eulerian field.
+ */
+class Multirate {
+   public:
+    //! the default maximum level when not specified in the options
+    inline static const PetscInt DefaultMaxLevel = 6;
+
+    //! the default relaxationTimeFactor when not specified in the options
+    inline static constexpr PetscReal DefaultRelaxationTimeFactor = 1.0;
+
+   private:
+    //! the fluid transport model used to compute the viscosity at each particle
+    const std::shared_ptr<eos::transport::TransportModel> transportModel;
+
+    //! the maximum level allowed, particles in this level take sub-steps no larger than flowTimeStep/2^maxLevel
+    const PetscInt maxLevel;
+
+    //! the particle sub-step is limited to relaxationTimeFactor*tauP
+    const PetscReal relaxationTimeFactor;
+
+   public:
+    /**
+     * Create the multirate binning
+     * @param transportModel the fluid transport model used to compute the viscosity at each particle
+     * @param options optional maxLevel (default is 6) and relaxationTimeFactor (default is 1.0), a maxLevel of 0 disables sub-cycling
+     */
+    explicit Multirate(std::shared_ptr<eos::transport::TransportModel> transportModel, const std::shared_ptr<ablate::parameters::Parameters>& options = {});
+
+    /**
+     * The fluid transport model used to compute the viscosity at each particle
+     * @return
+     */
+    [[nodiscard]] inline const std::shared_ptr<eos::transport::TransportModel>& GetTransportModel() const { return transportModel; }
+
+    /**
+     * Compute the Stokes relaxation time of a particle
+     * @param density particle density
+     * @param diameter particle diameter
+     * @param fluidViscosity the fluid viscosity at the particle
+     * @return
+     */
+    [[nodiscard]] static inline PetscReal ComputeRelaxationTime(PetscReal density, PetscReal diameter, PetscReal fluidViscosity) {
+        return density * PetscSqr(diameter) / (18.0 * fluidViscosity);
+    }
+
+    /**
+     * Compute the level for a particle so that the sub-step is no larger than relaxationTimeFactor*tauP
+     * @param flowTimeStep the flow time step the particles must be advanced over
+     * @param density particle density
+     * @param diameter particle diameter
+     * @param fluidViscosity the fluid viscosity at the particle
+     * @return the level of the particle
+     */
+    [[nodiscard]] PetscInt ComputeLevel(PetscReal flowTimeStep, PetscReal density, PetscReal diameter, PetscReal fluidViscosity) const;
+
+    /**
+     * The number of levels (maxLevel + 1)
+     * @return
+     */
+    [[nodiscard]] inline PetscInt GetNumberLevels() const { return maxLevel + 1; }
+
+    /**
+     * The minimum number of sub-steps taken per flow step for particles in this level
+     * @param level
+     * @return
+     */
+    [[nodiscard]] static inline PetscInt GetNumberSubSteps(PetscInt level) { return ((PetscInt)1) << level; }
+};
+
+}  // namespace ablate::particles
+#endif  // ABLATELIBRARY_PARTICLEMULTIRATE_HPP
@@ -1,5 +1,7 @@
 #include "particleSolver.hpp"
 #include <petscviewerhdf5.h>
+#include <algorithm>
+#include <limits>
 #include <numeric>
 #include <utility>
 #include "particles/accessors/eulerianAccessor.hpp"
@@ -11,21 +13,25 @@
 ablate::particles::ParticleSolver::ParticleSolver(std::string solverId, std::shared_ptr<domain::Region> region, std::shared_ptr<parameters::Parameters> options, std::vector<FieldDescription> fields,
                                                   std::vector<std::shared_ptr<processes::Process>> processes, std::shared_ptr<initializers::Initializer> initializer,
                                                   std::vector<std::shared_ptr<mathFunctions::FieldFunction>> fieldInitialization,
-                                                  std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions)
+                                                  std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions, SortOrder sortOrder,
+                                                  std::shared_ptr<Multirate> multirate)
     : Solver(std::move(solverId), std::move(region), std::move(options)),
       fieldsDescriptions(std::move(std::move(fields))),
       processes(std::move(processes)),
       initializer(std::move(initializer)),
       fieldInitialization(std::move(fieldInitialization)),
-      exactSolutions(std::move(exactSolutions))
+      exactSolutions(std::move(exactSolutions)),
+      sortOrder(sortOrder),
+      multirate(std::move(multirate))
 
 {}
 ablate::particles::ParticleSolver::ParticleSolver(std::string solverId, std::shared_ptr<domain::Region> region, std::shared_ptr<parameters::Parameters> options,
                                                   const std::vector<std::shared_ptr<FieldDescription>> &fields, std::vector<std::shared_ptr<processes::Process>> processes,
                                                   std::shared_ptr<initializers::Initializer> initializer, std::vector<std::shared_ptr<mathFunctions::FieldFunction>> fieldInitialization,
-                                                  std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions)
+                                                  std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions, SortOrder sortOrder,
+                                                  std::shared_ptr<Multirate> multirate)
     : ParticleSolver(std::move(solverId), std::move(region), std::move(options), ablate::utilities::VectorUtilities::Copy(fields), std::move(processes), std::move(initializer),
-                     std::move(fieldInitialization), std::move(exactSolutions)) {}
+                     std::move(fieldInitialization), std::move(exactSolutions), sortOrder, std::move(multirate)) {}
 
 ablate::particles::ParticleSolver::~ParticleSolver() {
     if (swarmDm) {
@@ -129,6 +135,11 @@ void ablate::particles::ParticleSolver::Initialize() {
     // initialize the particles
     initializer->Initialize(*subDomain, swarmDm);
 
+    // store the initial particles in the requested order
+    if (sortOrder != SortOrder::NONE) {
+        SortParticles();
+    }
+
     // Setup particle integrator
     TSCreate(subDomain->GetComm(), &particleTs) >> utilities::PetscUtilities::checkError;
     PetscObjectSetOptions((PetscObject)particleTs, petscOptions) >> utilities::PetscUtilities::checkError;
@@ -385,6 +396,159 @@ void ablate::particles::ParticleSolver::SwarmMigrate() {
     PetscMPIInt dmChangedAll = PETSC_FALSE;
     MPI_Allreduce(&dmChangedLocal, &dmChangedAll, 1, MPI_INT, MPI_MAX, comm) >> ablate::utilities::MpiUtilities::checkError;
     dmChanged = dmChangedAll > 0;
+
+    // Reorder the particles now that they are in their final location
+    if (sortOrder != SortOrder::NONE) {
+        SortParticles();
+    }
+}
+
+/**
+ * Interleave the lower 21 bits of each coordinate index to produce a Morton (z-order) key
+ */
+static uint64_t ComputeMortonKey(const PetscInt dim, const uint64_t index[3]) {
+    uint64_t key = 0;
+    for (uint64_t bit = 0; bit < 21; ++bit) {
+        for (PetscInt d = 0; d < dim; ++d) {
+            key |= ((index[d] >> bit) & 1u) << (bit * dim + d);
+        }
+    }
+    return key;
+}
+
+void ablate::particles::ParticleSolver::SortParticles() {
+    DM cellDm = subDomain->GetDM();
+    PetscInt cEnd;
+    DMPlexGetHeightStratum(cellDm, 0, &sortedCellStart, &cEnd) >> utilities::PetscUtilities::checkError;
+    const PetscInt numberCells = cEnd - sortedCellStart;
+
+    // compute the cell keys along the space-filling curve, they are rebuilt if the cell dm or its coordinates change (remesh or redistribution)
+    PetscObjectState coordinateState = -1;
+    if (sortOrder == SortOrder::CURVE) {
+        Vec cellCoordinates;
+        DMGetCoordinatesLocal(cellDm, &cellCoordinates) >> utilities::PetscUtilities::checkError;
+        PetscObjectStateGet((PetscObject)cellCoordinates, &coordinateState) >> utilities::PetscUtilities::checkError;
+    }
+    if (sortOrder == SortOrder::CURVE && (cellDm != cellSortKeysDm || coordinateState != cellSortKeysCoordinateState || (PetscInt)cellSortKeys.size() != numberCells)) {
+        PetscReal lower[3] = {0.0, 0.0, 0.0}, upper[3] = {1.0, 1.0, 1.0};
+        DMGetBoundingBox(cellDm, lower, upper) >> utilities::PetscUtilities::checkError;
+
+        const PetscReal maxIndex = (PetscReal)((1u << 21u) - 1u);
+        cellSortKeys.resize(numberCells);
+        for (PetscInt c = sortedCellStart; c < cEnd; ++c) {
+            PetscReal centroid[3];
+            DMPlexComputeCellGeometryFVM(cellDm, c, nullptr, centroid, nullptr) >> utilities::PetscUtilities::checkError;
+
+            uint64_t index[3] = {0, 0, 0};
+            for (PetscInt d = 0; d < ndims; ++d) {
+                const PetscReal length = PetscMax(upper[d] - lower[d], PETSC_SMALL);
+                index[d] = (uint64_t)(PetscClipInterval((centroid[d] - lower[d]) / length, 0.0, 1.0) * maxIndex);
+            }
+            cellSortKeys[c - sortedCellStart] = ComputeMortonKey(ndims, index);
+        }
+        cellSortKeysDm = cellDm;
+        cellSortKeysCoordinateState = coordinateState;
+    }
+
+    // Get the cell id for each particle
+    DMSwarmCellDM swarmCellDm;
+    const char* cellIdName;
+    DMSwarmGetCellDMActive(swarmDm, &swarmCellDm) >> utilities::PetscUtilities::checkError;
+    DMSwarmCellDMGetCellID(swarmCellDm, &cellIdName) >> utilities::PetscUtilities::checkError;
+
+    PetscInt np;
+    DMSwarmGetLocalSize(swarmDm, &np) >> utilities::PetscUtilities::checkError;
+
+    // compute the new order of the particles, any particle not in a local cell is placed at the end
+    std::vector<PetscInt> permutation(np);
+    std::iota(permutation.begin(), permutation.end(), 0);
+    {
+        PetscInt* cellIds;
+        DMSwarmGetField(swarmDm, cellIdName, nullptr, nullptr, (void**)&cellIds) >> utilities::PetscUtilities::checkError;
+        auto cellKey = [&](PetscInt p) {
+            const PetscInt cellIndex = cellIds[p] - sortedCellStart;
+            if (cellIndex < 0 || cellIndex >= numberCells) {
+                return std::make_pair(std::numeric_limits<uint64_t>::max(), cellIds[p]);
+            }
+            return std::make_pair(sortOrder == SortOrder::CURVE ? cellSortKeys[cellIndex] : (uint64_t)cellIndex, cellIds[p]);
+        };
+        std::stable_sort(permutation.begin(), permutation.end(), [&](PetscInt a, PetscInt b) { return cellKey(a) < cellKey(b); });
+        DMSwarmRestoreField(swarmDm, cellIdName, nullptr, nullptr, (void**)&cellIds) >> utilities::PetscUtilities::checkError;
+    }
+
+    PermuteParticles(permutation);
+
+    // Compute the range of particles in each cell
+    cellParticleStart.assign(numberCells, 0);
+    cellParticleEnd.assign(numberCells, 0);
+    PetscInt* cellIds;
+    DMSwarmGetField(swarmDm, cellIdName, nullptr, nullptr, (void**)&cellIds) >> utilities::PetscUtilities::checkError;
+    for (PetscInt p = 0; p < np; ++p) {
+        const PetscInt cellIndex = cellIds[p] - sortedCellStart;
+        if (cellIndex < 0 || cellIndex >= numberCells) {
+            continue;
+        }
+        if (cellParticleEnd[cellIndex] == 0) {
+            cellParticleStart[cellIndex] = p;
+        }
+        cellParticleEnd[cellIndex] = p + 1;
+    }
+    DMSwarmRestoreField(swarmDm, cellIdName, nullptr, nullptr, (void**)&cellIds) >> utilities::PetscUtilities::checkError;
+    cellParticleRangesValid = true;
+}
+
+void ablate::particles::ParticleSolver::PermuteParticles(const std::vector<PetscInt>& permutation) {
+    const auto np = (PetscInt)permutation.size();
+
+    // Get the name of the cell id field
+    DMSwarmCellDM swarmCellDm;
+    const char* cellIdName;
+    DMSwarmGetCellDMActive(swarmDm, &swarmCellDm) >> utilities::PetscUtilities::checkError;
+    DMSwarmCellDMGetCellID(swarmCellDm, &cellIdName) >> utilities::PetscUtilities::checkError;
+
+    // Permute every registered swarm field, this includes the packed solution and any aux fields
+    std::vector<std::string> swarmFieldNames = {DMSwarmPICField_coor, DMSwarmField_pid, DMSwarmField_rank, cellIdName};
+    for (const auto& field : fields) {
+        if (field.location == domain::FieldLocation::AUX) {
+            swarmFieldNames.push_back(field.name);
+        }
+    }
+
+    std::vector<char> buffer;
+    for (const auto& swarmFieldName : swarmFieldNames) {
+        PetscInt blockSize;
+        PetscDataType dataType;
+        char* data;
+        DMSwarmGetField(swarmDm, swarmFieldName.c_str(), &blockSize, &dataType, (void**)&data) >> utilities::PetscUtilities::checkError;
+
+        std::size_t typeSize;
+        PetscDataTypeGetSize(dataType, &typeSize) >> utilities::PetscUtilities::checkError;
+        const std::size_t pointSize = typeSize * blockSize;
+
+        buffer.resize(pointSize * np);
+        for (PetscInt p = 0; p < np; ++p) {
+            PetscArraycpy(buffer.data() + p * pointSize, data + permutation[p] * pointSize, pointSize) >> utilities::PetscUtilities::checkError;
+        }
+        PetscArraycpy(data, buffer.data(), pointSize * np) >> utilities::PetscUtilities::checkError;
+
+        DMSwarmRestoreField(swarmDm, swarmFieldName.c_str(), &blockSize, &dataType, (void**)&data) >> utilities::PetscUtilities::checkError;
+    }
+}
+
+void ablate::particles::ParticleSolver::GetCellParticleRange(PetscInt cell, PetscInt& start, PetscInt& end) const {
+    if (sortOrder == SortOrder::NONE) {
+        throw std::invalid_argument("The particle cell ranges are only available when the particles are sorted in " + GetSolverId());
+    }
+    if (!cellParticleRangesValid) {
+        throw std::runtime_error("The particle cell ranges are not available while the multirate levels are advanced in " + GetSolverId());
+    }
+    const PetscInt cellIndex = cell - sortedCellStart;
+    if (cellIndex < 0 || cellIndex >= (PetscInt)cellParticleStart.size()) {
+        start = end = 0;
+    } else {
+        start = cellParticleStart[cellIndex];
+        end = cellParticleEnd[cellIndex];
+    }
 }
 
 void ablate::particles::ParticleSolver::MacroStepParticles(TS macroTS, bool swarmMigrate) {
@@ -407,12 +571,18 @@ void ablate::particles::ParticleSolver::MacroStepParticles(TS macroTS, bool swar
     TSSetMaxTime(particleTs, time) >> utilities::PetscUtilities::checkError;
     timeFinal = time;
 
-    // get the solution vector as a vector
-    Vec solutionVector;
-    DMSwarmCreateGlobalVectorFromField(swarmDm, PackedSolution, &solutionVector) >> utilities::PetscUtilities::checkError;
-
     // take the needed timesteps to get to the flow time
-    TSSolve(particleTs, solutionVector) >> utilities::PetscUtilities::checkError;
+    if (multirate) {
+        MultirateStepParticles();
+    } else {
+        // get the solution vector as a vector
+        Vec solutionVector;
+        DMSwarmCreateGlobalVectorFromField(swarmDm, PackedSolution, &solutionVector) >> utilities::PetscUtilities::checkError;
+        TSSolve(particleTs, solutionVector) >> utilities::PetscUtilities::checkError;
+
+        // put back the vector
+        DMSwarmDestroyGlobalVectorFromField(swarmDm, PackedSolution, &solutionVector) >> utilities::PetscUtilities::checkError;
+    }
     timeInitial = timeFinal;
 
     // get the updated time step, and reset if it has gone down
@@ -422,9 +592,6 @@ void ablate::particles::ParticleSolver::MacroStepParticles(TS macroTS, bool swar
         TSSetTimeStep(particleTs, dtInitial) >> utilities::PetscUtilities::checkError;
     }
 
-    // put back the vector
-    DMSwarmDestroyGlobalVectorFromField(swarmDm, PackedSolution, &solutionVector) >> utilities::PetscUtilities::checkError;
-
     // Decode the solution vector to coordinates
     CoordinatesFromSolutionVector();
 
@@ -434,6 +601,142 @@ void ablate::particles::ParticleSolver::MacroStepParticles(TS macroTS, bool swar
     }
 }
 
+void ablate::particles::ParticleSolver::MultirateStepParticles() {
+    const PetscReal flowTimeStep = timeFinal - timeInitial;
+    const PetscInt numberLevels = multirate->GetNumberLevels();
+
+    // compute the level for each particle using the fluid viscosity at the start of the flow step
+    PetscInt np;
+    DMSwarmGetLocalSize(swarmDm, &np) >> utilities::PetscUtilities::checkError;
+    const auto fluidViscosity = ComputeParticleFluidViscosity();
+    std::vector<PetscInt> particleLevels(np);
+    {
+        const PetscReal *diameter, *density;
+        const auto& diameterField = GetField(ParticleDiameter, &diameter);
+        const auto& densityField = GetField(ParticleDensity, &density);
+        for (PetscInt p = 0; p < np; ++p) {
+            particleLevels[p] = multirate->ComputeLevel(flowTimeStep, density[densityField[p]], diameter[diameterField[p]], fluidViscosity[p]);
+        }
+        RestoreField(diameterField, &diameter);
+        RestoreField(densityField, &density);
+    }
+
+    // group the particles by level, the stable sort maintains any cell ordering within each level
+    std::vector<PetscInt> permutation(np);
+    std::iota(permutation.begin(), permutation.end(), 0);
+    std::stable_sort(permutation.begin(), permutation.end(), [&particleLevels](PetscInt a, PetscInt b) { return particleLevels[a] < particleLevels[b]; });
+
+    PermuteParticles(permutation);
+
+    // the particles are no longer grouped by cell until they are sorted again after stepping
+    cellParticleRangesValid = false;
+
+    // compute the local start of each level
+    std::vector<PetscInt> levelStart(numberLevels + 1, 0);
+    for (PetscInt p = 0; p < np; ++p) {
+        levelStart[particleLevels[p] + 1]++;
+    }
+    std::partial_sum(levelStart.begin(), levelStart.end(), levelStart.begin());
+
+    // determine which levels are used on any rank
+    std::vector<PetscInt> levelCountLocal(numberLevels), levelCountGlobal(numberLevels);
+    for (PetscInt l = 0; l < numberLevels; ++l) {
+        levelCountLocal[l] = levelStart[l + 1] - levelStart[l];
+    }
+    MPI_Comm comm;
+    PetscObjectGetComm((PetscObject)particleTs, &comm) >> utilities::PetscUtilities::checkError;
+    MPI_Allreduce(levelCountLocal.data(), levelCountGlobal.data(), numberLevels, MPIU_INT, MPI_SUM, comm) >> ablate::utilities::MpiUtilities::checkError;
+
+    // get the solution vector as a vector
+    Vec solutionVector;
+    DMSwarmCreateGlobalVectorFromField(swarmDm, PackedSolution, &solutionVector) >> utilities::PetscUtilities::checkError;
+    const auto dataSize = GetField(PackedSolution).dataSize;
+    PetscScalar* solutionArray;
+    VecGetArray(solutionVector, &solutionArray) >> utilities::PetscUtilities::checkError;
+
+    // an adaptive particle ts may grow the step, so limit each level to its sub-step and restore the user limits afterwards
+    TSAdapt adapt;
+    PetscReal adaptMinStep, adaptMaxStep;
+    TSGetAdapt(particleTs, &adapt) >> utilities::PetscUtilities::checkError;
+    TSAdaptGetStepLimits(adapt, &adaptMinStep, &adaptMaxStep) >> utilities::PetscUtilities::checkError;
+
+    // advance each level separately, the particles do not interact so each level is independent
+    for (PetscInt l = 0; l < numberLevels; ++l) {
+        if (levelCountGlobal[l] == 0) {
+            continue;
+        }
+
+        // wrap the particles in this level with a vector
+        Vec levelSolutionVector;
+        VecCreateMPIWithArray(comm, 1, levelCountLocal[l] * dataSize, PETSC_DECIDE, solutionArray + levelStart[l] * dataSize, &levelSolutionVector) >> utilities::PetscUtilities::checkError;
+
+        // the ts must be reset because the size of the solution vector changes for each level
+        TSReset(particleTs) >> utilities::PetscUtilities::checkError;
+        TSSetTime(particleTs, timeInitial) >> utilities::PetscUtilities::checkError;
+        TSSetStepNumber(particleTs, 0) >> utilities::PetscUtilities::checkError;
+        const PetscReal levelTimeStep = flowTimeStep / Multirate::GetNumberSubSteps(l);
+        TSSetTimeStep(particleTs, levelTimeStep) >> utilities::PetscUtilities::checkError;
+        TSAdaptSetStepLimits(adapt, PetscMin(adaptMinStep, levelTimeStep), PetscMin(adaptMaxStep, levelTimeStep)) >> utilities::PetscUtilities::checkError;
+
+        activeParticleStart = levelStart[l];
+        activeParticleCount = levelCountLocal[l];
+        TSSolve(particleTs, levelSolutionVector) >> utilities::PetscUtilities::checkError;
+
+        VecDestroy(&levelSolutionVector) >> utilities::PetscUtilities::checkError;
+    }
+    activeParticleStart = 0;
+    activeParticleCount = -1;
+    TSAdaptSetStepLimits(adapt, adaptMinStep, adaptMaxStep) >> utilities::PetscUtilities::checkError;
+
+    VecRestoreArray(solutionVector, &solutionArray) >> utilities::PetscUtilities::checkError;
+    DMSwarmDestroyGlobalVectorFromField(swarmDm, PackedSolution, &solutionVector) >> utilities::PetscUtilities::checkError;
+
+    // make sure the ts is at the flow time and reset before the next single rate use
+    TSSetTime(particleTs, timeFinal) >> utilities::PetscUtilities::checkError;
+    dmChanged = true;
+
+    // restore the cell order so the cell ranges remain available between steps
+    if (sortOrder != SortOrder::NONE) {
+        SortParticles();
+    }
+}
+
+std::vector<PetscReal> ablate::particles::ParticleSolver::ComputeParticleFluidViscosity() {
+    PetscInt np;
+    DMSwarmGetLocalSize(swarmDm, &np) >> utilities::PetscUtilities::checkError;
+    std::vector<PetscReal> fluidViscosity(np);
+
+    // the transport model is evaluated with every Eulerian solution field interpolated to the particle
+    const auto& eulerianFields = subDomain->GetFields(domain::FieldLocation::SOL);
+    auto viscosityFunction = multirate->GetTransportModel()->GetTransportFunction(eos::transport::TransportProperty::Viscosity, eulerianFields);
+    PetscInt numberEulerianComponents = 0;
+    for (const auto& eulerianField : eulerianFields) {
+        numberEulerianComponents = PetscMax(numberEulerianComponents, eulerianField.offset + eulerianField.numberComponents);
+    }
+
+    Vec solutionVector;
+    DMSwarmCreateGlobalVectorFromField(swarmDm, PackedSolution, &solutionVector) >> utilities::PetscUtilities::checkError;
+    {  // the brackets force the accessors to cleanup before the solution vector is returned
+        accessors::SwarmAccessor swarmAccessor(true, swarmDm, fieldsMap, solutionVector);
+        accessors::EulerianAccessor eulerianAccessor(true, subDomain, swarmAccessor, timeInitial);
+
+        std::vector<accessors::ConstPointData> eulerianData;
+        for (const auto& eulerianField : eulerianFields) {
+            eulerianData.push_back(eulerianAccessor[eulerianField.name]);
+        }
+
+        std::vector<PetscReal> conserved(numberEulerianComponents);
+        for (PetscInt p = 0; p < np; ++p) {
+            for (std::size_t f = 0; f < eulerianFields.size(); ++f) {
+                PetscArraycpy(conserved.data() + eulerianFields[f].offset, eulerianData[f][p], eulerianFields[f].numberComponents) >> utilities::PetscUtilities::checkError;
+            }
+            viscosityFunction.function(conserved.data(), &fluidViscosity[p], viscosityFunction.context.get()) >> utilities::PetscUtilities::checkError;
+        }
+    }
+    DMSwarmDestroyGlobalVectorFromField(swarmDm, PackedSolution, &solutionVector) >> utilities::PetscUtilities::checkError;
+    return fluidViscosity;
+}
+
 void ablate::particles::ParticleSolver::CoordinatesToSolutionVector() {
     // Get the local number of particles
     PetscInt np;
@@ -503,8 +806,8 @@ PetscErrorCode ablate::particles::ParticleSolver::ComputeParticleRHS(TS ts, Pets
     // Zero out f so that the processes can add do it
     PetscCall(VecZeroEntries(f));
 
-    // Build the needed data structures
-    accessors::SwarmAccessor swarmAccessor(cachePointData, particleSolver->swarmDm, particleSolver->fieldsMap, x);
+    // Build the needed data structures, only the active particles are included during multirate integration
+    accessors::SwarmAccessor swarmAccessor(cachePointData, particleSolver->swarmDm, particleSolver->fieldsMap, x, particleSolver->activeParticleStart, particleSolver->activeParticleCount);
     accessors::RhsAccessor rhsAccessor(cachePointData, particleSolver->fieldsMap, f);
     accessors::EulerianAccessor eulerianAccessor(cachePointData, particleSolver->subDomain, swarmAccessor, t);
 
@@ -769,9 +1072,41 @@ PetscErrorCode ablate::particles::ParticleSolver::Restore(PetscViewer viewer, Pe
     // Migrate the particle to the correct rank for the dmPlex
     PetscCall(DMSwarmMigrate(swarmDm, PETSC_TRUE));
     dmChanged = true;
+    if (sortOrder != SortOrder::NONE) {
+        SortParticles();
+    }
     PetscFunctionReturn(0);
 }
 
+std::ostream &ablate::particles::operator<<(std::ostream &os, const ablate::particles::ParticleSolver::SortOrder &v) {
+    switch (v) {
+        case ParticleSolver::SortOrder::NONE:
+            return os << "none";
+        case ParticleSolver::SortOrder::CELL:
+            return os << "cell";
+        case ParticleSolver::SortOrder::CURVE:
+            return os << "curve";
+        default:
+            return os;
+    }
+}
+
+std::istream &ablate::particles::operator>>(std::istream &is, ablate::particles::ParticleSolver::SortOrder &v) {
+    std::string enumString;
+    is >> enumString;
+
+    if (enumString.empty() || enumString == "none") {
+        v = ParticleSolver::SortOrder::NONE;
+    } else if (enumString == "cell") {
+        v = ParticleSolver::SortOrder::CELL;
+    } else if (enumString == "curve") {
+        v = ParticleSolver::SortOrder::CURVE;
+    } else {
+        throw std::invalid_argument("Unknown SortOrder type " + enumString);
+    }
+    return is;
+}
+
 #include "registrar.hpp"
 REGISTER(ablate::solver::Solver, ablate::particles::ParticleSolver, "Lagrangian particle solver", ARG(std::string, "id", "the name of the particle solver"),
          OPT(ablate::domain::Region, "region", "the region to apply this solver.  Default is entire domain"),
@@ -780,4 +1115,6 @@ REGISTER(ablate::solver::Solver, ablate::particles::ParticleSolver, "Lagrangian
          ARG(std::vector<ablate::particles::processes::Process>, "processes", "the processes used to describe the particle source terms"),
          ARG(ablate::particles::initializers::Initializer, "initializer", "the initial particle setup methods"),
          OPT(std::vector<ablate::mathFunctions::FieldFunction>, "fieldInitialization", "the initial particle fields values"),
-         OPT(std::vector<ablate::mathFunctions::FieldFunction>, "exactSolutions", "particle fields (SOL) exact solutions"));
\ No newline at end of file
+         OPT(std::vector<ablate::mathFunctions::FieldFunction>, "exactSolutions", "particle fields (SOL) exact solutions"),
+         ENUM(ablate::particles::ParticleSolver::SortOrder, "sortOrder", "optional order used to store the particles after each migration ('none', 'cell', 'curve').  Default is none"),
+         OPT(ablate::particles::Multirate, "multirate", "optional multirate binning used to sub-cycle the particles based upon relaxation time"));
\ No newline at end of file
@@ -1,9 +1,11 @@
 #ifndef ABLATELIBRARY_PARTICLESOLVER_HPP
 #define ABLATELIBRARY_PARTICLESOLVER_HPP
 
+#include <cstdint>
 #include "field.hpp"
 #include "fieldDescription.hpp"
 #include "initializers/initializer.hpp"
+#include "multirate.hpp"
 #include "processes/process.hpp"
 #include "solver/solver.hpp"
 
@@ -21,6 +23,14 @@ class ParticleSolver : public solver::Solver, public io::Serializable {
     //! These coordinates are part of the solution vector
     inline static const char ParticleCoordinates[] = "coordinates";
 
+    /**
+     * The order used to store particles after each migration
+     * NONE: particles are left in the order produced by the migration
+     * CELL: particles are sorted by owning cell
+     * CURVE: particles are grouped by owning cell with the cells ordered along a space-filling (Morton) curve
+     */
+    enum class SortOrder { NONE, CELL, CURVE };
+
    protected:
     //!  particle dm, this is a swarm
     DM swarmDm = nullptr;
@@ -61,6 +71,39 @@ class ParticleSolver : public solver::Solver, public io::Serializable {
     //! store the exact solution if provided
     const std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions;
 
+    //! the order used to store the particles after each migration
+    const SortOrder sortOrder;
+
+    //! the first cell in the cellParticleStart/cellParticleEnd arrays
+    PetscInt sortedCellStart = 0;
+
+    //! the first local particle in each cell, only valid when the particles are sorted
+    std::vector<PetscInt> cellParticleStart;
+
+    //! one past the last local particle in each cell, only valid when the particles are sorted
+    std::vector<PetscInt> cellParticleEnd;
+
+    //! true when cellParticleStart/cellParticleEnd match the current order of the local particles
+    bool cellParticleRangesValid = false;
+
+    //! the sort key of each cell used for the CURVE sort order
+    std::vector<uint64_t> cellSortKeys;
+
+    //! the cell dm used to compute the cellSortKeys
+    DM cellSortKeysDm = nullptr;
+
+    //! the state of the cell dm coordinates used to compute the cellSortKeys
+    PetscObjectState cellSortKeysCoordinateState = -1;
+
+    //! optional multirate binning used to sub-cycle the particles based upon relaxation time
+    const std::shared_ptr<Multirate> multirate;
+
+    //! the first local particle advanced by the particleTs, this is only non-zero during multirate integration
+    PetscInt activeParticleStart = 0;
+
+    //! the number of local particles advanced by the particleTs, negative implies all particles
+    PetscInt activeParticleCount = -1;
+
    public:
     /**
      * default constructor
@@ -71,10 +114,13 @@ class ParticleSolver : public solver::Solver, public io::Serializable {
      * @param initializer
      * @param fieldInitialization
      * @param exactSolutions
+     * @param sortOrder the order used to store the particles after each migration
+     * @param multirate optional multirate binning used to sub-cycle the particles based upon relaxation time
      */
     ParticleSolver(std::string solverId, std::shared_ptr<domain::Region>, std::shared_ptr<parameters::Parameters> options, std::vector<FieldDescription> fields,
                    std::vector<std::shared_ptr<processes::Process>> processes, std::shared_ptr<initializers::Initializer> initializer,
-                   std::vector<std::shared_ptr<mathFunctions::FieldFunction>> fieldInitialization, std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions = {});
+                   std::vector<std::shared_ptr<mathFunctions::FieldFunction>> fieldInitialization, std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions = {},
+                   SortOrder sortOrder = SortOrder::NONE, std::shared_ptr<Multirate> multirate = {});
 
     /**
      * shared pointer version of the constructor
@@ -85,10 +131,13 @@ class ParticleSolver : public solver::Solver, public io::Serializable {
      * @param initializer
      * @param fieldInitialization
      * @param exactSolutions
+     * @param sortOrder the order used to store the particles after each migration
+     * @param multirate optional multirate binning used to sub-cycle the particles based upon relaxation time
      */
     ParticleSolver(std::string solverId, std::shared_ptr<domain::Region>, std::shared_ptr<parameters::Parameters> options, const std::vector<std::shared_ptr<FieldDescription>>& fields,
                    std::vector<std::shared_ptr<processes::Process>> processes, std::shared_ptr<initializers::Initializer> initializer,
-                   std::vector<std::shared_ptr<mathFunctions::FieldFunction>> fieldInitialization, std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions = {});
+                   std::vector<std::shared_ptr<mathFunctions::FieldFunction>> fieldInitialization, std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions = {},
+                   SortOrder sortOrder = SortOrder::NONE, std::shared_ptr<Multirate> multirate = {});
 
     ~ParticleSolver() override;
 
@@ -110,6 +159,14 @@ class ParticleSolver : public solver::Solver, public io::Serializable {
      */
     inline TS GetParticleTS() { return particleTs; }
 
+    /**
+     * Returns the range of local particles [start, end) in the cell.  This is only available when a sortOrder is specified and not while the multirate levels are being advanced.
+     * @param cell the cell point in the subDomain dm
+     * @param start the first particle in the cell
+     * @param end one past the last particle in the cell
+     */
+    void GetCellParticleRange(PetscInt cell, PetscInt& start, PetscInt& end) const;
+
     /**
      * Helper function useful for tests
      * @param particleTS
@@ -177,6 +234,28 @@ class ParticleSolver : public solver::Solver, public io::Serializable {
      */
     void SwarmMigrate();
 
+    /**
+     * Reorder the local particles, and all registered fields, based upon the sortOrder and compute the per cell particle ranges
+     */
+    void SortParticles();
+
+    /**
+     * Reorder the local particles and all registered fields so that new particle p is the old particle permutation[p]
+     * @param permutation
+     */
+    void PermuteParticles(const std::vector<PetscInt>& permutation);
+
+    /**
+     * Advance each multirate level separately with its own sub-step from timeInitial to timeFinal
+     */
+    void MultirateStepParticles();
+
+    /**
+     * Compute the fluid viscosity at each local particle from the multirate transport model and the Eulerian solution at timeInitial
+     * @return the viscosity for each local particle
+     */
+    std::vector<PetscReal> ComputeParticleFluidViscosity();
+
     /**
      * map the coordinates to the solution vector
      */
@@ -252,5 +331,20 @@ class ParticleSolver : public solver::Solver, public io::Serializable {
     static PetscErrorCode ComputeParticleRHS(TS ts, PetscReal t, Vec X, Vec F, void* ctx);
 };
 
+/**
+ * Support function for the SortOrder Enum
+ * @param os
+ * @param v
+ * @return
+ */
+std::ostream& operator<<(std::ostream& os, const ParticleSolver::SortOrder& v);
+/**
+ * Support function for the SortOrder Enum
+ * @param os
+ * @param v
+ * @return
+ */
+std::istream& operator>>(std::istream& is, ParticleSolver::SortOrder& v);
+
 }  // namespace ablate::particles
 #endif  // ABLATELIBRARY_PARTICLESOLVER_HPP
@@ -562,7 +562,7 @@ void ablate::radiation::Radiation::ParticleStep(ablate::domain::SubDomain& subDo
 }
 
 void ablate::radiation::Radiation::EvaluateGains(Vec solVec, ablate::domain::Field temperatureField, Vec auxVec) {
-    StartEvent((GetClassType() + "::EvaluateGains").c_str());
+    ScopedEvent evaluateGainsScope(*this, evaluateGainsEvent);
 
     unsigned short int propertySize = static_cast<unsigned short int>(absorptivityFunction.propertySize);
 
@@ -678,7 +678,6 @@ void ablate::radiation::Radiation::EvaluateGains(Vec solVec, ablate::domain::Fie
     /** Cleanup */
     VecRestoreArrayRead(solVec, &solArray);
     VecRestoreArrayRead(auxVec, &auxArray);
-    EndEvent();
 }
 
 void ablate::radiation::Radiation::DeleteOutOfBounds(ablate::domain::SubDomain& subDomain) {
@@ -168,6 +168,9 @@ class Radiation : protected utilities::Loggable<Radiation> {  //!< Cell solver p
     //! create a data type to simplify moving the carrier
     MPI_Datatype carrierMpiType;
 
+    //! pre-registered profiling event for the gain evaluation called each rhs evaluation
+    const PetscLogEvent evaluateGainsEvent = RegisterEvent((GetClassType() + "::EvaluateGains").c_str());
+
     /** CellSegment belong to the local maps and hold all of the local information about the ray segments both during the search and the solve */
     struct CellSegment {
         //!< Stores the cell indices of the segment locally.
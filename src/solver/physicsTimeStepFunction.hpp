@@ -15,6 +15,23 @@ class PhysicsTimeStepFunction {
      * Computes the individual time steps useful for output/debugging.
      */
     virtual std::map<std::string, double> ComputePhysicsTimeSteps(TS ts) { return {{"", ComputePhysicsTimeStep(ts)}}; }
+
+    /**
+     * Reports if this function computes a physics based time step in each cell.  Only these functions can be used for local (pseudo) time stepping.
+     */
+    [[nodiscard]] virtual bool HasLocalPhysicsTimeSteps() const { return false; }
+
+    /**
+     * Computes and stores the physics based time step in each cell.  This is used for local (pseudo) time stepping when marching to steady state.
+     */
+    virtual void ComputeLocalPhysicsTimeSteps(TS ts) {}
+
+    /**
+     * Scales the rhs in each cell by the ratio of the stored local time step to the global time step so that each cell is advanced with its own time step
+     * @param dt the global time step
+     * @param F the global rhs vector
+     */
+    virtual PetscErrorCode ScaleRHSByLocalPhysicsTimeSteps(PetscReal dt, Vec F) { return 0; }
 };
 
 }  // namespace ablate::solver
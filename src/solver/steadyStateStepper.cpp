@@ -8,12 +8,14 @@ ablate::solver::SteadyStateStepper::SteadyStateStepper(std::shared_ptr<ablate::d
                                                        std::shared_ptr<ablate::domain::Initializer> initialization,
                                                        std::vector<std::shared_ptr<ablate::mathFunctions::FieldFunction>> absoluteTolerances,
                                                        std::vector<std::shared_ptr<ablate::mathFunctions::FieldFunction>> relativeTolerances, bool verboseSourceCheck,
-                                                       std::shared_ptr<ablate::monitors::logs::Log> log, int checkIntervalIn)
+                                                       std::shared_ptr<ablate::monitors::logs::Log> log, int checkIntervalIn, bool localTimeSteppingIn)
     : ablate::solver::TimeStepper(std::move(domain), arguments, std::move(serializer), std::move(initialization), {} /* no exact solution for stead state solver */, std::move(absoluteTolerances),
                                   std::move(relativeTolerances), verboseSourceCheck),
       checkInterval(checkIntervalIn ? checkIntervalIn : 100),
       convergenceCriteria(std::move(convergenceCriteria)),
-      log(std::move(log)) {}
+      log(std::move(log)) {
+    localTimeStepping = localTimeSteppingIn;
+}
 
 ablate::solver::SteadyStateStepper::~SteadyStateStepper() = default;
 
@@ -94,6 +96,9 @@ void ablate::solver::SteadyStateStepper::Solve() {
         // Increase the number of steps and try again
         TSSetMaxSteps(GetTS(), checkInterval + step) >> ablate::utilities::PetscUtilities::checkError;
     }
+
+    // complete the output written after the first solve
+    FinalizeOutput();
 }
 
 #include "registrar.hpp"
@@ -104,4 +109,7 @@ REGISTER(ablate::solver::TimeStepper, ablate::solver::SteadyStateStepper, "a tim
          OPT(std::vector<ablate::mathFunctions::FieldFunction>, "absoluteTolerances", "optional absolute tolerances for a field"),
          OPT(std::vector<ablate::mathFunctions::FieldFunction>, "relativeTolerances", "optional relative tolerances for a field"),
          OPT(bool, "verboseSourceCheck", "does a slow nan/inf for solvers that use rhs evaluation. This is slow and should only be used for debug."),
-         OPT(ablate::monitors::logs::Log, "log", "optionally log the convergence history"), OPT(int, "checkInterval", "the number of steps between criteria checks"));
+         OPT(ablate::monitors::logs::Log, "log", "optionally log the convergence history"), OPT(int, "checkInterval", "the number of steps between criteria checks"),
+         OPT(bool, "localTimeStepping",
+             "advance each cell with its own physics based time step (pseudo time).  At least one solver must compute a physics based time step in each cell and no solver may provide an "
+             "IFunction (default is false)"));
@@ -32,12 +32,15 @@ class SteadyStateStepper : public ablate::solver::TimeStepper {
      * @param absoluteTolerances
      * @param relativeTolerances
      * @param verboseSourceCheck
+     * @param log
+     * @param checkInterval
+     * @param localTimeStepping advance each cell with its own physics based time step, only explicit (rhs) solvers are supported
      */
     explicit SteadyStateStepper(std::shared_ptr<ablate::domain::Domain> domain, std::vector<std::shared_ptr<criteria::ConvergenceCriteria>> convergenceCriteria,
                                 const std::shared_ptr<ablate::parameters::Parameters> &arguments = {}, std::shared_ptr<ablate::io::Serializer> serializer = {},
                                 std::shared_ptr<ablate::domain::Initializer> initialization = {}, std::vector<std::shared_ptr<ablate::mathFunctions::FieldFunction>> absoluteTolerances = {},
                                 std::vector<std::shared_ptr<ablate::mathFunctions::FieldFunction>> relativeTolerances = {}, bool verboseSourceCheck = {},
-                                std::shared_ptr<ablate::monitors::logs::Log> log = {}, int checkInterval = 0);
+                                std::shared_ptr<ablate::monitors::logs::Log> log = {}, int checkInterval = 0, bool localTimeStepping = false);
 
     /**
      * clean up any of the local memory
@@ -1,5 +1,6 @@
 #include "timeStepper.hpp"
 #include <petscdm.h>
+#include <algorithm>
 #include <utility>
 #include "adaptPhysics.hpp"
 #include "adaptPhysicsConstrained.hpp"
@@ -88,6 +89,16 @@ bool ablate::solver::TimeStepper::Initialize() {
             DMTSSetIJacobianLocal(domain->GetDM(), SolverComputeIJacobianLocal, this) >> utilities::PetscUtilities::checkError;
         }
 
+        // local time stepping only scales the rhs, so every solver must be explicit and at least one must provide a time step in each cell
+        if (localTimeStepping) {
+            if (!iFunctionSolvers.empty()) {
+                throw std::invalid_argument("Local time stepping cannot be used with solvers that provide an IFunction because only the rhs is scaled by the cell time steps.");
+            }
+            if (std::none_of(physicsTimeStepFunctionSolvers.begin(), physicsTimeStepFunctionSolvers.end(), [](const auto& solver) { return solver->HasLocalPhysicsTimeSteps(); })) {
+                throw std::invalid_argument("Local time stepping requires at least one solver that computes a physics based time step in each cell.");
+            }
+        }
+
         // Register the monitors
         for (auto& solver : solvers) {
             // Get any monitors
@@ -144,6 +155,7 @@ void ablate::solver::TimeStepper::Solve() {
 
             serializer->Serialize(ts, step, time, domain->GetSolutionVector()) >> utilities::PetscUtilities::checkError;
             serializer->Serialize(ts, step + 1, time, domain->GetSolutionVector()) >> utilities::PetscUtilities::checkError;
+            serializer->Finalize();
         }
         // exit before ts solver
         return;
@@ -187,6 +199,20 @@ void ablate::solver::TimeStepper::Solve() {
     PetscLogEventBegin(logEvent, 0, 0, 0, 0);
     TSSolve(ts, solutionVec) >> utilities::PetscUtilities::checkError;
     PetscLogEventEnd(logEvent, 0, 0, 0, 0);
+
+    // complete any background output while every rank is still active
+    FinalizeOutput();
+}
+
+void ablate::solver::TimeStepper::FinalizeOutput() {
+    for (const auto& monitorPerSolver : monitors) {
+        for (const auto& monitor : monitorPerSolver.second) {
+            monitor->Finalize();
+        }
+    }
+    if (serializer) {
+        serializer->Finalize();
+    }
 }
 
 double ablate::solver::TimeStepper::GetTime() const {
@@ -238,6 +264,17 @@ PetscErrorCode ablate::solver::TimeStepper::TSPreStepFunction(TS ts) {
         }
     }
 
+    // compute the local time steps from the solution at the start of the step
+    if (timeStepper->localTimeStepping) {
+        for (auto& timeStepFunction : timeStepper->physicsTimeStepFunctionSolvers) {
+            try {
+                timeStepFunction->ComputeLocalPhysicsTimeSteps(ts);
+            } catch (std::exception& exp) {
+                SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exp.what());
+            }
+        }
+    }
+
     PetscFunctionReturn(0);
 }
 
@@ -332,9 +369,10 @@ PetscErrorCode ablate::solver::TimeStepper::SolverComputeRHSFunction(TS ts, Pets
     PetscFunctionBeginUser;
     auto timeStepper = (ablate::solver::TimeStepper*)timeStepperCtx;
 
-    timeStepper->StartEvent("SolverComputeRHSFunction::DMGlobalToLocal");
+    ScopedEvent rhsScope(*timeStepper, timeStepper->rhsEvent);
     DM dm = timeStepper->domain->GetDM();
     Vec locX, locF;
+    timeStepper->StartEvent(timeStepper->rhsGlobalToLocalEvent);
     DMGetLocalVector(dm, &locX);
     DMGetLocalVector(dm, &locF);
     VecZeroEntries(locX);
@@ -345,16 +383,18 @@ PetscErrorCode ablate::solver::TimeStepper::SolverComputeRHSFunction(TS ts, Pets
     timeStepper->EndEvent();
 
     // Update the boundary conditions
-    timeStepper->StartEvent("SolverComputeRHSFunction::SolverComputeBoundaryFunctionLocal");
-    PetscCall(SolverComputeBoundaryFunctionLocal(dm, time, locX, nullptr, timeStepperCtx));
-    timeStepper->EndEvent();
+    {
+        ScopedEvent boundaryScope(*timeStepper, timeStepper->rhsBoundaryEvent);
+        PetscCall(SolverComputeBoundaryFunctionLocal(dm, time, locX, nullptr, timeStepperCtx));
+    }
 
     // Call each of the provided pre RHS functions
-    timeStepper->StartEvent("SolverComputeRHSFunction::PreRHSFunction");
-    for (auto& solver : timeStepper->rhsFunctionSolvers) {
-        PetscCall(solver->PreRHSFunction(ts, time, timeStepper->runInitialStep, locX));
+    {
+        ScopedEvent preRhsScope(*timeStepper, timeStepper->rhsPreRhsEvent);
+        for (auto& solver : timeStepper->rhsFunctionSolvers) {
+            PetscCall(solver->PreRHSFunction(ts, time, timeStepper->runInitialStep, locX));
+        }
     }
-    timeStepper->EndEvent();
 
     // Reset the timeStepper->runInitialStep
     timeStepper->runInitialStep = false;
@@ -364,14 +404,15 @@ PetscErrorCode ablate::solver::TimeStepper::SolverComputeRHSFunction(TS ts, Pets
     CHKMEMQ;
 
     // Call each of the provided RHS functions
-    timeStepper->StartEvent("SolverComputeRHSFunction::ComputeRHSFunction");
-    for (auto& solver : timeStepper->rhsFunctionSolvers) {
-        PetscCall(solver->ComputeRHSFunction(time, locX, locF));
+    {
+        ScopedEvent computeRhsScope(*timeStepper, timeStepper->rhsComputeEvent);
+        for (auto& solver : timeStepper->rhsFunctionSolvers) {
+            PetscCall(solver->ComputeRHSFunction(time, locX, locF));
+        }
+        CHKMEMQ;
     }
-    CHKMEMQ;
-    timeStepper->EndEvent();
 
-    timeStepper->StartEvent("SolverComputeRHSFunction::DMLocalToGlobalEnd");
+    timeStepper->StartEvent(timeStepper->rhsLocalToGlobalEvent);
     VecZeroEntries(F);
     DMLocalToGlobalBegin(dm, locF, ADD_VALUES, F);
     DMLocalToGlobalEnd(dm, locF, ADD_VALUES, F);
@@ -379,10 +420,18 @@ PetscErrorCode ablate::solver::TimeStepper::SolverComputeRHSFunction(TS ts, Pets
     DMRestoreLocalVector(dm, &locF);
     timeStepper->EndEvent();
 
+    // scale the rhs so that each cell is advanced with its own time step
+    if (timeStepper->localTimeStepping) {
+        PetscReal dt;
+        PetscCall(TSGetTimeStep(ts, &dt));
+        for (auto& timeStepFunction : timeStepper->physicsTimeStepFunctionSolvers) {
+            PetscCall(timeStepFunction->ScaleRHSByLocalPhysicsTimeSteps(dt, F));
+        }
+    }
+
     if (timeStepper->verboseSourceCheck) {
-        timeStepper->StartEvent("SolverComputeRHSFunction::CheckFieldValues");
+        ScopedEvent checkScope(*timeStepper, timeStepper->rhsCheckFieldValuesEvent);
         timeStepper->domain->CheckFieldValues(F);
-        timeStepper->EndEvent();
     }
 
     PetscFunctionReturn(0);
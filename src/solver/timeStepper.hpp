@@ -49,6 +49,15 @@ class TimeStepper : public std::enable_shared_from_this<TimeStepper>, private ut
     // If true, uses a slow nan/inf check at each source term for each evaluation
     const bool verboseSourceCheck;
 
+    //! pre-registered profiling events for the rhs evaluation, the component events are nested inside rhsEvent
+    const PetscLogEvent rhsEvent = RegisterEvent("SolverComputeRHSFunction");
+    const PetscLogEvent rhsGlobalToLocalEvent = RegisterEvent("SolverComputeRHSFunction::DMGlobalToLocal");
+    const PetscLogEvent rhsBoundaryEvent = RegisterEvent("SolverComputeRHSFunction::SolverComputeBoundaryFunctionLocal");
+    const PetscLogEvent rhsPreRhsEvent = RegisterEvent("SolverComputeRHSFunction::PreRHSFunction");
+    const PetscLogEvent rhsComputeEvent = RegisterEvent("SolverComputeRHSFunction::ComputeRHSFunction");
+    const PetscLogEvent rhsLocalToGlobalEvent = RegisterEvent("SolverComputeRHSFunction::DMLocalToGlobalEnd");
+    const PetscLogEvent rhsCheckFieldValuesEvent = RegisterEvent("SolverComputeRHSFunction::CheckFieldValues");
+
     /**
      * The TSPre*Function is used to call both th PreStep (once) and PreStage (as need calls).
      *
@@ -88,6 +97,15 @@ class TimeStepper : public std::enable_shared_from_this<TimeStepper>, private ut
     //! hold a list of static AdaptInitializers
     static inline std::map<std::string, AdaptInitializer> adaptInitializers = {};
 
+   protected:
+    //! when true each cell is advanced with its own physics based time step.  This is only valid when marching to steady state.
+    bool localTimeStepping = false;
+
+    /**
+     * Complete the monitor and serializer output once stepping is done, this is collective
+     */
+    void FinalizeOutput();
+
    public:
     /**
      * primary constructor for timestepper
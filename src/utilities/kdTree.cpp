@@ -0,0 +1,167 @@
+#include "kdTree.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+ablate::utilities::KdTree::KdTree(std::vector<double> coordinatesIn, std::size_t dimensionIn)
+    : coordinates(std::move(coordinatesIn)), dimension(dimensionIn), numberPoints(dimensionIn > 0 ? coordinates.size() / dimensionIn : 0) {
+    if (dimension < 1 || dimension > 3) {
+        throw std::invalid_argument("The KdTree dimension must be 1, 2, or 3");
+    }
+    if (coordinates.size() != numberPoints * dimension) {
+        throw std::invalid_argument("The KdTree coordinates size (" + std::to_string(coordinates.size()) + ") must be a multiple of the dimension (" + std::to_string(dimension) + ")");
+    }
+
+    order.resize(numberPoints);
+    for (std::size_t p = 0; p < numberPoints; ++p) {
+        order[p] = p;
+    }
+    splitAxis.resize(numberPoints, 0);
+    Build(0, numberPoints);
+}
+
+void ablate::utilities::KdTree::Build(std::size_t begin, std::size_t end) {
+    if (end - begin < 2) {
+        return;
+    }
+
+    // split along the axis with the largest extent so clustered data still produces a balanced search
+    std::size_t axis = 0;
+    double largestExtent = -1.0;
+    for (std::size_t d = 0; d < dimension; ++d) {
+        double minValue = std::numeric_limits<double>::max();
+        double maxValue = std::numeric_limits<double>::lowest();
+        for (std::size_t i = begin; i < end; ++i) {
+            const double value = coordinates[order[i] * dimension + d];
+            minValue = std::min(minValue, value);
+            maxValue = std::max(maxValue, value);
+        }
+        if (maxValue - minValue > largestExtent) {
+            largestExtent = maxValue - minValue;
+            axis = d;
+        }
+    }
+
+    // partition about the median
+    const std::size_t mid = begin + (end - begin) / 2;
+    std::nth_element(order.begin() + begin, order.begin() + mid, order.begin() + end, [this, axis](std::size_t a, std::size_t b) {
+        return coordinates[a * dimension + axis] < coordinates[b * dimension + axis];
+    });
+    splitAxis[mid] = (unsigned char)axis;
+
+    Build(begin, mid);
+    Build(mid + 1, end);
+}
+
+void ablate::utilities::KdTree::SearchNearest(const double* xyz, std::size_t queryDimension, std::size_t begin, std::size_t end, std::size_t& nearest, double& nearestDistanceSquared) const {
+    if (begin >= end) {
+        return;
+    }
+    const std::size_t mid = begin + (end - begin) / 2;
+    const std::size_t p = order[mid];
+    const double distance = DistanceSquared(xyz, queryDimension, p);
+    if (distance < nearestDistanceSquared || (distance == nearestDistanceSquared && p < nearest)) {
+        nearest = p;
+        nearestDistanceSquared = distance;
+    }
+
+    // search the side containing the query first, then the other side only if it could hold a closer (or equally close) point
+    const double planeDistance = PlaneDistance(xyz, queryDimension, mid);
+    if (planeDistance < 0) {
+        SearchNearest(xyz, queryDimension, begin, mid, nearest, nearestDistanceSquared);
+        if (planeDistance * planeDistance <= nearestDistanceSquared) {
+            SearchNearest(xyz, queryDimension, mid + 1, end, nearest, nearestDistanceSquared);
+        }
+    } else {
+        SearchNearest(xyz, queryDimension, mid + 1, end, nearest, nearestDistanceSquared);
+        if (planeDistance * planeDistance <= nearestDistanceSquared) {
+            SearchNearest(xyz, queryDimension, begin, mid, nearest, nearestDistanceSquared);
+        }
+    }
+}
+
+void ablate::utilities::KdTree::SearchKNearest(const double* xyz, std::size_t queryDimension, std::size_t k, std::size_t begin, std::size_t end,
+                                               std::vector<std::pair<double, std::size_t>>& heap) const {
+    if (begin >= end) {
+        return;
+    }
+    const std::size_t mid = begin + (end - begin) / 2;
+    const std::size_t p = order[mid];
+    const std::pair<double, std::size_t> candidate{DistanceSquared(xyz, queryDimension, p), p};
+
+    // the heap is a max heap on (distance, index) so the farthest of the current k is on top
+    if (heap.size() < k) {
+        heap.push_back(candidate);
+        std::push_heap(heap.begin(), heap.end());
+    } else if (candidate < heap.front()) {
+        std::pop_heap(heap.begin(), heap.end());
+        heap.back() = candidate;
+        std::push_heap(heap.begin(), heap.end());
+    }
+
+    const double planeDistance = PlaneDistance(xyz, queryDimension, mid);
+    const std::size_t nearBegin = planeDistance < 0 ? begin : mid + 1;
+    const std::size_t nearEnd = planeDistance < 0 ? mid : end;
+    const std::size_t farBegin = planeDistance < 0 ? mid + 1 : begin;
+    const std::size_t farEnd = planeDistance < 0 ? end : mid;
+
+    SearchKNearest(xyz, queryDimension, k, nearBegin, nearEnd, heap);
+    if (heap.size() < k || planeDistance * planeDistance <= heap.front().first) {
+        SearchKNearest(xyz, queryDimension, k, farBegin, farEnd, heap);
+    }
+}
+
+void ablate::utilities::KdTree::SearchRadius(const double* xyz, std::size_t queryDimension, double radiusSquared, std::size_t begin, std::size_t end, std::vector<std::size_t>& indices) const {
+    if (begin >= end) {
+        return;
+    }
+    const std::size_t mid = begin + (end - begin) / 2;
+    if (DistanceSquared(xyz, queryDimension, order[mid]) <= radiusSquared) {
+        indices.push_back(order[mid]);
+    }
+
+    const double planeDistance = PlaneDistance(xyz, queryDimension, mid);
+    const double planeDistanceSquared = planeDistance * planeDistance;
+    if (planeDistance <= 0 || planeDistanceSquared <= radiusSquared) {
+        SearchRadius(xyz, queryDimension, radiusSquared, begin, mid, indices);
+    }
+    if (planeDistance >= 0 || planeDistanceSquared <= radiusSquared) {
+        SearchRadius(xyz, queryDimension, radiusSquared, mid + 1, end, indices);
+    }
+}
+
+std::size_t ablate::utilities::KdTree::Nearest(const double* xyz, std::size_t xyzDimension) const {
+    if (numberPoints == 0) {
+        throw std::runtime_error("Cannot search an empty KdTree");
+    }
+    std::size_t nearest = std::numeric_limits<std::size_t>::max();
+    double nearestDistanceSquared = std::numeric_limits<double>::max();
+    SearchNearest(xyz, std::min(xyzDimension, dimension), 0, numberPoints, nearest, nearestDistanceSquared);
+    return nearest;
+}
+
+void ablate::utilities::KdTree::KNearest(const double* xyz, std::size_t xyzDimension, std::size_t k, std::vector<std::size_t>& indices, std::vector<double>& distancesSquared) const {
+    std::vector<std::pair<double, std::size_t>> heap;
+    k = std::min(k, numberPoints);
+    heap.reserve(k);
+    if (k > 0) {
+        SearchKNearest(xyz, std::min(xyzDimension, dimension), k, 0, numberPoints, heap);
+    }
+    std::sort_heap(heap.begin(), heap.end());
+
+    indices.resize(heap.size());
+    distancesSquared.resize(heap.size());
+    for (std::size_t i = 0; i < heap.size(); ++i) {
+        distancesSquared[i] = heap[i].first;
+        indices[i] = heap[i].second;
+    }
+}
+
+void ablate::utilities::KdTree::Radius(const double* xyz, std::size_t xyzDimension, double radius, std::vector<std::size_t>& indices) const {
+    indices.clear();
+    if (radius < 0) {
+        return;
+    }
+    SearchRadius(xyz, std::min(xyzDimension, dimension), radius * radius, 0, numberPoints, indices);
+}
@@ -0,0 +1,117 @@
+#ifndef ABLATELIBRARY_KDTREE_HPP
+#define ABLATELIBRARY_KDTREE_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace ablate::utilities {
+
+/**
+ * A static kd-tree over a list of points used for nearest, k-nearest, and radius searches.  The tree is built once in O(N log N) and is stored
+ * implicitly as a permutation of the point indices (the median of each sub range is the splitting node) so no per node allocations are needed.
+ *
+ * Queries may use fewer dimensions than the tree, in which case the remaining dimensions are ignored when computing the distance.
+ */
+class KdTree {
+   private:
+    //! list of coordinates (x1, y1, z1, x2, y2, etc.)
+    const std::vector<double> coordinates;
+
+    //! the dimension of the coordinates
+    const std::size_t dimension;
+
+    //! the number of points in the tree
+    const std::size_t numberPoints;
+
+    //! the point indices ordered so that each sub range [begin, end) is split at its median
+    std::vector<std::size_t> order;
+
+    //! the splitting axis for each node, stored at the node (median) location
+    std::vector<unsigned char> splitAxis;
+
+    /**
+     * recursively build the sub range [begin, end)
+     */
+    void Build(std::size_t begin, std::size_t end);
+
+    /**
+     * the squared distance from xyz to point p using the first queryDimension dimensions
+     */
+    inline double DistanceSquared(const double* xyz, std::size_t queryDimension, std::size_t p) const {
+        double distance = 0.0;
+        for (std::size_t d = 0; d < queryDimension; ++d) {
+            const double delta = xyz[d] - coordinates[p * dimension + d];
+            distance += delta * delta;
+        }
+        return distance;
+    }
+
+    /**
+     * the signed distance from the query to the splitting plane of the node at mid, zero if the axis is not used by the query
+     */
+    inline double PlaneDistance(const double* xyz, std::size_t queryDimension, std::size_t mid) const {
+        const std::size_t axis = splitAxis[mid];
+        return axis < queryDimension ? xyz[axis] - coordinates[order[mid] * dimension + axis] : 0.0;
+    }
+
+    void SearchNearest(const double* xyz, std::size_t queryDimension, std::size_t begin, std::size_t end, std::size_t& nearest, double& nearestDistanceSquared) const;
+
+    void SearchKNearest(const double* xyz, std::size_t queryDimension, std::size_t k, std::size_t begin, std::size_t end, std::vector<std::pair<double, std::size_t>>& heap) const;
+
+    void SearchRadius(const double* xyz, std::size_t queryDimension, double radiusSquared, std::size_t begin, std::size_t end, std::vector<std::size_t>& indices) const;
+
+   public:
+    /**
+     * Build the tree
+     * @param coordinates list of coordinates (x1, y1, z1, x2, y2, etc.)
+     * @param dimension the dimension of each point
+     */
+    KdTree(std::vector<double> coordinates, std::size_t dimension);
+
+    /**
+     * Find the nearest point.  Ties are broken by the lowest point index so the result matches a brute force search.
+     * @param xyz the query location
+     * @param xyzDimension the dimension of xyz, only min(xyzDimension, dimension) dimensions are compared
+     * @return the index of the nearest point
+     */
+    std::size_t Nearest(const double* xyz, std::size_t xyzDimension) const;
+
+    /**
+     * Find the k nearest points sorted from nearest to farthest
+     * @param xyz the query location
+     * @param xyzDimension the dimension of xyz, only min(xyzDimension, dimension) dimensions are compared
+     * @param k the number of points to find, fewer are returned if the tree is smaller
+     * @param indices the resulting point indices
+     * @param distancesSquared the resulting squared distances
+     */
+    void KNearest(const double* xyz, std::size_t xyzDimension, std::size_t k, std::vector<std::size_t>& indices, std::vector<double>& distancesSquared) const;
+
+    /**
+     * Find all points within (or on) the radius of the query location in no particular order
+     * @param xyz the query location
+     * @param xyzDimension the dimension of xyz, only min(xyzDimension, dimension) dimensions are compared
+     * @param radius the search radius
+     * @param indices the resulting point indices
+     */
+    void Radius(const double* xyz, std::size_t xyzDimension, double radius, std::vector<std::size_t>& indices) const;
+
+    /**
+     * @param p the point index
+     * @return the coordinates of point p
+     */
+    [[nodiscard]] inline const double* GetPoint(std::size_t p) const { return coordinates.data() + p * dimension; }
+
+    /**
+     * @return the number of points in the tree
+     */
+    [[nodiscard]] inline std::size_t Size() const { return numberPoints; }
+
+    /**
+     * @return the dimension of the points in the tree
+     */
+    [[nodiscard]] inline std::size_t Dimension() const { return dimension; }
+};
+
+}  // namespace ablate::utilities
+#endif  // ABLATELIBRARY_KDTREE_HPP
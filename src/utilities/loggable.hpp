@@ -1,19 +1,45 @@
 #ifndef ABLATELIBRARY_LOGGABLE_HPP
 #define ABLATELIBRARY_LOGGABLE_HPP
 #include <petsc.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
 #include "demangler.hpp"
 #include "petscUtilities.hpp"
 
 namespace ablate::utilities {
+/**
+ * Provides PETSc log events for a class.  Events may be nested so that the time spent in each region is reported as part of its parent when using
+ * the PETSc nested log views (-log_view :profile.xml:ascii_xml or -log_view :profile.txt:ascii_flamegraph).  Hot paths should register their
+ * events once with RegisterEvent and start them by handle, the named StartEvent looks up a per class cache.
+ */
 template <class T>
 class Loggable {
    private:
     inline static PetscClassId petscClassId = 0;
 
-    // Store a single depth active event
-    mutable PetscLogEvent activeEvent = PETSC_DECIDE;
+    //! the events registered by name for this class, so each name is only registered with PETSc once
+    inline static std::unordered_map<std::string, PetscLogEvent> registeredEvents;
+
+    //! the stack of active (nested) events
+    mutable std::vector<PetscLogEvent> activeEvents;
 
    protected:
+    /**
+     * Ends the event when it goes out of scope, so the event stack stays consistent if an exception is thrown
+     */
+    class ScopedEvent {
+       private:
+        const Loggable& loggable;
+
+       public:
+        ScopedEvent(const Loggable& loggable, PetscLogEvent event) : loggable(loggable) { loggable.StartEvent(event); }
+        ~ScopedEvent() { loggable.EndEvent(); }
+
+        ScopedEvent(const ScopedEvent&) = delete;
+        ScopedEvent& operator=(const ScopedEvent&) = delete;
+    };
+
     Loggable() {
         if (petscClassId == 0) {
             auto className = utilities::Demangler::Demangle(typeid(T).name());
@@ -23,28 +49,46 @@ class Loggable {
 
     inline const PetscClassId& GetPetscClassId() const { return petscClassId; }
 
-    inline PetscLogEvent RegisterEvent(const char* eventName) {
+    /**
+     * Register (or look up the previously registered) event with this name
+     * @param eventName
+     * @return the event handle
+     */
+    inline PetscLogEvent RegisterEvent(const char* eventName) const {
+        auto registeredEvent = registeredEvents.find(eventName);
+        if (registeredEvent != registeredEvents.end()) {
+            return registeredEvent->second;
+        }
         PetscLogEvent eventId;
         PetscLogEventRegister(eventName, petscClassId, &eventId) >> utilities::PetscUtilities::checkError;
+        registeredEvents[eventName] = eventId;
         return eventId;
     }
 
-    inline void StartEvent(const char* eventName) const {
-        if (activeEvent == PETSC_DECIDE) {
-            PetscLogEventRegister(eventName, petscClassId, &activeEvent) >> utilities::PetscUtilities::checkError;
-            PetscLogEventBegin(activeEvent, 0, 0, 0, 0) >> utilities::PetscUtilities::checkError;
-        } else {
-            throw std::runtime_error("Cannot Start Event, an event is already active.");
-        }
+    /**
+     * Start a pre-registered event, nested inside any currently active event
+     * @param event
+     */
+    inline void StartEvent(PetscLogEvent event) const {
+        PetscLogEventBegin(event, 0, 0, 0, 0) >> utilities::PetscUtilities::checkError;
+        activeEvents.push_back(event);
     }
 
+    /**
+     * Start an event by name, nested inside any currently active event
+     * @param eventName
+     */
+    inline void StartEvent(const char* eventName) const { StartEvent(RegisterEvent(eventName)); }
+
+    /**
+     * End the most recently started event
+     */
     inline void EndEvent() const {
-        if (activeEvent > 0) {
-            PetscLogEventEnd(activeEvent, 0, 0, 0, 0);
-            activeEvent = PETSC_DECIDE;
-        } else {
+        if (activeEvents.empty()) {
             throw std::runtime_error("Cannot End Event.  No active event.");
         }
+        PetscLogEventEnd(activeEvents.back(), 0, 0, 0, 0);
+        activeEvents.pop_back();
     }
 };
 };  // namespace ablate::utilities
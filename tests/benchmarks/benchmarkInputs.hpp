@@ -0,0 +1,35 @@
+#ifndef ABLATELIBRARY_BENCHMARKINPUTS_HPP
+#define ABLATELIBRARY_BENCHMARKINPUTS_HPP
+
+#include <filesystem>
+#include <random>
+#include <vector>
+
+namespace ablateBenchmarks {
+
+/**
+ * The benchmarks only use inputs (meshes, mechanisms, yaml files) shipped with the tests
+ * @return the path to the tests directory in the source tree
+ */
+inline std::filesystem::path TestDirectory() { return std::filesystem::path(ABLATE_TEST_DIRECTORY); }
+
+/**
+ * Create a list of uniformly distributed values.  The generator is seeded so each run uses the same values.
+ * @param size
+ * @param min
+ * @param max
+ * @param seed
+ * @return
+ */
+inline std::vector<double> RandomValues(std::size_t size, double min, double max, unsigned int seed) {
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> distribution(min, max);
+    std::vector<double> values(size);
+    for (auto& value : values) {
+        value = distribution(generator);
+    }
+    return values;
+}
+
+}  // namespace ablateBenchmarks
+#endif  // ABLATELIBRARY_BENCHMARKINPUTS_HPP
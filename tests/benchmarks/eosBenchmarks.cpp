@@ -0,0 +1,97 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <memory>
+#include "benchmarkInputs.hpp"
+#include "domain/field.hpp"
+#include "eos/perfectGas.hpp"
+#include "eos/tChem.hpp"
+#include "parameters/mapParameters.hpp"
+
+/**
+ * Create a simple sol field at the offset for the eos functions
+ */
+static ablate::domain::Field CreateField(const std::string& name, PetscInt numberComponents, PetscInt offset) {
+    return ablate::domain::Field{.name = name,
+                                 .numberComponents = numberComponents,
+                                 .components = {},
+                                 .id = -1,
+                                 .subId = PETSC_DEFAULT,
+                                 .offset = offset,
+                                 .location = ablate::domain::FieldLocation::SOL,
+                                 .type = ablate::domain::FieldType::FVM,
+                                 .tags = {}};
+}
+
+/**
+ * Evaluate the thermodynamic function for state.range(0) conserved states
+ * @param eos
+ * @param property
+ * @param massFractions the species mass fractions, only used when the eos has species
+ */
+static void BenchmarkThermodynamicFunction(benchmark::State& state, const std::shared_ptr<ablate::eos::EOS>& eos, ablate::eos::ThermodynamicProperty property,
+                                           const std::map<std::string, PetscReal>& massFractions) {
+    const auto size = (std::size_t)state.range(0);
+    const auto& species = eos->GetSpeciesVariables();
+    const auto numberSpecies = (PetscInt)species.size();
+
+    // build the fields, euler followed by densityYi
+    std::vector<ablate::domain::Field> fields = {CreateField("euler", 5, 0)};
+    if (numberSpecies) {
+        fields.push_back(CreateField("densityYi", numberSpecies, 5));
+    }
+    const std::size_t stride = 5 + numberSpecies;
+
+    // vary the density, energy, and velocity of each state
+    const auto density = ablateBenchmarks::RandomValues(size, 0.8, 1.6, 1);
+    const auto energy = ablateBenchmarks::RandomValues(size, 5E4, 2E5, 2);
+    const auto velocity = ablateBenchmarks::RandomValues(3 * size, -50.0, 50.0, 3);
+    std::vector<PetscReal> conserved(stride * size, 0.0);
+    for (std::size_t i = 0; i < size; ++i) {
+        auto values = conserved.data() + i * stride;
+        values[0] = density[i];
+        values[1] = density[i] * energy[i];
+        for (std::size_t d = 0; d < 3; ++d) {
+            values[2 + d] = density[i] * velocity[3 * i + d];
+        }
+        for (const auto& [speciesName, yi] : massFractions) {
+            auto speciesIndex = std::distance(species.begin(), std::find(species.begin(), species.end(), speciesName));
+            values[5 + speciesIndex] = density[i] * yi;
+        }
+    }
+
+    auto function = eos->GetThermodynamicFunction(property, fields);
+    std::vector<PetscReal> result(function.propertySize);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < size; ++i) {
+            function.function(conserved.data() + i * stride, result.data(), function.context.get());
+            benchmark::DoNotOptimize(result.data());
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed((int64_t)(state.iterations() * size));
+}
+
+static std::shared_ptr<ablate::eos::EOS> CreatePerfectGas() {
+    static auto eos = std::make_shared<ablate::eos::PerfectGas>(std::make_shared<ablate::parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.4"}}));
+    return eos;
+}
+
+static std::shared_ptr<ablate::eos::EOS> CreateTChem() {
+    static auto eos = std::make_shared<ablate::eos::TChem>(ablateBenchmarks::TestDirectory() / "unitTests" / "inputs" / "eos" / "gri30.yaml");
+    return eos;
+}
+
+static void BenchmarkPerfectGas(benchmark::State& state, ablate::eos::ThermodynamicProperty property) { BenchmarkThermodynamicFunction(state, CreatePerfectGas(), property, {}); }
+
+static void BenchmarkTChem(benchmark::State& state, ablate::eos::ThermodynamicProperty property) {
+    BenchmarkThermodynamicFunction(state, CreateTChem(), property, {{"CH4", .2}, {"O2", .3}, {"N2", .5}});
+}
+
+BENCHMARK_CAPTURE(BenchmarkPerfectGas, Pressure, ablate::eos::ThermodynamicProperty::Pressure)->Arg(10000);
+BENCHMARK_CAPTURE(BenchmarkPerfectGas, Temperature, ablate::eos::ThermodynamicProperty::Temperature)->Arg(10000);
+BENCHMARK_CAPTURE(BenchmarkPerfectGas, SpeedOfSound, ablate::eos::ThermodynamicProperty::SpeedOfSound)->Arg(10000);
+BENCHMARK_CAPTURE(BenchmarkTChem, Pressure, ablate::eos::ThermodynamicProperty::Pressure)->Arg(1000);
+BENCHMARK_CAPTURE(BenchmarkTChem, Temperature, ablate::eos::ThermodynamicProperty::Temperature)->Arg(1000);
+BENCHMARK_CAPTURE(BenchmarkTChem, SpeedOfSound, ablate::eos::ThermodynamicProperty::SpeedOfSound)->Arg(1000);
@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+#include <memory>
+#include "domain/boxMesh.hpp"
+#include "domain/modifiers/distributeWithGhostCells.hpp"
+#include "domain/modifiers/ghostBoundaryCells.hpp"
+#include "eos/perfectGas.hpp"
+#include "finiteVolume/boundaryConditions/essentialGhost.hpp"
+#include "finiteVolume/compressibleFlowFields.hpp"
+#include "finiteVolume/compressibleFlowSolver.hpp"
+#include "finiteVolume/fluxCalculator/ausm.hpp"
+#include "mathFunctions/functionFactory.hpp"
+#include "parameters/mapParameters.hpp"
+#include "solver/timeStepper.hpp"
+#include "utilities/petscUtilities.hpp"
+
+/**
+ * Evaluate the compressible flow (CellInterpolant) rhs on a 2D box mesh with state.range(0) cells in each direction
+ */
+static void BenchmarkCompressibleFlowRhs(benchmark::State& state) {
+    const auto faces = (int)state.range(0);
+    auto eos = std::make_shared<ablate::eos::PerfectGas>(std::make_shared<ablate::parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.4"}}));
+
+    std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>> fieldDescriptors = {std::make_shared<ablate::finiteVolume::CompressibleFlowFields>(eos)};
+    auto mesh = std::make_shared<ablate::domain::BoxMesh>(
+        "benchmarkMesh",
+        fieldDescriptors,
+        std::vector<std::shared_ptr<ablate::domain::modifiers::Modifier>>{std::make_shared<ablate::domain::modifiers::DistributeWithGhostCells>(),
+                                                                          std::make_shared<ablate::domain::modifiers::GhostBoundaryCells>()},
+        std::vector<int>{faces, faces},
+        std::vector<double>{0.0, 0.0},
+        std::vector<double>{.01, .01},
+        std::vector<std::string>{} /*boundary*/,
+        false /*simplex*/,
+        ablate::parameters::MapParameters::Create({{"dm_plex_separate_marker", ""}}));
+
+    // use a smoothly varying flow so each face has a different state
+    auto eulerField = std::make_shared<ablate::mathFunctions::FieldFunction>(ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD,
+                                                                             ablate::mathFunctions::Create("1.2, 240000 + 1000*sin(2*_pi*x/.01), 12*sin(2*_pi*y/.01), 12*cos(2*_pi*x/.01)"));
+
+    // create a time stepper that only initializes the flow
+    auto timeStepper = ablate::solver::TimeStepper(mesh, ablate::parameters::MapParameters::Create({{"ts_max_steps", 0}}), {}, std::make_shared<ablate::domain::Initializer>(eulerField));
+
+    auto flowObject = std::make_shared<ablate::finiteVolume::CompressibleFlowSolver>(
+        "benchmarkFlow",
+        ablate::domain::Region::ENTIREDOMAIN,
+        nullptr /*options*/,
+        eos,
+        std::make_shared<ablate::parameters::MapParameters>(std::map<std::string, std::string>{{"cfl", "0.5"}}),
+        nullptr /*transportModel*/,
+        std::make_shared<ablate::finiteVolume::fluxCalculator::Ausm>(),
+        std::vector<std::shared_ptr<ablate::finiteVolume::boundaryConditions::BoundaryCondition>>{
+            std::make_shared<ablate::finiteVolume::boundaryConditions::EssentialGhost>("walls", std::vector<int>{1, 2, 3, 4}, eulerField)});
+    timeStepper.Register(flowObject);
+    timeStepper.Solve();
+
+    // prepare the local solution vector once
+    DM dm = mesh->GetDM();
+    Vec locX, locF;
+    DMGetLocalVector(dm, &locX) >> ablate::utilities::PetscUtilities::checkError;
+    DMGetLocalVector(dm, &locF) >> ablate::utilities::PetscUtilities::checkError;
+    DMGlobalToLocal(dm, mesh->GetSolutionVector(), INSERT_VALUES, locX) >> ablate::utilities::PetscUtilities::checkError;
+    flowObject->ComputeBoundary(0.0, locX, nullptr) >> ablate::utilities::PetscUtilities::checkError;
+    flowObject->PreRHSFunction(timeStepper.GetTS(), 0.0, true, locX) >> ablate::utilities::PetscUtilities::checkError;
+
+    for (auto _ : state) {
+        VecZeroEntries(locF) >> ablate::utilities::PetscUtilities::checkError;
+        flowObject->ComputeRHSFunction(0.0, locX, locF) >> ablate::utilities::PetscUtilities::checkError;
+    }
+    state.SetItemsProcessed((int64_t)(state.iterations() * faces * faces));
+
+    DMRestoreLocalVector(dm, &locX) >> ablate::utilities::PetscUtilities::checkError;
+    DMRestoreLocalVector(dm, &locF) >> ablate::utilities::PetscUtilities::checkError;
+}
+
+BENCHMARK(BenchmarkCompressibleFlowRhs)->Arg(32)->Arg(64)->Arg(128)->Unit(benchmark::kMillisecond);
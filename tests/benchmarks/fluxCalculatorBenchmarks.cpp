@@ -0,0 +1,57 @@
+#include <benchmark/benchmark.h>
+#include <functional>
+#include <memory>
+#include "benchmarkInputs.hpp"
+#include "eos/perfectGas.hpp"
+#include "finiteVolume/fluxCalculator/ausm.hpp"
+#include "finiteVolume/fluxCalculator/ausmpUp.hpp"
+#include "finiteVolume/fluxCalculator/riemann.hpp"
+#include "finiteVolume/fluxCalculator/riemannStiff.hpp"
+#include "parameters/mapParameters.hpp"
+
+using FluxCalculatorFactory = std::function<std::shared_ptr<ablate::finiteVolume::fluxCalculator::FluxCalculator>()>;
+
+static std::shared_ptr<ablate::eos::EOS> CreatePerfectGas() {
+    return std::make_shared<ablate::eos::PerfectGas>(std::make_shared<ablate::parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.4"}}));
+}
+
+/**
+ * Evaluate the flux calculator for state.range(0) left/right face states
+ */
+static void BenchmarkFluxCalculator(benchmark::State& state, const FluxCalculatorFactory& factory) {
+    const auto size = (std::size_t)state.range(0);
+    auto fluxCalculator = factory();
+    auto function = fluxCalculator->GetFluxCalculatorFunction();
+    auto context = fluxCalculator->GetFluxCalculatorContext();
+
+    // create consistent perfect gas states on each side of the faces
+    const auto uL = ablateBenchmarks::RandomValues(size, -500.0, 500.0, 1);
+    const auto rhoL = ablateBenchmarks::RandomValues(size, 0.5, 7.0, 2);
+    const auto pL = ablateBenchmarks::RandomValues(size, 1E4, 4E5, 3);
+    const auto uR = ablateBenchmarks::RandomValues(size, -500.0, 500.0, 4);
+    const auto rhoR = ablateBenchmarks::RandomValues(size, 0.5, 7.0, 5);
+    const auto pR = ablateBenchmarks::RandomValues(size, 1E4, 4E5, 6);
+    std::vector<PetscReal> aL(size), aR(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        aL[i] = PetscSqrtReal(1.4 * pL[i] / rhoL[i]);
+        aR[i] = PetscSqrtReal(1.4 * pR[i] / rhoR[i]);
+    }
+
+    PetscReal massFlux;
+    PetscReal pressureFace;
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < size; ++i) {
+            benchmark::DoNotOptimize(function(context, uL[i], aL[i], rhoL[i], pL[i], uR[i], aR[i], rhoR[i], pR[i], &massFlux, &pressureFace));
+            benchmark::DoNotOptimize(massFlux);
+            benchmark::DoNotOptimize(pressureFace);
+        }
+    }
+    state.SetItemsProcessed((int64_t)(state.iterations() * size));
+}
+
+BENCHMARK_CAPTURE(BenchmarkFluxCalculator, Ausm, []() { return std::make_shared<ablate::finiteVolume::fluxCalculator::Ausm>(); })->Arg(10000);
+BENCHMARK_CAPTURE(BenchmarkFluxCalculator, AusmpUp, []() { return std::make_shared<ablate::finiteVolume::fluxCalculator::AusmpUp>(.3); })->Arg(10000);
+BENCHMARK_CAPTURE(BenchmarkFluxCalculator, Riemann, []() { return std::make_shared<ablate::finiteVolume::fluxCalculator::Riemann>(CreatePerfectGas()); })->Arg(10000);
+BENCHMARK_CAPTURE(BenchmarkFluxCalculator, RiemannStiff, []() {
+    return std::make_shared<ablate::finiteVolume::fluxCalculator::RiemannStiff>(CreatePerfectGas(), CreatePerfectGas());
+})->Arg(10000);
@@ -0,0 +1,18 @@
+#include <benchmark/benchmark.h>
+#include "environment/runEnvironment.hpp"
+#include "utilities/petscUtilities.hpp"
+
+int main(int argc, char** argv) {
+    // remove the benchmark arguments before they are passed to petsc
+    ::benchmark::Initialize(&argc, argv);
+
+    // initialize petsc and mpi
+    ablate::environment::RunEnvironment::Initialize(&argc, &argv);
+    ablate::utilities::PetscUtilities::Initialize();
+
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+
+    ablate::environment::RunEnvironment::Finalize();
+    return 0;
+}
@@ -0,0 +1,45 @@
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <memory>
+#include "benchmarkInputs.hpp"
+#include "builder.hpp"
+#include "environment/runEnvironment.hpp"
+#include "parameters/mapParameters.hpp"
+#include "solver/timeStepper.hpp"
+#include "yamlParser.hpp"
+
+/**
+ * Run a fixed number of time steps for an integration test input.  Only the Solve (initialization and time stepping) is timed.
+ * @param inputPath the input relative to the integration test inputs
+ * @param maxSteps the number of time steps to take
+ */
+static void BenchmarkSimulation(benchmark::State& state, const std::filesystem::path& inputPath, const std::string& maxSteps) {
+    const auto inputFile = ablateBenchmarks::TestDirectory() / "integrationTests" / "inputs" / inputPath;
+    const auto outputDirectory = std::filesystem::temp_directory_path() / "ablateBenchmarks" / inputFile.stem();
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        // write any output to a temporary directory
+        ablate::parameters::MapParameters runEnvironmentParameters(std::map<std::string, std::string>{{"directory", outputDirectory}, {"tagDirectory", "false"}});
+        ablate::environment::RunEnvironment::Setup(runEnvironmentParameters, inputFile);
+
+        auto parser = std::make_shared<cppParser::YamlParser>(inputFile, std::map<std::string, std::string>{{"timestepper::arguments::ts_max_steps", maxSteps}});
+        auto timeStepper = ablate::Builder::Build(parser);
+        state.ResumeTiming();
+
+        timeStepper->Solve();
+
+        state.PauseTiming();
+        timeStepper.reset();
+        state.ResumeTiming();
+    }
+}
+
+// TChem batch chemistry with the gri30 mechanism on a box mesh
+BENCHMARK_CAPTURE(BenchmarkSimulation, TChemReactingFlow, "reactingFlow/simpleReactingFlow.yaml", "5")->Iterations(3)->Unit(benchmark::kMillisecond);
+
+// radiation setup (ray tracing) and gain evaluation
+BENCHMARK_CAPTURE(BenchmarkSimulation, ParallelPlatesRadiation, "radiation/parallelPlatesRadiation.yaml", "1")->Iterations(3)->Unit(benchmark::kMillisecond);
+
+// particle interpolation from the flow field
+BENCHMARK_CAPTURE(BenchmarkSimulation, TracerParticles3D, "particles/tracerParticles3D.yaml", "5")->Iterations(3)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,158 @@
+#include <algorithm>
+#include <filesystem>
+#include <functional>
+#include "boundarySolver/physics/subModels/batchedOneDimensionHeatTransfer.hpp"
+#include "boundarySolver/physics/subModels/oneDimensionHeatTransfer.hpp"
+#include "gtest/gtest.h"
+#include "mathFunctions/functionFactory.hpp"
+#include "parameters/mapParameters.hpp"
+#include "petscTestFixture.hpp"
+
+struct BatchedOneDimensionHeatTransferTestParameters {
+    // Creation options
+    const std::shared_ptr<ablate::parameters::MapParameters> properties;
+    const std::shared_ptr<ablate::parameters::MapParameters> options;
+    std::optional<double> maximumSurfaceTemperature;
+
+    // the initial temperature profile
+    std::function<std::shared_ptr<ablate::mathFunctions::MathFunction>()> initializationFactory;
+
+    // the heat flux applied during each solve
+    std::vector<PetscReal> heatFluxToSurface;
+
+    // the time for each solve
+    PetscReal dt;
+
+    // comparisons
+    PetscReal relativeTolerance;
+};
+
+class BatchedOneDimensionHeatTransferTestFixture : public testingResources::PetscTestFixture, public ::testing::WithParamInterface<BatchedOneDimensionHeatTransferTestParameters> {};
+
+TEST_P(BatchedOneDimensionHeatTransferTestFixture, ShouldMatchSingleFaceSolver) {
+    // get the required variables
+    const auto& params = GetParam();
+    auto initialization = params.initializationFactory();
+
+    // Create the reference single face solver and a batch with multiple faces
+    auto singleFace = std::make_shared<ablate::boundarySolver::physics::subModels::OneDimensionHeatTransfer>(
+        "test", params.properties, initialization, params.options, params.maximumSurfaceTemperature.value_or(PETSC_DEFAULT));
+    auto batched = std::make_shared<ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer>(
+        "test", params.properties, initialization, std::vector<PetscInt>{4, 12, 7}, params.options, params.maximumSurfaceTemperature.value_or(PETSC_DEFAULT));
+    ASSERT_EQ(3, batched->GetNumberFaces());
+
+    // the initial surface temperature should match
+    PetscReal expectedSurfaceTemperature, computedSurfaceTemperature;
+    singleFace->GetSurfaceTemperature(expectedSurfaceTemperature) >> ablate::utilities::PetscUtilities::checkError;
+    batched->GetSurfaceTemperature(12, computedSurfaceTemperature) >> ablate::utilities::PetscUtilities::checkError;
+    ASSERT_NEAR(expectedSurfaceTemperature, computedSurfaceTemperature, 1E-8 * PetscMax(1.0, PetscAbsReal(expectedSurfaceTemperature)));
+
+    // March in time with each heat flux
+    for (const auto& heatFluxToSurface : params.heatFluxToSurface) {
+        PetscReal expectedHeatFlux;
+        singleFace->Solve(heatFluxToSurface, params.dt, expectedSurfaceTemperature, expectedHeatFlux) >> ablate::utilities::PetscUtilities::checkError;
+
+        // solve every face in the batch with the same heat flux
+        for (const auto& faceId : {4, 12, 7}) {
+            PetscReal surfaceTemperature, computedHeatFlux;
+            batched->Solve(faceId, heatFluxToSurface, params.dt, surfaceTemperature, computedHeatFlux) >> ablate::utilities::PetscUtilities::checkError;
+
+            // assert
+            ASSERT_NEAR(expectedSurfaceTemperature, surfaceTemperature, params.relativeTolerance * PetscAbsReal(expectedSurfaceTemperature)) << "surface temperature for face " << faceId;
+            ASSERT_NEAR(expectedHeatFlux, computedHeatFlux, params.relativeTolerance * PetscMax(PetscAbsReal(expectedHeatFlux), PetscAbsReal(heatFluxToSurface)) + 1E-8)
+                << "heat flux for face " << faceId;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(SolidHeatTransfer, BatchedOneDimensionHeatTransferTestFixture,
+                         testing::Values(
+                             // heating without a maximum temperature
+                             (BatchedOneDimensionHeatTransferTestParameters){
+                                 .properties = ablate::parameters::MapParameters::Create({{"specificHeat", 1000.0}, {"conductivity", 1.0}, {"density", 1.0}}),
+                                 .options = ablate::parameters::MapParameters::Create({{"ts_dt", "1E-4"}, {"dm_plex_box_upper", .1}, {"dm_plex_box_faces", 20}, {"ts_adapt_type", "none"}}),
+                                 .maximumSurfaceTemperature = {},
+                                 .initializationFactory = []() { return ablate::mathFunctions::Create("300.0"); },
+                                 .heatFluxToSurface = {1E5, 5E4, 0.0, 2E5},
+                                 .dt = 2.5E-4,
+                                 .relativeTolerance = 1E-6},
+                             // heating up to a maximum surface temperature
+                             (BatchedOneDimensionHeatTransferTestParameters){
+                                 .properties = ablate::parameters::MapParameters::Create({{"specificHeat", 1000.0}, {"conductivity", .25}, {"density", 0.7}}),
+                                 .options = ablate::parameters::MapParameters::Create({{"ts_dt", "0.001"}, {"dm_plex_box_upper", .25}, {"dm_plex_box_faces", 30}, {"ts_adapt_type", "none"}}),
+                                 .maximumSurfaceTemperature = 400.0,
+                                 .initializationFactory = []() { return ablate::mathFunctions::Create("300.0 + 100*x"); },
+                                 .heatFluxToSurface = {5E4, 1E5, 1E5, 1E3, 1E5},
+                                 .dt = 0.0025,
+                                 .relativeTolerance = 1E-6},
+                             // the single face solver with its default adaptive time stepping (the batched model always uses the ts_dt sub steps)
+                             (BatchedOneDimensionHeatTransferTestParameters){
+                                 .properties = ablate::parameters::MapParameters::Create({{"specificHeat", 1000.0}, {"conductivity", 1.0}, {"density", 1.0}}),
+                                 .options = ablate::parameters::MapParameters::Create({{"ts_dt", "1E-4"}, {"dm_plex_box_upper", .1}, {"dm_plex_box_faces", 20}}),
+                                 .maximumSurfaceTemperature = {},
+                                 .initializationFactory = []() { return ablate::mathFunctions::Create("300.0"); },
+                                 .heatFluxToSurface = {1E5, 5E4, 0.0, 2E5},
+                                 .dt = 2.5E-4,
+                                 .relativeTolerance = 5E-3},
+                             (BatchedOneDimensionHeatTransferTestParameters){
+                                 .properties = ablate::parameters::MapParameters::Create({{"specificHeat", 1000.0}, {"conductivity", .25}, {"density", 0.7}}),
+                                 .options = ablate::parameters::MapParameters::Create({{"ts_dt", "0.001"}, {"dm_plex_box_upper", .25}, {"dm_plex_box_faces", 30}, {"ts_adapt_type", "basic"}}),
+                                 .maximumSurfaceTemperature = 400.0,
+                                 .initializationFactory = []() { return ablate::mathFunctions::Create("300.0 + 100*x"); },
+                                 .heatFluxToSurface = {5E4, 1E5, 1E5, 1E3, 1E5},
+                                 .dt = 0.0025,
+                                 .relativeTolerance = 5E-3}),
+                         [](const testing::TestParamInfo<BatchedOneDimensionHeatTransferTestParameters>& info) { return std::to_string(info.index); });
+
+class BatchedOneDimensionHeatTransferRestoreTestFixture : public testingResources::PetscTestFixture {};
+
+TEST_F(BatchedOneDimensionHeatTransferRestoreTestFixture, ShouldRestoreLegacyPerFaceCheckpoint) {
+    // arrange
+    auto properties = ablate::parameters::MapParameters::Create({{"specificHeat", 1000.0}, {"conductivity", 1.0}, {"density", 1.0}});
+    auto options = ablate::parameters::MapParameters::Create({{"ts_dt", "1E-4"}, {"dm_plex_box_upper", .1}, {"dm_plex_box_faces", 20}, {"ts_adapt_type", "none"}});
+    auto initialization = ablate::mathFunctions::Create("300.0");
+    const std::map<PetscInt, PetscReal> heatFluxToSurface = {{4, 1E5}, {12, 3E4}};
+    const PetscInt sequenceNumber = 3;
+    const PetscReal restoreTime = 0.5;
+    auto checkpointPath = std::filesystem::temp_directory_path() / "batchedOneDimensionHeatTransferLegacy.h5";
+
+    // write a checkpoint with a separate model for each face, named using the legacy prefix + faceId
+    std::map<PetscInt, std::shared_ptr<ablate::boundarySolver::physics::subModels::OneDimensionHeatTransfer>> perFaceModels;
+    PetscViewer viewer;
+    PetscViewerHDF5Open(PETSC_COMM_SELF, checkpointPath.c_str(), FILE_MODE_WRITE, &viewer) >> ablate::utilities::PetscUtilities::checkError;
+    for (const auto& [faceId, heatFlux] : heatFluxToSurface) {
+        auto perFaceModel = std::make_shared<ablate::boundarySolver::physics::subModels::OneDimensionHeatTransfer>("0-" + std::to_string(faceId), properties, initialization, options);
+        PetscReal surfaceTemperature, computedHeatFlux;
+        perFaceModel->Solve(heatFlux, 5E-4, surfaceTemperature, computedHeatFlux) >> ablate::utilities::PetscUtilities::checkError;
+        perFaceModel->Save(viewer, sequenceNumber, restoreTime) >> ablate::utilities::PetscUtilities::checkError;
+        perFaceModels[faceId] = perFaceModel;
+    }
+    PetscViewerDestroy(&viewer) >> ablate::utilities::PetscUtilities::checkError;
+
+    // act
+    auto batched = std::make_shared<ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer>(
+        "oneDimensionHeatTransfer-0", properties, initialization, std::vector<PetscInt>{4, 12}, options, PETSC_DEFAULT, "0-");
+    PetscViewerHDF5Open(PETSC_COMM_SELF, checkpointPath.c_str(), FILE_MODE_READ, &viewer) >> ablate::utilities::PetscUtilities::checkError;
+    batched->Restore(viewer, sequenceNumber, restoreTime) >> ablate::utilities::PetscUtilities::checkError;
+    PetscViewerDestroy(&viewer) >> ablate::utilities::PetscUtilities::checkError;
+    std::filesystem::remove(checkpointPath);
+
+    // assert
+    for (const auto& [faceId, perFaceModel] : perFaceModels) {
+        std::vector<PetscReal> coordinates, temperatures;
+        perFaceModel->GetNodeTemperatures(coordinates, temperatures) >> ablate::utilities::PetscUtilities::checkError;
+        ASSERT_EQ((PetscInt)temperatures.size(), batched->GetNumberNodes());
+
+        const PetscReal* profile = batched->GetProfile(faceId);
+        const PetscReal dx = *std::max_element(coordinates.begin(), coordinates.end()) / (batched->GetNumberNodes() - 1);
+        for (std::size_t n = 0; n < temperatures.size(); ++n) {
+            ASSERT_NEAR(temperatures[n], profile[(PetscInt)PetscRoundReal(coordinates[n] / dx)], 1E-10 * temperatures[n]) << "node at " << coordinates[n] << " for face " << faceId;
+        }
+
+        // the restored faces continue to follow the per-face model
+        PetscReal expectedSurfaceTemperature, expectedHeatFlux, surfaceTemperature, computedHeatFlux;
+        perFaceModel->Solve(heatFluxToSurface.at(faceId), 5E-4, expectedSurfaceTemperature, expectedHeatFlux) >> ablate::utilities::PetscUtilities::checkError;
+        batched->Solve(faceId, heatFluxToSurface.at(faceId), 5E-4, surfaceTemperature, computedHeatFlux) >> ablate::utilities::PetscUtilities::checkError;
+        ASSERT_NEAR(expectedSurfaceTemperature, surfaceTemperature, 1E-6 * expectedSurfaceTemperature) << "surface temperature for face " << faceId;
+    }
+}
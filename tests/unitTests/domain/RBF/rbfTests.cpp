@@ -695,6 +695,99 @@ INSTANTIATE_TEST_SUITE_P(
                                                 .maxError = {1e-15, 8e-06, 2.0e-03, 2.1e-05, 4e-04, 2.0e-03, 2.2e-05, 4.0e-04, 3e-04, 1.6e-03}}),
     [](const testing::TestParamInfo<RBFParameters_DerivativeInterpolation> &info) { return info.param.mpiTestParameter.getTestName(); });
 
+class RBFTestFixture_DerivativeOperator : public testingResources::MpiTestFixture, public ::testing::WithParamInterface<RBFParameters_DerivativeInterpolation> {
+   public:
+    void SetUp() override { SetMpiParameters(GetParam().mpiTestParameter); }
+};
+
+// This tests that the assembled derivative operator matches the single-cell derivatives
+TEST_P(RBFTestFixture_DerivativeOperator, ShouldMatchSingleCellDerivatives) {
+    StartWithMPI
+        // initialize petsc and mpi
+        environment::RunEnvironment::Initialize(argc, argv);
+        utilities::PetscUtilities::Initialize();
+        auto testingParam = GetParam();
+        std::vector<std::shared_ptr<domain::rbf::RBF>> rbfList = testingParam.rbfList;
+
+        // Make the field
+        std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>> fieldDescriptor = {
+            std::make_shared<ablate::domain::FieldDescription>("fieldA", "", ablate::domain::FieldDescription::ONECOMPONENT, ablate::domain::FieldLocation::AUX, ablate::domain::FieldType::FVM)};
+
+        // Create the mesh
+        auto mesh = std::make_shared<domain::BoxMesh>("mesh",
+                                                      fieldDescriptor,
+                                                      std::vector<std::shared_ptr<domain::modifiers::Modifier>>{std::make_shared<domain::modifiers::DistributeWithGhostCells>(3)},
+                                                      testingParam.meshFaces,
+                                                      testingParam.meshStart,
+                                                      testingParam.meshEnd,
+                                                      std::vector<std::string>{},
+                                                      testingParam.meshSimplex);
+
+        mesh->InitializeSubDomains();
+
+        std::shared_ptr<ablate::domain::SubDomain> subDomain = mesh->GetSubDomain(domain::Region::ENTIREDOMAIN);
+        const ablate::domain::Field *field = &(subDomain->GetField("fieldA"));
+
+        ablate::domain::Range cellRange;
+        subDomain->GetCellRange(nullptr, cellRange);
+        for (auto &rbf : rbfList) {
+            rbf->Setup(subDomain);
+            rbf->Initialize();
+        }
+
+        RBFTestFixture_SetData(cellRange, field, subDomain);
+
+        for (std::size_t i = 0; i < testingParam.dx.size(); ++i) {
+            for (auto &rbf : rbfList) {
+                // act
+                Vec derivative;
+                MatCreateVecs(rbf->GetDerivativeOperator(field, testingParam.dx[i], testingParam.dy[i], testingParam.dz[i]), nullptr, &derivative) >> utilities::PetscUtilities::checkError;
+                rbf->EvalDer(field, subDomain->GetVec(*field), testingParam.dx[i], testingParam.dy[i], testingParam.dz[i], derivative);
+
+                // assert
+                const PetscScalar *derivativeArray;
+                VecGetArrayRead(derivative, &derivativeArray) >> utilities::PetscUtilities::checkError;
+                for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+                    PetscReal expected = rbf->EvalDer(field, c, testingParam.dx[i], testingParam.dy[i], testingParam.dz[i]);
+                    EXPECT_NEAR(expected, derivativeArray[c - cellRange.start], 1E-10 * PetscMax(1.0, PetscAbsReal(expected)))
+                        << "RBF: " << rbf->type() << ", dx: " << testingParam.dx[i] << ", dy:" << testingParam.dy[i] << ", dz: " << testingParam.dz[i] << " at cell " << c;
+                }
+                VecRestoreArrayRead(derivative, &derivativeArray) >> utilities::PetscUtilities::checkError;
+                VecDestroy(&derivative) >> utilities::PetscUtilities::checkError;
+            }
+        }
+
+        subDomain->RestoreRange(cellRange);
+    EndWithMPI
+}
+
+INSTANTIATE_TEST_SUITE_P(MeshTests, RBFTestFixture_DerivativeOperator,
+                         testing::Values((RBFParameters_DerivativeInterpolation){.mpiTestParameter = testingResources::MpiTestParameter("Operator_2DQuadN21_1Proc"),
+                                                                                 .meshFaces = {21, 21},
+                                                                                 .meshStart = {-1.0, -1.0},
+                                                                                 .meshEnd = {1.0, 1.0},
+                                                                                 .meshSimplex = false,
+                                                                                 .rbfList = {std::make_shared<ablate::domain::rbf::PHS>(4, 2, false, false)},
+                                                                                 .dx = {0, 1, 2, 0, 1, 0},
+                                                                                 .dy = {0, 0, 0, 1, 1, 2},
+                                                                                 .dz = {0, 0, 0, 0, 0, 0},
+                                                                                 .cell = -1,
+                                                                                 .x = {},
+                                                                                 .maxError = {}},
+                                         (RBFParameters_DerivativeInterpolation){.mpiTestParameter = testingResources::MpiTestParameter("Operator_2DTriN21_2Proc", 2),
+                                                                                 .meshFaces = {21, 21},
+                                                                                 .meshStart = {-1.0, -1.0},
+                                                                                 .meshEnd = {1.0, 1.0},
+                                                                                 .meshSimplex = true,
+                                                                                 .rbfList = {std::make_shared<ablate::domain::rbf::PHS>(4, 2, false, false)},
+                                                                                 .dx = {1, 0, 1},
+                                                                                 .dy = {0, 1, 1},
+                                                                                 .dz = {0, 0, 0},
+                                                                                 .cell = -1,
+                                                                                 .x = {},
+                                                                                 .maxError = {}}),
+                         [](const testing::TestParamInfo<RBFParameters_DerivativeInterpolation> &info) { return info.param.mpiTestParameter.getTestName(); });
+
 class RBFTestFixture_Interpolation : public testingResources::MpiTestFixture, public ::testing::WithParamInterface<RBFParameters_DerivativeInterpolation> {
    public:
     void SetUp() override { SetMpiParameters(GetParam().mpiTestParameter); }
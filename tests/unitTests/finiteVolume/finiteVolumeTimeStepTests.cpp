@@ -0,0 +1,192 @@
+#include <petsc.h>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "domain/boxMesh.hpp"
+#include "domain/modifiers/distributeWithGhostCells.hpp"
+#include "domain/modifiers/ghostBoundaryCells.hpp"
+#include "environment/runEnvironment.hpp"
+#include "eos/perfectGas.hpp"
+#include "eos/transport/constant.hpp"
+#include "finiteVolume/compressibleFlowFields.hpp"
+#include "finiteVolume/compressibleFlowSolver.hpp"
+#include "finiteVolume/fieldFunctions/compressibleFlowState.hpp"
+#include "finiteVolume/fieldFunctions/euler.hpp"
+#include "finiteVolume/fluxCalculator/ausm.hpp"
+#include "gtest/gtest.h"
+#include "mathFunctions/functionFactory.hpp"
+#include "mpiTestFixture.hpp"
+#include "parameters/mapParameters.hpp"
+#include "petscTestErrorChecker.hpp"
+#include "utilities/constants.hpp"
+#include "utilities/mpiUtilities.hpp"
+#include "utilities/petscUtilities.hpp"
+
+using namespace ablate;
+
+class FiniteVolumeTimeStepTestFixture : public testingResources::MpiTestFixture, public ::testing::WithParamInterface<testingResources::MpiTestParameter> {
+   public:
+    void SetUp() override { SetMpiParameters(GetParam()); }
+};
+
+/**
+ * Compute the cfl, conduction, and viscous time steps with a separate march over the cells for each constraint, as the time step functions did before
+ * they were fused into a single pass
+ */
+static std::map<std::string, PetscReal> ComputeSeparateTimeSteps(TS ts, finiteVolume::FiniteVolumeSolver& flow, eos::EOS& eos, eos::transport::TransportModel& transport, PetscReal cfl,
+                                                                 PetscReal conductionStabilityFactor, PetscReal viscousStabilityFactor) {
+    DM dm;
+    TSGetDM(ts, &dm) >> testErrorChecker;
+    Vec v;
+    TSGetSolution(ts, &v) >> testErrorChecker;
+    PetscInt dim;
+    DMGetDimension(dm, &dim) >> testErrorChecker;
+
+    const auto& fields = flow.GetSubDomain().GetFields();
+    auto computeTemperature = eos.GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::Temperature, fields);
+    auto computeSpeedOfSound = eos.GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::SpeedOfSound, fields);
+    auto computeCv = eos.GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::SpecificHeatConstantVolume, fields);
+    auto computeDensity = eos.GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::Density, fields);
+    auto computeK = transport.GetTransportTemperatureFunction(eos::transport::TransportProperty::Conductivity, fields);
+    auto computeMu = transport.GetTransportTemperatureFunction(eos::transport::TransportProperty::Viscosity, fields);
+
+    DM characteristicsDm;
+    Vec characteristicsVec;
+    flow.GetMeshCharacteristics(characteristicsDm, characteristicsVec);
+    const PetscScalar* characteristicsArray;
+    VecGetArrayRead(characteristicsVec, &characteristicsArray) >> testErrorChecker;
+
+    const PetscScalar* x;
+    VecGetArrayRead(v, &x) >> testErrorChecker;
+    const DM auxDM = flow.GetSubDomain().GetAuxDM();
+    const PetscScalar* auxArray;
+    VecGetArrayRead(flow.GetSubDomain().GetAuxGlobalVector(), &auxArray) >> testErrorChecker;
+    const auto eulerId = flow.GetSubDomain().GetField(finiteVolume::CompressibleFlowFields::EULER_FIELD).id;
+    const auto temperatureId = flow.GetSubDomain().GetField(finiteVolume::CompressibleFlowFields::TEMPERATURE_FIELD).id;
+
+    ablate::domain::Range cellRange;
+    flow.GetCellRangeWithoutGhost(cellRange);
+
+    // each constraint marches over the cells separately
+    std::vector<std::string> names = {"cfl", "cond", "visc"};
+    std::vector<PetscReal> dtLocal(names.size(), ablate::utilities::Constants::large);
+    for (std::size_t n = 0; n < names.size(); ++n) {
+        for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+            const PetscInt cell = cellRange.GetPoint(c);
+            const PetscScalar* conserved = nullptr;
+            DMPlexPointGlobalRead(dm, cell, x, &conserved) >> testErrorChecker;
+            if (!conserved) {
+                continue;
+            }
+            const PetscScalar* euler = nullptr;
+            DMPlexPointGlobalFieldRead(dm, cell, eulerId, x, &euler) >> testErrorChecker;
+            const PetscScalar* temperature = nullptr;
+            DMPlexPointLocalFieldRead(auxDM, cell, temperatureId, auxArray, &temperature) >> testErrorChecker;
+            const PetscReal* cellCharacteristics = nullptr;
+            DMPlexPointLocalRead(characteristicsDm, cell, characteristicsArray, &cellCharacteristics) >> testErrorChecker;
+            const PetscReal dx = 2.0 * cellCharacteristics[finiteVolume::FiniteVolumeSolver::MIN_CELL_RADIUS];
+
+            PetscReal dt;
+            if (names[n] == "cfl") {
+                const PetscReal rho = euler[finiteVolume::CompressibleFlowFields::RHO];
+                PetscReal decodedTemperature, a;
+                computeTemperature.function(conserved, 300, &decodedTemperature, computeTemperature.context.get()) >> testErrorChecker;
+                computeSpeedOfSound.function(conserved, decodedTemperature, &a, computeSpeedOfSound.context.get()) >> testErrorChecker;
+                PetscReal velSum = 0.0;
+                for (PetscInt d = 0; d < dim; d++) {
+                    velSum += PetscAbsReal(euler[finiteVolume::CompressibleFlowFields::RHOU + d]) / rho;
+                }
+                dt = cfl * dx / (a + velSum);
+            } else if (names[n] == "cond") {
+                PetscReal k, cv, rho;
+                computeK.function(conserved, *temperature, &k, computeK.context.get()) >> testErrorChecker;
+                computeCv.function(conserved, *temperature, &cv, computeCv.context.get()) >> testErrorChecker;
+                computeDensity.function(conserved, *temperature, &rho, computeDensity.context.get()) >> testErrorChecker;
+                dt = PetscAbs(conductionStabilityFactor * PetscSqr(dx) / (k / (rho * cv)));
+            } else {
+                PetscReal mu, rho;
+                computeMu.function(conserved, *temperature, &mu, computeMu.context.get()) >> testErrorChecker;
+                computeDensity.function(conserved, *temperature, &rho, computeDensity.context.get()) >> testErrorChecker;
+                dt = PetscAbs(viscousStabilityFactor * PetscSqr(dx) / (mu / rho));
+            }
+            dtLocal[n] = PetscMin(dtLocal[n], dt);
+        }
+    }
+    flow.RestoreRange(cellRange);
+    VecRestoreArrayRead(flow.GetSubDomain().GetAuxGlobalVector(), &auxArray) >> testErrorChecker;
+    VecRestoreArrayRead(v, &x) >> testErrorChecker;
+    VecRestoreArrayRead(characteristicsVec, &characteristicsArray) >> testErrorChecker;
+
+    // the time steps are only reduced to the root
+    std::vector<PetscReal> dtGlobal(names.size());
+    MPI_Reduce(dtLocal.data(), dtGlobal.data(), (PetscMPIInt)dtLocal.size(), MPIU_REAL, MPI_MIN, 0, PetscObjectComm((PetscObject)ts)) >> ablate::utilities::MpiUtilities::checkError;
+    std::map<std::string, PetscReal> timeSteps;
+    for (std::size_t n = 0; n < names.size(); ++n) {
+        timeSteps[names[n]] = dtGlobal[n];
+    }
+    return timeSteps;
+}
+
+TEST_P(FiniteVolumeTimeStepTestFixture, ShouldReproduceSeparateTimeStepFunctions) {
+    StartWithMPI
+        {
+            // initialize petsc and mpi
+            ablate::environment::RunEnvironment::Initialize(argc, argv);
+            ablate::utilities::PetscUtilities::Initialize();
+
+            // arrange
+            const PetscReal cfl = 0.5;
+            const PetscReal conductionStabilityFactor = 0.25;
+            const PetscReal viscousStabilityFactor = 0.3;
+            auto eos = std::make_shared<eos::PerfectGas>(std::make_shared<parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.4"}, {"Rgas", "287"}}));
+            auto transport = std::make_shared<eos::transport::Constant>(0.5, 1E-3);
+
+            std::vector<std::shared_ptr<domain::FieldDescriptor>> fieldDescriptors = {std::make_shared<finiteVolume::CompressibleFlowFields>(eos)};
+            auto mesh = std::make_shared<domain::BoxMesh>("mesh",
+                                                          fieldDescriptors,
+                                                          std::vector<std::shared_ptr<domain::modifiers::Modifier>>{std::make_shared<domain::modifiers::DistributeWithGhostCells>(),
+                                                                                                                    std::make_shared<domain::modifiers::GhostBoundaryCells>()},
+                                                          std::vector<int>{12, 5},
+                                                          std::vector<double>{0.0, 0.0},
+                                                          std::vector<double>{2.0, 0.5},
+                                                          std::vector<std::string>{"NONE", "NONE"} /*boundary*/,
+                                                          false /*simplex*/);
+
+            // vary the state so that each constraint is limited by a different cell
+            auto flowState = std::make_shared<finiteVolume::fieldFunctions::CompressibleFlowState>(
+                eos, mathFunctions::Create("300 + 500*x*y"), mathFunctions::Create("101325 + 1000*x"), mathFunctions::Create("10 + 50*y, 20*x"));
+            auto initialization = std::make_shared<domain::Initializer>(std::make_shared<finiteVolume::fieldFunctions::Euler>(flowState));
+
+            auto timeStepper = solver::TimeStepper(mesh, nullptr, {}, initialization);
+            auto flowParameters = std::make_shared<parameters::MapParameters>(std::map<std::string, std::string>{{"cfl", std::to_string(cfl)},
+                                                                                                                  {"conductionStabilityFactor", std::to_string(conductionStabilityFactor)},
+                                                                                                                  {"viscousStabilityFactor", std::to_string(viscousStabilityFactor)}});
+            auto flowObject = std::make_shared<finiteVolume::CompressibleFlowSolver>(
+                "testFlow", domain::Region::ENTIREDOMAIN, nullptr /*options*/, eos, flowParameters, transport, std::make_shared<finiteVolume::fluxCalculator::Ausm>());
+            timeStepper.Register(flowObject);
+            timeStepper.Initialize();
+
+            // act
+            auto fusedTimeSteps = flowObject->ComputePhysicsTimeSteps(timeStepper.GetTS());
+            auto separateTimeSteps = ComputeSeparateTimeSteps(timeStepper.GetTS(), *flowObject, *eos, *transport, cfl, conductionStabilityFactor, viscousStabilityFactor);
+
+            // assert
+            // the time steps are only reduced to the root
+            int rank;
+            MPI_Comm_rank(PETSC_COMM_WORLD, &rank) >> testErrorChecker;
+            if (rank == 0) {
+                ASSERT_EQ(separateTimeSteps.size(), fusedTimeSteps.size());
+                for (const auto& [name, dt] : separateTimeSteps) {
+                    ASSERT_EQ(1, fusedTimeSteps.count(name)) << "the " << name << " time step should be computed";
+                    ASSERT_NEAR(dt, fusedTimeSteps[name], 1E-12 * dt) << "for the " << name << " time step";
+                }
+            }
+        }
+        ablate::environment::RunEnvironment::Finalize();
+    EndWithMPI
+}
+
+INSTANTIATE_TEST_SUITE_P(FiniteVolumeTimeStepTests, FiniteVolumeTimeStepTestFixture,
+                         testing::Values(testingResources::MpiTestParameter("fused time steps"), testingResources::MpiTestParameter("fused time steps in parallel", 2)),
+                         [](const testing::TestParamInfo<testingResources::MpiTestParameter>& info) { return info.param.getTestName(); });
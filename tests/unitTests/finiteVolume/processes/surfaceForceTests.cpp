@@ -2,6 +2,7 @@
 #include <memory>
 #include <vector>
 #include "domain/boxMesh.hpp"
+#include "domain/modifiers/distributeWithGhostCells.hpp"
 #include "domain/modifiers/ghostBoundaryCells.hpp"
 #include "environment/runEnvironment.hpp"
 #include "finiteVolume/compressibleFlowFields.hpp"
@@ -11,6 +12,8 @@
 #include "gtest/gtest.h"
 #include "mathFunctions/functionFactory.hpp"
 #include "mpiTestFixture.hpp"
+#include "petscTestErrorChecker.hpp"
+#include "utilities/petscUtilities.hpp"
 
 struct SurfaceForceTestParameters {
     PetscInt dim;
@@ -157,4 +160,116 @@ INSTANTIATE_TEST_SUITE_P(SurfaceForce, SurfaceForceTestFixture,
                                                                       .expectedEulerSource = {0, -0.890954544, -0.445477, -0.445477, 0}}  // should calculate energy also
 
                                          ),
-                         [](const testing::TestParamInfo<SurfaceForceTestParameters> &info) { return "SurfaceForceTest" + std::to_string(info.index); });
\ No newline at end of file
+                         [](const testing::TestParamInfo<SurfaceForceTestParameters> &info) { return "SurfaceForceTest" + std::to_string(info.index); });
+
+class SurfaceForceNarrowBandTestFixture : public testingResources::MpiTestFixture, public ::testing::WithParamInterface<testingResources::MpiTestParameter> {
+   public:
+    void SetUp() override { SetMpiParameters(GetParam()); }
+};
+
+TEST_P(SurfaceForceNarrowBandTestFixture, ShouldMatchWholeDomainSurfaceForce) {
+    StartWithMPI
+        {
+            ablate::environment::RunEnvironment::Initialize(argc, argv);
+            ablate::utilities::PetscUtilities::Initialize();
+            PetscReal sigma = 0.07;
+
+            auto eos = std::make_shared<ablate::eos::PerfectGas>(std::make_shared<ablate::parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.4"}}));
+            std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>> fieldDescriptors = {
+                std::make_shared<ablate::finiteVolume::CompressibleFlowFields>(eos),
+                std::make_shared<ablate::domain::FieldDescription>(ablate::finiteVolume::processes::TwoPhaseEulerAdvection::VOLUME_FRACTION_FIELD,
+                                                                   "",
+                                                                   ablate::domain::FieldDescription::ONECOMPONENT,
+                                                                   ablate::domain::FieldLocation::SOL,
+                                                                   ablate::domain::FieldType::FVM)};
+
+            // a distributed mesh so the droplet crosses the partition boundaries
+            auto domain =
+                std::make_shared<ablate::domain::BoxMesh>("test",
+                                                          fieldDescriptors,
+                                                          std::vector<std::shared_ptr<ablate::domain::modifiers::Modifier>>{std::make_shared<ablate::domain::modifiers::DistributeWithGhostCells>(),
+                                                                                                                            std::make_shared<ablate::domain::modifiers::GhostBoundaryCells>()},
+                                                          std::vector<int>{20, 20},
+                                                          std::vector<double>{0.0, 0.0},
+                                                          std::vector<double>{1.0, 1.0},
+                                                          std::vector<std::string>{"NONE", "NONE"} /*boundary*/,
+                                                          false /*simplex*/);
+            auto initialConditionFV = std::make_shared<ablate::mathFunctions::FieldFunction>(ablate::finiteVolume::processes::TwoPhaseEulerAdvection::VOLUME_FRACTION_FIELD,
+                                                                                             ablate::mathFunctions::Create("(x-0.5)^2 + (y-0.5)^2 < 0.09 ? 1:0"));
+            auto initialConditionEuler = std::make_shared<ablate::mathFunctions::FieldFunction>("euler", std::make_shared<ablate::mathFunctions::ConstantValue>(1));
+            auto fvSolver = std::make_shared<ablate::finiteVolume::FiniteVolumeSolver>("testSolver",
+                                                                                       ablate::domain::Region::ENTIREDOMAIN,
+                                                                                       nullptr,
+                                                                                       std::vector<std::shared_ptr<ablate::finiteVolume::processes::Process>>(),
+                                                                                       std::vector<std::shared_ptr<ablate::finiteVolume::boundaryConditions::BoundaryCondition>>{});
+            domain->InitializeSubDomains({fvSolver}, std::make_shared<ablate::domain::Initializer>(initialConditionFV, initialConditionEuler));
+
+            // the boundary ghost cells are not set by the global to local, so zero them
+            Vec locSolution;
+            DMGetLocalVector(domain->GetDM(), &locSolution) >> testErrorChecker;
+            VecZeroEntries(locSolution) >> testErrorChecker;
+            DMGlobalToLocal(domain->GetDM(), domain->GetSolutionVector(), INSERT_VALUES, locSolution) >> testErrorChecker;
+
+            // the whole domain result
+            auto wholeDomain = ablate::finiteVolume::processes::SurfaceForce(sigma);
+            wholeDomain.Setup(*fvSolver);
+            wholeDomain.Initialize(*fvSolver);
+            Vec wholeDomainF;
+            DMGetLocalVector(domain->GetDM(), &wholeDomainF) >> testErrorChecker;
+            VecZeroEntries(wholeDomainF) >> testErrorChecker;
+            ablate::finiteVolume::processes::SurfaceForce::ComputeSource(*fvSolver, domain->GetDM(), 0.0, locSolution, wholeDomainF, &wholeDomain) >> testErrorChecker;
+
+            // act
+            // the first evaluation builds the band and the second updates it
+            auto narrowBand = ablate::finiteVolume::processes::SurfaceForce(sigma, 2);
+            narrowBand.Setup(*fvSolver);
+            narrowBand.Initialize(*fvSolver);
+            Vec narrowBandF;
+            DMGetLocalVector(domain->GetDM(), &narrowBandF) >> testErrorChecker;
+            for (PetscInt evaluation = 0; evaluation < 2; ++evaluation) {
+                VecZeroEntries(narrowBandF) >> testErrorChecker;
+                ablate::finiteVolume::processes::SurfaceForce::ComputeSource(*fvSolver, domain->GetDM(), 0.0, locSolution, narrowBandF, &narrowBand) >> testErrorChecker;
+            }
+
+            // assert
+            // every cell outside of the band has no surface force, so the sources should be identical
+            ablate::domain::Range cellRange;
+            fvSolver->GetCellRangeWithoutGhost(cellRange);
+            const PetscScalar *wholeDomainArray, *narrowBandArray;
+            VecGetArrayRead(wholeDomainF, &wholeDomainArray) >> testErrorChecker;
+            VecGetArrayRead(narrowBandF, &narrowBandArray) >> testErrorChecker;
+            const auto eulerId = domain->GetField("euler").id;
+            const auto numberComponents = (PetscInt)domain->GetField("euler").numberComponents;
+            PetscInt numberForcedCells = 0;
+            for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+                const PetscInt cell = cellRange.GetPoint(c);
+                const PetscScalar *wholeDomainSource, *narrowBandSource;
+                DMPlexPointLocalFieldRead(domain->GetDM(), cell, eulerId, wholeDomainArray, &wholeDomainSource) >> testErrorChecker;
+                DMPlexPointLocalFieldRead(domain->GetDM(), cell, eulerId, narrowBandArray, &narrowBandSource) >> testErrorChecker;
+                bool forced = false;
+                for (PetscInt e = 0; e < numberComponents; ++e) {
+                    ASSERT_NEAR(wholeDomainSource[e], narrowBandSource[e], 1E-12) << "for cell " << cell << " component " << e;
+                    forced = forced || wholeDomainSource[e] != 0.0;
+                }
+                numberForcedCells += forced ? 1 : 0;
+            }
+            VecRestoreArrayRead(narrowBandF, &narrowBandArray) >> testErrorChecker;
+            VecRestoreArrayRead(wholeDomainF, &wholeDomainArray) >> testErrorChecker;
+
+            // the droplet should be seen on every rank
+            ASSERT_GT(numberForcedCells, 0);
+            fvSolver->RestoreRange(cellRange);
+
+            DMRestoreLocalVector(domain->GetDM(), &narrowBandF) >> testErrorChecker;
+            DMRestoreLocalVector(domain->GetDM(), &wholeDomainF) >> testErrorChecker;
+            DMRestoreLocalVector(domain->GetDM(), &locSolution) >> testErrorChecker;
+        }
+        ablate::environment::RunEnvironment::Finalize();
+        exit(0);
+    EndWithMPI
+}
+
+INSTANTIATE_TEST_SUITE_P(SurfaceForce, SurfaceForceNarrowBandTestFixture,
+                         testing::Values(testingResources::MpiTestParameter("narrow band"), testingResources::MpiTestParameter("narrow band in parallel", 2),
+                                         testingResources::MpiTestParameter("narrow band in parallel 4", 4)),
+                         [](const testing::TestParamInfo<testingResources::MpiTestParameter> &info) { return info.param.getTestName(); });
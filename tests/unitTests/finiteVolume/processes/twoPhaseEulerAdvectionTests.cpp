@@ -262,6 +262,29 @@ INSTANTIATE_TEST_SUITE_P(
             .expectedML = 0.010776661126898394,
             .expectedPressure = 100000.0,
             .expectedAlpha = 0.65},
+        (TwoPhaseEulerAdvectionTestDecodeStateParameters){
+            .testName = "stiffened_gas_plus_stiffened_gas_high_pressure",
+            .eosGas = std::make_shared<eos::StiffenedGas>(std::make_shared<parameters::MapParameters>(std::map<std::string, std::string>{
+                {"gamma", "2.31015"}, {"Cp", "4643.4015"}, {"p0", "6.0695E8"}})),
+            .eosLiquid = std::make_shared<eos::StiffenedGas>(std::make_shared<parameters::MapParameters>(std::map<std::string, std::string>{
+                {"gamma", "1.932"}, {"Cp", "8095.08"}, {"p0", "1.1645E9"}})),
+            .dim = 3,
+            .conservedValuesIn = {798.146310553569, 2016298707.2500744, 7981.46310553569, -15962.92621107138, 23944.38931660707, 199.18290903554637},  // RHO, RHOE, RHOU, RHOV, RHOW, RHOALPHA
+            .normalIn = {0.5, 0.5, 0.7071},                                                                                                           // x, y, z
+            .expectedDensity = 798.146310553569,
+            .expectedDensityG = 663.943030118488,
+            .expectedDensityL = 855.6620021686039,
+            .expectedNormalVelocity = 16.213,
+            .expectedVelocity = {10.0, -20.0, 30.0},
+            .expectedInternalEnergy = 2525526.9343218957,
+            .expectedInternalEnergyG = 1617659.7583932509,
+            .expectedInternalEnergyL = 2827434.571184267,
+            .expectedSoundSpeedG = 1459.1927104836943,
+            .expectedSoundSpeedL = 1624.9969526125271,
+            .expectedMG = 0.011110938180760031,
+            .expectedML = 0.009977249479720047,
+            .expectedPressure = 5.0E6,
+            .expectedAlpha = 0.3},
         (TwoPhaseEulerAdvectionTestDecodeStateParameters){.testName = "stiffened_gas_plus_stiffened_gas_all_water",
                                                           .eosGas = std::make_shared<eos::StiffenedGas>(std::make_shared<parameters::MapParameters>(std::map<std::string, std::string>{
                                                               {"gamma", "2.31015"}, {"Cp", "4643.4015"}, {"p0", "6.0695E8"}})),
@@ -0,0 +1,105 @@
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include "gtest/gtest.h"
+#include "io/backgroundFileMover.hpp"
+
+class BackgroundFileMoverTestFixture : public ::testing::Test {
+   protected:
+    std::filesystem::path stagingDirectory;
+    std::filesystem::path outputDirectory;
+
+    void SetUp() override {
+        auto root = std::filesystem::temp_directory_path() / ("backgroundFileMoverTests_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+        std::filesystem::remove_all(root);
+        stagingDirectory = root / "staging";
+        outputDirectory = root / "output";
+        std::filesystem::create_directories(stagingDirectory);
+        std::filesystem::create_directories(outputDirectory);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(stagingDirectory.parent_path()); }
+
+    std::filesystem::path WriteStagedFile(const std::string& name, std::size_t size) const {
+        auto path = stagingDirectory / name;
+        std::ofstream file(path, std::ios::binary);
+        file << std::string(size, 'a');
+        return path;
+    }
+};
+
+TEST_F(BackgroundFileMoverTestFixture, ShouldMoveAllFilesToOutput) {
+    // arrange
+    ablate::io::BackgroundFileMover fileMover(1000000);
+
+    // act
+    for (PetscInt s = 0; s < 5; ++s) {
+        auto name = "file." + std::to_string(s) + ".hdf5";
+        fileMover.Enqueue(WriteStagedFile(name, 100), outputDirectory / name, s);
+    }
+    fileMover.Wait();
+
+    // assert
+    ASSERT_EQ(4, fileMover.GetCompletedSequenceNumber(4));
+    for (PetscInt s = 0; s < 5; ++s) {
+        auto name = "file." + std::to_string(s) + ".hdf5";
+        ASSERT_TRUE(std::filesystem::exists(outputDirectory / name)) << name;
+        ASSERT_FALSE(std::filesystem::exists(stagingDirectory / name)) << name;
+        ASSERT_EQ(100u, std::filesystem::file_size(outputDirectory / name));
+    }
+}
+
+TEST_F(BackgroundFileMoverTestFixture, ShouldApplyBackPressureWhenStagingIsFull) {
+    // arrange, only allow a single file in staging at once
+    ablate::io::BackgroundFileMover fileMover(150);
+
+    // act
+    for (PetscInt s = 0; s < 10; ++s) {
+        auto name = "file." + std::to_string(s) + ".hdf5";
+        fileMover.Enqueue(WriteStagedFile(name, 100), outputDirectory / name, s);
+
+        // assert, at most the current file can remain in staging
+        PetscInt stagedFiles = 0;
+        for ([[maybe_unused]] const auto& file : std::filesystem::directory_iterator(stagingDirectory)) {
+            stagedFiles++;
+        }
+        ASSERT_LE(stagedFiles, 1);
+        ASSERT_GE(fileMover.GetCompletedSequenceNumber(s), s - 1);
+    }
+    fileMover.Wait();
+    ASSERT_EQ(9, fileMover.GetCompletedSequenceNumber(9));
+}
+
+TEST_F(BackgroundFileMoverTestFixture, ShouldReportMoveErrors) {
+    // arrange
+    ablate::io::BackgroundFileMover fileMover(1000);
+    auto missingDirectory = outputDirectory / "missing" / "file.hdf5";
+
+    // act
+    fileMover.Enqueue(WriteStagedFile("file.hdf5", 10), missingDirectory, 0);
+
+    // assert
+    ASSERT_THROW(fileMover.Wait(), std::runtime_error);
+}
+
+TEST_F(BackgroundFileMoverTestFixture, ShouldCopyAndKeepSourceForAppendedFiles) {
+    // arrange
+    ablate::io::BackgroundFileMover fileMover(1000);
+    auto stagedFile = WriteStagedFile("file.hdf5", 10);
+
+    // act, copy the file, grow it, and copy it again
+    fileMover.Enqueue(stagedFile, outputDirectory / "file.hdf5", 0, true);
+    fileMover.Wait();
+    {
+        std::ofstream file(stagedFile, std::ios::binary | std::ios::app);
+        file << std::string(20, 'b');
+    }
+    fileMover.Enqueue(stagedFile, outputDirectory / "file.hdf5", 1, true);
+    fileMover.Wait();
+
+    // assert
+    ASSERT_EQ(1, fileMover.GetCompletedSequenceNumber(1));
+    ASSERT_TRUE(std::filesystem::exists(stagedFile));
+    ASSERT_EQ(30u, std::filesystem::file_size(outputDirectory / "file.hdf5"));
+    ASSERT_FALSE(std::filesystem::exists(outputDirectory / "file.hdf5.copy"));
+}
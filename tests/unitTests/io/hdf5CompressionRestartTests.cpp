@@ -0,0 +1,132 @@
+#include <petsc.h>
+#include <filesystem>
+#include <memory>
+#include <vector>
+#include "domain/boxMesh.hpp"
+#include "domain/fieldDescription.hpp"
+#include "domain/modifiers/distributeWithGhostCells.hpp"
+#include "environment/runEnvironment.hpp"
+#include "finiteVolume/finiteVolumeSolver.hpp"
+#include "gtest/gtest.h"
+#include "io/hdf5Compression.hpp"
+#include "io/hdf5MultiFileSerializer.hpp"
+#include "io/interval/fixedInterval.hpp"
+#include "mathFunctions/functionFactory.hpp"
+#include "mpiTestFixture.hpp"
+#include "parameters/mapParameters.hpp"
+#include "petscTestErrorChecker.hpp"
+#include "solver/timeStepper.hpp"
+#include "utilities/petscUtilities.hpp"
+
+using namespace ablate;
+
+class Hdf5CompressionRestartTestFixture : public testingResources::MpiTestFixture, public ::testing::WithParamInterface<testingResources::MpiTestParameter> {
+   public:
+    void SetUp() override { SetMpiParameters(GetParam()); }
+};
+
+/**
+ * Build a time stepper over a box mesh with a single finite volume solver so the field is serialized by the sub domain
+ */
+static std::shared_ptr<solver::TimeStepper> CreateTimeStepper(const std::shared_ptr<io::Serializer>& serializer, const std::string& initialization) {
+    std::vector<std::shared_ptr<domain::FieldDescriptor>> fieldDescriptors = {
+        std::make_shared<domain::FieldDescription>("phi", "", std::vector<std::string>{"phi0", "phi1"}, domain::FieldLocation::SOL, domain::FieldType::FVM)};
+
+    auto mesh = std::make_shared<domain::BoxMesh>("mesh",
+                                                  fieldDescriptors,
+                                                  std::vector<std::shared_ptr<domain::modifiers::Modifier>>{std::make_shared<domain::modifiers::DistributeWithGhostCells>()},
+                                                  std::vector<int>{8, 6},
+                                                  std::vector<double>{0.0, 0.0},
+                                                  std::vector<double>{1.0, 1.0},
+                                                  std::vector<std::string>{} /*boundary*/,
+                                                  false /*simplex*/);
+
+    auto arguments = std::make_shared<parameters::MapParameters>(std::map<std::string, std::string>{{"ts_type", "euler"}, {"ts_max_steps", "2"}, {"ts_dt", "0.1"}, {"ts_adapt_type", "none"}});
+    auto timeStepper = std::make_shared<solver::TimeStepper>(
+        mesh, arguments, serializer, std::make_shared<domain::Initializer>(std::make_shared<mathFunctions::FieldFunction>("phi", mathFunctions::Create(initialization))));
+
+    // a finite volume solver without any processes so the field is unchanged by the steps
+    timeStepper->Register(std::make_shared<finiteVolume::FiniteVolumeSolver>("fvSolver",
+                                                                             domain::Region::ENTIREDOMAIN,
+                                                                             nullptr,
+                                                                             std::vector<std::shared_ptr<finiteVolume::processes::Process>>{},
+                                                                             std::vector<std::shared_ptr<finiteVolume::boundaryConditions::BoundaryCondition>>{}));
+    return timeStepper;
+}
+
+static std::vector<PetscScalar> CopySolution(solver::TimeStepper& timeStepper) {
+    Vec solution;
+    TSGetSolution(timeStepper.GetTS(), &solution) >> testErrorChecker;
+    PetscInt size;
+    VecGetLocalSize(solution, &size) >> testErrorChecker;
+    const PetscScalar* array;
+    VecGetArrayRead(solution, &array) >> testErrorChecker;
+    std::vector<PetscScalar> values(array, array + size);
+    VecRestoreArrayRead(solution, &array) >> testErrorChecker;
+    return values;
+}
+
+TEST_P(Hdf5CompressionRestartTestFixture, ShouldRestartFromCompressedOutputBitForBit) {
+    StartWithMPI
+        {
+            // initialize petsc and mpi
+            ablate::environment::RunEnvironment::Initialize(argc, argv);
+            ablate::utilities::PetscUtilities::Initialize();
+
+            // write to a clean output directory
+            int rank;
+            MPI_Comm_rank(PETSC_COMM_WORLD, &rank) >> testErrorChecker;
+            auto outputDirectory = std::filesystem::temp_directory_path() / ("hdf5CompressionRestart_" + GetParam().getTestName());
+            if (rank == 0) {
+                std::filesystem::remove_all(outputDirectory);
+            }
+            MPI_Barrier(PETSC_COMM_WORLD);
+            ablate::environment::RunEnvironment::Setup(
+                *parameters::MapParameters::Create({{"title", "hdf5CompressionRestart"}, {"directory", outputDirectory.string()}, {"tagDirectory", "false"}}));
+
+            // values that are not exactly representable in single precision
+            const std::string initialization = "sin(x)/3 + 1/7, 300 + cos(y)/3";
+
+            // act
+            std::vector<PetscScalar> savedSolution;
+            {
+                auto serializer = std::make_shared<io::Hdf5MultiFileSerializer>(std::make_shared<io::interval::FixedInterval>(), nullptr, "", 4.0E9, std::make_shared<io::Hdf5Compression>());
+                auto timeStepper = CreateTimeStepper(serializer, initialization);
+                timeStepper->Solve();
+                savedSolution = CopySolution(*timeStepper);
+            }
+
+            // lossless outputs write the restart information
+            ASSERT_TRUE(std::filesystem::exists(outputDirectory / "restart.rst"));
+
+            // restart from the compressed output with a different initialization
+            std::vector<PetscScalar> restoredSolution;
+            PetscReal restoredTime;
+            {
+                auto serializer = std::make_shared<io::Hdf5MultiFileSerializer>(std::make_shared<io::interval::FixedInterval>(), nullptr, "", 4.0E9, std::make_shared<io::Hdf5Compression>());
+                auto timeStepper = CreateTimeStepper(serializer, "0.0, 0.0");
+                timeStepper->Initialize();
+                restoredSolution = CopySolution(*timeStepper);
+                restoredTime = timeStepper->GetTime();
+            }
+
+            // assert
+            ASSERT_NEAR(0.2, restoredTime, 1E-12);
+            ASSERT_EQ(savedSolution.size(), restoredSolution.size());
+            for (std::size_t i = 0; i < savedSolution.size(); ++i) {
+                ASSERT_EQ(savedSolution[i], restoredSolution[i]) << "at index " << i;
+            }
+
+            // cleanup
+            MPI_Barrier(PETSC_COMM_WORLD);
+            if (rank == 0) {
+                std::filesystem::remove_all(outputDirectory);
+            }
+        }
+        ablate::environment::RunEnvironment::Finalize();
+    EndWithMPI
+}
+
+INSTANTIATE_TEST_SUITE_P(Hdf5CompressionTests, Hdf5CompressionRestartTestFixture,
+                         testing::Values(testingResources::MpiTestParameter("compressed restart"), testingResources::MpiTestParameter("compressed restart in parallel", 2)),
+                         [](const testing::TestParamInfo<testingResources::MpiTestParameter>& info) { return info.param.getTestName(); });
@@ -0,0 +1,231 @@
+#include <petscviewerhdf5.h>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include "gtest/gtest.h"
+#include "io/hdf5Compression.hpp"
+#include "petscTestFixture.hpp"
+#include "utilities/petscUtilities.hpp"
+
+class Hdf5CompressionTestFixture : public testingResources::PetscTestFixture {
+   protected:
+    std::filesystem::path filePath;
+
+    void SetUp() override {
+        testingResources::PetscTestFixture::SetUp();
+        filePath = std::filesystem::temp_directory_path() / ("hdf5CompressionTests_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()) + ".hdf5");
+        std::filesystem::remove(filePath);
+    }
+
+    void TearDown() override { std::filesystem::remove(filePath); }
+
+    /**
+     * writes a vector using the compression (repacking it like the serializers) and reads it back into a new vector
+     */
+    void WriteAndRead(const ablate::io::Hdf5Compression& compression, Vec source, Vec result) const {
+        PetscViewer viewer;
+        PetscViewerHDF5Open(PETSC_COMM_SELF, filePath.string().c_str(), FILE_MODE_WRITE, &viewer) >> ablate::utilities::PetscUtilities::checkError;
+        compression.Apply(viewer) >> ablate::utilities::PetscUtilities::checkError;
+        VecView(source, viewer) >> ablate::utilities::PetscUtilities::checkError;
+        PetscViewerDestroy(&viewer) >> ablate::utilities::PetscUtilities::checkError;
+        if (compression.RequiresRepack()) {
+            compression.Repack(filePath);
+        }
+
+        PetscViewerHDF5Open(PETSC_COMM_SELF, filePath.string().c_str(), FILE_MODE_READ, &viewer) >> ablate::utilities::PetscUtilities::checkError;
+        VecLoad(result, viewer) >> ablate::utilities::PetscUtilities::checkError;
+        PetscViewerDestroy(&viewer) >> ablate::utilities::PetscUtilities::checkError;
+    }
+
+    static void CreateVecs(PetscInt size, Vec* source, Vec* result) {
+        VecCreateSeq(PETSC_COMM_SELF, size, source) >> ablate::utilities::PetscUtilities::checkError;
+        PetscObjectSetName((PetscObject)*source, "field") >> ablate::utilities::PetscUtilities::checkError;
+        VecDuplicate(*source, result) >> ablate::utilities::PetscUtilities::checkError;
+        PetscObjectSetName((PetscObject)*result, "field") >> ablate::utilities::PetscUtilities::checkError;
+
+        // fill with values that are not exactly representable in single precision
+        PetscScalar* array;
+        VecGetArray(*source, &array) >> ablate::utilities::PetscUtilities::checkError;
+        for (PetscInt i = 0; i < size; ++i) {
+            array[i] = 300.0 + PetscSinReal(0.001 * i) / 3.0;
+        }
+        VecRestoreArray(*source, &array) >> ablate::utilities::PetscUtilities::checkError;
+    }
+};
+
+TEST_F(Hdf5CompressionTestFixture, ShouldRoundTripLosslessCompression) {
+    // arrange
+    const PetscInt size = 10000;
+    Vec source, result;
+    CreateVecs(size, &source, &result);
+    ablate::io::Hdf5Compression compression;
+
+    // act
+    WriteAndRead(compression, source, result);
+
+    // assert
+    ASSERT_TRUE(compression.IsLossless());
+    const PetscScalar *sourceArray, *resultArray;
+    VecGetArrayRead(source, &sourceArray) >> ablate::utilities::PetscUtilities::checkError;
+    VecGetArrayRead(result, &resultArray) >> ablate::utilities::PetscUtilities::checkError;
+    for (PetscInt i = 0; i < size; ++i) {
+        ASSERT_EQ(sourceArray[i], resultArray[i]) << "at index " << i;
+    }
+    VecRestoreArrayRead(source, &sourceArray) >> ablate::utilities::PetscUtilities::checkError;
+    VecRestoreArrayRead(result, &resultArray) >> ablate::utilities::PetscUtilities::checkError;
+
+    // cleanup
+    VecDestroy(&source) >> ablate::utilities::PetscUtilities::checkError;
+    VecDestroy(&result) >> ablate::utilities::PetscUtilities::checkError;
+}
+
+TEST_F(Hdf5CompressionTestFixture, ShouldRoundTripSinglePrecisionWithinTolerance) {
+    // arrange
+    const PetscInt size = 1000;
+    Vec source, result;
+    CreateVecs(size, &source, &result);
+    ablate::io::Hdf5Compression compression(true);
+
+    // act
+    WriteAndRead(compression, source, result);
+
+    // assert
+    ASSERT_FALSE(compression.IsLossless());
+    const PetscScalar *sourceArray, *resultArray;
+    VecGetArrayRead(source, &sourceArray) >> ablate::utilities::PetscUtilities::checkError;
+    VecGetArrayRead(result, &resultArray) >> ablate::utilities::PetscUtilities::checkError;
+    for (PetscInt i = 0; i < size; ++i) {
+        ASSERT_NEAR(sourceArray[i], resultArray[i], 1E-6 * PetscAbsScalar(sourceArray[i])) << "at index " << i;
+    }
+    VecRestoreArrayRead(source, &sourceArray) >> ablate::utilities::PetscUtilities::checkError;
+    VecRestoreArrayRead(result, &resultArray) >> ablate::utilities::PetscUtilities::checkError;
+
+    // cleanup
+    VecDestroy(&source) >> ablate::utilities::PetscUtilities::checkError;
+    VecDestroy(&result) >> ablate::utilities::PetscUtilities::checkError;
+}
+
+TEST_F(Hdf5CompressionTestFixture, ShouldSetDeflateFilterOnDataset) {
+    // arrange
+    const PetscInt size = 10000;
+    Vec source, result;
+    CreateVecs(size, &source, &result);
+    ablate::io::Hdf5Compression compression;
+
+    // act
+    WriteAndRead(compression, source, result);
+
+    // inspect the dataset creation properties directly with hdf5
+    PetscViewer viewer;
+    PetscViewerHDF5Open(PETSC_COMM_SELF, filePath.string().c_str(), FILE_MODE_READ, &viewer) >> ablate::utilities::PetscUtilities::checkError;
+    hid_t fileId;
+    PetscViewerHDF5GetFileId(viewer, &fileId) >> ablate::utilities::PetscUtilities::checkError;
+    hid_t datasetId = H5Dopen2(fileId, "/field", H5P_DEFAULT);
+    ASSERT_GE(datasetId, 0) << "the dataset should be written to the root group";
+    hid_t createPropertyList = H5Dget_create_plist(datasetId);
+    const auto layout = H5Pget_layout(createPropertyList);
+    unsigned int flags, filterConfig;
+    size_t numberValues = 0;
+    const auto deflateFilter = H5Pget_filter_by_id2(createPropertyList, H5Z_FILTER_DEFLATE, &flags, &numberValues, nullptr, 0, nullptr, &filterConfig);
+    H5Pclose(createPropertyList);
+    H5Dclose(datasetId);
+    PetscViewerDestroy(&viewer) >> ablate::utilities::PetscUtilities::checkError;
+
+    // assert
+    ASSERT_EQ(H5D_CHUNKED, layout) << "compressed datasets must be chunked";
+    ASSERT_GE(deflateFilter, 0) << "the deflate filter should be set on the dataset";
+
+    // cleanup
+    VecDestroy(&source) >> ablate::utilities::PetscUtilities::checkError;
+    VecDestroy(&result) >> ablate::utilities::PetscUtilities::checkError;
+}
+
+TEST_F(Hdf5CompressionTestFixture, ShouldRepackWithCompressionLevelAndChunkSize) {
+    // arrange
+    const PetscInt size = 10000;
+    Vec source, result;
+    CreateVecs(size, &source, &result);
+    ablate::io::Hdf5Compression compression(false, 4 /*compressionLevel*/, 1000 /*chunkSize*/);
+
+    // act
+    WriteAndRead(compression, source, result);
+
+    // inspect the dataset creation properties directly with hdf5
+    hid_t fileId = H5Fopen(filePath.string().c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    ASSERT_GE(fileId, 0);
+    hid_t datasetId = H5Dopen2(fileId, "/field", H5P_DEFAULT);
+    ASSERT_GE(datasetId, 0) << "the dataset should be kept in the root group";
+    hid_t createPropertyList = H5Dget_create_plist(datasetId);
+    hsize_t chunk[1] = {0};
+    const auto chunkRank = H5Pget_chunk(createPropertyList, 1, chunk);
+    unsigned int flags, filterConfig;
+    unsigned int level[1] = {0};
+    size_t numberValues = 1;
+    const auto deflateFilter = H5Pget_filter_by_id2(createPropertyList, H5Z_FILTER_DEFLATE, &flags, &numberValues, level, 0, nullptr, &filterConfig);
+    H5Pclose(createPropertyList);
+    H5Dclose(datasetId);
+    H5Fclose(fileId);
+
+    // assert
+    ASSERT_TRUE(compression.IsLossless());
+    ASSERT_EQ(1, chunkRank);
+    ASSERT_EQ(1000u, chunk[0]);
+    ASSERT_GE(deflateFilter, 0) << "the deflate filter should be set on the dataset";
+    ASSERT_EQ(4u, level[0]);
+    const PetscScalar *sourceArray, *resultArray;
+    VecGetArrayRead(source, &sourceArray) >> ablate::utilities::PetscUtilities::checkError;
+    VecGetArrayRead(result, &resultArray) >> ablate::utilities::PetscUtilities::checkError;
+    for (PetscInt i = 0; i < size; ++i) {
+        ASSERT_EQ(sourceArray[i], resultArray[i]) << "at index " << i;
+    }
+    VecRestoreArrayRead(source, &sourceArray) >> ablate::utilities::PetscUtilities::checkError;
+    VecRestoreArrayRead(result, &resultArray) >> ablate::utilities::PetscUtilities::checkError;
+
+    // cleanup
+    VecDestroy(&source) >> ablate::utilities::PetscUtilities::checkError;
+    VecDestroy(&result) >> ablate::utilities::PetscUtilities::checkError;
+}
+
+TEST_F(Hdf5CompressionTestFixture, ShouldRoundMantissaBitsWithinTolerance) {
+    // arrange
+    const PetscInt size = 1000;
+    const int mantissaBits = 12;
+    Vec source, result;
+    CreateVecs(size, &source, &result);
+    ablate::io::Hdf5Compression compression(false, 0, 0, mantissaBits);
+
+    // act
+    WriteAndRead(compression, source, result);
+
+    // assert
+    ASSERT_FALSE(compression.IsLossless());
+    const PetscScalar *sourceArray, *resultArray;
+    VecGetArrayRead(source, &sourceArray) >> ablate::utilities::PetscUtilities::checkError;
+    VecGetArrayRead(result, &resultArray) >> ablate::utilities::PetscUtilities::checkError;
+    for (PetscInt i = 0; i < size; ++i) {
+        ASSERT_NEAR(sourceArray[i], resultArray[i], PetscPowReal(2.0, -mantissaBits) * PetscAbsScalar(sourceArray[i])) << "at index " << i;
+
+        // only the kept mantissa bits may be set
+        double rounded = resultArray[i];
+        std::uint64_t bits;
+        std::memcpy(&bits, &rounded, sizeof(bits));
+        ASSERT_EQ(0u, bits & ((std::uint64_t{1} << (52 - mantissaBits)) - 1)) << "at index " << i;
+    }
+    VecRestoreArrayRead(source, &sourceArray) >> ablate::utilities::PetscUtilities::checkError;
+    VecRestoreArrayRead(result, &resultArray) >> ablate::utilities::PetscUtilities::checkError;
+
+    // cleanup
+    VecDestroy(&source) >> ablate::utilities::PetscUtilities::checkError;
+    VecDestroy(&result) >> ablate::utilities::PetscUtilities::checkError;
+}
+
+TEST(Hdf5CompressionTests, ShouldOnlyRepackWhenOptionsAreSet) {
+    ASSERT_FALSE(ablate::io::Hdf5Compression().RequiresRepack());
+    ASSERT_FALSE(ablate::io::Hdf5Compression(true).RequiresRepack());
+    ASSERT_TRUE(ablate::io::Hdf5Compression(false, 6).RequiresRepack());
+    ASSERT_TRUE(ablate::io::Hdf5Compression(false, 0, 4096).RequiresRepack());
+    ASSERT_TRUE(ablate::io::Hdf5Compression(false, 0, 0, 16).RequiresRepack());
+    ASSERT_THROW(ablate::io::Hdf5Compression(false, 10), std::invalid_argument);
+    ASSERT_THROW(ablate::io::Hdf5Compression(false, 0, 0, 53), std::invalid_argument);
+}
@@ -0,0 +1,173 @@
+#include <petsc.h>
+#include <petscviewerhdf5.h>
+#include <filesystem>
+#include <memory>
+#include "environment/runEnvironment.hpp"
+#include "gtest/gtest.h"
+#include "io/hdf5Serializer.hpp"
+#include "io/interval/fixedInterval.hpp"
+#include "mpiTestFixture.hpp"
+#include "parameters/mapParameters.hpp"
+#include "petscTestErrorChecker.hpp"
+#include "utilities/petscUtilities.hpp"
+
+using namespace ablate;
+
+/**
+ * Simple serializable object that writes a single value for each sequence and reports a state that only changes with the value
+ */
+class ValueSerializable : public io::Serializable {
+   private:
+    const std::string id;
+
+   public:
+    PetscScalar value = 0.0;
+    PetscObjectState state = 0;
+    PetscInt numberSaves = 0;
+    PetscInt restoredSequenceNumber = -1;
+    PetscReal restoredTime = NAN;
+
+    explicit ValueSerializable(std::string id) : id(std::move(id)) {}
+
+    void SetValue(PetscScalar newValue) {
+        value = newValue;
+        ++state;
+    }
+
+    [[nodiscard]] const std::string& GetId() const override { return id; }
+
+    [[nodiscard]] PetscObjectState GetSerializableState() override { return state; }
+
+    PetscErrorCode Save(PetscViewer viewer, PetscInt sequenceNumber, PetscReal) override {
+        PetscFunctionBeginUser;
+        Vec valueVec;
+        PetscCall(CreateValueVec(viewer, &valueVec));
+        PetscCall(VecSet(valueVec, value));
+        PetscCall(PetscViewerHDF5PushTimestepping(viewer));
+        PetscCall(PetscViewerHDF5SetTimestep(viewer, sequenceNumber));
+        PetscCall(VecView(valueVec, viewer));
+        PetscCall(PetscViewerHDF5PopTimestepping(viewer));
+        PetscCall(VecDestroy(&valueVec));
+        ++numberSaves;
+        PetscFunctionReturn(PETSC_SUCCESS);
+    }
+
+    PetscErrorCode Restore(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) override {
+        PetscFunctionBeginUser;
+        Vec valueVec;
+        PetscCall(CreateValueVec(viewer, &valueVec));
+        PetscCall(PetscViewerHDF5PushTimestepping(viewer));
+        PetscCall(PetscViewerHDF5SetTimestep(viewer, sequenceNumber));
+        PetscCall(VecLoad(valueVec, viewer));
+        PetscCall(PetscViewerHDF5PopTimestepping(viewer));
+        PetscCall(VecMax(valueVec, nullptr, &value));
+        PetscCall(VecDestroy(&valueVec));
+        restoredSequenceNumber = sequenceNumber;
+        restoredTime = time;
+        PetscFunctionReturn(PETSC_SUCCESS);
+    }
+
+   private:
+    static PetscErrorCode CreateValueVec(PetscViewer viewer, Vec* valueVec) {
+        PetscFunctionBeginUser;
+        PetscMPIInt rank;
+        PetscCallMPI(MPI_Comm_rank(PetscObjectComm((PetscObject)viewer), &rank));
+        PetscCall(VecCreateMPI(PetscObjectComm((PetscObject)viewer), rank == 0 ? 1 : 0, 1, valueVec));
+        PetscCall(PetscObjectSetName((PetscObject)*valueVec, "value"));
+        PetscFunctionReturn(PETSC_SUCCESS);
+    }
+};
+
+class Hdf5SerializerTestFixture : public testingResources::MpiTestFixture, public ::testing::WithParamInterface<testingResources::MpiTestParameter> {
+   public:
+    void SetUp() override { SetMpiParameters(GetParam()); }
+};
+
+TEST_P(Hdf5SerializerTestFixture, ShouldRestoreUnchangedObjectsFromTheirRecordedSequence) {
+    StartWithMPI
+        {
+            // initialize petsc and mpi
+            ablate::environment::RunEnvironment::Initialize(argc, argv);
+            ablate::utilities::PetscUtilities::Initialize();
+
+            // write to a clean output directory
+            int rank;
+            MPI_Comm_rank(PETSC_COMM_WORLD, &rank) >> testErrorChecker;
+            auto outputDirectory = std::filesystem::temp_directory_path() / ("hdf5SerializerIncremental_" + GetParam().getTestName());
+            if (rank == 0) {
+                std::filesystem::remove_all(outputDirectory);
+            }
+            MPI_Barrier(PETSC_COMM_WORLD);
+            ablate::environment::RunEnvironment::Setup(
+                *parameters::MapParameters::Create({{"title", "hdf5SerializerIncremental"}, {"directory", outputDirectory.string()}, {"tagDirectory", "false"}}));
+
+            // a bare ts used to provide the time step and communicator
+            const PetscReal dt = 0.1;
+            TS ts;
+            TSCreate(PETSC_COMM_WORLD, &ts) >> testErrorChecker;
+            TSSetTimeStep(ts, dt) >> testErrorChecker;
+
+            // act
+            // the unchanged object is only written for the first two sequences, the changing object is written every sequence
+            const PetscInt numberSteps = 4;
+            {
+                auto serializer = std::make_shared<io::Hdf5Serializer>(std::make_shared<io::interval::FixedInterval>(), nullptr, 10);
+                auto unchanged = std::make_shared<ValueSerializable>("unchanged");
+                auto changing = std::make_shared<ValueSerializable>("changing");
+                serializer->Register(unchanged);
+                serializer->Register(changing);
+
+                for (PetscInt step = 0; step < numberSteps; ++step) {
+                    if (step < 2) {
+                        unchanged->SetValue(10.0 + step);
+                    }
+                    changing->SetValue(20.0 + step);
+                    serializer->Serialize(ts, step, step * dt, nullptr) >> testErrorChecker;
+                }
+
+                // assert
+                ASSERT_EQ(2, unchanged->numberSaves) << "unchanged objects should not be written again";
+                ASSERT_EQ(numberSteps, changing->numberSaves);
+            }
+
+            // restart into new objects
+            auto serializer = std::make_shared<io::Hdf5Serializer>(std::make_shared<io::interval::FixedInterval>(), nullptr, 10);
+            auto unchanged = std::make_shared<ValueSerializable>("unchanged");
+            auto changing = std::make_shared<ValueSerializable>("changing");
+            serializer->Register(unchanged);
+            serializer->Register(changing);
+            serializer->RestoreTS(ts);
+
+            // assert
+            // the unchanged object is restored from the last sequence it was written with the time of that sequence
+            ASSERT_EQ(1, unchanged->restoredSequenceNumber);
+            ASSERT_NEAR(dt, unchanged->restoredTime, 1E-12);
+            ASSERT_EQ(11.0, unchanged->value);
+            ASSERT_EQ(numberSteps - 1, changing->restoredSequenceNumber);
+            ASSERT_NEAR((numberSteps - 1) * dt, changing->restoredTime, 1E-12);
+            ASSERT_EQ(20.0 + numberSteps - 1, changing->value);
+
+            PetscReal restoredTime;
+            TSGetTime(ts, &restoredTime) >> testErrorChecker;
+            ASSERT_NEAR((numberSteps - 1) * dt, restoredTime, 1E-12);
+
+            // a restored object has no recorded state so it is written with the next save
+            ASSERT_EQ(0, unchanged->numberSaves);
+            serializer->Serialize(ts, numberSteps + 10, (numberSteps + 10) * dt, nullptr) >> testErrorChecker;
+            ASSERT_EQ(1, unchanged->numberSaves);
+
+            // cleanup
+            serializer.reset();
+            TSDestroy(&ts) >> testErrorChecker;
+            MPI_Barrier(PETSC_COMM_WORLD);
+            if (rank == 0) {
+                std::filesystem::remove_all(outputDirectory);
+            }
+        }
+        ablate::environment::RunEnvironment::Finalize();
+    EndWithMPI
+}
+
+INSTANTIATE_TEST_SUITE_P(Hdf5SerializerTests, Hdf5SerializerTestFixture,
+                         testing::Values(testingResources::MpiTestParameter("incremental restart"), testingResources::MpiTestParameter("incremental restart in parallel", 2)),
+                         [](const testing::TestParamInfo<testingResources::MpiTestParameter>& info) { return info.param.getTestName(); });
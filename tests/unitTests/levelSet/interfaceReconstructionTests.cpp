@@ -0,0 +1,297 @@
+#include <petsc.h>
+#include <memory>
+#include <vector>
+#include "domain/dmTransfer.hpp"
+#include "domain/range.hpp"
+#include "gtest/gtest.h"
+#include "levelSet/interfaceReconstruction.hpp"
+#include "levelSet/levelSetUtilities.hpp"
+#include "levelSet/vofMathFunction.hpp"
+#include "mathFunctions/functionFactory.hpp"
+#include "petscTestFixture.hpp"
+#include "utilities/petscSupport.hpp"
+
+namespace ablateTesting::levelSet {
+
+struct InterfaceReconstructionParameters {
+    std::string name;
+    PetscInt dim;
+    PetscBool simplex;
+    std::vector<PetscInt> faces;
+    //! the level set used for the vof comparison
+    std::string levelSet;
+    //! a linear field and its exact gradient
+    std::string linearField;
+    std::vector<PetscReal> linearGradient;
+};
+
+class InterfaceReconstructionTestFixture : public testingResources::PetscTestFixture, public ::testing::WithParamInterface<InterfaceReconstructionParameters> {
+   protected:
+    DM dm = nullptr;
+    DM vertexDm = nullptr;
+
+    void SetUp() override {
+        PetscTestFixture::SetUp();
+        const auto& param = GetParam();
+
+        // Create a mesh over [-1, 1] that is slightly skewed so the cells are not all identical
+        std::vector<PetscReal> lower(param.dim, -1.0), upper(param.dim, 1.0);
+        DMPlexCreateBoxMesh(PETSC_COMM_SELF, param.dim, param.simplex, param.faces.data(), lower.data(), upper.data(), nullptr, PETSC_TRUE, 0, PETSC_TRUE, &dm) >> errorChecker;
+        Vec coordinates;
+        DMGetCoordinatesLocal(dm, &coordinates) >> errorChecker;
+        PetscScalar* coordinateArray;
+        PetscInt coordinateSize;
+        VecGetLocalSize(coordinates, &coordinateSize) >> errorChecker;
+        VecGetArray(coordinates, &coordinateArray) >> errorChecker;
+        for (PetscInt i = 0; i < coordinateSize; i += param.dim) {
+            coordinateArray[i] += 0.1 * coordinateArray[i + param.dim - 1] * coordinateArray[i + param.dim - 1];
+        }
+        VecRestoreArray(coordinates, &coordinateArray) >> errorChecker;
+        DMSetCoordinatesLocal(dm, coordinates) >> errorChecker;
+
+        // A dm with a single value at each vertex
+        DMClone(dm, &vertexDm) >> errorChecker;
+        PetscSection section;
+        PetscInt pStart, pEnd, vStart, vEnd;
+        DMPlexGetChart(dm, &pStart, &pEnd) >> errorChecker;
+        DMPlexGetDepthStratum(dm, 0, &vStart, &vEnd) >> errorChecker;
+        PetscSectionCreate(PETSC_COMM_SELF, &section) >> errorChecker;
+        PetscSectionSetChart(section, pStart, pEnd) >> errorChecker;
+        for (PetscInt v = vStart; v < vEnd; ++v) {
+            PetscSectionSetDof(section, v, 1) >> errorChecker;
+        }
+        PetscSectionSetUp(section) >> errorChecker;
+        DMSetLocalSection(vertexDm, section) >> errorChecker;
+        PetscSectionDestroy(&section) >> errorChecker;
+    }
+
+    void TearDown() override {
+        DMDestroy(&vertexDm) >> errorChecker;
+        DMDestroy(&dm) >> errorChecker;
+    }
+
+    /**
+     * Create a local vertex vector from the function
+     */
+    Vec CreateVertexVec(const std::shared_ptr<ablate::mathFunctions::MathFunction>& function) {
+        Vec vec;
+        DMCreateLocalVector(vertexDm, &vec) >> errorChecker;
+        PetscInt vStart, vEnd;
+        DMPlexGetDepthStratum(vertexDm, 0, &vStart, &vEnd) >> errorChecker;
+        PetscScalar* array;
+        VecGetArray(vec, &array) >> errorChecker;
+        for (PetscInt v = vStart; v < vEnd; ++v) {
+            PetscScalar* coords = nullptr;
+            DMPlexVertexGetCoordinates(vertexDm, 1, &v, &coords) >> errorChecker;
+            PetscScalar* value;
+            DMPlexPointLocalRef(vertexDm, v, array, &value) >> errorChecker;
+            *value = function->Eval(coords, (int)GetParam().dim, 0.0);
+            DMPlexVertexRestoreCoordinates(vertexDm, 1, &v, &coords) >> errorChecker;
+        }
+        VecRestoreArray(vec, &array) >> errorChecker;
+        return vec;
+    }
+};
+
+TEST_P(InterfaceReconstructionTestFixture, ShouldMatchScalarVOF) {
+    // arrange
+    const auto& param = GetParam();
+    auto levelSet = ablate::mathFunctions::Create(param.levelSet);
+    ablate::domain::Range cellRange;
+    DMPlexGetHeightStratum(dm, 0, &cellRange.start, &cellRange.end) >> errorChecker;
+    ablate::levelSet::InterfaceReconstruction reconstruction(dm, cellRange);
+    const PetscInt numberCells = reconstruction.GetNumberCells();
+    Vec levelSetVec = CreateVertexVec(levelSet);
+
+    // act
+    std::vector<PetscReal> vof(numberCells), area(numberCells), vol(numberCells);
+    reconstruction.VOF(levelSet, 0.0, vof.data(), area.data(), vol.data());
+    std::vector<PetscReal> fieldVof(numberCells), fieldArea(numberCells);
+    reconstruction.VOF(vertexDm, levelSetVec, -1, fieldVof.data(), fieldArea.data(), nullptr);
+
+    // assert
+    PetscInt interfaceCells = 0;
+    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+        PetscReal expectedVof, expectedArea, expectedVol;
+        ablate::levelSet::Utilities::VOF(dm, c, levelSet, &expectedVof, &expectedArea, &expectedVol);
+        const PetscInt i = c - cellRange.start;
+        ASSERT_NEAR(expectedVof, vof[i], 1E-12) << "for cell " << c;
+        ASSERT_NEAR(expectedArea, area[i], 1E-12) << "for cell " << c;
+        ASSERT_NEAR(expectedVol, vol[i], 1E-12) << "for cell " << c;
+        ASSERT_NEAR(expectedVof, fieldVof[i], 1E-12) << "for cell " << c;
+        ASSERT_NEAR(expectedArea, fieldArea[i], 1E-12) << "for cell " << c;
+        interfaceCells += expectedVof > 0.0 && expectedVof < 1.0;
+    }
+    ASSERT_GT(interfaceCells, 0) << "the level set should cross the mesh";
+
+    VecDestroy(&levelSetVec) >> errorChecker;
+}
+
+TEST_P(InterfaceReconstructionTestFixture, ShouldMatchScalarVOFFromMathFunction) {
+    // arrange
+    const auto& param = GetParam();
+    auto levelSet = ablate::mathFunctions::Create(param.levelSet);
+    DM domainDm;
+    DMClone(dm, &domainDm) >> errorChecker;
+    auto domain = std::make_shared<ablate::domain::DMTransfer>(domainDm, std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>>{});
+    ablate::levelSet::VOFMathFunction vofFunction(domain, levelSet);
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> errorChecker;
+
+    // act/assert
+    // the batched vof is reused for every cell at the same time
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        PetscReal centroid[3];
+        DMPlexComputeCellGeometryFVM(dm, c, nullptr, centroid, nullptr) >> errorChecker;
+        PetscScalar vof;
+        vofFunction.GetPetscFunction()(param.dim, 0.0, centroid, 1, &vof, vofFunction.GetContext()) >> errorChecker;
+
+        PetscReal expectedVof;
+        ablate::levelSet::Utilities::VOF(dm, c, levelSet, &expectedVof, nullptr, nullptr);
+        ASSERT_NEAR(expectedVof, vof, 1E-12) << "for cell " << c;
+    }
+}
+
+TEST_P(InterfaceReconstructionTestFixture, ShouldEvaluateLevelSetAtProjectionTime) {
+    // arrange
+    // the interface shrinks with time, so the vof at t = 1 differs from the vof at t = 0
+    const auto& param = GetParam();
+    auto levelSet = ablate::mathFunctions::Create(param.levelSet + " + 0.25*t");
+    const PetscReal time = 1.0;
+    DM domainDm;
+    DMClone(dm, &domainDm) >> errorChecker;
+    auto domain = std::make_shared<ablate::domain::DMTransfer>(domainDm, std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>>{});
+    ablate::levelSet::VOFMathFunction vofFunction(domain, levelSet);
+    ablate::domain::Range cellRange;
+    DMPlexGetHeightStratum(dm, 0, &cellRange.start, &cellRange.end) >> errorChecker;
+    ablate::levelSet::InterfaceReconstruction reconstruction(dm, cellRange);
+    std::vector<PetscReal> batchedVof(reconstruction.GetNumberCells());
+
+    // act
+    reconstruction.VOF(levelSet, time, batchedVof.data(), nullptr, nullptr);
+
+    // assert
+    PetscInt changedCells = 0;
+    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+        PetscReal centroid[3];
+        DMPlexComputeCellGeometryFVM(dm, c, nullptr, centroid, nullptr) >> errorChecker;
+        PetscScalar vof;
+        vofFunction.GetPetscFunction()(param.dim, time, centroid, 1, &vof, vofFunction.GetContext()) >> errorChecker;
+
+        PetscReal expectedVof, initialVof;
+        ablate::levelSet::Utilities::VOF(dm, c, levelSet, &expectedVof, nullptr, nullptr, time);
+        ablate::levelSet::Utilities::VOF(dm, c, levelSet, &initialVof, nullptr, nullptr);
+        ASSERT_NEAR(expectedVof, vof, 1E-12) << "for cell " << c;
+        ASSERT_NEAR(expectedVof, batchedVof[c - cellRange.start], 1E-12) << "for cell " << c;
+        changedCells += PetscAbsReal(expectedVof - initialVof) > 1E-6;
+    }
+    ASSERT_GT(changedCells, 0) << "the level set should move with time";
+}
+
+TEST_P(InterfaceReconstructionTestFixture, ShouldRebuildVOFWhenCoordinatesChange) {
+    // arrange
+    const auto& param = GetParam();
+    auto levelSet = ablate::mathFunctions::Create(param.levelSet);
+    DM domainDm;
+    DMClone(dm, &domainDm) >> errorChecker;
+    auto domain = std::make_shared<ablate::domain::DMTransfer>(domainDm, std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>>{});
+    ablate::levelSet::VOFMathFunction vofFunction(domain, levelSet);
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(domain->GetDM(), 0, &cStart, &cEnd) >> errorChecker;
+
+    // compute the cached vof on the original mesh
+    std::vector<PetscScalar> initialVof(cEnd - cStart);
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        PetscReal centroid[3];
+        DMPlexComputeCellGeometryFVM(domain->GetDM(), c, nullptr, centroid, nullptr) >> errorChecker;
+        vofFunction.GetPetscFunction()(param.dim, 0.0, centroid, 1, &initialVof[c - cStart], vofFunction.GetContext()) >> errorChecker;
+    }
+
+    // act
+    // shrink the mesh in place, the dm is unchanged but the coordinate state is not
+    Vec coordinates;
+    DMGetCoordinatesLocal(domain->GetDM(), &coordinates) >> errorChecker;
+    VecScale(coordinates, 0.98) >> errorChecker;
+    DMSetCoordinatesLocal(domain->GetDM(), coordinates) >> errorChecker;
+
+    // assert
+    PetscInt changedCells = 0;
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        PetscReal centroid[3];
+        DMPlexComputeCellGeometryFVM(domain->GetDM(), c, nullptr, centroid, nullptr) >> errorChecker;
+        PetscScalar vof;
+        vofFunction.GetPetscFunction()(param.dim, 0.0, centroid, 1, &vof, vofFunction.GetContext()) >> errorChecker;
+
+        PetscReal expectedVof;
+        ablate::levelSet::Utilities::VOF(domain->GetDM(), c, levelSet, &expectedVof, nullptr, nullptr);
+        ASSERT_NEAR(expectedVof, vof, 1E-12) << "for cell " << c;
+        changedCells += PetscAbsReal(expectedVof - initialVof[c - cStart]) > 1E-6;
+    }
+    ASSERT_GT(changedCells, 0) << "the vof should be recomputed on the moved mesh";
+}
+
+TEST_P(InterfaceReconstructionTestFixture, ShouldMatchScalarCellValGrad) {
+    // arrange
+    const auto& param = GetParam();
+    ablate::domain::Range cellRange;
+    DMPlexGetHeightStratum(dm, 0, &cellRange.start, &cellRange.end) >> errorChecker;
+    ablate::levelSet::InterfaceReconstruction reconstruction(dm, cellRange);
+    const PetscInt numberCells = reconstruction.GetNumberCells();
+    Vec levelSetVec = CreateVertexVec(ablate::mathFunctions::Create(param.levelSet));
+    Vec linearVec = CreateVertexVec(ablate::mathFunctions::Create(param.linearField));
+
+    // act
+    std::vector<PetscReal> c0(numberCells), g(numberCells * param.dim);
+    reconstruction.CellValGrad(vertexDm, levelSetVec, -1, c0.data(), g.data());
+    std::vector<PetscReal> linearGradient(numberCells * param.dim);
+    reconstruction.CellValGrad(vertexDm, linearVec, -1, nullptr, linearGradient.data());
+
+    // assert
+    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+        PetscReal expectedC0, expectedG[3];
+        ablate::levelSet::Utilities::CellValGrad(vertexDm, -1, c, levelSetVec, &expectedC0, expectedG);
+        const PetscInt i = c - cellRange.start;
+        ASSERT_NEAR(expectedC0, c0[i], 1E-10) << "for cell " << c;
+        for (PetscInt d = 0; d < param.dim; ++d) {
+            ASSERT_NEAR(expectedG[d], g[i * param.dim + d], 1E-10) << "for cell " << c << " direction " << d;
+            ASSERT_NEAR(param.linearGradient[d], linearGradient[i * param.dim + d], 1E-10) << "for cell " << c << " direction " << d;
+        }
+    }
+
+    VecDestroy(&linearVec) >> errorChecker;
+    VecDestroy(&levelSetVec) >> errorChecker;
+}
+
+INSTANTIATE_TEST_SUITE_P(LevelSetTests, InterfaceReconstructionTestFixture,
+                         testing::Values(
+                             (InterfaceReconstructionParameters){.name = "2D_Tri",
+                                                                 .dim = 2,
+                                                                 .simplex = PETSC_TRUE,
+                                                                 .faces = {8, 8},
+                                                                 .levelSet = "sqrt(x*x + y*y) - 0.55",
+                                                                 .linearField = "1.0 + 2.0*x - 3.0*y",
+                                                                 .linearGradient = {2.0, -3.0}},
+                             (InterfaceReconstructionParameters){.name = "2D_Quad",
+                                                                 .dim = 2,
+                                                                 .simplex = PETSC_FALSE,
+                                                                 .faces = {8, 8},
+                                                                 .levelSet = "sqrt(x*x + y*y) - 0.55",
+                                                                 .linearField = "1.0 + 2.0*x - 3.0*y",
+                                                                 .linearGradient = {2.0, -3.0}},
+                             (InterfaceReconstructionParameters){.name = "3D_Tetra",
+                                                                 .dim = 3,
+                                                                 .simplex = PETSC_TRUE,
+                                                                 .faces = {4, 4, 4},
+                                                                 .levelSet = "sqrt(x*x + y*y + z*z) - 0.55",
+                                                                 .linearField = "1.0 + 2.0*x - 3.0*y + 0.5*z",
+                                                                 .linearGradient = {2.0, -3.0, 0.5}},
+                             (InterfaceReconstructionParameters){.name = "3D_Hex",
+                                                                 .dim = 3,
+                                                                 .simplex = PETSC_FALSE,
+                                                                 .faces = {4, 4, 4},
+                                                                 .levelSet = "sqrt(x*x + y*y + z*z) - 0.55",
+                                                                 .linearField = "1.0 + 2.0*x - 3.0*y + 0.5*z",
+                                                                 .linearGradient = {2.0, -3.0, 0.5}}),
+                         [](const testing::TestParamInfo<InterfaceReconstructionParameters>& info) { return info.param.name; });
+
+}  // namespace ablateTesting::levelSet
@@ -0,0 +1,218 @@
+#include <petsc.h>
+#include <functional>
+#include <set>
+#include <vector>
+#include "domain/range.hpp"
+#include "gtest/gtest.h"
+#include "levelSet/narrowBand.hpp"
+#include "petscTestFixture.hpp"
+#include "utilities/petscSupport.hpp"
+
+namespace ablateTesting::levelSet {
+
+struct NarrowBandParameters {
+    std::string name;
+    PetscInt dim;
+    PetscBool simplex;
+    std::vector<PetscInt> faces;
+    PetscInt numberLevels;
+};
+
+class NarrowBandTestFixture : public testingResources::PetscTestFixture, public ::testing::WithParamInterface<NarrowBandParameters> {
+   protected:
+    DM dm = nullptr;
+    ablate::domain::Range cellRange;
+
+    void SetUp() override {
+        PetscTestFixture::SetUp();
+        const auto& param = GetParam();
+        std::vector<PetscReal> lower(param.dim, -1.0), upper(param.dim, 1.0);
+        DMPlexCreateBoxMesh(PETSC_COMM_SELF, param.dim, param.simplex, param.faces.data(), lower.data(), upper.data(), nullptr, PETSC_TRUE, 0, PETSC_TRUE, &dm) >> errorChecker;
+        DMPlexGetHeightStratum(dm, 0, &cellRange.start, &cellRange.end) >> errorChecker;
+    }
+
+    void TearDown() override { DMDestroy(&dm) >> errorChecker; }
+
+    /**
+     * The interface cells are the cells with a centroid within a cell size of a sphere
+     */
+    std::function<bool(PetscInt)> CreateInterface(PetscReal radius) {
+        const auto& param = GetParam();
+        const PetscReal h = 2.0 / (PetscReal)param.faces[0];
+        return [this, radius, h](PetscInt cell) {
+            PetscReal centroid[3] = {0.0, 0.0, 0.0};
+            DMPlexComputeCellGeometryFVM(dm, cell, nullptr, centroid, nullptr) >> errorChecker;
+            const PetscReal distance = PetscSqrtReal(PetscSqr(centroid[0]) + PetscSqr(centroid[1]) + PetscSqr(centroid[2])) - radius;
+            return PetscAbsReal(distance) < h;
+        };
+    }
+
+    /**
+     * Compute the band levels using a brute force search over the cells sharing a vertex
+     */
+    std::vector<PetscInt> ComputeExpectedLevels(const std::function<bool(PetscInt)>& isInterfaceCell, PetscInt numberLevels) {
+        std::vector<PetscInt> levels(cellRange.end - cellRange.start, -1);
+        std::vector<PetscInt> front;
+        for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+            if (isInterfaceCell(c)) {
+                levels[c - cellRange.start] = 0;
+                front.push_back(c);
+            }
+        }
+        for (PetscInt level = 1; level <= numberLevels; ++level) {
+            std::vector<PetscInt> nextFront;
+            for (const auto cell : front) {
+                PetscInt nVerts, *verts;
+                DMPlexCellGetVertices(dm, cell, &nVerts, &verts) >> errorChecker;
+                for (PetscInt v = 0; v < nVerts; ++v) {
+                    PetscInt nCells, *cells;
+                    DMPlexVertexGetCells(dm, verts[v], &nCells, &cells) >> errorChecker;
+                    for (PetscInt n = 0; n < nCells; ++n) {
+                        if (levels[cells[n] - cellRange.start] < 0) {
+                            levels[cells[n] - cellRange.start] = level;
+                            nextFront.push_back(cells[n]);
+                        }
+                    }
+                    DMPlexVertexRestoreCells(dm, verts[v], &nCells, &cells) >> errorChecker;
+                }
+                DMPlexCellRestoreVertices(dm, cell, &nVerts, &verts) >> errorChecker;
+            }
+            front = nextFront;
+        }
+        return levels;
+    }
+
+    void AssertBand(const ablate::levelSet::NarrowBand& narrowBand, const std::vector<PetscInt>& expectedLevels) {
+        std::vector<PetscInt> expectedCells;
+        std::set<PetscInt> expectedVertices;
+        for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+            ASSERT_EQ(expectedLevels[c - cellRange.start], narrowBand.GetLevel(c)) << "for cell " << c;
+            if (expectedLevels[c - cellRange.start] >= 0) {
+                expectedCells.push_back(c);
+                PetscInt nVerts, *verts;
+                DMPlexCellGetVertices(dm, c, &nVerts, &verts) >> errorChecker;
+                expectedVertices.insert(verts, verts + nVerts);
+                DMPlexCellRestoreVertices(dm, c, &nVerts, &verts) >> errorChecker;
+            }
+        }
+        ASSERT_EQ(expectedCells, narrowBand.GetCells());
+        ASSERT_EQ(std::vector<PetscInt>(expectedVertices.begin(), expectedVertices.end()), narrowBand.GetVertices());
+    }
+};
+
+TEST_P(NarrowBandTestFixture, ShouldMatchBruteForceBand) {
+    // arrange
+    const auto& param = GetParam();
+    ablate::levelSet::NarrowBand narrowBand(dm, cellRange, param.numberLevels);
+    auto isInterfaceCell = CreateInterface(0.5);
+
+    // act
+    narrowBand.Rebuild(isInterfaceCell);
+
+    // assert
+    ASSERT_FALSE(narrowBand.GetCells().empty());
+    ASSERT_LT(narrowBand.GetCells().size(), (std::size_t)(cellRange.end - cellRange.start));
+    AssertBand(narrowBand, ComputeExpectedLevels(isInterfaceCell, param.numberLevels));
+}
+
+TEST_P(NarrowBandTestFixture, ShouldUpdateAsInterfaceMoves) {
+    // arrange
+    const auto& param = GetParam();
+    ablate::levelSet::NarrowBand narrowBand(dm, cellRange, param.numberLevels);
+    narrowBand.Rebuild(CreateInterface(0.5));
+
+    // act/assert
+    // move the interface less than a cell each update
+    const PetscReal h = 2.0 / (PetscReal)param.faces[0];
+    for (PetscInt step = 1; step <= 4; ++step) {
+        auto isInterfaceCell = CreateInterface(0.5 + 0.5 * h * (PetscReal)step);
+        narrowBand.Update(isInterfaceCell);
+        AssertBand(narrowBand, ComputeExpectedLevels(isInterfaceCell, param.numberLevels));
+    }
+
+    // the band should be emptied if the interface leaves the domain
+    narrowBand.Update([](PetscInt) { return false; });
+    ASSERT_TRUE(narrowBand.GetCells().empty());
+    ASSERT_TRUE(narrowBand.GetVertices().empty());
+}
+
+TEST_P(NarrowBandTestFixture, ShouldKeepEmptyBandEmptyUntilRebuild) {
+    // arrange
+    const auto& param = GetParam();
+    ablate::levelSet::NarrowBand narrowBand(dm, cellRange, param.numberLevels);
+    narrowBand.Rebuild([](PetscInt) { return false; });
+    auto isInterfaceCell = CreateInterface(0.5);
+
+    // act
+    // the interface does not reach any cell outside of the range, so it is only found with a rebuild
+    narrowBand.Update(isInterfaceCell);
+
+    // assert
+    ASSERT_TRUE(narrowBand.GetCells().empty());
+    narrowBand.Rebuild(isInterfaceCell);
+    AssertBand(narrowBand, ComputeExpectedLevels(isInterfaceCell, param.numberLevels));
+}
+
+TEST_P(NarrowBandTestFixture, ShouldRebuildAtInterval) {
+    // arrange
+    const auto& param = GetParam();
+    const PetscInt rebuildInterval = 3;
+    ablate::levelSet::NarrowBand narrowBand(dm, cellRange, param.numberLevels, rebuildInterval);
+    narrowBand.Rebuild([](PetscInt) { return false; });
+    auto isInterfaceCell = CreateInterface(0.5);
+
+    // act/assert
+    for (PetscInt update = 1; update < rebuildInterval; ++update) {
+        narrowBand.Update(isInterfaceCell);
+        ASSERT_TRUE(narrowBand.GetCells().empty()) << "for update " << update;
+    }
+    narrowBand.Update(isInterfaceCell);
+    AssertBand(narrowBand, ComputeExpectedLevels(isInterfaceCell, param.numberLevels));
+}
+
+TEST_P(NarrowBandTestFixture, ShouldFindInterfaceOutsideOfRange) {
+    // arrange
+    // only report the cells with a negative x centroid, the interface is only in the cells just on the other side
+    const auto& param = GetParam();
+    const PetscReal h = 2.0 / (PetscReal)param.faces[0];
+    std::vector<PetscInt> rangeCells;
+    std::vector<PetscReal> centroidX(cellRange.end - cellRange.start);
+    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+        PetscReal centroid[3] = {0.0, 0.0, 0.0};
+        DMPlexComputeCellGeometryFVM(dm, c, nullptr, centroid, nullptr) >> errorChecker;
+        centroidX[c - cellRange.start] = centroid[0];
+        if (centroid[0] < 0.0) {
+            rangeCells.push_back(c);
+        }
+    }
+    ablate::domain::Range subRange{.start = 0, .end = (PetscInt)rangeCells.size(), .points = rangeCells.data()};
+    auto isInterfaceCell = [&](PetscInt cell) { return centroidX[cell - cellRange.start] > 0.0 && centroidX[cell - cellRange.start] < h; };
+    ablate::levelSet::NarrowBand narrowBand(dm, subRange, param.numberLevels);
+    narrowBand.Rebuild([](PetscInt) { return false; });
+
+    // act
+    // an update only checks the band and the cells outside of the range
+    narrowBand.Update(isInterfaceCell);
+
+    // assert
+    auto expectedLevels = ComputeExpectedLevels(isInterfaceCell, param.numberLevels);
+    std::vector<PetscInt> expectedCells;
+    for (const auto cell : rangeCells) {
+        ASSERT_EQ(expectedLevels[cell - cellRange.start], narrowBand.GetLevel(cell)) << "for cell " << cell;
+        if (expectedLevels[cell - cellRange.start] >= 0) {
+            expectedCells.push_back(cell);
+        }
+    }
+    ASSERT_FALSE(expectedCells.empty());
+    ASSERT_EQ(expectedCells, narrowBand.GetCells());
+}
+
+INSTANTIATE_TEST_SUITE_P(LevelSetTests, NarrowBandTestFixture,
+                         testing::Values((NarrowBandParameters){.name = "2D_Tri", .dim = 2, .simplex = PETSC_TRUE, .faces = {20, 20}, .numberLevels = 2},
+                                         (NarrowBandParameters){.name = "2D_Quad", .dim = 2, .simplex = PETSC_FALSE, .faces = {20, 20}, .numberLevels = 1},
+                                         (NarrowBandParameters){.name = "2D_Quad_Wide", .dim = 2, .simplex = PETSC_FALSE, .faces = {20, 20}, .numberLevels = 4},
+                                         (NarrowBandParameters){.name = "3D_Tetra", .dim = 3, .simplex = PETSC_TRUE, .faces = {8, 8, 8}, .numberLevels = 2},
+                                         (NarrowBandParameters){.name = "3D_Hex", .dim = 3, .simplex = PETSC_FALSE, .faces = {8, 8, 8}, .numberLevels = 2}),
+                         [](const testing::TestParamInfo<NarrowBandParameters>& info) { return info.param.name; });
+
+}  // namespace ablateTesting::levelSet
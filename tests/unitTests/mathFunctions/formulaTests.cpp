@@ -77,6 +77,23 @@ TEST_P(FormulaScalarFixture, ShouldComputeCorrectAnswerFromCoord) {
     ASSERT_DOUBLE_EQ(param.expectedResult, function.Eval(array1, 3, 4.0));
 }
 
+TEST_P(FormulaScalarFixture, ShouldComputeCorrectAnswerForManyPoints) {
+    // arrange
+    const auto& param = GetParam();
+    auto function = ablate::mathFunctions::Formula(param.formula, ToFunctionMap(param.nested), param.constants);
+
+    const double points[9] = {1.0, 2.0, 3.0, 1.0, 2.0, 3.0, 1.0, 2.0, 3.0};
+    double result[3] = {NAN, NAN, NAN};
+
+    // act
+    function.Eval(points, 3, 3, 4.0, result);
+
+    // assert
+    for (const auto& value : result) {
+        ASSERT_DOUBLE_EQ(param.expectedResult, value);
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(FormulaTests, FormulaScalarFixture,
                          testing::Values((FormulaScalarParameters){.formula = "v*x", .nested = {{"v", "2.0"}}, .constants = {}, .expectedResult = 2.0},
                                          (FormulaScalarParameters){.formula = "v*x + z", .nested = {{"v", "3.0*y"}}, .constants = {}, .expectedResult = 9.0},
@@ -1,4 +1,8 @@
+#include <algorithm>
+#include <limits>
+#include <map>
 #include <memory>
+#include <random>
 #include "gtest/gtest.h"
 #include "mathFunctions/functionFactory.hpp"
 #include "mathFunctions/geom/box.hpp"
@@ -56,6 +60,34 @@ TEST_P(GeometryTestScalarFixture, ShouldComputeCorrectAnswerFromCoord) {
     }
 }
 
+TEST_P(GeometryTestScalarFixture, ShouldComputeCorrectAnswerFromBulkEval) {
+    // arrange
+    const auto& param = GetParam();
+    auto function = param.createGeom();
+
+    // batch the points of each dimension together
+    std::map<std::size_t, std::vector<ExpectedValue<double>>> pointsByDimension;
+    for (const auto& expectedResult : param.expectedResults) {
+        pointsByDimension[expectedResult.xyz.size()].push_back(expectedResult);
+    }
+
+    for (const auto& [ndims, points] : pointsByDimension) {
+        std::vector<double> xyz;
+        for (const auto& point : points) {
+            xyz.insert(xyz.end(), point.xyz.begin(), point.xyz.end());
+        }
+        std::vector<double> result(points.size(), NAN);
+
+        // act
+        function->Eval(xyz.data(), (int)ndims, points.size(), NAN, result.data());
+
+        // assert
+        for (std::size_t p = 0; p < points.size(); ++p) {
+            ASSERT_DOUBLE_EQ(points[p].value, result[p]) << " at point " << p << " of dimension " << ndims;
+        }
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(
     GeometryTests, GeometryTestScalarFixture,
     testing::Values(
@@ -663,4 +695,198 @@ INSTANTIATE_TEST_SUITE_P(
 
                                        }}));
 
+static std::vector<std::shared_ptr<Geometry>> CreateMixedGeometries() {
+    return {std::make_shared<Sphere>(std::vector<double>{.5, .5, .5}, .25),
+            std::make_shared<Sphere>(std::vector<double>{-1.0, .5}, .5),
+            std::make_shared<Box>(std::vector<double>{1.0, -1.5, -.5}, std::vector<double>{1.5, -1.0, .5}),
+            std::make_shared<Box>(std::vector<double>{-2.0}, std::vector<double>{-1.75}),
+            std::make_shared<CylinderShell>(std::vector<double>{0.0, -1.0, -1.0}, std::vector<double>{1.0, 0.0, 1.0}, .1, .3),
+            std::make_shared<Cylinder>(std::vector<double>{-1.0, -1.0}, std::vector<double>{-.5, -1.5}, .2),
+            std::make_shared<Triangle>(std::vector<double>{1.0, 1.0, 0.0}, std::vector<double>{2.0, 1.0, 0.0}, std::vector<double>{1.0, 2.0, 0.0}),
+            std::make_shared<Triangle>(std::vector<double>{0.0, 1.0, 0.0}, std::vector<double>{1.0, 1.0, 1.0}, std::vector<double>{0.0, 2.0, 0.5}, .2),
+            std::make_shared<ConvexPolygon>(std::vector<std::vector<double>>{{1.0, 2.0, .5}, {2.0, 2.0, .5}, {2.0, 3.0, 0.5}, {1.0, 3.0, 0.5}}, 0.25),
+            std::make_shared<Difference>(std::make_shared<Sphere>(std::vector<double>{-.5, 1.5, -.5}, .75),
+                                         std::make_shared<Box>(std::vector<double>{-.5, 1.0, -2.0}, std::vector<double>{2.0, 2.0, 2.0})),
+            std::make_shared<Union>(std::vector<std::shared_ptr<Geometry>>{std::make_shared<Sphere>(std::vector<double>{2.0, -2.0, 2.0}, .4),
+                                                                           std::make_shared<Sphere>(std::vector<double>{-2.0, 2.0, -2.0}, .4)})};
+}
+
+static std::vector<double> CreateTestPoints(std::size_t numberPoints, int ndims, double extent) {
+    std::mt19937 generator(26);
+    std::uniform_real_distribution<double> distribution(-extent, extent);
+    std::vector<double> xyz(numberPoints * ndims);
+    std::generate(xyz.begin(), xyz.end(), [&]() { return distribution(generator); });
+    return xyz;
+}
+
+TEST(GeometryBoundsTests, ShouldContainAllInsidePoints) {
+    // arrange
+    auto geometries = CreateMixedGeometries();
+    geometries.push_back(std::make_shared<Inverse>(geometries.front()));
+
+    for (int ndims = 2; ndims <= 3; ndims++) {
+        const std::size_t numberPoints = 20000;
+        const auto xyz = CreateTestPoints(numberPoints, ndims, 3.0);
+
+        for (const auto& geometry : geometries) {
+            // act
+            const auto bounds = geometry->GetBoundingBox();
+
+            // assert
+            for (std::size_t p = 0; p < numberPoints; p++) {
+                if (geometry->InsideGeometry(xyz.data() + p * ndims, ndims, 0.0)) {
+                    ASSERT_TRUE(bounds.Contains(xyz.data() + p * ndims, ndims)) << "for point " << p << " in " << ndims << "D";
+                }
+            }
+        }
+    }
+}
+
+TEST(GeometryBoundsTests, ShouldComputeBoundsForComposites) {
+    // arrange
+    auto sphere = std::make_shared<Sphere>(std::vector<double>{1.0, 2.0, 3.0}, .5);
+    auto box = std::make_shared<Box>(std::vector<double>{-1.0, -1.0, -1.0}, std::vector<double>{0.0, 0.0, 0.0});
+    Union unionGeometry({sphere, box});
+    Difference difference(sphere, box);
+    Inverse inverse(sphere);
+
+    // act
+    auto unionBounds = unionGeometry.GetBoundingBox();
+    auto differenceBounds = difference.GetBoundingBox();
+    auto inverseBounds = inverse.GetBoundingBox();
+
+    // assert
+    for (std::size_t d = 0; d < 3; d++) {
+        ASSERT_DOUBLE_EQ(unionBounds.lower[d], -1.0);
+        ASSERT_DOUBLE_EQ(unionBounds.upper[d], d + 1.5);
+        ASSERT_DOUBLE_EQ(differenceBounds.lower[d], d + 0.5);
+        ASSERT_DOUBLE_EQ(differenceBounds.upper[d], d + 1.5);
+        ASSERT_EQ(inverseBounds.lower[d], -std::numeric_limits<double>::infinity());
+        ASSERT_EQ(inverseBounds.upper[d], std::numeric_limits<double>::infinity());
+    }
+}
+
+TEST(UnionTests, ShouldMatchBruteForceForManySpheres) {
+    // arrange
+    std::mt19937 generator(44);
+    std::uniform_real_distribution<double> centerDistribution(-1.0, 1.0);
+    std::uniform_real_distribution<double> radiusDistribution(.01, .05);
+    std::vector<std::shared_ptr<Geometry>> spheres;
+    for (std::size_t s = 0; s < 1000; s++) {
+        spheres.push_back(
+            std::make_shared<Sphere>(std::vector<double>{centerDistribution(generator), centerDistribution(generator), centerDistribution(generator)}, radiusDistribution(generator)));
+    }
+    auto unionGeometry = std::make_shared<Union>(spheres);
+
+    const std::size_t numberPoints = 5000;
+    const auto xyz = CreateTestPoints(numberPoints, 3, 1.1);
+
+    // act
+    std::vector<bool> batchInside;
+    unionGeometry->InsideGeometryBatch(xyz.data(), 3, numberPoints, 0.0, batchInside);
+
+    // assert
+    std::size_t insideCount = 0;
+    for (std::size_t p = 0; p < numberPoints; p++) {
+        const double* point = xyz.data() + p * 3;
+        const bool expected = std::any_of(spheres.begin(), spheres.end(), [point](const auto& sphere) { return sphere->InsideGeometry(point, 3, 0.0); });
+        ASSERT_EQ(expected, unionGeometry->InsideGeometry(point, 3, 0.0)) << "for point " << p;
+        ASSERT_EQ(expected, batchInside[p]) << "for point " << p;
+        insideCount += expected;
+    }
+    ASSERT_GT(insideCount, 0u) << "the test points should include inside points";
+}
+
+TEST(UnionTests, ShouldMatchSinglePointEvalWithBulkEval) {
+    // arrange
+    std::mt19937 generator(45);
+    std::uniform_real_distribution<double> centerDistribution(-1.0, 1.0);
+    std::uniform_real_distribution<double> radiusDistribution(.05, .2);
+    std::vector<std::shared_ptr<Geometry>> spheres;
+    for (std::size_t s = 0; s < 100; s++) {
+        spheres.push_back(
+            std::make_shared<Sphere>(std::vector<double>{centerDistribution(generator), centerDistribution(generator), centerDistribution(generator)}, radiusDistribution(generator)));
+    }
+    auto unionGeometry = std::make_shared<Union>(spheres, ablate::mathFunctions::Create("x + 2*y + 3*z"), ablate::mathFunctions::Create(-10.0));
+
+    const std::size_t numberPoints = 2000;
+    const auto xyz = CreateTestPoints(numberPoints, 3, 1.1);
+    std::vector<double> result(numberPoints, NAN);
+
+    // act
+    unionGeometry->Eval(xyz.data(), 3, numberPoints, 0.0, result.data());
+
+    // assert
+    std::size_t insideCount = 0;
+    for (std::size_t p = 0; p < numberPoints; p++) {
+        const double* point = xyz.data() + p * 3;
+        ASSERT_DOUBLE_EQ(unionGeometry->Eval(point, 3, 0.0), result[p]) << "for point " << p;
+        insideCount += unionGeometry->InsideGeometry(point, 3, 0.0);
+    }
+    ASSERT_GT(insideCount, 0u) << "the test points should include inside points";
+    ASSERT_LT(insideCount, numberPoints) << "the test points should include outside points";
+}
+
+TEST(UnionTests, ShouldMatchBruteForceForMixedGeometries) {
+    // arrange
+    auto geometries = CreateMixedGeometries();
+    geometries.push_back(std::make_shared<Inverse>(std::make_shared<Sphere>(std::vector<double>{0.0, 0.0, 0.0}, 2.75)));
+    auto unionGeometry = std::make_shared<Union>(geometries);
+    auto inverseGeometry = std::make_shared<Inverse>(unionGeometry);
+
+    for (int ndims = 2; ndims <= 3; ndims++) {
+        const std::size_t numberPoints = 5000;
+        const auto xyz = CreateTestPoints(numberPoints, ndims, 3.0);
+
+        // act
+        std::vector<bool> batchInside;
+        unionGeometry->InsideGeometryBatch(xyz.data(), ndims, numberPoints, 0.0, batchInside);
+        std::vector<bool> batchInverse;
+        inverseGeometry->InsideGeometryBatch(xyz.data(), ndims, numberPoints, 0.0, batchInverse);
+
+        // assert
+        for (std::size_t p = 0; p < numberPoints; p++) {
+            const double* point = xyz.data() + p * ndims;
+            const bool expected = std::any_of(geometries.begin(), geometries.end(), [point, ndims](const auto& geometry) { return geometry->InsideGeometry(point, ndims, 0.0); });
+            ASSERT_EQ(expected, unionGeometry->InsideGeometry(point, ndims, 0.0)) << "for point " << p << " in " << ndims << "D";
+            ASSERT_EQ(expected, batchInside[p]) << "for point " << p << " in " << ndims << "D";
+            ASSERT_EQ(!expected, batchInverse[p]) << "for point " << p << " in " << ndims << "D";
+        }
+    }
+}
+
+TEST(SurfaceTests, ShouldMatchExactCadQueries) {
+    // arrange
+    Surface acceleratedSurface("inputs/mathFunctions/geom/testShape_m.step", {}, {}, 0, 2E-4);
+    Surface exactSurface("inputs/mathFunctions/geom/testShape_m.step");
+
+    // act/assert
+    const int numberPoints = 9;
+    std::size_t insideCount = 0;
+    for (int i = 0; i < numberPoints; i++) {
+        for (int j = 0; j < numberPoints; j++) {
+            for (int k = 0; k < numberPoints; k++) {
+                const double xyz[3] = {-0.05 + 0.1 * i / (numberPoints - 1), -0.05 + 0.1 * j / (numberPoints - 1), -0.05 + 0.1 * k / (numberPoints - 1)};
+                const bool inside = exactSurface.InsideGeometry(xyz, 3, 0.0);
+                ASSERT_EQ(inside, acceleratedSurface.InsideGeometry(xyz, 3, 0.0)) << "for point " << xyz[0] << ", " << xyz[1] << ", " << xyz[2];
+                insideCount += inside;
+            }
+        }
+    }
+    ASSERT_GT(insideCount, 0u) << "the test points should include inside points";
+}
+
+TEST(SurfaceTests, ShouldComputeDistanceToSurface) {
+    // arrange
+    Surface surface("inputs/mathFunctions/geom/testShape_m.step", {}, {}, 0, 2E-4);
+    const double farPoint[3] = {0.0, 1.0, 0.0};
+    const double insidePoint[3] = {0.0, 0.0, 0.0};
+
+    // act/assert
+    ASSERT_GT(surface.Distance(farPoint, 3), 0.9);
+    ASSERT_GT(surface.Distance(insidePoint, 3), 0.0);
+    ASSERT_LT(surface.Distance(insidePoint, 3), 0.05);
+    ASSERT_ANY_THROW(Surface("inputs/mathFunctions/geom/testShape_m.step").Distance(farPoint, 3));
+}
+
 }  // namespace ablateTesting::mathFunctions::geom
\ No newline at end of file
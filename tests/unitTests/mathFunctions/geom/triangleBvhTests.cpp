@@ -0,0 +1,102 @@
+#include <cmath>
+#include <random>
+#include "gtest/gtest.h"
+#include "mathFunctions/geom/triangleBvh.hpp"
+
+namespace ablateTesting::mathFunctions::geom {
+
+/**
+ * build a closed, refined cube surface [0, 1]^3 with n x n quads (two triangles each) per side
+ */
+static ablate::mathFunctions::geom::TriangleBvh CreateCube(std::size_t n) {
+    std::vector<double> vertices;
+    std::vector<std::size_t> triangles;
+    for (std::size_t axis = 0; axis < 3; axis++) {
+        for (double side : {0.0, 1.0}) {
+            const std::size_t offset = vertices.size() / 3;
+            for (std::size_t i = 0; i <= n; i++) {
+                for (std::size_t j = 0; j <= n; j++) {
+                    double point[3];
+                    point[axis] = side;
+                    point[(axis + 1) % 3] = (double)i / (double)n;
+                    point[(axis + 2) % 3] = (double)j / (double)n;
+                    vertices.insert(vertices.end(), point, point + 3);
+                }
+            }
+            for (std::size_t i = 0; i < n; i++) {
+                for (std::size_t j = 0; j < n; j++) {
+                    const std::size_t corner = offset + i * (n + 1) + j;
+                    triangles.insert(triangles.end(), {corner, corner + n + 1, corner + 1, corner + 1, corner + n + 1, corner + n + 2});
+                }
+            }
+        }
+    }
+    return {vertices, triangles};
+}
+
+TEST(TriangleBvhTests, ShouldDetermineInsideOfClosedSurface) {
+    // arrange
+    auto bvh = CreateCube(8);
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> distribution(-0.5, 1.5);
+
+    // act/assert
+    std::size_t decided = 0;
+    for (std::size_t p = 0; p < 1000; p++) {
+        const double xyz[3] = {distribution(generator), distribution(generator), distribution(generator)};
+        const bool expected = xyz[0] > 0 && xyz[0] < 1 && xyz[1] > 0 && xyz[1] < 1 && xyz[2] > 0 && xyz[2] < 1;
+        bool inside;
+        if (bvh.Inside(xyz, inside)) {
+            decided++;
+            ASSERT_EQ(expected, inside) << "for point " << xyz[0] << ", " << xyz[1] << ", " << xyz[2];
+        }
+    }
+    // only rays passing through edges or vertices should be undecided
+    ASSERT_GT(decided, 990u);
+}
+
+TEST(TriangleBvhTests, ShouldComputeDistanceToSurface) {
+    // arrange
+    auto bvh = CreateCube(4);
+    std::mt19937 generator(11);
+    std::uniform_real_distribution<double> distribution(-0.5, 1.5);
+
+    // act/assert
+    for (std::size_t p = 0; p < 1000; p++) {
+        const double xyz[3] = {distribution(generator), distribution(generator), distribution(generator)};
+
+        // compute the exact distance to the cube surface
+        double expected;
+        double outside = 0.0;
+        double insideDistance = 1.0;
+        for (double value : xyz) {
+            const double delta = std::max({-value, 0.0, value - 1.0});
+            outside += delta * delta;
+            insideDistance = std::min({insideDistance, value, 1.0 - value});
+        }
+        expected = outside > 0 ? std::sqrt(outside) : insideDistance;
+
+        ASSERT_NEAR(expected, bvh.Distance(xyz), 1E-12);
+        ASSERT_TRUE(bvh.WithinDistance(xyz, expected + 1E-10));
+        ASSERT_FALSE(bvh.WithinDistance(xyz, expected * 0.99 - 1E-10));
+    }
+}
+
+TEST(TriangleBvhTests, ShouldComputeBoundingBox) {
+    // arrange
+    auto bvh = CreateCube(2);
+
+    // act/assert
+    ASSERT_EQ(bvh.Size(), 6u * 2 * 2 * 2);
+    for (std::size_t d = 0; d < 3; d++) {
+        ASSERT_DOUBLE_EQ(0.0, bvh.GetLower()[d]);
+        ASSERT_DOUBLE_EQ(1.0, bvh.GetUpper()[d]);
+    }
+}
+
+TEST(TriangleBvhTests, ShouldThrowForInvalidTriangles) {
+    ASSERT_ANY_THROW(ablate::mathFunctions::geom::TriangleBvh({0, 0, 0, 1, 0, 0, 0, 1, 0}, {0, 1}));
+    ASSERT_ANY_THROW(ablate::mathFunctions::geom::TriangleBvh({0, 0, 0, 1, 0, 0, 0, 1, 0}, {0, 1, 3}));
+}
+
+}  // namespace ablateTesting::mathFunctions::geom
@@ -64,6 +64,69 @@ TEST(LinearInterpolatorTests, ShouldThrowErrorForMissingYColumn) {
     ASSERT_THROW(ablate::mathFunctions::LinearTable(csvFileStream, "x", {"z", "y"}, ablate::mathFunctions::Create(ToXFunction)), std::invalid_argument);
 }
 
+TEST(LinearTableTests, ShouldStoreDecreasingTableInIncreasingOrder) {
+    // arrange
+    std::string csvFileString =
+        "x, y\n"
+        ".3, 1.1\n"
+        ".2, 2.2\n"
+        ".1, 3.3\n";
+    std::istringstream csvFileStream(csvFileString);
+
+    // act
+    ablate::mathFunctions::LinearTable interpolator(csvFileStream, "x", {"y"}, ablate::mathFunctions::Create(ToXFunction));
+
+    // assert
+    ASSERT_EQ(interpolator.GetIndependentValues(), std::vector<double>({.1, .2, .3}));
+    ASSERT_EQ(interpolator.GetDependentValues()[0], std::vector<double>({3.3, 2.2, 1.1}));
+    ASSERT_DOUBLE_EQ(interpolator.Eval(.25, 0.0, 0.0, 0.0), 1.65);
+}
+
+TEST(LinearTableTests, ShouldThrowErrorForNonMonotonicXColumn) {
+    // arrange
+    std::string csvFileString =
+        "x, y\n"
+        ".1, 1.1\n"
+        ".3, 2.2\n"
+        ".2, 3.3\n";
+    std::istringstream csvFileStream(csvFileString);
+
+    // act
+    // assert
+    ASSERT_THROW(ablate::mathFunctions::LinearTable(csvFileStream, "x", {"y"}, ablate::mathFunctions::Create(ToXFunction)), std::invalid_argument);
+}
+
+TEST(LinearTableTests, ShouldInterpolateManyPointsAndColumns) {
+    // arrange
+    // build a long uniform table of y = 2x and z = x*x
+    std::stringstream csvFileStream;
+    csvFileStream << "x, y, z\n";
+    for (int i = 0; i <= 1000; i++) {
+        csvFileStream << i / 1000.0 << ", " << 2.0 * i / 1000.0 << ", " << (i / 1000.0) * (i / 1000.0) << "\n";
+    }
+    ablate::mathFunctions::LinearTable interpolator(csvFileStream, "x", {"y", "z"}, ablate::mathFunctions::Create(ToXFunction));
+    std::vector<double> xyz = {-1.0, 0.0, 0.1234, 0.5, 0.9999, 2.0};
+    std::vector<double> result(xyz.size() * 2);
+    std::vector<double> firstColumn(xyz.size());
+
+    // act
+    interpolator.EvalAllColumns(xyz.data(), 1, xyz.size(), 0.0, result.data());
+    interpolator.Eval(xyz.data(), 1, xyz.size(), 0.0, firstColumn.data());
+
+    // assert
+    for (std::size_t p = 0; p < xyz.size(); p++) {
+        std::vector<double> expected(2);
+        interpolator.Eval(&xyz[p], 1, 0.0, expected);
+        ASSERT_DOUBLE_EQ(result[p * 2], expected[0]);
+        ASSERT_DOUBLE_EQ(result[p * 2 + 1], expected[1]);
+        ASSERT_DOUBLE_EQ(firstColumn[p], interpolator.Eval(&xyz[p], 1, 0.0)) << "the bulk Eval should match the single value Eval";
+    }
+    ASSERT_DOUBLE_EQ(result[0], 0.0) << "should not extrapolate below the table";
+    ASSERT_NEAR(result[2 * 2], 0.2468, 1E-12);
+    ASSERT_NEAR(result[2 * 2 + 1], 0.1234 * 0.1234, 1E-6);
+    ASSERT_DOUBLE_EQ(result[5 * 2], 2.0) << "should not extrapolate above the table";
+}
+
 struct LinearTableTestParameters {
     std::vector<std::string> yColumns;
     std::vector<PetscReal> xyz;
@@ -0,0 +1,104 @@
+#include <memory>
+#include "gtest/gtest.h"
+#include "mathFunctions/functionFactory.hpp"
+#include "mathFunctions/multilinearTable.hpp"
+
+namespace ablateTesting::mathFunctions {
+
+static int ToXYFunction(int dim, double time, const double x[], int nf, double* u, void* ctx) {
+    u[0] = x[0];
+    u[1] = x[1];
+    return 0;
+}
+
+TEST(MultilinearTableTests, ShouldInterpolateBilinearTable) {
+    // arrange
+    // z = 1 + 2x + 3y + 4xy on an unordered, non-uniform grid
+    std::string csvFileString =
+        "y, x, z, w\n"
+        "0, 0, 1, 0\n"
+        "1, 2, 16, 1\n"
+        "0, 0.5, 2, 0\n"
+        "0, 2, 5, 0\n"
+        "1, 0, 4, 1\n"
+        "1, 0.5, 7, 1\n";
+    std::istringstream csvFileStream(csvFileString);
+    ablate::mathFunctions::MultilinearTable table(csvFileStream, {"x", "y"}, {"z", "w"}, ablate::mathFunctions::Create(ToXYFunction));
+    std::vector<double> result(2);
+
+    // act
+    double xyz[2] = {1.25, 0.25};
+    table.Eval(xyz, 2, 0.0, result);
+
+    // assert
+    ASSERT_DOUBLE_EQ(result[0], 1 + 2 * 1.25 + 3 * 0.25 + 4 * 1.25 * 0.25);
+    ASSERT_DOUBLE_EQ(result[1], 0.25);
+    ASSERT_DOUBLE_EQ(table.Eval(0.5, 1.0, 0.0, 0.0), 7.0);
+    ASSERT_DOUBLE_EQ(table.Eval(-10.0, 10.0, 0.0, 0.0), 4.0) << "should not extrapolate";
+}
+
+TEST(MultilinearTableTests, ShouldInterpolateManyPoints) {
+    // arrange
+    std::string csvFileString =
+        "x, y, z\n"
+        "0, 0, 0\n"
+        "1, 0, 1\n"
+        "0, 1, 2\n"
+        "1, 1, 3\n";
+    std::istringstream csvFileStream(csvFileString);
+    ablate::mathFunctions::MultilinearTable table(csvFileStream, {"x", "y"}, {"z"}, ablate::mathFunctions::Create(ToXYFunction));
+    std::vector<double> xyz = {0.0, 0.0, 0.5, 0.5, 1.0, 0.25};
+    std::vector<double> result(3);
+
+    // act
+    table.Eval(xyz.data(), 2, 3, 0.0, result.data());
+
+    // assert
+    ASSERT_DOUBLE_EQ(result[0], 0.0);
+    ASSERT_DOUBLE_EQ(result[1], 1.5);
+    ASSERT_DOUBLE_EQ(result[2], 1.5);
+}
+
+TEST(MultilinearTableTests, ShouldInterpolateManyPointsAndColumns) {
+    // arrange
+    // z = x + 2y and w = 10 + x
+    std::string csvFileString =
+        "x, y, z, w\n"
+        "0, 0, 0, 10\n"
+        "1, 0, 1, 11\n"
+        "0, 1, 2, 10\n"
+        "1, 1, 3, 11\n";
+    std::istringstream csvFileStream(csvFileString);
+    ablate::mathFunctions::MultilinearTable table(csvFileStream, {"x", "y"}, {"z", "w"}, ablate::mathFunctions::Create(ToXYFunction));
+    std::vector<double> xyz = {0.0, 0.0, 0.5, 0.5, 1.0, 0.25};
+    std::vector<double> firstColumn(3);
+    std::vector<double> allColumns(3 * 2);
+
+    // act
+    table.Eval(xyz.data(), 2, 3, 0.0, firstColumn.data());
+    table.EvalAllColumns(xyz.data(), 2, 3, 0.0, allColumns.data());
+
+    // assert
+    // the bulk Eval returns one value per point, matching the single value Eval
+    for (std::size_t p = 0; p < 3; p++) {
+        ASSERT_DOUBLE_EQ(firstColumn[p], table.Eval(&xyz[2 * p], 2, 0.0));
+        ASSERT_DOUBLE_EQ(allColumns[2 * p], xyz[2 * p] + 2 * xyz[2 * p + 1]);
+        ASSERT_DOUBLE_EQ(allColumns[2 * p + 1], 10 + xyz[2 * p]);
+    }
+}
+
+TEST(MultilinearTableTests, ShouldThrowErrorForIncompleteGrid) {
+    // arrange
+    std::string csvFileString =
+        "x, y, z\n"
+        "0, 0, 0\n"
+        "1, 0, 1\n"
+        "0, 1, 2\n";
+    std::istringstream csvFileStream(csvFileString);
+
+    // act
+    // assert
+    ASSERT_THROW(ablate::mathFunctions::MultilinearTable(csvFileStream, {"x", "y"}, {"z"}, ablate::mathFunctions::Create(ToXYFunction)), std::invalid_argument);
+}
+
+}  // namespace ablateTesting::mathFunctions
@@ -0,0 +1,104 @@
+#include <memory>
+#include "gtest/gtest.h"
+#include "mathFunctions/inverseDistanceWeighted.hpp"
+#include "mathFunctions/nearestPoint.hpp"
+#include "mockFactory.hpp"
+#include "registrar.hpp"
+
+namespace ablateTesting::mathFunctions {
+
+TEST(NearestPointTests, ShouldBeCreatedFromRegistrar) {
+    // arrange
+    std::shared_ptr<cppParserTesting::MockFactory> mockFactory = std::make_shared<cppParserTesting::MockFactory>();
+    const std::string expectedClassType = "ablate::mathFunctions::NearestPoint";
+    EXPECT_CALL(*mockFactory, GetClassType()).Times(::testing::Exactly(1)).WillOnce(::testing::ReturnRef(expectedClassType));
+    EXPECT_CALL(*mockFactory, Get(cppParser::ArgumentIdentifier<std::vector<double>>{.inputName = "coordinates", .description = "", .optional = false}))
+        .Times(::testing::Exactly(1))
+        .WillOnce(::testing::Return(std::vector<double>{0.0, 0.0, 1.0, 1.0}));
+    EXPECT_CALL(*mockFactory, Get(cppParser::ArgumentIdentifier<std::vector<double>>{.inputName = "values", .description = "", .optional = false}))
+        .Times(::testing::Exactly(1))
+        .WillOnce(::testing::Return(std::vector<double>{1.0, 2.0}));
+
+    // act
+    auto createMethod = Creator<ablate::mathFunctions::MathFunction>::GetCreateMethod(mockFactory->GetClassType());
+    auto instance = createMethod(mockFactory);
+
+    // assert
+    ASSERT_TRUE(instance != nullptr) << " should create an instance of the MathFunction";
+    ASSERT_TRUE(std::dynamic_pointer_cast<ablate::mathFunctions::NearestPoint>(instance) != nullptr) << " should be an instance of NearestPoint";
+}
+
+TEST(NearestPointTests, ShouldEvalToNearestValue) {
+    // arrange
+    auto function = ablate::mathFunctions::NearestPoint({0.0, 0.0, 1.0, 0.0, 0.0, 1.0, 1.0, 1.0}, {1.0, 2.0, 3.0, 4.0});
+    std::vector<double> result(1);
+
+    // act/assert
+    ASSERT_DOUBLE_EQ(function.Eval(0.1, 0.2, 5.0, 0.0), 1.0);
+    ASSERT_DOUBLE_EQ(function.Eval(0.9, -0.2, 0.0, 0.0), 2.0);
+    double xyz[2] = {0.2, 0.7};
+    ASSERT_DOUBLE_EQ(function.Eval(xyz, 2, 0.0), 3.0);
+    function.Eval(2.0, 2.0, 0.0, 0.0, result);
+    ASSERT_DOUBLE_EQ(result[0], 4.0);
+    // when only one dimension is provided only x is compared
+    double x[1] = {0.9};
+    ASSERT_DOUBLE_EQ(function.Eval(x, 1, 0.0), 2.0);
+}
+
+TEST(NearestPointTests, ShouldThrowForMismatchedCoordinates) {
+    ASSERT_ANY_THROW(ablate::mathFunctions::NearestPoint({0.0, 0.0, 1.0}, {1.0, 2.0}));
+    ASSERT_ANY_THROW(ablate::mathFunctions::NearestPoint({0.0, 0.0, 1.0, 0.0, 0.0, 1.0, 1.0, 1.0}, {1.0}));
+}
+
+TEST(InverseDistanceWeightedTests, ShouldBeCreatedFromRegistrar) {
+    // arrange
+    std::shared_ptr<cppParserTesting::MockFactory> mockFactory = std::make_shared<cppParserTesting::MockFactory>();
+    const std::string expectedClassType = "ablate::mathFunctions::InverseDistanceWeighted";
+    EXPECT_CALL(*mockFactory, GetClassType()).Times(::testing::Exactly(1)).WillOnce(::testing::ReturnRef(expectedClassType));
+    EXPECT_CALL(*mockFactory, Get(cppParser::ArgumentIdentifier<std::vector<double>>{.inputName = "coordinates", .description = "", .optional = false}))
+        .Times(::testing::Exactly(1))
+        .WillOnce(::testing::Return(std::vector<double>{0.0, 0.0, 1.0, 1.0}));
+    EXPECT_CALL(*mockFactory, Get(cppParser::ArgumentIdentifier<std::vector<double>>{.inputName = "values", .description = "", .optional = false}))
+        .Times(::testing::Exactly(1))
+        .WillOnce(::testing::Return(std::vector<double>{1.0, 2.0}));
+    EXPECT_CALL(*mockFactory, Get(cppParser::ArgumentIdentifier<int>{.inputName = "neighbors", .description = "", .optional = true})).Times(::testing::Exactly(1)).WillOnce(::testing::Return(2));
+    EXPECT_CALL(*mockFactory, Get(cppParser::ArgumentIdentifier<double>{.inputName = "power", .description = "", .optional = true})).Times(::testing::Exactly(1)).WillOnce(::testing::Return(1.0));
+    EXPECT_CALL(*mockFactory, Get(cppParser::ArgumentIdentifier<double>{.inputName = "radius", .description = "", .optional = true})).Times(::testing::Exactly(1)).WillOnce(::testing::Return(0.0));
+
+    // act
+    auto createMethod = Creator<ablate::mathFunctions::MathFunction>::GetCreateMethod(mockFactory->GetClassType());
+    auto instance = createMethod(mockFactory);
+
+    // assert
+    ASSERT_TRUE(instance != nullptr) << " should create an instance of the MathFunction";
+    ASSERT_TRUE(std::dynamic_pointer_cast<ablate::mathFunctions::InverseDistanceWeighted>(instance) != nullptr) << " should be an instance of InverseDistanceWeighted";
+}
+
+TEST(InverseDistanceWeightedTests, ShouldWeightNearestNeighbors) {
+    // arrange
+    auto function = ablate::mathFunctions::InverseDistanceWeighted({0.0, 1.0, 4.0}, {1.0, 3.0, 100.0}, 2, 1.0);
+
+    // act/assert
+    // between the two nearest points the weights are 1/0.25 and 1/0.75
+    ASSERT_DOUBLE_EQ(function.Eval(0.25, 0.0, 0.0, 0.0), (1.0 / 0.25 * 1.0 + 1.0 / 0.75 * 3.0) / (1.0 / 0.25 + 1.0 / 0.75));
+    // on a data point the value is returned directly
+    ASSERT_DOUBLE_EQ(function.Eval(4.0, 0.0, 0.0, 0.0), 100.0);
+}
+
+TEST(InverseDistanceWeightedTests, ShouldWeightPointsWithinRadius) {
+    // arrange
+    auto function = ablate::mathFunctions::InverseDistanceWeighted({0.0, 0.0, 2.0, 0.0, 0.0, 2.0, 10.0, 10.0}, {1.0, 2.0, 3.0, 100.0}, 0, 2.0, 3.0);
+    std::vector<double> result(1);
+
+    // act
+    double xyz[2] = {1.0, 1.0};
+    function.Eval(xyz, 2, 0.0, result);
+
+    // assert
+    // the three points in the radius are equidistant so the far point is not included
+    ASSERT_DOUBLE_EQ(result[0], 2.0);
+    // fall back to the nearest point when nothing is within the radius
+    ASSERT_DOUBLE_EQ(function.Eval(20.0, 20.0, 0.0, 0.0), 100.0);
+}
+
+}  // namespace ablateTesting::mathFunctions
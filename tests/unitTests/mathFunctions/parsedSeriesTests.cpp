@@ -64,6 +64,22 @@ TEST_P(ParsedSeriesTestsScalarFixture, ShouldComputeCorrectAnswerFromCoord) {
     ASSERT_DOUBLE_EQ(param.expectedResult, function.Eval(array1, 3, 4.0));
 }
 
+TEST_P(ParsedSeriesTestsScalarFixture, ShouldComputeCorrectAnswerForManyPoints) {
+    // arrange
+    const auto& param = GetParam();
+    auto function = ablate::mathFunctions::ParsedSeries(param.formula, param.lowerBound, param.upperBound, param.constants);
+
+    const double points[6] = {1.0, 2.0, 3.0, 1.0, 2.0, 3.0};
+    double result[2] = {NAN, NAN};
+
+    // act
+    function.Eval(points, 3, 2, 4.0, result);
+
+    // assert
+    ASSERT_DOUBLE_EQ(param.expectedResult, result[0]);
+    ASSERT_DOUBLE_EQ(param.expectedResult, result[1]);
+}
+
 INSTANTIATE_TEST_SUITE_P(ParsedSeriesTests, ParsedSeriesTestsScalarFixture,
                          testing::Values((ParsedSeriesTestsScalarParameters){.formula = "i*x", .lowerBound = 1, .upperBound = 100, .constants = {}, .expectedResult = 5050},
                                          (ParsedSeriesTestsScalarParameters){.formula = "i*x + y", .lowerBound = 0, .upperBound = 0, .constants = {}, .expectedResult = 2},
@@ -52,6 +52,73 @@ TEST(SimpleFormulaTests, ShouldEvalToScalarFromCoord) {
     ASSERT_DOUBLE_EQ(0.0, function.Eval(array3, 3, -5));
 }
 
+TEST(SimpleFormulaTests, ShouldEvalToScalarForManyPoints) {
+    // arrange
+    auto function = ablate::mathFunctions::SimpleFormula("x+y*y+z+t");
+    const std::vector<double> points2D = {1.0, 2.0, 3.0, 4.0, -1.0, 0.5};
+    const std::vector<double> points3D = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0};
+    std::vector<double> result(4, NAN);
+
+    // act/assert
+    function.Eval(points2D.data(), 2, 3, 2.0, result.data());
+    for (std::size_t p = 0; p < 3; p++) {
+        ASSERT_DOUBLE_EQ(function.Eval(&points2D[p * 2], 2, 2.0), result[p]);
+    }
+
+    // grow the batch so the bulk parser is rebuilt
+    function.Eval(points3D.data(), 3, 4, -1.0, result.data());
+    for (std::size_t p = 0; p < 4; p++) {
+        ASSERT_DOUBLE_EQ(function.Eval(&points3D[p * 3], 3, -1.0), result[p]);
+    }
+}
+
+TEST(SimpleFormulaTests, ShouldEvalPseudoRandomFormulaForManyPointsInPointOrder) {
+    // arrange
+    // the random engines are shared, so the batch must produce the same sequence as evaluating one point at a time
+    auto bulkFunction = ablate::mathFunctions::SimpleFormula("x + pRand(0, 1)");
+    auto pointFunction = ablate::mathFunctions::SimpleFormula("x + pRand(0, 1)");
+    const std::vector<double> points = {1.0, 2.0, 3.0, 4.0, 5.0};
+    std::vector<double> result(points.size(), NAN);
+
+    // act
+    bulkFunction.Eval(points.data(), 1, points.size(), 0.0, result.data());
+
+    // assert
+    for (std::size_t p = 0; p < points.size(); p++) {
+        ASSERT_DOUBLE_EQ(pointFunction.Eval(&points[p], 1, 0.0), result[p]);
+    }
+}
+
+TEST(SimpleFormulaTests, ShouldEvalMathFunctionForManyPoints) {
+    // arrange
+    // evaluate through the base interface before any single point evaluation
+    std::shared_ptr<ablate::mathFunctions::MathFunction> function = std::make_shared<ablate::mathFunctions::SimpleFormula>("x*x - y");
+    const std::vector<double> points = {1.0, 2.0, 3.0, 4.0, -1.0, 0.5};
+    std::vector<double> result(3, NAN);
+
+    // act
+    function->Eval(points.data(), 2, 3, 0.0, result.data());
+
+    // assert
+    ASSERT_DOUBLE_EQ(-1.0, result[0]);
+    ASSERT_DOUBLE_EQ(5.0, result[1]);
+    ASSERT_DOUBLE_EQ(0.5, result[2]);
+}
+
+TEST(SimpleFormulaTests, ShouldEvalLastValueOfVectorForManyPoints) {
+    // arrange
+    auto function = ablate::mathFunctions::SimpleFormula("x+y, x*y");
+    const std::vector<double> points = {1.0, 2.0, 3.0, 4.0};
+    std::vector<double> result(2, NAN);
+
+    // act
+    function.Eval(points.data(), 2, 2, 0.0, result.data());
+
+    // assert
+    ASSERT_DOUBLE_EQ(2.0, result[0]);
+    ASSERT_DOUBLE_EQ(12.0, result[1]);
+}
+
 TEST(SimpleFormulaTests, ShouldEvalToVectorFromXYZ) {
     // arrange
     auto function = ablate::mathFunctions::SimpleFormula("x+y+z+t,x*y*z,t");
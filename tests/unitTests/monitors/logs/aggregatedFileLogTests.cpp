@@ -0,0 +1,153 @@
+#include <petsc.h>
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <mpiTestParamFixture.hpp>
+#include "environment/runEnvironment.hpp"
+#include "gtest/gtest.h"
+#include "monitors/logs/aggregatedFileLog.hpp"
+#include "mpiTestFixture.hpp"
+#include "utilities/petscUtilities.hpp"
+
+using namespace ablate;
+
+class AggregatedFileLogTestFixture : public testingResources::MpiTestParamFixture {};
+
+TEST_P(AggregatedFileLogTestFixture, ShouldPrintTaggedRecordsInRankOrder) {
+    StartWithMPI
+        {
+            // arrange
+            // initialize petsc and mpi
+            ablate::environment::RunEnvironment::Initialize(argc, argv);
+            ablate::utilities::PetscUtilities::Initialize();
+
+            // Create the log
+            auto logPath = MakeTemporaryPath("aggregatedLogFile.txt", PETSC_COMM_WORLD);
+            monitors::logs::AggregatedFileLog log(logPath);
+            log.Initialize(PETSC_COMM_WORLD);
+
+            // Get the current rank
+            PetscMPIInt rank;
+            MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+
+            // act
+            log.Print("Log Out Log\n");
+            log.Printf("rank: %d", rank);
+            log.Printf(" iter: %d\n", 0);
+        }
+        ablate::environment::RunEnvironment::Finalize();
+        exit(0);
+    EndWithMPI
+
+    // Load the file
+    std::ifstream logFile(std::filesystem::temp_directory_path() / "aggregatedLogFile.txt");
+    std::stringstream buffer;
+    buffer << logFile.rdbuf();
+
+    // assert
+    std::string expected;
+    for (int r = 0; r < GetParam().nproc; r++) {
+        expected += "[" + std::to_string(r) + "] Log Out Log\n[" + std::to_string(r) + "] rank: " + std::to_string(r) + " iter: 0\n";
+    }
+    ASSERT_EQ(buffer.str(), expected);
+}
+
+TEST_P(AggregatedFileLogTestFixture, ShouldWriteCompleteLinesWhenBufferIsFull) {
+    StartWithMPI
+        {
+            // arrange
+            // initialize petsc and mpi
+            ablate::environment::RunEnvironment::Initialize(argc, argv);
+            ablate::utilities::PetscUtilities::Initialize();
+
+            // Create the log with a buffer that is always full
+            auto logPath = MakeTemporaryPath("aggregatedLogFileSmallBuffer.txt", PETSC_COMM_WORLD);
+            monitors::logs::AggregatedFileLog log(logPath, 1);
+            log.Initialize(PETSC_COMM_WORLD);
+
+            // Get the current rank
+            PetscMPIInt rank;
+            MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+
+            // act
+            for (int i = 0; i < 3; i++) {
+                log.Printf("rank: %d", rank);
+                log.Printf(" iter: %d\n", i);
+            }
+        }
+        ablate::environment::RunEnvironment::Finalize();
+        exit(0);
+    EndWithMPI
+
+    // Load the file
+    std::ifstream logFile(std::filesystem::temp_directory_path() / "aggregatedLogFileSmallBuffer.txt");
+    std::vector<std::string> lines;
+    std::string line;
+    while (std::getline(logFile, line)) {
+        lines.push_back(line);
+    }
+
+    // assert - the ranks may be written in any order, but each line must be complete
+    std::vector<std::string> expected;
+    for (int r = 0; r < GetParam().nproc; r++) {
+        for (int i = 0; i < 3; i++) {
+            expected.push_back("[" + std::to_string(r) + "] rank: " + std::to_string(r) + " iter: " + std::to_string(i));
+        }
+    }
+    std::sort(lines.begin(), lines.end());
+    ASSERT_EQ(lines, expected);
+}
+
+TEST_P(AggregatedFileLogTestFixture, ShouldWriteBufferedLinesAfterFlushInterval) {
+    StartWithMPI
+        {
+            // arrange
+            // initialize petsc and mpi
+            ablate::environment::RunEnvironment::Initialize(argc, argv);
+            ablate::utilities::PetscUtilities::Initialize();
+
+            // Create the log with the default buffer size and a flush interval that has always elapsed
+            auto logPath = MakeTemporaryPath("aggregatedLogFileFlushInterval.txt", PETSC_COMM_WORLD);
+            monitors::logs::AggregatedFileLog log(logPath, 0, 1E-9);
+            log.Initialize(PETSC_COMM_WORLD);
+
+            // Get the current rank and size
+            PetscMPIInt rank, size;
+            MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+            MPI_Comm_size(PETSC_COMM_WORLD, &size);
+
+            // act
+            for (int i = 0; i < 3; i++) {
+                log.Printf("rank: %d", rank);
+                log.Printf(" iter: %d\n", i);
+            }
+            log.Sync();
+            MPI_Barrier(PETSC_COMM_WORLD);
+
+            // the lines are in the file before the log is destroyed
+            std::ifstream logFile(logPath);
+            std::vector<std::string> lines;
+            std::string line;
+            while (std::getline(logFile, line)) {
+                lines.push_back(line);
+            }
+            std::vector<std::string> expected;
+            for (int r = 0; r < size; r++) {
+                for (int i = 0; i < 3; i++) {
+                    expected.push_back("[" + std::to_string(r) + "] rank: " + std::to_string(r) + " iter: " + std::to_string(i));
+                }
+            }
+            std::sort(lines.begin(), lines.end());
+
+            // assert only after every rank has read the file so a failure on one rank cannot hang the others
+            MPI_Barrier(PETSC_COMM_WORLD);
+            ASSERT_EQ(lines, expected);
+        }
+        ablate::environment::RunEnvironment::Finalize();
+        exit(0);
+    EndWithMPI
+}
+
+INSTANTIATE_TEST_SUITE_P(LogTests, AggregatedFileLogTestFixture,
+                         testing::Values(testingResources::MpiTestParameter("aggregatedLogFile 1 proc"), testingResources::MpiTestParameter("aggregatedLogFile 2 proc", 2)),
+                         [](const testing::TestParamInfo<MpiTestParameter>& info) { return info.param.getTestName(); });
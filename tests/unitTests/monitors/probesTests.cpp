@@ -1,3 +1,4 @@
+#include <fstream>
 #include "gtest/gtest.h"
 #include "monitors/probes.hpp"
 #include "temporaryPath.hpp"
@@ -77,3 +78,147 @@ TEST_P(ProbeRecorderFixture, ShouldSaveAndRestart) {
 }
 
 INSTANTIATE_TEST_SUITE_P(ProbeTests, ProbeRecorderFixture, testing::Values(0, 1, 3, 4, 5, 6), [](const ::testing::TestParamInfo<int>& info) { return "buffer_size_" + std::to_string(info.param); });
+
+class BinaryProbeRecorderFixture : public ::testing::TestWithParam<int> {};
+
+TEST_P(BinaryProbeRecorderFixture, ShouldSaveRestartAndConvertToCsv) {
+    // arrange
+    testingResources::TemporaryPath outputPath;
+    const std::vector<std::string> probeNames = {"probeA", "probeB"};
+    const std::vector<std::string> variables = {"a", "b"};
+    {
+        ablate::monitors::Probes::BinaryProbeRecorder recorder(GetParam(), probeNames, variables, outputPath.GetPath());
+
+        // act
+        for (int t = 0; t < 4; t++) {
+            recorder.AdvanceTime(0.1 * t);
+            recorder.SetValue(0, 0, 10.0 * t + 1);
+            recorder.SetValue(1, 1, 10.0 * t + 4);
+            recorder.SetValue(0, 1, 10.0 * t + 2);
+            recorder.SetValue(1, 0, 10.0 * t + 3);
+        }
+    }
+
+    {  // simulate a restart
+        ablate::monitors::Probes::BinaryProbeRecorder recorder(GetParam(), probeNames, variables, outputPath.GetPath());
+
+        // act
+        for (int t = 2; t < 6; t++) {
+            recorder.AdvanceTime(0.1 * t);
+            recorder.SetValue(0, 0, 10.0 * t + 1);
+            recorder.SetValue(0, 1, 10.0 * t + 2);
+            recorder.SetValue(1, 0, 10.0 * t + 3);
+            recorder.SetValue(1, 1, 10.0 * t + 4);
+        }
+    }
+    auto outputDirectory = outputPath.GetPath().parent_path() / (outputPath.GetPath().filename().string() + "_csv");
+    std::filesystem::create_directories(outputDirectory);
+    ablate::monitors::Probes::BinaryProbeRecorder::ConvertToCsv({outputPath.GetPath()}, outputDirectory);
+
+    // assert
+    auto readFile = [](const std::filesystem::path& path) {
+        std::ifstream file(path);
+        return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    };
+    const char* expectedA =
+        "time,a,b,\n"
+        "0,1,2,\n"
+        "0.1,11,12,\n"
+        "0.2,21,22,\n"
+        "0.3,31,32,\n"
+        "0.4,41,42,\n"
+        "0.5,51,52,\n";
+    const char* expectedB =
+        "time,a,b,\n"
+        "0,3,4,\n"
+        "0.1,13,14,\n"
+        "0.2,23,24,\n"
+        "0.3,33,34,\n"
+        "0.4,43,44,\n"
+        "0.5,53,54,\n";
+    ASSERT_EQ(std::string(expectedA), readFile(outputDirectory / "probeA.csv"));
+    ASSERT_EQ(std::string(expectedB), readFile(outputDirectory / "probeB.csv"));
+
+    // cleanup
+    std::filesystem::remove_all(outputDirectory);
+}
+
+TEST(BinaryProbeRecorderTests, ShouldThrowWhenRestartingWithDifferentProbes) {
+    // arrange
+    testingResources::TemporaryPath outputPath;
+    { ablate::monitors::Probes::BinaryProbeRecorder recorder(1, {"probeA"}, {"a"}, outputPath.GetPath()); }
+
+    // act/assert
+    ASSERT_THROW(ablate::monitors::Probes::BinaryProbeRecorder(1, {"probeA", "probeB"}, {"a"}, outputPath.GetPath()), std::invalid_argument);
+}
+
+TEST(BinaryProbeRecorderTests, ShouldMergeAndConvertFilesWrittenWithDifferentPartitions) {
+    // arrange
+    testingResources::TemporaryPath outputPath;
+    const auto& directory = outputPath.GetPath();
+    std::filesystem::create_directories(directory);
+    {  // the first run records each probe on a separate rank
+        ablate::monitors::Probes::BinaryProbeRecorder recorder0(2, {"probeA"}, {"a", "b"}, directory / "probes.0.bin");
+        ablate::monitors::Probes::BinaryProbeRecorder recorder1(2, {"probeB"}, {"a", "b"}, directory / "probes.1.bin");
+        for (int t = 0; t < 3; t++) {
+            recorder0.AdvanceTime(0.1 * t);
+            recorder0.SetValue(0, 0, 10.0 * t + 1);
+            recorder0.SetValue(0, 1, 10.0 * t + 2);
+            recorder1.AdvanceTime(0.1 * t);
+            recorder1.SetValue(0, 0, 10.0 * t + 3);
+            recorder1.SetValue(0, 1, 10.0 * t + 4);
+        }
+    }
+
+    // act
+    // restart on a single rank that owns both probes
+    ASSERT_FALSE(ablate::monitors::Probes::BinaryProbeRecorder::IsCompatible(directory / "probes.0.bin", {"probeB", "probeA"}, {"a", "b"}));
+    const auto files = ablate::monitors::Probes::BinaryProbeRecorder::GetBinaryFiles(directory);
+    ASSERT_EQ((std::size_t)2, files.size());
+    const auto restartTime = ablate::monitors::Probes::BinaryProbeRecorder::Merge(files, directory / "probes.bin.merge");
+    for (const auto& file : files) {
+        std::filesystem::remove(file);
+    }
+    std::filesystem::rename(directory / "probes.bin.merge", directory / "probes.bin");
+    {
+        ablate::monitors::Probes::BinaryProbeRecorder recorder(1, {"probeB", "probeA"}, {"a", "b"}, directory / "probes.0.bin", restartTime);
+        for (int t = 1; t < 5; t++) {
+            recorder.AdvanceTime(0.1 * t);
+            recorder.SetValue(1, 0, 10.0 * t + 1);
+            recorder.SetValue(1, 1, 10.0 * t + 2);
+            recorder.SetValue(0, 0, 10.0 * t + 3);
+            recorder.SetValue(0, 1, 10.0 * t + 4);
+        }
+    }
+    ablate::monitors::Probes::BinaryProbeRecorder::ConvertToCsv(ablate::monitors::Probes::BinaryProbeRecorder::GetBinaryFiles(directory), directory);
+
+    // assert
+    ASSERT_DOUBLE_EQ(0.2, restartTime);
+    auto readFile = [](const std::filesystem::path& path) {
+        std::ifstream file(path);
+        return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    };
+    ASSERT_EQ(std::string("time,a,b,\n0,1,2,\n0.1,11,12,\n0.2,21,22,\n0.3,31,32,\n0.4,41,42,\n"), readFile(directory / "probeA.csv"));
+    ASSERT_EQ(std::string("time,a,b,\n0,3,4,\n0.1,13,14,\n0.2,23,24,\n0.3,33,34,\n0.4,43,44,\n"), readFile(directory / "probeB.csv"));
+
+    // cleanup
+    std::filesystem::remove_all(directory);
+}
+
+TEST(BinaryProbeRecorderTests, ShouldThrowWhenMergingFilesWithDifferentVariables) {
+    // arrange
+    testingResources::TemporaryPath outputPath;
+    const auto& directory = outputPath.GetPath();
+    std::filesystem::create_directories(directory);
+    { ablate::monitors::Probes::BinaryProbeRecorder recorder(1, {"probeA"}, {"a"}, directory / "probes.0.bin"); }
+    { ablate::monitors::Probes::BinaryProbeRecorder recorder(1, {"probeB"}, {"b"}, directory / "probes.1.bin"); }
+
+    // act/assert
+    ASSERT_THROW(ablate::monitors::Probes::BinaryProbeRecorder::Merge(ablate::monitors::Probes::BinaryProbeRecorder::GetBinaryFiles(directory), directory / "probes.bin"),
+                 std::invalid_argument);
+
+    // cleanup
+    std::filesystem::remove_all(directory);
+}
+
+INSTANTIATE_TEST_SUITE_P(ProbeTests, BinaryProbeRecorderFixture, testing::Values(0, 1, 3, 4, 5), [](const ::testing::TestParamInfo<int>& info) { return "buffer_size_" + std::to_string(info.param); });
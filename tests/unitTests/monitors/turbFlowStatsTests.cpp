@@ -0,0 +1,271 @@
+#include <petsc.h>
+#include <petscviewerhdf5.h>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <memory>
+#include <tuple>
+#include "domain/boxMesh.hpp"
+#include "domain/fieldDescription.hpp"
+#include "environment/runEnvironment.hpp"
+#include "eos/perfectGas.hpp"
+#include "finiteVolume/compressibleFlowFields.hpp"
+#include "finiteVolume/finiteVolumeSolver.hpp"
+#include "gtest/gtest.h"
+#include "io/interval/fixedInterval.hpp"
+#include "mathFunctions/functionFactory.hpp"
+#include "monitors/turbFlowStats.hpp"
+#include "mpiTestFixture.hpp"
+#include "parameters/mapParameters.hpp"
+#include "petscTestErrorChecker.hpp"
+#include "solver/timeStepper.hpp"
+#include "temporaryPath.hpp"
+#include "utilities/petscUtilities.hpp"
+
+using namespace ablate;
+
+/**
+ * Provide access to the monitor sub domain holding the accumulated statistics
+ */
+class TurbFlowStatsAccessor : public monitors::TurbFlowStats {
+   public:
+    using TurbFlowStats::TurbFlowStats;
+
+    domain::SubDomain& GetMonitorSubDomain() { return *monitorSubDomain; }
+};
+
+//! the value of a monitored component for each sample at a cell center
+using SampleFunction = std::function<PetscReal(PetscInt sample, const PetscReal x[])>;
+
+/**
+ * The expected statistics for a single component or pair of components computed with a direct two pass summation
+ */
+struct TwoPassStatistics {
+    PetscReal mean = 0.0;
+    PetscReal m2 = 0.0;
+    PetscReal rms = 0.0;
+    PetscReal favreAvg = 0.0;
+    PetscReal favreMean = 0.0;
+    PetscReal favreM2 = 0.0;
+    PetscReal mRms = 0.0;
+};
+
+static TwoPassStatistics ComputeTwoPassStatistics(const std::vector<PetscReal>& values, const std::vector<PetscReal>& density, const std::vector<PetscReal>& dt) {
+    const auto numberSamples = (PetscReal)values.size();
+    PetscReal densitySum = 0.0, densityDtSum = 0.0;
+    TwoPassStatistics statistics;
+    for (std::size_t s = 0; s < values.size(); ++s) {
+        statistics.mean += values[s] / numberSamples;
+        statistics.favreMean += density[s] * values[s];
+        statistics.favreAvg += density[s] * dt[s] * values[s];
+        densitySum += density[s];
+        densityDtSum += density[s] * dt[s];
+    }
+    statistics.favreMean /= densitySum;
+    statistics.favreAvg /= densityDtSum;
+
+    for (std::size_t s = 0; s < values.size(); ++s) {
+        statistics.m2 += PetscSqr(values[s] - statistics.mean);
+        statistics.favreM2 += density[s] * PetscSqr(values[s] - statistics.favreMean);
+    }
+    statistics.rms = PetscSqrtReal(statistics.m2 / numberSamples);
+    statistics.mRms = PetscSqrtReal(statistics.favreM2 / densitySum);
+    return statistics;
+}
+
+/**
+ * Compute the arithmetic and density weighted covariance with a direct two pass summation
+ */
+static std::pair<PetscReal, PetscReal> ComputeTwoPassCovariance(const std::vector<PetscReal>& a, const std::vector<PetscReal>& b, const std::vector<PetscReal>& density) {
+    const auto numberSamples = (PetscReal)a.size();
+    PetscReal aMean = 0.0, bMean = 0.0, aFavreMean = 0.0, bFavreMean = 0.0, densitySum = 0.0;
+    for (std::size_t s = 0; s < a.size(); ++s) {
+        aMean += a[s] / numberSamples;
+        bMean += b[s] / numberSamples;
+        aFavreMean += density[s] * a[s];
+        bFavreMean += density[s] * b[s];
+        densitySum += density[s];
+    }
+    aFavreMean /= densitySum;
+    bFavreMean /= densitySum;
+
+    PetscReal covariance = 0.0, favreCovariance = 0.0;
+    for (std::size_t s = 0; s < a.size(); ++s) {
+        covariance += (a[s] - aMean) * (b[s] - bMean) / numberSamples;
+        favreCovariance += density[s] * (a[s] - aFavreMean) * (b[s] - bFavreMean);
+    }
+    return {covariance, favreCovariance / densitySum};
+}
+
+static PetscInt FindComponent(const domain::Field& field, const std::string& name) {
+    auto it = std::find(field.components.begin(), field.components.end(), name);
+    if (it == field.components.end()) {
+        throw std::invalid_argument("Unable to locate component " + name + " in " + field.name);
+    }
+    return field.offset + (PetscInt)std::distance(field.components.begin(), it);
+}
+
+class TurbFlowStatsTestFixture : public testingResources::MpiTestFixture, public ::testing::WithParamInterface<testingResources::MpiTestParameter> {
+   public:
+    void SetUp() override { SetMpiParameters(GetParam()); }
+};
+
+TEST_P(TurbFlowStatsTestFixture, ShouldMatchTwoPassStatistics) {
+    StartWithMPI
+        {
+            // initialize petsc and mpi
+            ablate::environment::RunEnvironment::Initialize(argc, argv);
+            ablate::utilities::PetscUtilities::Initialize();
+
+            // the euler field provides the density used for the weighted statistics
+            const std::vector<std::string> eulerComponents = {"rho", "rhoE", "rhoVel0", "rhoVel1"};
+            std::vector<std::shared_ptr<domain::FieldDescriptor>> fieldDescriptors = {
+                std::make_shared<domain::FieldDescription>(finiteVolume::CompressibleFlowFields::EULER_FIELD, "", eulerComponents, domain::FieldLocation::SOL, domain::FieldType::FVM),
+                std::make_shared<domain::FieldDescription>("phi", "", domain::FieldDescription::ONECOMPONENT, domain::FieldLocation::SOL, domain::FieldType::FVM)};
+
+            auto mesh = std::make_shared<domain::BoxMesh>("mesh",
+                                                          fieldDescriptors,
+                                                          std::vector<std::shared_ptr<domain::modifiers::Modifier>>{},
+                                                          std::vector<int>{4, 3},
+                                                          std::vector<double>{0.0, 0.0},
+                                                          std::vector<double>{1.0, 1.0},
+                                                          std::vector<std::string>{} /*boundary*/,
+                                                          false /*simplex*/);
+
+            auto initialization = std::make_shared<domain::Initializer>(
+                std::make_shared<mathFunctions::FieldFunction>(finiteVolume::CompressibleFlowFields::EULER_FIELD, mathFunctions::Create({1.0, 1.0, 0.0, 0.0})),
+                std::make_shared<mathFunctions::FieldFunction>("phi", mathFunctions::Create(0.0)));
+            auto timeStepper = solver::TimeStepper(mesh, std::make_shared<parameters::MapParameters>(), {}, initialization);
+
+            // the monitored values for each sample, the large offsets check the stability of the single pass updates
+            const std::map<std::string, SampleFunction> sampleFunctions = {
+                {"rho", [](PetscInt s, const PetscReal x[]) { return 1.0 + 0.5 * PetscSinReal(1.7 * s + 3.0 * x[0]) + 0.2 * x[1]; }},
+                {"rhoE", [](PetscInt s, const PetscReal x[]) { return 2.5E5 + 1.0E3 * PetscCosReal(s + x[1]); }},
+                {"rhoVel0", [](PetscInt s, const PetscReal x[]) { return 10.0 + PetscCosReal(0.9 * s + x[0]) * (1.0 + x[1]); }},
+                {"rhoVel1", [](PetscInt s, const PetscReal x[]) { return -5.0 + 0.3 * s * x[0] + PetscSinReal(2.3 * s); }},
+                {"phi", [](PetscInt s, const PetscReal x[]) { return 1.0E4 + PetscSinReal(1.1 * s + x[0] * x[1]); }}};
+            auto sampleDt = [](PetscInt s) { return 0.01 * (1.0 + 0.5 * (s % 3)); };
+            const PetscInt numberSamples = 7;
+
+            // monitor both fields with covariances between components of the same field and a single component field
+            auto solver = std::make_shared<finiteVolume::FiniteVolumeSolver>("fvSolver",
+                                                                             domain::Region::ENTIREDOMAIN,
+                                                                             nullptr,
+                                                                             std::vector<std::shared_ptr<finiteVolume::processes::Process>>{},
+                                                                             std::vector<std::shared_ptr<finiteVolume::boundaryConditions::BoundaryCondition>>{});
+            auto monitor = std::make_shared<TurbFlowStatsAccessor>(
+                std::vector<std::string>{finiteVolume::CompressibleFlowFields::EULER_FIELD, "phi"},
+                std::make_shared<eos::PerfectGas>(std::make_shared<parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.4"}, {"Rgas", "287.0"}})),
+                std::make_shared<io::interval::FixedInterval>(),
+                std::vector<std::string>{"euler.rhoVel0,euler.rhoVel1", "phi,euler.rho"});
+            timeStepper.Register(solver, {monitor});
+            timeStepper.Initialize();
+
+            // act
+            auto& subDomain = solver->GetSubDomain();
+            DM dm = subDomain.GetDM();
+            Vec solution = subDomain.GetSolutionVector();
+            const auto& eulerField = subDomain.GetField(finiteVolume::CompressibleFlowFields::EULER_FIELD);
+            const auto& phiField = subDomain.GetField("phi");
+            PetscInt cStart, cEnd;
+            DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> testErrorChecker;
+            for (PetscInt s = 0; s < numberSamples; ++s) {
+                PetscScalar* solutionArray;
+                VecGetArray(solution, &solutionArray) >> testErrorChecker;
+                for (PetscInt c = cStart; c < cEnd; ++c) {
+                    PetscReal centroid[3];
+                    DMPlexComputeCellGeometryFVM(dm, c, nullptr, centroid, nullptr) >> testErrorChecker;
+                    PetscScalar* point;
+                    DMPlexPointGlobalRef(dm, c, solutionArray, &point) >> testErrorChecker;
+                    if (!point) {
+                        continue;
+                    }
+                    for (std::size_t p = 0; p < eulerComponents.size(); ++p) {
+                        point[eulerField.offset + p] = sampleFunctions.at(eulerComponents[p])(s, centroid);
+                    }
+                    point[phiField.offset] = sampleFunctions.at("phi")(s, centroid);
+                }
+                VecRestoreArray(solution, &solutionArray) >> testErrorChecker;
+
+                TSSetTimeStep(timeStepper.GetTS(), sampleDt(s)) >> testErrorChecker;
+                monitor->GetPetscFunction()(timeStepper.GetTS(), s, s * 0.1, solution, monitor->GetContext()) >> testErrorChecker;
+            }
+
+            // the rms and covariances are computed when the monitor is saved
+            testingResources::TemporaryPath outputPath;
+            PetscViewer viewer;
+            PetscViewerHDF5Open(PETSC_COMM_WORLD, outputPath.GetPath().c_str(), FILE_MODE_WRITE, &viewer) >> testErrorChecker;
+            monitor->Save(viewer, 0, numberSamples * 0.1) >> testErrorChecker;
+            PetscViewerDestroy(&viewer) >> testErrorChecker;
+
+            // assert
+            auto& monitorSubDomain = monitor->GetMonitorSubDomain();
+            DM monitorDm = monitorSubDomain.GetSubDM();
+            const auto& monitorEulerField = monitorSubDomain.GetField(finiteVolume::CompressibleFlowFields::EULER_FIELD);
+            const auto& monitorPhiField = monitorSubDomain.GetField("phi");
+            const auto& monitorCovarianceField = monitorSubDomain.GetField("covariance");
+            const PetscScalar* monitorArray;
+            VecGetArrayRead(monitorSubDomain.GetSolutionVector(), &monitorArray) >> testErrorChecker;
+
+            PetscInt monitorCStart, monitorCEnd;
+            DMPlexGetHeightStratum(monitorDm, 0, &monitorCStart, &monitorCEnd) >> testErrorChecker;
+            ASSERT_LT(monitorCStart, monitorCEnd);
+            for (PetscInt c = monitorCStart; c < monitorCEnd; ++c) {
+                const PetscScalar* point;
+                DMPlexPointGlobalRead(monitorDm, c, monitorArray, &point) >> testErrorChecker;
+                if (!point) {
+                    continue;
+                }
+                PetscReal centroid[3];
+                DMPlexComputeCellGeometryFVM(monitorDm, c, nullptr, centroid, nullptr) >> testErrorChecker;
+
+                // compute the sampled values at this cell
+                std::map<std::string, std::vector<PetscReal>> values;
+                std::vector<PetscReal> dt;
+                for (PetscInt s = 0; s < numberSamples; ++s) {
+                    for (const auto& [name, function] : sampleFunctions) {
+                        values[name].push_back(function(s, centroid));
+                    }
+                    dt.push_back(sampleDt(s));
+                }
+                const auto& density = values.at("rho");
+
+                // check the single pass statistics against the two pass result for every component
+                auto assertStatistics = [&](const domain::Field& field, const std::string& componentPrefix, const std::string& name) {
+                    const auto expected = ComputeTwoPassStatistics(values.at(name), density, dt);
+                    const std::vector<std::pair<std::string, PetscReal>> expectedValues = {{"mean", expected.mean},
+                                                                                          {"m2", expected.m2},
+                                                                                          {"rms", expected.rms},
+                                                                                          {"favreAvg", expected.favreAvg},
+                                                                                          {"favreMean", expected.favreMean},
+                                                                                          {"favreM2", expected.favreM2},
+                                                                                          {"mRms", expected.mRms}};
+                    for (const auto& [suffix, expectedValue] : expectedValues) {
+                        const auto actual = point[FindComponent(field, componentPrefix + suffix)];
+                        ASSERT_NEAR(expectedValue, actual, 1E-9 * PetscMax(1.0, PetscAbsReal(expectedValue))) << name << " " << suffix << " in cell " << c;
+                    }
+                };
+                for (const auto& name : eulerComponents) {
+                    assertStatistics(monitorEulerField, name + "_", name);
+                }
+                assertStatistics(monitorPhiField, "", "phi");
+
+                // and each covariance
+                const std::vector<std::tuple<std::string, std::string, std::string>> covariances = {{"euler_rhoVel0_euler_rhoVel1", "rhoVel0", "rhoVel1"}, {"phi_euler_rho", "phi", "rho"}};
+                for (const auto& [prefix, a, b] : covariances) {
+                    const auto [expectedCovariance, expectedFavreCovariance] = ComputeTwoPassCovariance(values.at(a), values.at(b), density);
+                    const auto covariance = point[FindComponent(monitorCovarianceField, prefix + "_cov")];
+                    const auto favreCovariance = point[FindComponent(monitorCovarianceField, prefix + "_favreCov")];
+                    ASSERT_NEAR(expectedCovariance, covariance, 1E-9 * PetscMax(1.0, PetscAbsReal(expectedCovariance))) << prefix << " in cell " << c;
+                    ASSERT_NEAR(expectedFavreCovariance, favreCovariance, 1E-9 * PetscMax(1.0, PetscAbsReal(expectedFavreCovariance))) << prefix << " in cell " << c;
+                }
+            }
+            VecRestoreArrayRead(monitorSubDomain.GetSolutionVector(), &monitorArray) >> testErrorChecker;
+        }
+        ablate::environment::RunEnvironment::Finalize();
+    EndWithMPI
+}
+
+INSTANTIATE_TEST_SUITE_P(TurbFlowStatsTests, TurbFlowStatsTestFixture, testing::Values(testingResources::MpiTestParameter("two pass statistics")),
+                         [](const testing::TestParamInfo<testingResources::MpiTestParameter>& info) { return info.param.getTestName(); });
@@ -0,0 +1,137 @@
+#include <petsc.h>
+#include <memory>
+#include "domain/boxMesh.hpp"
+#include "domain/fieldDescription.hpp"
+#include "domain/modifiers/distributeWithGhostCells.hpp"
+#include "environment/runEnvironment.hpp"
+#include "gtest/gtest.h"
+#include "mathFunctions/functionFactory.hpp"
+#include "mpiTestFixture.hpp"
+#include "parameters/mapParameters.hpp"
+#include "particles/coupledParticleSolver.hpp"
+#include "particles/initializers/cellInitializer.hpp"
+#include "particles/processes/arbitraryEulerianSource.hpp"
+#include "petscTestErrorChecker.hpp"
+#include "solver/timeStepper.hpp"
+#include "utilities/petscUtilities.hpp"
+
+using namespace ablate;
+
+struct CoupledParticleSolverDepositionParameters {
+    testingResources::MpiTestParameter mpiTestParameter;
+    int particlesPerCellPerDim;
+    std::vector<double> alphaSource;
+    std::vector<double> betaSource;
+};
+
+class CoupledParticleSolverDepositionTestFixture : public testingResources::MpiTestFixture, public ::testing::WithParamInterface<CoupledParticleSolverDepositionParameters> {
+   public:
+    void SetUp() override { SetMpiParameters(GetParam().mpiTestParameter); }
+};
+
+TEST_P(CoupledParticleSolverDepositionTestFixture, ShouldDepositParticleSourcesIntoOwningCell) {
+    StartWithMPI
+        {
+            // initialize petsc and mpi
+            ablate::environment::RunEnvironment::Initialize(argc, argv);
+            ablate::utilities::PetscUtilities::Initialize();
+
+            const auto& testingParam = GetParam();
+
+            // two finite volume fields so the particle sources are deposited directly into each cell
+            std::vector<std::shared_ptr<domain::FieldDescriptor>> fieldDescriptors = {
+                std::make_shared<domain::FieldDescription>("alpha", "", std::vector<std::string>{"alpha"}, domain::FieldLocation::SOL, domain::FieldType::FVM),
+                std::make_shared<domain::FieldDescription>("beta", "", std::vector<std::string>{"beta0", "beta1"}, domain::FieldLocation::SOL, domain::FieldType::FVM)};
+
+            auto mesh = std::make_shared<domain::BoxMesh>("mesh",
+                                                          fieldDescriptors,
+                                                          std::vector<std::shared_ptr<domain::modifiers::Modifier>>{std::make_shared<domain::modifiers::DistributeWithGhostCells>()},
+                                                          std::vector<int>{5, 5},
+                                                          std::vector<double>{0.0, 0.0},
+                                                          std::vector<double>{1.0, 1.0},
+                                                          std::vector<std::string>{} /*boundary*/,
+                                                          false /*simplex*/);
+
+            // take a single fixed flow step so the particle sources are computed over a known dt
+            const PetscReal flowTimeStep = 0.1;
+            auto arguments = std::make_shared<parameters::MapParameters>(
+                std::map<std::string, std::string>{{"ts_type", "euler"}, {"ts_max_steps", "1"}, {"ts_dt", std::to_string(flowTimeStep)}, {"ts_adapt_type", "none"}});
+            auto initialization = std::make_shared<domain::Initializer>(std::make_shared<mathFunctions::FieldFunction>("alpha", mathFunctions::Create(0.0)),
+                                                                        std::make_shared<mathFunctions::FieldFunction>("beta", mathFunctions::Create({0.0, 0.0})));
+            auto timeStepper = ablate::solver::TimeStepper(mesh, arguments, {}, initialization);
+
+            // couple both fields with a constant source for each particle
+            auto particles = std::make_shared<ablate::particles::CoupledParticleSolver>(
+                "particle",
+                domain::Region::ENTIREDOMAIN,
+                std::make_shared<parameters::MapParameters>(std::map<std::string, std::string>{{"ts_dt", "0.05"}}),
+                std::vector<ablate::particles::FieldDescription>{{ablate::particles::ParticleSolver::ParticleVelocity, domain::FieldLocation::SOL, {"u", "v"}}},
+                std::vector<std::shared_ptr<ablate::particles::processes::Process>>{
+                    std::make_shared<ablate::particles::processes::ArbitraryEulerianSource>("alpha", mathFunctions::Create(testingParam.alphaSource)),
+                    std::make_shared<ablate::particles::processes::ArbitraryEulerianSource>("beta", mathFunctions::Create(testingParam.betaSource))},
+                std::make_shared<ablate::particles::initializers::CellInitializer>(testingParam.particlesPerCellPerDim),
+                std::vector<std::shared_ptr<mathFunctions::FieldFunction>>{
+                    std::make_shared<mathFunctions::FieldFunction>(ablate::particles::ParticleSolver::ParticleVelocity, mathFunctions::Create({0.0, 0.0}))},
+                std::vector<std::shared_ptr<mathFunctions::FieldFunction>>{},
+                std::vector<std::string>{"alpha", "beta"});
+            timeStepper.Register(particles);
+
+            // advance a single step so each particle holds source*dt
+            timeStepper.Solve();
+
+            // act
+            DM dm = mesh->GetDM();
+            Vec locX, locF;
+            DMGetLocalVector(dm, &locX) >> testErrorChecker;
+            DMGetLocalVector(dm, &locF) >> testErrorChecker;
+            VecZeroEntries(locF) >> testErrorChecker;
+            particles->PreRHSFunction(timeStepper.GetTS(), timeStepper.GetTime(), true, locX) >> testErrorChecker;
+            particles->ComputeRHSFunction(timeStepper.GetTime(), locX, locF) >> testErrorChecker;
+
+            // assert
+            // every owned cell holds particlesPerCell particles, so the rate added to each cell is particlesPerCell*source
+            const PetscReal particlesPerCell = PetscPowRealInt(testingParam.particlesPerCellPerDim, 2);
+            PetscSection globalSection;
+            DMGetGlobalSection(dm, &globalSection) >> testErrorChecker;
+            PetscInt cStart, cEnd;
+            DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> testErrorChecker;
+            const PetscScalar* locFArray;
+            VecGetArrayRead(locF, &locFArray) >> testErrorChecker;
+            for (PetscInt c = cStart; c < cEnd; ++c) {
+                PetscInt globalOffset;
+                PetscSectionGetOffset(globalSection, c, &globalOffset) >> testErrorChecker;
+                if (globalOffset < 0) {
+                    continue;
+                }
+
+                const PetscScalar *alpha, *beta;
+                DMPlexPointLocalFieldRead(dm, c, 0, locFArray, &alpha) >> testErrorChecker;
+                DMPlexPointLocalFieldRead(dm, c, 1, locFArray, &beta) >> testErrorChecker;
+                ASSERT_NEAR(particlesPerCell * testingParam.alphaSource[0], alpha[0], 1E-10) << "alpha in cell " << c;
+                for (std::size_t b = 0; b < testingParam.betaSource.size(); ++b) {
+                    ASSERT_NEAR(particlesPerCell * testingParam.betaSource[b], beta[b], 1E-10) << "beta[" << b << "] in cell " << c;
+                }
+            }
+            VecRestoreArrayRead(locF, &locFArray) >> testErrorChecker;
+            DMRestoreLocalVector(dm, &locX) >> testErrorChecker;
+            DMRestoreLocalVector(dm, &locF) >> testErrorChecker;
+        }
+        ablate::environment::RunEnvironment::Finalize();
+    EndWithMPI
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    CoupledParticleSolverTests, CoupledParticleSolverDepositionTestFixture,
+    testing::Values((CoupledParticleSolverDepositionParameters){.mpiTestParameter = testingResources::MpiTestParameter("single particle per cell"),
+                                                                .particlesPerCellPerDim = 1,
+                                                                .alphaSource = {1.0},
+                                                                .betaSource = {10.0, -10.0}},
+                    (CoupledParticleSolverDepositionParameters){.mpiTestParameter = testingResources::MpiTestParameter("multiple particles per cell"),
+                                                                .particlesPerCellPerDim = 2,
+                                                                .alphaSource = {2.5},
+                                                                .betaSource = {-1.0, 3.0}},
+                    (CoupledParticleSolverDepositionParameters){.mpiTestParameter = testingResources::MpiTestParameter("multiple particles per cell in parallel", 2),
+                                                                .particlesPerCellPerDim = 2,
+                                                                .alphaSource = {2.5},
+                                                                .betaSource = {-1.0, 3.0}}),
+    [](const testing::TestParamInfo<CoupledParticleSolverDepositionParameters>& info) { return info.param.mpiTestParameter.getTestName(); });
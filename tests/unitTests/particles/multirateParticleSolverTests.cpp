@@ -0,0 +1,158 @@
+#include <petsc.h>
+#include <cmath>
+#include <memory>
+#include "domain/boxMesh.hpp"
+#include "domain/fieldDescription.hpp"
+#include "domain/modifiers/distributeWithGhostCells.hpp"
+#include "environment/runEnvironment.hpp"
+#include "eos/transport/constant.hpp"
+#include "gtest/gtest.h"
+#include "mathFunctions/functionFactory.hpp"
+#include "mpiTestFixture.hpp"
+#include "parameters/mapParameters.hpp"
+#include "particles/initializers/cellInitializer.hpp"
+#include "particles/multirate.hpp"
+#include "particles/particleSolver.hpp"
+#include "particles/processes/inertial.hpp"
+#include "petscTestErrorChecker.hpp"
+#include "solver/timeStepper.hpp"
+#include "utilities/petscUtilities.hpp"
+
+using namespace ablate;
+
+struct MultirateParticleSolverParameters {
+    testingResources::MpiTestParameter mpiTestParameter;
+    std::map<std::string, std::string> multirateOptions;
+    std::map<std::string, std::string> particleOptions;
+    //! for a fixed step forward euler particle ts, the number of sub-steps per flow step expected for the particles with each diameter
+    std::map<PetscReal, PetscInt> expectedSubSteps;
+    //! when expectedSubSteps is empty the particle velocity is compared to the exact exponential decay
+    PetscReal exactTolerance;
+};
+
+class MultirateParticleSolverTestFixture : public testingResources::MpiTestFixture, public ::testing::WithParamInterface<MultirateParticleSolverParameters> {
+   public:
+    void SetUp() override { SetMpiParameters(GetParam().mpiTestParameter); }
+};
+
+TEST_P(MultirateParticleSolverTestFixture, ShouldSubCycleParticlesByRelaxationTime) {
+    StartWithMPI
+        {
+            // initialize petsc and mpi
+            ablate::environment::RunEnvironment::Initialize(argc, argv);
+            ablate::utilities::PetscUtilities::Initialize();
+
+            const auto& testingParam = GetParam();
+
+            // with a viscosity of 1/18 and particle density of 100 the relaxation time is 100*diameter^2
+            const PetscReal fluidViscosity = 1.0 / 18.0;
+            const PetscReal particleDensity = 100.0;
+            const PetscReal initialVelocity = 1E-3;
+            const PetscReal flowTimeStep = 1.0;
+            const PetscInt flowSteps = 3;
+
+            // a quiescent fluid so each particle velocity decays with its own relaxation time
+            std::vector<std::shared_ptr<domain::FieldDescriptor>> fieldDescriptors = {
+                std::make_shared<domain::FieldDescription>("velocity", "", std::vector<std::string>{"vel0", "vel1"}, domain::FieldLocation::SOL, domain::FieldType::FVM)};
+
+            auto mesh = std::make_shared<domain::BoxMesh>("mesh",
+                                                          fieldDescriptors,
+                                                          std::vector<std::shared_ptr<domain::modifiers::Modifier>>{std::make_shared<domain::modifiers::DistributeWithGhostCells>()},
+                                                          std::vector<int>{4, 4},
+                                                          std::vector<double>{0.0, 0.0},
+                                                          std::vector<double>{1.0, 1.0},
+                                                          std::vector<std::string>{} /*boundary*/,
+                                                          false /*simplex*/);
+
+            auto arguments = std::make_shared<parameters::MapParameters>(std::map<std::string, std::string>{
+                {"ts_type", "euler"}, {"ts_max_steps", std::to_string(flowSteps)}, {"ts_dt", std::to_string(flowTimeStep)}, {"ts_adapt_type", "none"}});
+            auto initialization = std::make_shared<domain::Initializer>(std::make_shared<mathFunctions::FieldFunction>("velocity", mathFunctions::Create({0.0, 0.0})));
+            auto timeStepper = ablate::solver::TimeStepper(mesh, arguments, {}, initialization);
+
+            auto inertialParameters = std::make_shared<parameters::MapParameters>(
+                std::map<std::string, std::string>{{"fluidDensity", "1.0"}, {"fluidViscosity", std::to_string(fluidViscosity)}, {"gravityField", "0.0 0.0 0.0"}});
+            auto multirate = std::make_shared<ablate::particles::Multirate>(std::make_shared<eos::transport::Constant>(0.0, fluidViscosity),
+                                                                            std::make_shared<parameters::MapParameters>(testingParam.multirateOptions));
+
+            // small particles on the left and large particles on the right of the domain
+            auto particles = std::make_shared<ablate::particles::ParticleSolver>(
+                "particle",
+                domain::Region::ENTIREDOMAIN,
+                std::make_shared<parameters::MapParameters>(testingParam.particleOptions),
+                std::vector<ablate::particles::FieldDescription>{{ablate::particles::ParticleSolver::ParticleVelocity, domain::FieldLocation::SOL, {"u", "v"}},
+                                                                 {ablate::particles::ParticleSolver::ParticleDiameter, domain::FieldLocation::AUX},
+                                                                 {ablate::particles::ParticleSolver::ParticleDensity, domain::FieldLocation::AUX}},
+                std::vector<std::shared_ptr<ablate::particles::processes::Process>>{std::make_shared<ablate::particles::processes::Inertial>(inertialParameters)},
+                std::make_shared<ablate::particles::initializers::CellInitializer>(1),
+                std::vector<std::shared_ptr<mathFunctions::FieldFunction>>{
+                    std::make_shared<mathFunctions::FieldFunction>(ablate::particles::ParticleSolver::ParticleVelocity, mathFunctions::Create({initialVelocity, 0.0})),
+                    std::make_shared<mathFunctions::FieldFunction>(ablate::particles::ParticleSolver::ParticleDiameter, mathFunctions::Create("x < 0.5 ? 0.1 : 0.4")),
+                    std::make_shared<mathFunctions::FieldFunction>(ablate::particles::ParticleSolver::ParticleDensity, mathFunctions::Create(particleDensity))},
+                std::vector<std::shared_ptr<mathFunctions::FieldFunction>>{},
+                ablate::particles::ParticleSolver::SortOrder::NONE,
+                multirate);
+            timeStepper.Register(particles);
+
+            // act
+            timeStepper.Solve();
+
+            // assert
+            DM swarmDm = particles->GetParticleDM();
+            PetscInt np, packedSize;
+            DMSwarmGetLocalSize(swarmDm, &np) >> testErrorChecker;
+            const PetscReal *packedSolution, *diameter;
+            DMSwarmGetField(swarmDm, ablate::particles::ParticleSolver::PackedSolution, &packedSize, nullptr, (void**)&packedSolution) >> testErrorChecker;
+            DMSwarmGetField(swarmDm, ablate::particles::ParticleSolver::ParticleDiameter, nullptr, nullptr, (void**)&diameter) >> testErrorChecker;
+
+            // the packed solution stores the coordinates followed by the velocity
+            const PetscInt velocityOffset = mesh->GetDimensions();
+            for (PetscInt p = 0; p < np; ++p) {
+                const PetscReal relaxationTime = ablate::particles::Multirate::ComputeRelaxationTime(particleDensity, diameter[p], fluidViscosity);
+                const PetscReal velocity = packedSolution[p * packedSize + velocityOffset];
+
+                if (testingParam.expectedSubSteps.empty()) {
+                    const PetscReal exactVelocity = initialVelocity * PetscExpReal(-flowSteps * flowTimeStep / relaxationTime);
+                    ASSERT_NEAR(exactVelocity, velocity, testingParam.exactTolerance * initialVelocity) << "particle " << p << " with diameter " << diameter[p];
+                } else {
+                    // forward euler with n sub-steps per flow step scales the velocity by (1 - dt/(n tau)) each sub-step
+                    const auto subSteps = testingParam.expectedSubSteps.at(diameter[p]);
+                    const PetscReal subStepFactor = 1.0 - flowTimeStep / (subSteps * relaxationTime);
+                    const PetscReal expectedVelocity = initialVelocity * PetscPowRealInt(subStepFactor, flowSteps * subSteps);
+                    ASSERT_NEAR(expectedVelocity, velocity, 1E-12 * initialVelocity) << "particle " << p << " with diameter " << diameter[p];
+                }
+            }
+
+            DMSwarmRestoreField(swarmDm, ablate::particles::ParticleSolver::ParticleDiameter, nullptr, nullptr, (void**)&diameter) >> testErrorChecker;
+            DMSwarmRestoreField(swarmDm, ablate::particles::ParticleSolver::PackedSolution, &packedSize, nullptr, (void**)&packedSolution) >> testErrorChecker;
+        }
+        ablate::environment::RunEnvironment::Finalize();
+    EndWithMPI
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    MultirateTests, MultirateParticleSolverTestFixture,
+    testing::Values(
+        // the small particles (tau = 1) need two sub-steps to stay below 0.5 tau, the large particles (tau = 16) take the flow step
+        (MultirateParticleSolverParameters){.mpiTestParameter = testingResources::MpiTestParameter("multirate fixed particle step"),
+                                            .multirateOptions = {{"relaxationTimeFactor", "0.5"}},
+                                            .particleOptions = {{"ts_type", "euler"}, {"ts_adapt_type", "none"}, {"ts_dt", "1.0"}},
+                                            .expectedSubSteps = {{0.1, 2}, {0.4, 1}},
+                                            .exactTolerance = 0.0},
+        (MultirateParticleSolverParameters){.mpiTestParameter = testingResources::MpiTestParameter("multirate fixed particle step in parallel", 2),
+                                            .multirateOptions = {{"relaxationTimeFactor", "0.5"}},
+                                            .particleOptions = {{"ts_type", "euler"}, {"ts_adapt_type", "none"}, {"ts_dt", "1.0"}},
+                                            .expectedSubSteps = {{0.1, 2}, {0.4, 1}},
+                                            .exactTolerance = 0.0},
+        // an explicit maxLevel of zero disables sub-cycling
+        (MultirateParticleSolverParameters){.mpiTestParameter = testingResources::MpiTestParameter("multirate with sub-cycling disabled"),
+                                            .multirateOptions = {{"relaxationTimeFactor", "0.5"}, {"maxLevel", "0"}},
+                                            .particleOptions = {{"ts_type", "euler"}, {"ts_adapt_type", "none"}, {"ts_dt", "1.0"}},
+                                            .expectedSubSteps = {{0.1, 1}, {0.4, 1}},
+                                            .exactTolerance = 0.0},
+        // an adaptive particle ts may take more steps but never larger than the level sub-step
+        (MultirateParticleSolverParameters){.mpiTestParameter = testingResources::MpiTestParameter("multirate adaptive particle step"),
+                                            .multirateOptions = {{"relaxationTimeFactor", "0.5"}},
+                                            .particleOptions = {{"ts_type", "rk"}, {"ts_rk_type", "3bs"}, {"ts_adapt_type", "basic"}, {"ts_dt", "1.0"}},
+                                            .expectedSubSteps = {},
+                                            .exactTolerance = 1E-3}),
+    [](const testing::TestParamInfo<MultirateParticleSolverParameters>& info) { return info.param.mpiTestParameter.getTestName(); });
@@ -0,0 +1,70 @@
+#include "eos/transport/constant.hpp"
+#include "gtest/gtest.h"
+#include "parameters/mapParameters.hpp"
+#include "particles/multirate.hpp"
+
+namespace ablateTesting::particles {
+
+// with a viscosity of 1/18 the relaxation time is density*diameter^2
+static const PetscReal fluidViscosity = 1.0 / 18.0;
+
+struct MultirateTestParameters {
+    int maxLevel;
+    double relaxationTimeFactor;
+    double flowTimeStep;
+    double density;
+    double diameter;
+    PetscInt expectedLevel;
+};
+
+class MultirateTestFixture : public ::testing::TestWithParam<MultirateTestParameters> {};
+
+TEST_P(MultirateTestFixture, ShouldComputeLevel) {
+    // arrange
+    const auto& params = GetParam();
+    auto options = std::make_shared<ablate::parameters::MapParameters>(
+        std::map<std::string, std::string>{{"maxLevel", std::to_string(params.maxLevel)}, {"relaxationTimeFactor", std::to_string(params.relaxationTimeFactor)}});
+    ablate::particles::Multirate multirate(std::make_shared<ablate::eos::transport::Constant>(0.0, fluidViscosity), options);
+
+    // act
+    auto level = multirate.ComputeLevel(params.flowTimeStep, params.density, params.diameter, fluidViscosity);
+
+    // assert
+    ASSERT_EQ(params.expectedLevel, level);
+    const PetscReal relaxationTime = ablate::particles::Multirate::ComputeRelaxationTime(params.density, params.diameter, fluidViscosity);
+    ASSERT_LE(params.flowTimeStep / ablate::particles::Multirate::GetNumberSubSteps(level),
+              PetscMax(params.relaxationTimeFactor * relaxationTime, params.flowTimeStep / (1 << params.maxLevel)) * (1.0 + 1E-12));
+}
+
+INSTANTIATE_TEST_SUITE_P(MultirateTests, MultirateTestFixture,
+                         testing::Values((MultirateTestParameters){.maxLevel = 6, .relaxationTimeFactor = 1.0, .flowTimeStep = 0.5, .density = 1.0, .diameter = 1.0, .expectedLevel = 0},
+                                         (MultirateTestParameters){.maxLevel = 6, .relaxationTimeFactor = 1.0, .flowTimeStep = 1.0, .density = 1.0, .diameter = 1.0, .expectedLevel = 0},
+                                         (MultirateTestParameters){.maxLevel = 6, .relaxationTimeFactor = 1.0, .flowTimeStep = 1.5, .density = 1.0, .diameter = 1.0, .expectedLevel = 1},
+                                         (MultirateTestParameters){.maxLevel = 6, .relaxationTimeFactor = 1.0, .flowTimeStep = 1.0, .density = 1.0, .diameter = 0.5, .expectedLevel = 2},
+                                         (MultirateTestParameters){.maxLevel = 6, .relaxationTimeFactor = 0.5, .flowTimeStep = 1.0, .density = 1.0, .diameter = 0.5, .expectedLevel = 3},
+                                         (MultirateTestParameters){.maxLevel = 6, .relaxationTimeFactor = 1.0, .flowTimeStep = 1.0, .density = 1000.0, .diameter = 0.01, .expectedLevel = 4},
+                                         (MultirateTestParameters){.maxLevel = 2, .relaxationTimeFactor = 1.0, .flowTimeStep = 1.0, .density = 1.0, .diameter = 0.01, .expectedLevel = 2},
+                                         (MultirateTestParameters){.maxLevel = 0, .relaxationTimeFactor = 1.0, .flowTimeStep = 1.0, .density = 1.0, .diameter = 0.01, .expectedLevel = 0}));
+
+TEST(MultirateTests, ShouldUseDefaultsWhenOptionsAreNotSet) {
+    // arrange
+    ablate::particles::Multirate multirate(std::make_shared<ablate::eos::transport::Constant>(0.0, fluidViscosity), std::make_shared<ablate::parameters::MapParameters>());
+
+    // act
+    // assert
+    ASSERT_EQ(ablate::particles::Multirate::DefaultMaxLevel + 1, multirate.GetNumberLevels());
+    ASSERT_EQ(ablate::particles::Multirate::DefaultMaxLevel, multirate.ComputeLevel(1.0, 1.0, 1E-6, fluidViscosity));
+}
+
+TEST(MultirateTests, ShouldDisableSubCyclingWithZeroMaxLevel) {
+    // arrange
+    auto options = std::make_shared<ablate::parameters::MapParameters>(std::map<std::string, std::string>{{"maxLevel", "0"}});
+    ablate::particles::Multirate multirate(std::make_shared<ablate::eos::transport::Constant>(0.0, fluidViscosity), options);
+
+    // act
+    // assert
+    ASSERT_EQ(1, multirate.GetNumberLevels());
+    ASSERT_EQ(0, multirate.ComputeLevel(1.0, 1.0, 1E-6, fluidViscosity));
+}
+
+}  // namespace ablateTesting::particles
@@ -0,0 +1,134 @@
+#include <petsc.h>
+#include <memory>
+#include "domain/boxMesh.hpp"
+#include "domain/fieldDescription.hpp"
+#include "domain/modifiers/distributeWithGhostCells.hpp"
+#include "environment/runEnvironment.hpp"
+#include "gtest/gtest.h"
+#include "mathFunctions/functionFactory.hpp"
+#include "mpiTestFixture.hpp"
+#include "parameters/mapParameters.hpp"
+#include "particles/initializers/cellInitializer.hpp"
+#include "particles/particleSolver.hpp"
+#include "particles/processes/tracer.hpp"
+#include "petscTestErrorChecker.hpp"
+#include "solver/timeStepper.hpp"
+#include "utilities/petscUtilities.hpp"
+
+using namespace ablate;
+
+struct ParticleSolverSortParameters {
+    testingResources::MpiTestParameter mpiTestParameter;
+    ablate::particles::ParticleSolver::SortOrder sortOrder;
+};
+
+class ParticleSolverSortTestFixture : public testingResources::MpiTestFixture, public ::testing::WithParamInterface<ParticleSolverSortParameters> {
+   public:
+    void SetUp() override { SetMpiParameters(GetParam().mpiTestParameter); }
+};
+
+/**
+ * Check that every local particle is in the range reported for its cell and that the ranges cover all local particles
+ */
+static void AssertCellParticleRanges(ablate::particles::ParticleSolver& particles, DM cellDm, ablate::particles::ParticleSolver::SortOrder sortOrder) {
+    DM swarmDm = particles.GetParticleDM();
+    PetscInt np;
+    DMSwarmGetLocalSize(swarmDm, &np) >> testErrorChecker;
+
+    DMSwarmCellDM swarmCellDm;
+    const char* cellIdName;
+    DMSwarmGetCellDMActive(swarmDm, &swarmCellDm) >> testErrorChecker;
+    DMSwarmCellDMGetCellID(swarmCellDm, &cellIdName) >> testErrorChecker;
+    PetscInt* cellIds;
+    DMSwarmGetField(swarmDm, cellIdName, nullptr, nullptr, (void**)&cellIds) >> testErrorChecker;
+
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(cellDm, 0, &cStart, &cEnd) >> testErrorChecker;
+
+    PetscInt particlesInRanges = 0;
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        PetscInt start, end;
+        particles.GetCellParticleRange(c, start, end);
+        ASSERT_LE(start, end) << "cell " << c;
+        for (PetscInt p = start; p < end; ++p) {
+            ASSERT_EQ(c, cellIds[p]) << "particle " << p << " is not in cell " << c;
+        }
+        particlesInRanges += end - start;
+    }
+    ASSERT_EQ(np, particlesInRanges) << "the cell ranges should cover every local particle";
+
+    // the cell order stores the particles in increasing cell order
+    if (sortOrder == ablate::particles::ParticleSolver::SortOrder::CELL) {
+        for (PetscInt p = 1; p < np; ++p) {
+            ASSERT_LE(cellIds[p - 1], cellIds[p]);
+        }
+    }
+
+    DMSwarmRestoreField(swarmDm, cellIdName, nullptr, nullptr, (void**)&cellIds) >> testErrorChecker;
+}
+
+TEST_P(ParticleSolverSortTestFixture, ShouldGroupParticlesByCell) {
+    StartWithMPI
+        {
+            // initialize petsc and mpi
+            ablate::environment::RunEnvironment::Initialize(argc, argv);
+            ablate::utilities::PetscUtilities::Initialize();
+
+            const auto& testingParam = GetParam();
+
+            // a constant finite volume velocity field that moves the particles between cells
+            std::vector<std::shared_ptr<domain::FieldDescriptor>> fieldDescriptors = {
+                std::make_shared<domain::FieldDescription>("velocity", "", std::vector<std::string>{"vel0", "vel1"}, domain::FieldLocation::SOL, domain::FieldType::FVM)};
+
+            auto mesh = std::make_shared<domain::BoxMesh>("mesh",
+                                                          fieldDescriptors,
+                                                          std::vector<std::shared_ptr<domain::modifiers::Modifier>>{std::make_shared<domain::modifiers::DistributeWithGhostCells>()},
+                                                          std::vector<int>{6, 6},
+                                                          std::vector<double>{0.0, 0.0},
+                                                          std::vector<double>{1.0, 1.0},
+                                                          std::vector<std::string>{} /*boundary*/,
+                                                          false /*simplex*/);
+
+            auto arguments = std::make_shared<parameters::MapParameters>(
+                std::map<std::string, std::string>{{"ts_type", "euler"}, {"ts_max_steps", "3"}, {"ts_dt", "0.1"}, {"ts_adapt_type", "none"}});
+            auto initialization = std::make_shared<domain::Initializer>(std::make_shared<mathFunctions::FieldFunction>("velocity", mathFunctions::Create({0.3, 0.1})));
+            auto timeStepper = ablate::solver::TimeStepper(mesh, arguments, {}, initialization);
+
+            auto particles = std::make_shared<ablate::particles::ParticleSolver>(
+                "particle",
+                domain::Region::ENTIREDOMAIN,
+                std::make_shared<parameters::MapParameters>(std::map<std::string, std::string>{{"ts_dt", "0.05"}}),
+                std::vector<ablate::particles::FieldDescription>{},
+                std::vector<std::shared_ptr<ablate::particles::processes::Process>>{std::make_shared<ablate::particles::processes::Tracer>("velocity")},
+                std::make_shared<ablate::particles::initializers::CellInitializer>(2),
+                std::vector<std::shared_ptr<mathFunctions::FieldFunction>>{},
+                std::vector<std::shared_ptr<mathFunctions::FieldFunction>>{},
+                testingParam.sortOrder);
+            timeStepper.Register(particles);
+
+            // act
+            timeStepper.Initialize();
+
+            // assert
+            AssertCellParticleRanges(*particles, mesh->GetDM(), testingParam.sortOrder);
+
+            // act
+            // move the particles so they are migrated and sorted again
+            timeStepper.Solve();
+
+            // assert
+            AssertCellParticleRanges(*particles, mesh->GetDM(), testingParam.sortOrder);
+        }
+        ablate::environment::RunEnvironment::Finalize();
+    EndWithMPI
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ParticleSolverSortTests, ParticleSolverSortTestFixture,
+    testing::Values((ParticleSolverSortParameters){.mpiTestParameter = testingResources::MpiTestParameter("cell sort order"), .sortOrder = ablate::particles::ParticleSolver::SortOrder::CELL},
+                    (ParticleSolverSortParameters){.mpiTestParameter = testingResources::MpiTestParameter("curve sort order"), .sortOrder = ablate::particles::ParticleSolver::SortOrder::CURVE},
+                    (ParticleSolverSortParameters){.mpiTestParameter = testingResources::MpiTestParameter("cell sort order in parallel", 2),
+                                                   .sortOrder = ablate::particles::ParticleSolver::SortOrder::CELL},
+                    (ParticleSolverSortParameters){.mpiTestParameter = testingResources::MpiTestParameter("curve sort order in parallel", 2),
+                                                   .sortOrder = ablate::particles::ParticleSolver::SortOrder::CURVE}),
+    [](const testing::TestParamInfo<ParticleSolverSortParameters>& info) { return info.param.mpiTestParameter.getTestName(); });
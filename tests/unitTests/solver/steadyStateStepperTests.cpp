@@ -0,0 +1,197 @@
+#include <petsc.h>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "domain/boxMesh.hpp"
+#include "domain/modifiers/distributeWithGhostCells.hpp"
+#include "domain/modifiers/edgeClusteringMapper.hpp"
+#include "domain/modifiers/ghostBoundaryCells.hpp"
+#include "environment/runEnvironment.hpp"
+#include "eos/perfectGas.hpp"
+#include "eos/transport/constant.hpp"
+#include "finiteVolume/boundaryConditions/essentialGhost.hpp"
+#include "finiteVolume/compressibleFlowFields.hpp"
+#include "finiteVolume/compressibleFlowSolver.hpp"
+#include "gtest/gtest.h"
+#include "mathFunctions/functionFactory.hpp"
+#include "mpiTestFixture.hpp"
+#include "parameters/mapParameters.hpp"
+#include "petscTestErrorChecker.hpp"
+#include "solver/criteria/variableChange.hpp"
+#include "solver/iFunction.hpp"
+#include "solver/steadyStateStepper.hpp"
+#include "utilities/mpiUtilities.hpp"
+#include "utilities/petscUtilities.hpp"
+
+using namespace ablate;
+
+class SteadyStateStepperTestFixture : public testingResources::MpiTestFixture, public ::testing::WithParamInterface<testingResources::MpiTestParameter> {
+   public:
+    void SetUp() override { SetMpiParameters(GetParam()); }
+};
+
+/**
+ * Simple implicit solver used to check that local time stepping is not silently ignored by solvers that provide an IFunction
+ */
+class ImplicitTestSolver : public solver::Solver, public solver::IFunction {
+   public:
+    ImplicitTestSolver() : solver::Solver("implicitSolver", domain::Region::ENTIREDOMAIN) {}
+    void Setup() override {}
+    void Initialize() override {}
+    PetscErrorCode ComputeIFunction(PetscReal, Vec, Vec, Vec) override { return PETSC_SUCCESS; }
+    PetscErrorCode ComputeIJacobian(PetscReal, Vec, Vec, PetscReal, Mat, Mat) override { return PETSC_SUCCESS; }
+};
+
+//! the 1D heat conduction problem used by each test
+struct ConductionProblem {
+    std::shared_ptr<domain::BoxMesh> mesh;
+    std::shared_ptr<domain::Initializer> initialization;
+    std::shared_ptr<finiteVolume::CompressibleFlowSolver> flowObject;
+};
+
+/**
+ * Creates a 1D conduction only problem on a mesh stretched towards the left wall.  A perfect gas (cv = 2.5) at rest with a density of 1 starts at 400 K and
+ * relaxes to the 300 K wall temperature, so the steady state rhoE is 750.
+ * @param conductionStabilityFactor the conduction time step is only computed when greater than zero
+ */
+static ConductionProblem CreateConductionProblem(PetscReal conductionStabilityFactor) {
+    auto eos = std::make_shared<eos::PerfectGas>(std::make_shared<parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.4"}, {"Rgas", "1.0"}}));
+    auto transport = std::make_shared<eos::transport::Constant>(0.3);
+
+    // cluster the cells towards the left wall, the largest cell is about five times the smallest
+    std::vector<std::shared_ptr<domain::FieldDescriptor>> fieldDescriptors = {std::make_shared<finiteVolume::CompressibleFlowFields>(eos)};
+    ConductionProblem problem;
+    problem.mesh = std::make_shared<domain::BoxMesh>("mesh",
+                                                     fieldDescriptors,
+                                                     std::vector<std::shared_ptr<domain::modifiers::Modifier>>{std::make_shared<domain::modifiers::EdgeClusteringMapper>(0, 0.0, 1.0, 1.1),
+                                                                                                               std::make_shared<domain::modifiers::DistributeWithGhostCells>(),
+                                                                                                               std::make_shared<domain::modifiers::GhostBoundaryCells>()},
+                                                     std::vector<int>{10},
+                                                     std::vector<double>{0.0},
+                                                     std::vector<double>{1.0},
+                                                     std::vector<std::string>{"NONE"} /*boundary*/,
+                                                     false /*simplex*/);
+
+    problem.initialization = std::make_shared<domain::Initializer>(std::make_shared<mathFunctions::FieldFunction>("euler", mathFunctions::Create("1.0, 1000.0, 0.0")));
+    auto boundaryConditions = std::vector<std::shared_ptr<finiteVolume::boundaryConditions::BoundaryCondition>>{std::make_shared<finiteVolume::boundaryConditions::EssentialGhost>(
+        "walls", std::vector<int>{1, 2}, std::make_shared<mathFunctions::FieldFunction>("euler", mathFunctions::Create("1.0, 750.0, 0.0")), "", true)};
+
+    auto flowParameters = std::make_shared<parameters::MapParameters>(std::map<std::string, std::string>{{"conductionStabilityFactor", std::to_string(conductionStabilityFactor)}});
+    problem.flowObject = std::make_shared<finiteVolume::CompressibleFlowSolver>("testFlow",
+                                                                                domain::Region::ENTIREDOMAIN,
+                                                                                nullptr /*options*/,
+                                                                                eos,
+                                                                                flowParameters,
+                                                                                transport,
+                                                                                nullptr /*fluxCalculator*/,
+                                                                                boundaryConditions);
+    return problem;
+}
+
+/**
+ * March the conduction problem to steady state
+ * @param steps the number of steps needed to converge
+ * @param maxError the max difference from the steady state rhoE over every cell
+ */
+static void MarchToSteadyState(bool localTimeStepping, PetscInt& steps, PetscReal& maxError) {
+    auto problem = CreateConductionProblem(0.25);
+    auto criteria = std::vector<std::shared_ptr<solver::criteria::ConvergenceCriteria>>{
+        std::make_shared<solver::criteria::VariableChange>("euler", 1E-2, utilities::MathUtilities::Norm::L2, domain::Region::ENTIREDOMAIN)};
+    auto arguments = parameters::MapParameters::Create({{"ts_type", "euler"}, {"ts_adapt_type", "physics"}, {"ts_max_steps", "100000"}});
+    auto timeStepper = solver::SteadyStateStepper(problem.mesh, criteria, arguments, nullptr, problem.initialization, {}, {}, false, nullptr, 10, localTimeStepping);
+    timeStepper.Register(problem.flowObject);
+    timeStepper.Solve();
+
+    TSGetStepNumber(timeStepper.GetTS(), &steps) >> testErrorChecker;
+
+    // compare the rhoE in each cell to the steady state
+    DM dm = problem.mesh->GetDM();
+    const auto eulerId = problem.flowObject->GetSubDomain().GetField(finiteVolume::CompressibleFlowFields::EULER_FIELD).id;
+    const PetscScalar* x;
+    VecGetArrayRead(problem.mesh->GetSolutionVector(), &x) >> testErrorChecker;
+    ablate::domain::Range cellRange;
+    problem.flowObject->GetCellRangeWithoutGhost(cellRange);
+    PetscReal localMaxError = 0.0;
+    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+        const PetscScalar* euler = nullptr;
+        DMPlexPointGlobalFieldRead(dm, cellRange.GetPoint(c), eulerId, x, &euler) >> testErrorChecker;
+        if (euler) {
+            localMaxError = PetscMax(localMaxError, PetscAbsReal(euler[finiteVolume::CompressibleFlowFields::RHOE] - 750.0));
+        }
+    }
+    problem.flowObject->RestoreRange(cellRange);
+    VecRestoreArrayRead(problem.mesh->GetSolutionVector(), &x) >> testErrorChecker;
+    MPI_Allreduce(&localMaxError, &maxError, 1, MPIU_REAL, MPI_MAX, PETSC_COMM_WORLD) >> ablate::utilities::MpiUtilities::checkError;
+}
+
+TEST_P(SteadyStateStepperTestFixture, ShouldConvergeInFewerStepsWithLocalTimeStepping) {
+    StartWithMPI
+        {
+            // initialize petsc and mpi
+            ablate::environment::RunEnvironment::Initialize(argc, argv);
+            ablate::utilities::PetscUtilities::Initialize();
+
+            // act
+            PetscInt globalSteps, localSteps;
+            PetscReal globalError, localError;
+            MarchToSteadyState(false, globalSteps, globalError);
+            MarchToSteadyState(true, localSteps, localError);
+
+            // assert
+            // both march to the same steady state, but the large cells are no longer limited by the time step of the smallest cell
+            ASSERT_LT(globalError, 1.0);
+            ASSERT_LT(localError, 1.0);
+            ASSERT_LT(2 * localSteps, globalSteps) << "local time stepping should reduce the number of steps to steady state";
+        }
+        ablate::environment::RunEnvironment::Finalize();
+    EndWithMPI
+}
+
+TEST_P(SteadyStateStepperTestFixture, ShouldThrowWithoutPerCellTimeSteps) {
+    StartWithMPI
+        {
+            // initialize petsc and mpi
+            ablate::environment::RunEnvironment::Initialize(argc, argv);
+            ablate::utilities::PetscUtilities::Initialize();
+
+            // arrange
+            // without a conduction stability factor no solver computes a time step in each cell
+            auto problem = CreateConductionProblem(0.0);
+            auto timeStepper = solver::SteadyStateStepper(problem.mesh, {}, nullptr, nullptr, problem.initialization, {}, {}, false, nullptr, 10, true);
+            timeStepper.Register(problem.flowObject);
+
+            // act
+            // assert
+            ASSERT_THROW(timeStepper.Initialize(), std::invalid_argument);
+        }
+        ablate::environment::RunEnvironment::Finalize();
+    EndWithMPI
+}
+
+TEST_P(SteadyStateStepperTestFixture, ShouldThrowWithIFunctionSolvers) {
+    StartWithMPI
+        {
+            // initialize petsc and mpi
+            ablate::environment::RunEnvironment::Initialize(argc, argv);
+            ablate::utilities::PetscUtilities::Initialize();
+
+            // arrange
+            // the flow solver provides the cell time steps but the implicit solver would not be scaled by them
+            auto problem = CreateConductionProblem(0.25);
+            auto timeStepper = solver::SteadyStateStepper(problem.mesh, {}, nullptr, nullptr, problem.initialization, {}, {}, false, nullptr, 10, true);
+            timeStepper.Register(problem.flowObject);
+            timeStepper.Register(std::make_shared<ImplicitTestSolver>());
+
+            // act
+            // assert
+            ASSERT_THROW(timeStepper.Initialize(), std::invalid_argument);
+        }
+        ablate::environment::RunEnvironment::Finalize();
+    EndWithMPI
+}
+
+INSTANTIATE_TEST_SUITE_P(SteadyStateStepperTests, SteadyStateStepperTestFixture,
+                         testing::Values(testingResources::MpiTestParameter("local time stepping", 1, "-dm_plex_separate_marker"),
+                                         testingResources::MpiTestParameter("local time stepping in parallel", 2, "-dm_plex_separate_marker")),
+                         [](const testing::TestParamInfo<testingResources::MpiTestParameter>& info) { return info.param.getTestName(); });
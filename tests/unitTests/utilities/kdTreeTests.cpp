@@ -0,0 +1,138 @@
+#include <algorithm>
+#include <random>
+#include "gtest/gtest.h"
+#include "utilities/kdTree.hpp"
+
+namespace ablateTesting::utilities {
+
+struct KdTreeTestParameters {
+    std::size_t dimension;
+    std::size_t numberPoints;
+    //! the dimension of the query, may be less than the tree dimension
+    std::size_t queryDimension;
+};
+
+class KdTreeTestFixture : public ::testing::TestWithParam<KdTreeTestParameters> {
+   protected:
+    std::vector<double> coordinates;
+    std::vector<std::vector<double>> queries;
+
+    void SetUp() override {
+        // use a fixed seed and a coarse lattice so there are duplicate points and ties
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<int> lattice(0, 20);
+        std::uniform_real_distribution<double> queryDistribution(-0.2, 1.2);
+
+        coordinates.resize(GetParam().numberPoints * GetParam().dimension);
+        for (auto& coordinate : coordinates) {
+            coordinate = lattice(generator) / 20.0;
+        }
+        queries.resize(100);
+        for (auto& query : queries) {
+            query.resize(GetParam().queryDimension);
+            for (auto& value : query) {
+                value = queryDistribution(generator);
+            }
+        }
+    }
+
+    [[nodiscard]] std::vector<double> BruteForceDistances(const std::vector<double>& query) const {
+        const auto& params = GetParam();
+        std::vector<double> distances(params.numberPoints, 0.0);
+        for (std::size_t p = 0; p < params.numberPoints; ++p) {
+            for (std::size_t d = 0; d < std::min(params.dimension, params.queryDimension); ++d) {
+                distances[p] += (query[d] - coordinates[p * params.dimension + d]) * (query[d] - coordinates[p * params.dimension + d]);
+            }
+        }
+        return distances;
+    }
+};
+
+TEST_P(KdTreeTestFixture, ShouldFindNearestPointMatchingBruteForce) {
+    // arrange
+    const auto& params = GetParam();
+    ablate::utilities::KdTree tree(coordinates, params.dimension);
+
+    for (const auto& query : queries) {
+        auto distances = BruteForceDistances(query);
+        auto expected = (std::size_t)std::distance(distances.begin(), std::min_element(distances.begin(), distances.end()));
+
+        // act
+        auto nearest = tree.Nearest(query.data(), params.queryDimension);
+
+        // assert
+        ASSERT_EQ(nearest, expected);
+    }
+}
+
+TEST_P(KdTreeTestFixture, ShouldFindKNearestPointsMatchingBruteForce) {
+    // arrange
+    const auto& params = GetParam();
+    ablate::utilities::KdTree tree(coordinates, params.dimension);
+    const std::size_t k = 7;
+
+    for (const auto& query : queries) {
+        auto distances = BruteForceDistances(query);
+        std::vector<std::pair<double, std::size_t>> expected;
+        for (std::size_t p = 0; p < params.numberPoints; ++p) {
+            expected.emplace_back(distances[p], p);
+        }
+        std::sort(expected.begin(), expected.end());
+        expected.resize(std::min(k, params.numberPoints));
+
+        // act
+        std::vector<std::size_t> indices;
+        std::vector<double> distancesSquared;
+        tree.KNearest(query.data(), params.queryDimension, k, indices, distancesSquared);
+
+        // assert
+        ASSERT_EQ(indices.size(), expected.size());
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            ASSERT_EQ(indices[i], expected[i].second);
+            ASSERT_DOUBLE_EQ(distancesSquared[i], expected[i].first);
+        }
+    }
+}
+
+TEST_P(KdTreeTestFixture, ShouldFindPointsWithinRadiusMatchingBruteForce) {
+    // arrange
+    const auto& params = GetParam();
+    ablate::utilities::KdTree tree(coordinates, params.dimension);
+    const double radius = 0.15;
+
+    for (const auto& query : queries) {
+        auto distances = BruteForceDistances(query);
+        std::vector<std::size_t> expected;
+        for (std::size_t p = 0; p < params.numberPoints; ++p) {
+            if (distances[p] <= radius * radius) {
+                expected.push_back(p);
+            }
+        }
+
+        // act
+        std::vector<std::size_t> indices;
+        tree.Radius(query.data(), params.queryDimension, radius, indices);
+
+        // assert
+        std::sort(indices.begin(), indices.end());
+        ASSERT_EQ(indices, expected);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(KdTreeTests, KdTreeTestFixture,
+                         testing::Values((KdTreeTestParameters){.dimension = 1, .numberPoints = 50, .queryDimension = 1},
+                                         (KdTreeTestParameters){.dimension = 2, .numberPoints = 500, .queryDimension = 2},
+                                         (KdTreeTestParameters){.dimension = 3, .numberPoints = 2000, .queryDimension = 3},
+                                         (KdTreeTestParameters){.dimension = 3, .numberPoints = 500, .queryDimension = 2},
+                                         (KdTreeTestParameters){.dimension = 2, .numberPoints = 500, .queryDimension = 3},
+                                         (KdTreeTestParameters){.dimension = 3, .numberPoints = 1, .queryDimension = 3}),
+                         [](const testing::TestParamInfo<KdTreeTestParameters>& info) {
+                             return "dim" + std::to_string(info.param.dimension) + "_n" + std::to_string(info.param.numberPoints) + "_query" + std::to_string(info.param.queryDimension);
+                         });
+
+TEST(KdTreeTests, ShouldThrowForInvalidDimension) {
+    ASSERT_ANY_THROW(ablate::utilities::KdTree({0.0, 1.0, 2.0, 3.0}, 4));
+    ASSERT_ANY_THROW(ablate::utilities::KdTree({0.0, 1.0, 2.0}, 2));
+}
+
+}  // namespace ablateTesting::utilities
@@ -0,0 +1,65 @@
+#include <stdexcept>
+#include "gtest/gtest.h"
+#include "petscTestFixture.hpp"
+#include "utilities/loggable.hpp"
+
+namespace ablateTesting::utilities {
+
+/**
+ * Simple class to expose the protected Loggable functions
+ */
+class LoggableTestObject : public ablate::utilities::Loggable<LoggableTestObject> {
+   public:
+    using Loggable::EndEvent;
+    using Loggable::RegisterEvent;
+    using Loggable::ScopedEvent;
+    using Loggable::StartEvent;
+};
+
+class LoggableTestFixture : public testingResources::PetscTestFixture {};
+
+TEST_F(LoggableTestFixture, ShouldReturnSameEventForSameName) {
+    // arrange
+    LoggableTestObject loggable;
+
+    // act
+    auto firstEvent = loggable.RegisterEvent("LoggableTests::SameName");
+    auto secondEvent = loggable.RegisterEvent("LoggableTests::SameName");
+    auto otherEvent = loggable.RegisterEvent("LoggableTests::OtherName");
+
+    // assert
+    ASSERT_EQ(firstEvent, secondEvent);
+    ASSERT_NE(firstEvent, otherEvent);
+}
+
+TEST_F(LoggableTestFixture, ShouldAllowNestedEvents) {
+    // arrange
+    LoggableTestObject loggable;
+    auto outerEvent = loggable.RegisterEvent("LoggableTests::Outer");
+
+    // act
+    // assert
+    ASSERT_NO_THROW(loggable.StartEvent(outerEvent));
+    ASSERT_NO_THROW(loggable.StartEvent("LoggableTests::Inner"));
+    ASSERT_NO_THROW(loggable.EndEvent());
+    ASSERT_NO_THROW(loggable.EndEvent());
+    ASSERT_THROW(loggable.EndEvent(), std::runtime_error);
+}
+
+TEST_F(LoggableTestFixture, ShouldEndScopedEventWhenExceptionIsThrown) {
+    // arrange
+    LoggableTestObject loggable;
+    auto event = loggable.RegisterEvent("LoggableTests::Scoped");
+
+    // act
+    try {
+        LoggableTestObject::ScopedEvent scope(loggable, event);
+        throw std::invalid_argument("test exception");
+    } catch (std::invalid_argument&) {
+    }
+
+    // assert
+    ASSERT_THROW(loggable.EndEvent(), std::runtime_error);
+}
+
+}  // namespace ablateTesting::utilities